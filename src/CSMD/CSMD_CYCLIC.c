@@ -530,6 +530,7 @@ CSMD_FUNC_RET CSMD_SetConnectionData( CSMD_INSTANCE *prCSMD_Instance,
       CSMD_USHORT *pusDest = prMasterProd->apusConnTxRam[prCSMD_Instance->rPriv.usTxBuffer];
       /* usLength: connection data length (without C-CON) in words */
       CSMD_USHORT  usLength = (CSMD_USHORT)(prCSMD_Instance->rConfiguration.parConnection[usConnIdx].usS_0_1050_SE5 / 2 - 1);
+      CSMD_USHORT  usC_Con;
 
       if (   (prMasterProd->eState == CSMD_PROD_STATE_READY)
           || (prMasterProd->eState == CSMD_PROD_STATE_WAITING) )
@@ -538,10 +539,15 @@ CSMD_FUNC_RET CSMD_SetConnectionData( CSMD_INSTANCE *prCSMD_Instance,
       }
 
       /* merge C-CON with connection data and include real-time bits */
-      *pusDest++ = (CSMD_USHORT)(prMasterProd->usC_Con | (usRTBits & CSMD_C_CON_RTB_MASK));
+      usC_Con = (CSMD_USHORT)(prMasterProd->usC_Con | (usRTBits & CSMD_C_CON_RTB_MASK));
+      CSMD_Write_Tx_Ram ( &prCSMD_Instance->rCSMD_HAL,
+                          pusDest++,    /* destination pointer */
+                          &usC_Con,     /* source pointer */
+                          1U );         /* length in words */
 
       /* copy connection data (after C-CON) to TxRam */
-      CSMD_Write_Tx_Ram ( pusDest,      /* destination pointer */
+      CSMD_Write_Tx_Ram ( &prCSMD_Instance->rCSMD_HAL,
+                          pusDest,      /* destination pointer */
                           pusConnData,  /* source pointer */
                           usLength );   /* length in words */
 
@@ -554,6 +560,143 @@ CSMD_FUNC_RET CSMD_SetConnectionData( CSMD_INSTANCE *prCSMD_Instance,
 }  /* end: CSMD_SetConnectionData() */
 
 
+/**************************************************************************/ /**
+\brief Returns the address of a master-produced connection in Tx ram.
+
+\ingroup func_cyclic
+\b Description: \n
+   This function returns a pointer to the connection control word of the
+   connection with the selected index in the Tx ram buffer of the current
+   cycle. The connection data follows the connection control word. It allows
+   the application to write the connection data in place instead of copying
+   it with CSMD_SetConnectionData(). The connection control word itself is
+   written by CSMD_SetConnectionC_Con().
+
+<B>Call Environment:</B> \n
+   This function can be called from an interrupt in CP4 after
+   CSMD_CyclicHandling() has been processed. The pointer is only valid in the
+   current Sercos cycle, as the Tx ram buffer changes with multiple buffering.
+
+\param [in]   prCSMD_Instance
+              Pointer to memory range allocated for the variables of the
+              CoSeMa instance
+
+\param [in]   usConnIdx
+              connection index selection
+
+\param [out]  ppusConnData
+              pointer to connection control word in Tx ram
+
+\return       \ref CSMD_WRONG_PHASE \n
+              \ref CSMD_CONNECTION_NOT_CONFIGURED \n
+              \ref CSMD_CONNECTION_NOT_MASTERPRODUCED \n
+              \ref CSMD_NO_ERROR \n
+
+***************************************************************************** */
+CSMD_FUNC_RET CSMD_GetConnectionTxRamPtr( CSMD_INSTANCE *prCSMD_Instance,
+                                          CSMD_USHORT    usConnIdx,
+                                          CSMD_USHORT  **ppusConnData )
+{
+  CSMD_CONN_MASTERPROD  *prMasterProd = &prCSMD_Instance->rPriv.parConnMasterProd[usConnIdx];
+  CSMD_CONN_SLAVEPROD   *prSlaveProd  = &prCSMD_Instance->rPriv.parConnSlaveProd[usConnIdx];
+
+  if (prCSMD_Instance->sCSMD_Phase != CSMD_SERC_PHASE_4)
+  {
+    return (CSMD_WRONG_PHASE);
+  }
+  /* connection is produced by a slave */
+  if (prSlaveProd->usProduced)
+  {
+    return (CSMD_CONNECTION_NOT_MASTERPRODUCED);
+  }
+  /* connection is not configured */
+  if (prMasterProd->usProduced == 0)
+  {
+    return (CSMD_CONNECTION_NOT_CONFIGURED);
+  }
+
+  *ppusConnData = prMasterProd->apusConnTxRam[prCSMD_Instance->rPriv.usTxBuffer];
+
+  return (CSMD_NO_ERROR);
+
+}  /* end: CSMD_GetConnectionTxRamPtr() */
+
+
+/**************************************************************************/ /**
+\brief Writes the connection control of a master-produced connection whose
+       data has been written directly into Tx ram.
+
+\ingroup func_cyclic
+\b Description: \n
+   This function corresponds to CSMD_SetConnectionData() for connection data
+   written in place via CSMD_GetConnectionTxRamPtr(). Only the connection
+   control word is written, merged with the consigned values of configured
+   real-time bits. In soft master mode, the connection data is signaled as
+   changed to the soft master.
+
+<B>Call Environment:</B> \n
+   This function can be called from an interrupt in CP4 after
+   CSMD_CyclicHandling() has been processed and the connection data has been
+   written.
+
+\param [in]   prCSMD_Instance
+              Pointer to memory range allocated for the variables of the
+              CoSeMa instance
+
+\param [in]   usConnIdx
+              connection index selection
+
+\param [in]   usRTBits
+              values of configured real-time-bits for the selected connection
+              - Bit 6: Real-time bit 1
+              - Bit 7: Real-time bit 2
+              - All other bits are ignored
+
+\return       \ref CSMD_WRONG_PHASE \n
+              \ref CSMD_CONNECTION_NOT_CONFIGURED \n
+              \ref CSMD_CONNECTION_NOT_MASTERPRODUCED \n
+              \ref CSMD_NO_ERROR \n
+
+***************************************************************************** */
+CSMD_FUNC_RET CSMD_SetConnectionC_Con( CSMD_INSTANCE *prCSMD_Instance,
+                                       CSMD_USHORT    usConnIdx,
+                                       CSMD_USHORT    usRTBits )
+{
+  CSMD_FUNC_RET          eFuncRet;
+  CSMD_CONN_MASTERPROD  *prMasterProd = &prCSMD_Instance->rPriv.parConnMasterProd[usConnIdx];
+  CSMD_USHORT           *pusDest;
+  CSMD_USHORT            usC_Con;
+
+  eFuncRet = CSMD_GetConnectionTxRamPtr( prCSMD_Instance, usConnIdx, &pusDest );
+
+  if (eFuncRet == CSMD_NO_ERROR)
+  {
+    if (   (prMasterProd->eState == CSMD_PROD_STATE_READY)
+        || (prMasterProd->eState == CSMD_PROD_STATE_WAITING) )
+    {
+      prMasterProd->eState = CSMD_PROD_STATE_PRODUCING;
+    }
+
+    /* merge C-CON with real-time bits */
+    usC_Con = (CSMD_USHORT)(prMasterProd->usC_Con | (usRTBits & CSMD_C_CON_RTB_MASK));
+    CSMD_Write_Tx_Ram ( &prCSMD_Instance->rCSMD_HAL,
+                        pusDest,      /* destination pointer */
+                        &usC_Con,     /* source pointer */
+                        1U );         /* length in words */
+
+#ifdef CSMD_SOFT_MASTER
+    /* connection data (after C-CON) has been written without change tracking */
+    CSMD_HAL_MarkTxRamDirty( &prCSMD_Instance->rCSMD_HAL,
+                             pusDest + 1,
+                             (CSMD_USHORT)(prCSMD_Instance->rConfiguration.parConnection[usConnIdx].usS_0_1050_SE5 - 2U) );
+#endif
+  }
+
+  return (eFuncRet);
+
+}  /* end: CSMD_SetConnectionC_Con() */
+
+
 /**************************************************************************/ /**
 \brief Copies cyclic data of master-consumed connections
        to a given destination.
@@ -658,6 +801,90 @@ CSMD_FUNC_RET CSMD_GetConnectionData( CSMD_INSTANCE *prCSMD_Instance,
 }  /* end: CSMD_GetConnectionData() */
 
 
+/**************************************************************************/ /**
+\brief Returns the address of a master-consumed connection in Rx ram.
+
+\ingroup func_cyclic
+\b Description: \n
+   This function returns a pointer to the connection control word of the
+   connection with the selected index in the Rx ram buffer of the current
+   cycle, on the preferred master port of the producer. The connection data
+   follows the connection control word. It allows the application to read the
+   connection data in place instead of copying it with CSMD_GetConnectionData().
+
+<B>Call Environment:</B> \n
+   This function can be called from an interrupt in CP4 after
+   CSMD_CyclicHandling() has been processed and the connection state of the
+   respective connection has been read. The pointer is only valid in the
+   current Sercos cycle, as the Rx ram buffer and the preferred port may
+   change.
+
+\param [in]   prCSMD_Instance
+              Pointer to memory range allocated for the variables of the
+              CoSeMa instance
+
+\param [in]   usConnIdx
+              connection index selection
+
+\param [out]  ppusConnData
+              pointer to connection control word in Rx ram. It is also set
+              if CSMD_CONNECTION_DATA_INVALID is returned and then points to
+              the data of the last reception.
+
+\return       \ref CSMD_CONNECTION_NOT_CONFIGURED \n
+              \ref CSMD_CONNECTION_NOT_SLAVEPRODUCED \n
+              \ref CSMD_CONNECTION_DATA_INVALID \n
+              \ref CSMD_WRONG_PHASE \n
+              \ref CSMD_NO_ERROR \n
+
+***************************************************************************** */
+CSMD_FUNC_RET CSMD_GetConnectionRxRamPtr( CSMD_INSTANCE *prCSMD_Instance,
+                                          CSMD_USHORT    usConnIdx,
+                                          CSMD_USHORT  **ppusConnData )
+{
+  CSMD_CONN_MASTERPROD  *prMasterProd = &prCSMD_Instance->rPriv.parConnMasterProd[usConnIdx];
+  CSMD_CONN_SLAVEPROD   *prSlaveProd  = &prCSMD_Instance->rPriv.parConnSlaveProd[usConnIdx];
+  CSMD_USHORT            usPort;
+
+  if (prCSMD_Instance->sCSMD_Phase != CSMD_SERC_PHASE_4)
+  {
+    return (CSMD_WRONG_PHASE);
+  }
+  /* connection is produced by the master */
+  if (prMasterProd->usProduced)
+  {
+    return (CSMD_CONNECTION_NOT_SLAVEPRODUCED);
+  }
+  /* connection is not configured */
+  if (prSlaveProd->usProduced == 0)
+  {
+    return (CSMD_CONNECTION_NOT_CONFIGURED);
+  }
+
+  /* preferred master port for connection (may change in CSMD_EvaluateConnections() ) */
+  if (prCSMD_Instance->rPriv.ausPrefPortBySlave[prSlaveProd->usProdIdx] == CSMD_PORT_1)
+  {
+    usPort = CSMD_PORT_1;
+  }
+  else
+  {
+    usPort = CSMD_PORT_2;
+  }
+
+  *ppusConnData =
+    prSlaveProd->apusConnRxRam[usPort][prCSMD_Instance->rPriv.rRedundancy.ausRxBuffer[usPort]];
+
+  /* check for slave valid of the connection's producer in current cycle */
+  if (prCSMD_Instance->arDevStatus[prSlaveProd->usProdIdx].usMiss != 0)
+  {
+    return (CSMD_CONNECTION_DATA_INVALID);
+  }
+
+  return (CSMD_NO_ERROR);
+
+}  /* end: CSMD_GetConnectionRxRamPtr() */
+
+
 /**************************************************************************/ /**
 \brief Returns the age of the consumed connection data in producer cycles.
 
@@ -63,7 +63,8 @@ extern "C"
 
 /* Memory copy function to copy from local Ram to FPGA TxRam. */
 SOURCE CSMD_VOID CSMD_Write_Tx_Ram
-                                ( CSMD_USHORT               *pusTelDestTxRam,
+                                ( CSMD_HAL                  *prCSMD_HAL,
+                                  CSMD_USHORT               *pusTelDestTxRam,
                                   CSMD_USHORT               *pusTelSource,
                                   CSMD_USHORT                usNbrWords );
 
@@ -1242,12 +1242,15 @@ CSMD_VOID CSMD_Read_Rx_Ram( CSMD_USHORT *pusTelDest,
 \ingroup module_cyclic
 \b Description: \n
    This function copies a certain number of words from a given source address
-   in local Ram to a given destination address in FPGA TxRam.
+   in local Ram to a given destination address in FPGA TxRam. In soft master
+   mode, changed words are signaled to the soft master.
 
 
 <B>Call Environment:</B> \n
    This is a CoSeMa-private function.
 
+\param [in]   prCSMD_HAL
+              Pointer to the CoSeMa HAL structure
 \param [in]   pusTelDestTxRam
               Pointer to destination in linear Tx Ram
 \param [in]   pusTelSource
@@ -1261,12 +1264,13 @@ CSMD_VOID CSMD_Read_Rx_Ram( CSMD_USHORT *pusTelDest,
 \date         14.03.2005
 
 ***************************************************************************** */
-CSMD_VOID CSMD_Write_Tx_Ram( CSMD_USHORT *pusTelDestTxRam,
+CSMD_VOID CSMD_Write_Tx_Ram( CSMD_HAL    *prCSMD_HAL,
+                             CSMD_USHORT *pusTelDestTxRam,
                              CSMD_USHORT *pusTelSource,
                              CSMD_USHORT  usNbrWords )
 {
 
-  CSMD_HAL_WriteBlock( pusTelDestTxRam, pusTelSource, usNbrWords );
+  CSMD_HAL_WriteTxRam( prCSMD_HAL, pusTelDestTxRam, pusTelSource, usNbrWords );
 
 } /* end: CSMD_Write_Tx_Ram() */
 
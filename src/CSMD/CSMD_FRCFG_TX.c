@@ -1388,6 +1388,11 @@ CSMD_FUNC_RET CSMD_Config_TX_Tel_P3( CSMD_INSTANCE *prCSMD_Instance )
     prCSMD_Instance->rPriv.pusTxRam = (CSMD_USHORT *)(CSMD_VOID *) prCSMD_Instance->rCSMD_HAL.prSERC_TX_Ram->aulTx_Ram;
   }
   
+#ifdef CSMD_SOFT_MASTER
+  /* Connection data is tracked again below */
+  CSMD_HAL_ResetTxRamTracking( &prCSMD_Instance->rCSMD_HAL );
+#endif
+
   /* ------------------------------------------------------------- */
   /* Calculate TxRam offset for MDT connections                    */
   /* ------------------------------------------------------------- */
@@ -1428,6 +1433,12 @@ CSMD_FUNC_RET CSMD_Config_TX_Tel_P3( CSMD_INSTANCE *prCSMD_Instance )
       {
         prCSMD_Instance->rPriv.parConnMasterProd[usConnIdx].apusConnTxRam[usBuf] =
           (CSMD_USHORT *)(CSMD_VOID *)(pucTel + usBuf * usBuff0_Offset);
+#ifdef CSMD_SOFT_MASTER
+        /* Connection data is only written by CSMD_SetConnectionData() */
+        CSMD_HAL_TrackTxRam( &prCSMD_Instance->rCSMD_HAL,
+                             pucTel + usBuf * usBuff0_Offset,
+                             prCSMD_Instance->rConfiguration.parConnection[usConnIdx].usS_0_1050_SE5 );
+#endif
       }
     }
     // pucTel += prCSMD_Instance->rConfiguration.parConnection[usConnIdx].usS_0_1050_SE5;
@@ -1468,6 +1479,11 @@ CSMD_FUNC_RET CSMD_Config_TX_Tel_P3( CSMD_INSTANCE *prCSMD_Instance )
         {
           prCSMD_Instance->rPriv.parConnMasterProd[usConnIdx].apusConnTxRam[usBuf] =
             (CSMD_USHORT *)(CSMD_VOID *)(pucTel + usBuf * usBuff0_Offset);
+#ifdef CSMD_SOFT_MASTER
+          CSMD_HAL_TrackTxRam( &prCSMD_Instance->rCSMD_HAL,
+                               pucTel + usBuf * usBuff0_Offset,
+                               prCSMD_Instance->rConfiguration.parConnection[usConnIdx].usS_0_1050_SE5 );
+#endif
         }
         pucTel += prCSMD_Instance->rConfiguration.parConnection[usConnIdx].usS_0_1050_SE5;
 
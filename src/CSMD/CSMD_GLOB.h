@@ -3115,6 +3115,21 @@ SOURCE CSMD_FUNC_RET CSMD_GetConnectionData
                                   CSMD_USHORT                usConnIdx,
                                   CSMD_USHORT               *pusDestination );
 
+SOURCE CSMD_FUNC_RET CSMD_GetConnectionTxRamPtr
+                                ( CSMD_INSTANCE             *prCSMD_Instance,
+                                  CSMD_USHORT                usConnIdx,
+                                  CSMD_USHORT              **ppusConnData );
+
+SOURCE CSMD_FUNC_RET CSMD_SetConnectionC_Con
+                                ( CSMD_INSTANCE             *prCSMD_Instance,
+                                  CSMD_USHORT                usConnIdx,
+                                  CSMD_USHORT                usRTBits );
+
+SOURCE CSMD_FUNC_RET CSMD_GetConnectionRxRamPtr
+                                ( CSMD_INSTANCE             *prCSMD_Instance,
+                                  CSMD_USHORT                usConnIdx,
+                                  CSMD_USHORT              **ppusConnData );
+
 SOURCE CSMD_FUNC_RET CSMD_GetConnectionDataDelay
                                 ( CSMD_INSTANCE             *prCSMD_Instance,
                                   CSMD_USHORT                usConnIdx,
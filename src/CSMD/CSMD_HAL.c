@@ -2473,6 +2473,232 @@ CSMD_VOID CSMD_HAL_WriteBlock( CSMD_VOID   *pvWriteDes,
 
 
 
+/**************************************************************************/ /**
+\brief Writes a data block to TxRam and signals the changed parts to the
+       soft master.
+
+\ingroup module_cyclic
+\b Description: \n
+   This function copies a given amount of words from a source address to a
+   destination address in TxRam. If the soft master evaluates the change
+   tracking, only the words that differ are written, and the TxRam blocks
+   containing them are marked in the change tracking of the soft master.
+   This way, the soft master only needs to copy changed data into its
+   telegrams.
+
+<B>Call Environment:</B> \n
+   This is a CoSeMa-private function.
+
+\param [in]   prCSMD_HAL
+              Pointer to the CoSeMa HAL structure
+\param [in]   pvWriteDes
+              Destination address in TxRam
+\param [in]   pvDataSource
+              Source address to read data from
+\param [in]   usLength
+              Data length [words]
+
+\return       none
+
+***************************************************************************** */
+CSMD_VOID CSMD_HAL_WriteTxRam( CSMD_HAL    *prCSMD_HAL,
+                               CSMD_VOID   *pvWriteDes,
+                               CSMD_VOID   *pvDataSource,
+                               CSMD_USHORT  usLength )
+{
+#ifdef CSMD_SOFT_MASTER
+  CSMD_HAL_TX_TRACK *prTrack = (CSMD_HAL_TX_TRACK *)
+    (CSMD_VOID *)((CSMD_UCHAR *)prCSMD_HAL->prSERC_Reg + CSMD_HAL_SOFT_MASTER_REG_TX_TRACK_OFFSET);
+
+  if (   (CSMD_HAL_IsSoftMaster( prCSMD_HAL ) == TRUE)
+      && (prTrack->ulEnabled != 0U) )
+  {
+    CSMD_USHORT       *pusDest = (CSMD_USHORT *)pvWriteDes;
+    CSMD_USHORT       *pusSrc  = (CSMD_USHORT *)pvDataSource;
+    CSMD_ULONG         ulBlock;
+    CSMD_USHORT        usI;
+
+    for (usI = 0U; usI < usLength; usI++)
+    {
+      if (pusDest[usI] != pusSrc[usI])
+      {
+        pusDest[usI] = pusSrc[usI];
+
+        ulBlock = (CSMD_ULONG)((CSMD_UCHAR *)&pusDest[usI] - prCSMD_HAL->prSERC_TX_Ram->aucTx_Ram)
+                    / CSMD_HAL_TX_TRACK_BLOCK_SIZE;
+        if (ulBlock < CSMD_HAL_TX_TRACK_NBR_WORDS * 32U)
+        {
+          prTrack->aulDirty[ulBlock / 32U] |= 1UL << (ulBlock % 32U);
+        }
+      }
+    }
+  }
+  else
+#endif
+  {
+    CSMD_HAL_WriteBlock( pvWriteDes, pvDataSource, usLength );
+  }
+
+} /* end: CSMD_HAL_WriteTxRam() */
+
+
+
+#ifdef CSMD_SOFT_MASTER
+/**************************************************************************/ /**
+\brief Resets the TxRam change tracking of the soft master.
+
+\ingroup module_cyclic
+\b Description: \n
+   This function clears all tracked TxRam blocks and increments the
+   configuration counter, so that the soft master copies all data into its
+   telegrams until the tracked blocks are configured again with
+   CSMD_HAL_TrackTxRam().
+
+<B>Call Environment:</B> \n
+   This is a CoSeMa-private function.
+
+\param [in]   prCSMD_HAL
+              Pointer to the CoSeMa HAL structure
+
+\return       none
+
+***************************************************************************** */
+CSMD_VOID CSMD_HAL_ResetTxRamTracking( CSMD_HAL *prCSMD_HAL )
+{
+  CSMD_HAL_TX_TRACK *prTrack;
+
+  if (CSMD_HAL_IsSoftMaster( prCSMD_HAL ) == TRUE)
+  {
+    prTrack = (CSMD_HAL_TX_TRACK *)
+                (CSMD_VOID *)((CSMD_UCHAR *)prCSMD_HAL->prSERC_Reg + CSMD_HAL_SOFT_MASTER_REG_TX_TRACK_OFFSET);
+
+    (CSMD_VOID) CSMD_HAL_memset( prTrack->aulTracked, 0, sizeof (prTrack->aulTracked) );
+    (CSMD_VOID) CSMD_HAL_memset( prTrack->aulDirty, 0, sizeof (prTrack->aulDirty) );
+    prTrack->ulConfigCnt++;
+  }
+
+} /* end: CSMD_HAL_ResetTxRamTracking() */
+
+
+
+/**************************************************************************/ /**
+\brief Declares a TxRam range as written by CoSeMa only with
+       CSMD_HAL_WriteTxRam().
+
+\ingroup module_cyclic
+\b Description: \n
+   This function marks all TxRam blocks lying completely within the given
+   range as tracked. The soft master copies tracked blocks into its
+   telegrams only when they have been changed. Blocks shared with other data
+   remain untracked and are always copied.
+
+<B>Call Environment:</B> \n
+   This is a CoSeMa-private function.
+
+\param [in]   prCSMD_HAL
+              Pointer to the CoSeMa HAL structure
+\param [in]   pvTxRam
+              Start address of the range in TxRam
+\param [in]   usLength
+              Length of the range [bytes]
+
+\return       none
+
+***************************************************************************** */
+CSMD_VOID CSMD_HAL_TrackTxRam( CSMD_HAL    *prCSMD_HAL,
+                               CSMD_VOID   *pvTxRam,
+                               CSMD_USHORT  usLength )
+{
+  CSMD_HAL_TX_TRACK *prTrack;
+  CSMD_LONG          lStart;
+  CSMD_LONG          lBlock;
+  CSMD_LONG          lEnd;
+
+  if (CSMD_HAL_IsSoftMaster( prCSMD_HAL ) == TRUE)
+  {
+    lStart = (CSMD_LONG)((CSMD_UCHAR *)pvTxRam - prCSMD_HAL->prSERC_TX_Ram->aucTx_Ram);
+
+    /* Range not in TxRam, e.g. local copy for DMA */
+    if ((lStart < 0) || ((lStart + usLength) > (CSMD_LONG)CSMD_HAL_TX_RAM_SIZE))
+    {
+      return;
+    }
+
+    prTrack = (CSMD_HAL_TX_TRACK *)
+                (CSMD_VOID *)((CSMD_UCHAR *)prCSMD_HAL->prSERC_Reg + CSMD_HAL_SOFT_MASTER_REG_TX_TRACK_OFFSET);
+
+    /* Only blocks completely within the range */
+    lEnd = (lStart + usLength) / (CSMD_LONG)CSMD_HAL_TX_TRACK_BLOCK_SIZE;
+    for (lBlock = (lStart + (CSMD_LONG)CSMD_HAL_TX_TRACK_BLOCK_SIZE - 1) / (CSMD_LONG)CSMD_HAL_TX_TRACK_BLOCK_SIZE;
+         lBlock < lEnd;
+         lBlock++)
+    {
+      prTrack->aulTracked[lBlock / 32] |= 1UL << (lBlock % 32);
+    }
+  }
+
+} /* end: CSMD_HAL_TrackTxRam() */
+
+
+
+/**************************************************************************/ /**
+\brief Marks a TxRam range as changed for the soft master.
+
+\ingroup module_cyclic
+\b Description: \n
+   This function marks all TxRam blocks touching the given range as dirty,
+   so that the soft master copies them into its telegrams in the next cycle.
+   It is used for connection data written directly into TxRam instead of
+   with CSMD_HAL_WriteTxRam().
+
+<B>Call Environment:</B> \n
+   This is a CoSeMa-private function.
+
+\param [in]   prCSMD_HAL
+              Pointer to the CoSeMa HAL structure
+\param [in]   pvTxRam
+              Start address of the range in TxRam
+\param [in]   usLength
+              Length of the range [bytes]
+
+\return       none
+
+***************************************************************************** */
+CSMD_VOID CSMD_HAL_MarkTxRamDirty( CSMD_HAL    *prCSMD_HAL,
+                                   CSMD_VOID   *pvTxRam,
+                                   CSMD_USHORT  usLength )
+{
+  CSMD_HAL_TX_TRACK *prTrack;
+  CSMD_LONG          lStart;
+  CSMD_LONG          lBlock;
+  CSMD_LONG          lEnd;
+
+  if ((CSMD_HAL_IsSoftMaster( prCSMD_HAL ) == TRUE) && (usLength != 0U))
+  {
+    lStart = (CSMD_LONG)((CSMD_UCHAR *)pvTxRam - prCSMD_HAL->prSERC_TX_Ram->aucTx_Ram);
+
+    /* Range not in TxRam */
+    if ((lStart < 0) || ((lStart + usLength) > (CSMD_LONG)CSMD_HAL_TX_RAM_SIZE))
+    {
+      return;
+    }
+
+    prTrack = (CSMD_HAL_TX_TRACK *)
+                (CSMD_VOID *)((CSMD_UCHAR *)prCSMD_HAL->prSERC_Reg + CSMD_HAL_SOFT_MASTER_REG_TX_TRACK_OFFSET);
+
+    /* All blocks touching the range */
+    lEnd = (lStart + usLength - 1) / (CSMD_LONG)CSMD_HAL_TX_TRACK_BLOCK_SIZE;
+    for (lBlock = lStart / (CSMD_LONG)CSMD_HAL_TX_TRACK_BLOCK_SIZE; lBlock <= lEnd; lBlock++)
+    {
+      prTrack->aulDirty[lBlock / 32] |= 1UL << (lBlock % 32);
+    }
+  }
+
+} /* end: CSMD_HAL_MarkTxRamDirty() */
+#endif  /* #ifdef CSMD_SOFT_MASTER */
+
+
+
 /*###########################################################################*/
 /*-----------------------{ DESCRIPTOR FUNCTIONS }----------------------------*/
 /*###########################################################################*/
@@ -785,6 +785,24 @@ typedef volatile struct CSMD_HAL_SERCFPGA_REGISTER_STR
 #define CSMD_HAL_SOFT_MASTER_REG_EVENT_OFFSET   0x400
                                                   /*!< Byte offset for event mapping to register memory for soft master*/
 
+#define CSMD_HAL_SOFT_MASTER_REG_TX_TRACK_OFFSET  0x800
+                                                  /*!< Byte offset for TxRam change tracking in register memory for soft master*/
+#define CSMD_HAL_TX_TRACK_BLOCK_SIZE      16U     /*!< Number of TxRam bytes per tracking bit */
+#define CSMD_HAL_TX_TRACK_NBR_WORDS       (CSMD_HAL_TX_RAM_SIZE / CSMD_HAL_TX_TRACK_BLOCK_SIZE / 32U)
+                                                  /*!< Number of long words of a tracking bit field */
+
+/* -------------------------------------------------------------------------- */
+/*! \brief TxRam change tracking of the soft master                           */
+/* -------------------------------------------------------------------------- */
+typedef struct CSMD_HAL_TX_TRACK_STR
+{
+  CSMD_ULONG  ulEnabled;                                /*!< Set by the soft master if it evaluates the change tracking */
+  CSMD_ULONG  ulConfigCnt;                              /*!< Incremented whenever aulTracked is reset */
+  CSMD_ULONG  aulTracked[CSMD_HAL_TX_TRACK_NBR_WORDS];  /*!< Blocks written by CoSeMa only with CSMD_HAL_WriteTxRam() */
+  CSMD_ULONG  aulDirty[CSMD_HAL_TX_TRACK_NBR_WORDS];    /*!< Tracked blocks changed since the soft master has read them */
+
+} CSMD_HAL_TX_TRACK;
+
 #ifdef CSMD_PCI_MASTER
 /*-------------------------------------------------- */
 /*! SERCON100M DMA Registers (local address space 1  */
@@ -2445,6 +2445,27 @@ SOURCE CSMD_VOID CSMD_HAL_WriteBlock
                                   CSMD_VOID             *pvDataSource,
                                   CSMD_USHORT            usLength );
 
+SOURCE CSMD_VOID CSMD_HAL_WriteTxRam
+                                ( CSMD_HAL              *prCSMD_HAL,
+                                  CSMD_VOID             *pvWriteDes,
+                                  CSMD_VOID             *pvDataSource,
+                                  CSMD_USHORT            usLength );
+
+#ifdef CSMD_SOFT_MASTER
+SOURCE CSMD_VOID CSMD_HAL_ResetTxRamTracking
+                                ( CSMD_HAL              *prCSMD_HAL );
+
+SOURCE CSMD_VOID CSMD_HAL_TrackTxRam
+                                ( CSMD_HAL              *prCSMD_HAL,
+                                  CSMD_VOID             *pvTxRam,
+                                  CSMD_USHORT            usLength );
+
+SOURCE CSMD_VOID CSMD_HAL_MarkTxRamDirty
+                                ( CSMD_HAL              *prCSMD_HAL,
+                                  CSMD_VOID             *pvTxRam,
+                                  CSMD_USHORT            usLength );
+#endif
+
 SOURCE CSMD_VOID CSMD_HAL_SetTxDescriptor
                                 ( CSMD_HAL              *prCSMD_HAL,
                                   CSMD_ULONG             ulTxRamOffset,
@@ -133,6 +133,8 @@ SOURCE INT RTLX_WriteFile
 #define         RTOS_DestroyThreadData      RTLX_DestroyThreadData
 #define         RTOS_SetThreadPriority      RTLX_SetThreadPriority
 #define         RTOS_AllowRemoteClose       RTLX_AllowRemoteClose
+#define         RTOS_JoinThread             RTLX_JoinThread
+#define         RTOS_SetThreadCoreAffinity  RTLX_SetThreadCoreAffinity
 
 SOURCE INT RTLX_CreateThread
     (
@@ -157,6 +159,11 @@ SOURCE VOID RTLX_DestroyThreadData
       RTLX_THREAD *pThread
     );
 
+SOURCE INT RTLX_JoinThread
+    (
+      RTLX_THREAD *pThread
+    );
+
 SOURCE INT RTLX_SetThreadPriority
     (
       INT iPriority
@@ -177,6 +184,7 @@ SOURCE INT RTLX_SetThreadCoreAffinity
 #define         RTOS_CreateSemaphore        RTLX_CreateSemaphore
 #define         RTOS_WaitForSemaphore       RTLX_WaitForSemaphore
 #define         RTOS_TrySemaphore           RTLX_TrySemaphore
+#define         RTOS_WaitForSemaphoreTimeout RTLX_WaitForSemaphoreTimeout
 #define         RTOS_PostSemaphore          RTLX_PostSemaphore
 #define         RTOS_DestroySemaphore       RTLX_DestroySemaphore
 
@@ -196,6 +204,12 @@ SOURCE INT RTLX_TrySemaphore
       RTLX_SEMAPHORE *pSem
     );
 
+SOURCE INT RTLX_WaitForSemaphoreTimeout
+    (
+      RTLX_SEMAPHORE *pSem,
+      ULONG ulTimeoutMs
+    );
+
 SOURCE INT RTLX_PostSemaphore
     (
       RTLX_SEMAPHORE *pSem
@@ -206,6 +220,21 @@ SOURCE INT RTLX_DestroySemaphore
       RTLX_SEMAPHORE *pSem
     );
 
+// Functions for memory used in the real-time cycle (RTLX_MEM.c)
+
+#define         RTOS_AllocLockedMem         RTLX_AllocLockedMem
+#define         RTOS_FreeLockedMem          RTLX_FreeLockedMem
+
+SOURCE VOID* RTLX_AllocLockedMem
+    (
+      ULONG ulSize
+    );
+
+SOURCE VOID RTLX_FreeLockedMem
+    (
+      VOID *pvMem
+    );
+
 // Timing functions (RTLX_TIME.c)
 
 #define         RTOS_SimpleMicroWait        RTLX_SimpleMicroWait
@@ -214,6 +243,8 @@ SOURCE INT RTLX_DestroySemaphore
 #define         RTOS_WaitForSystemTime      RTLX_WaitForSystemTime
 #define         RTOS_GetTimeDifference      RTLX_GetTimeDifference
 #define         RTOS_GetTimeNs              RTLX_GetTimeNs
+#define         RTOS_GetTimeS               RTLX_GetTimeS
+#define         RTOS_GetTaiTime             RTLX_GetTaiTime
 
 SOURCE VOID RTLX_SimpleMicroWait
     (
@@ -248,6 +279,16 @@ SOURCE LONG RTLX_GetTimeNs
       RTLX_TIMESPEC *pTime
     );
 
+SOURCE LONG RTLX_GetTimeS
+    (
+      RTLX_TIMESPEC *pTime
+    );
+
+SOURCE ULONGLONG RTLX_GetTaiTime
+    (
+      VOID
+    );
+
 // Functions for memory management (RTLX_MEM.c)
 
 #define         RTOS_GetPageAlignedMemSize  RTLX_GetPageAlignedMemSize
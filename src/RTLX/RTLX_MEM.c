@@ -0,0 +1,156 @@
+/**
+ * \file      RTLX_MEM.c
+ *
+ * \brief     Real-time operating system abstraction layer for Linux
+ *            RT-Preempt: Memory for use in the real-time cycle
+ *
+ * \attention Prototype status! Only for demo purposes! Not to be used in
+ *            machines, only in controlled safe environments! Risk of unwanted
+ *            machine movement!
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS"; WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY;
+ * FITNESS FOR A PERTICULAR PURPOSE AND NONINFRINGEMENT. THE AUTHORS OR COPYRIGHT
+ * HOLDERS SHALL NOT BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE;
+ * UNLESS STIPULATED BY MANDATORY LAW.
+ *
+ *
+ * \ingroup   RTLX
+ */
+
+//---- includes ---------------------------------------------------------------
+
+#define SOURCE_RTLX
+
+/*lint -save -w0 */
+#include <sys/mman.h>
+#include <errno.h>
+/*lint -restore */
+
+#include "../RTLX/RTLX_GLOB.h"
+#include "../RTLX/RTLX_PRIV.h"
+#include "../RTLX/RTLX_USER.h"
+#include "../GLOB/GLOB_DEFS.h"
+#include "../GLOB/GLOB_TYPE.h"
+
+//---- defines ----------------------------------------------------------------
+
+#define RTLX_MEM_HDR_SIZE   (64)    /**< Header in front of the memory, keeps
+                                         its cache line alignment */
+
+//---- type definitions -------------------------------------------------------
+
+//---- variable declarations --------------------------------------------------
+
+//---- function declarations --------------------------------------------------
+
+//---- function implementations -----------------------------------------------
+
+/**
+ * \fn VOID* RTLX_AllocLockedMem(
+ *              ULONG ulSize
+ *          )
+ *
+ * \brief   Allocates zeroed memory that is locked in RAM and aligned to a
+ *          page, so no page faults occur on access. With RTOS_HUGE_PAGES,
+ *          huge pages are tried first.
+ *
+ * \param[in]   ulSize  Size of memory in bytes
+ *
+ * \return  Pointer to memory, aligned to at least 64 bytes, or NULL
+ *
+ * \note    Locking fails if RLIMIT_MEMLOCK is too small. The memory is used
+ *          anyway and a warning is printed.
+ *
+ * \ingroup RTLX
+ */
+VOID* RTLX_AllocLockedMem
+    (
+      ULONG ulSize
+    )
+{
+  size_t  ulMapSize;
+  UCHAR*  pucMem    = MAP_FAILED;
+
+#ifdef RTOS_HUGE_PAGES
+  ulMapSize = ((size_t)ulSize + RTLX_MEM_HDR_SIZE + RTOS_HUGE_PAGE_SIZE - 1) &
+      ~((size_t)RTOS_HUGE_PAGE_SIZE - 1);
+
+  pucMem = (UCHAR*)mmap
+      (
+        NULL,
+        ulMapSize,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE | MAP_HUGETLB,
+        -1,
+        0
+      );
+
+  if (pucMem == MAP_FAILED)
+  {
+    RTLX_VERBOSE(1, "No huge pages available (%s), using normal pages\n", strerror(errno));
+  }
+#endif
+
+  if (pucMem == MAP_FAILED)
+  {
+    ulMapSize = ((size_t)ulSize + RTLX_MEM_HDR_SIZE + RTOS_MEM_PAGE_SIZE - 1) &
+        ~((size_t)RTOS_MEM_PAGE_SIZE - 1);
+
+    pucMem = (UCHAR*)mmap
+        (
+          NULL,
+          ulMapSize,
+          PROT_READ | PROT_WRITE,
+          MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE,
+          -1,
+          0
+        );
+
+    if (pucMem == MAP_FAILED)
+    {
+      RTLX_VERBOSE(0, "Error %d (%s) allocating memory\n", errno, strerror(errno));
+      return(NULL);
+    }
+  }
+
+  if (mlock(pucMem, ulMapSize) != 0)
+  {
+    RTLX_VERBOSE(0, "Warning: Could not lock memory (%s)\n", strerror(errno));
+  }
+
+  // Mapping size for RTLX_FreeLockedMem()
+  *((size_t*)pucMem) = ulMapSize;
+
+  return(pucMem + RTLX_MEM_HDR_SIZE);
+}
+
+/**
+ * \fn VOID RTLX_FreeLockedMem(
+ *              VOID *pvMem
+ *          )
+ *
+ * \brief   Releases memory allocated with RTLX_AllocLockedMem().
+ *
+ * \param[in]   pvMem   Pointer to memory, NULL is ignored
+ *
+ * \ingroup RTLX
+ */
+VOID RTLX_FreeLockedMem
+    (
+      VOID *pvMem
+    )
+{
+  UCHAR* pucMem;
+
+  if (pvMem == NULL)
+  {
+    return;
+  }
+
+  pucMem = (UCHAR*)pvMem - RTLX_MEM_HDR_SIZE;
+
+  (VOID)munmap(pucMem, *((size_t*)pucMem));
+}
@@ -0,0 +1,894 @@
+/**
+ * \file      RTLX_NIC_TIMED.c
+ *
+ * \brief     Real-time operating system abstraction layer for Linux RT-Preempt:
+ *            NIC-timed packet transmission for Sercos soft master
+ *
+ * \attention Prototype status! Only for demo purposes! Not to be used in
+ *            machines, only in controlled safe environments! Risk of unwanted
+ *            machine movement!
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS"; WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY;
+ * FITNESS FOR A PERTICULAR PURPOSE AND NONINFRINGEMENT. THE AUTHORS OR COPYRIGHT
+ * HOLDERS SHALL NOT BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE;
+ * UNLESS STIPULATED BY MANDATORY LAW.
+ *
+ * \details   Packets are handed over to the kernel with their launch time
+ *            (SO_TXTIME / SCM_TXTIME). If an ETF or taprio queueing discipline
+ *            is installed on the adapter, the kernel or the NIC releases each
+ *            packet exactly at its launch time. Otherwise, the launch times
+ *            are met by software: the calling thread sleeps until the launch
+ *            time of each group of packets and transmits them right after.
+ *
+ *            The NIC timer is emulated by a timer thread that wakes up on
+ *            absolute deadlines of RTOS_NIC_TIMED_CLOCK. The launch times are
+ *            relative to the last timer expiry, or to the time of the call of
+ *            RTLX_TxPacketsNicTimed() if no timer is running, shifted by
+ *            RTOS_TIME_SHIFT_NIC_TIMED.
+ *
+ * \ingroup   RTLX
+ */
+
+//---- includes ---------------------------------------------------------------
+
+#define SOURCE_RTLX
+
+#define _GNU_SOURCE
+
+/*lint -save -w0 */
+#include <sys/socket.h>
+#include <net/if.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <linux/net_tstamp.h>
+#include <linux/rtnetlink.h>
+/*lint -restore */
+
+#include "../RTLX/RTLX_GLOB.h"
+#include "../RTLX/RTLX_PRIV.h"
+#include "../RTLX/RTLX_S3SM_GLOB.h"
+#include "../RTLX/RTLX_S3SM_USER.h"
+#include "../GLOB/GLOB_DEFS.h"
+#include "../GLOB/GLOB_TYPE.h"
+#include "../SICE/SICE_GLOB.h"
+
+//---- defines ----------------------------------------------------------------
+
+/**
+ * \def     RTLX_NIC_TIMED_MAX_PACKETS
+ *
+ * \brief   Maximum number of packets per call of RTLX_TxPacketsNicTimed():
+ *          all MDTs and ATs on both ports plus the UCC packets.
+ */
+#define RTLX_NIC_TIMED_MAX_PACKETS    (4 * CSMD_MAX_TEL + RTOS_UCC_MAX_PACKETS)
+
+#define RTLX_NSEC_PER_SEC             (1000000000ULL)
+
+//---- type definitions -------------------------------------------------------
+
+/**
+ * \struct  RTLX_NIC_TIMED_PACKET
+ *
+ * \brief   Packet to be transmitted at a given launch time
+ */
+typedef struct
+{
+  UCHAR*    pucData;                        /**< Packet data */
+  USHORT    usLen;                          /**< Packet length */
+  INT       iPort;                          /**< Port index */
+  ULONGLONG ullLaunchNs;                    /**< Absolute launch time in ns */
+} RTLX_NIC_TIMED_PACKET;
+
+typedef struct
+{
+  INT                aiSocketId[RTOS_MAX_PORTS];
+                                            /**< TX socket handle per port */
+  struct sockaddr_ll arAddr[RTOS_MAX_PORTS];
+                                            /**< TX socket address per port */
+  INT                iNumPorts;             /**< Number of opened ports */
+  BOOL               boTxTime;              /**< Launch time enforced by kernel/NIC */
+  RTLX_THREAD        rTimerThread;          /**< Timer thread */
+  volatile BOOL      boTimerRunning;        /**< Timer thread active */
+  VOID               (*pAlarmFunc)(VOID);   /**< Function called on timer expiry */
+  volatile ULONG     ulCycleTimeNs;         /**< Timer period in ns */
+  volatile ULONGLONG ullCycleStartNs;       /**< Time of last timer expiry in ns */
+} RTLX_NIC_TIMED_INSTANCE;
+
+//---- variable declarations --------------------------------------------------
+
+static RTLX_NIC_TIMED_INSTANCE RTLX_NicTimedInstances[RTOS_MAX_INSTANCES];
+
+//---- function declarations --------------------------------------------------
+
+static ULONGLONG RTLX_NicTimedNow
+    (
+      VOID
+    );
+
+static BOOL RTLX_NicTimedCheckQdisc
+    (
+      INT iIfIndex
+    );
+
+static VOID* RTLX_NicTimerThread
+    (
+      VOID* pvArg
+    );
+
+static INT RTLX_NicTimedSend
+    (
+      RTLX_NIC_TIMED_INSTANCE* prInst,
+      RTLX_NIC_TIMED_PACKET* prPackets,
+      INT iNum
+    );
+
+//---- function implementations -----------------------------------------------
+
+/**
+ * \fn INT RTLX_InitNicTimedTransmission(
+ *              INT iInstanceNo,
+ *              BOOL boRedundancy,
+ *              INT iUCCPackets,
+ *              UCHAR* pucMAC
+ *          )
+ *
+ * \brief   Opens the transmit sockets for NIC-timed transmission, one per
+ *          port, and enables launch times (SO_TXTIME) on them.
+ *
+ * \param[in]   iInstanceNo     Sercos IP core emulation instance number
+ * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
+ * \param[in]   iUCCPackets     Maximum number of UCC packets per cycle
+ * \param[out]  pucMAC          MAC address of port P
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ */
+INT RTLX_InitNicTimedTransmission
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy,
+      INT iUCCPackets,
+      UCHAR* pucMAC
+    )
+{
+  RTLX_NIC_TIMED_INSTANCE* prInst = NULL;
+  struct ifreq             rIfReq;
+  struct sock_txtime       rTxTime;
+  INT                      iPort  = 0;
+  INT                      iRet   = 0;
+
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    RTLX_VERBOSE
+        (
+          0,
+          "RTLX_InitNicTimedTransmission() instance %d too large, only %d available\n",
+          iInstanceNo,
+          RTOS_MAX_INSTANCES
+        );
+    return(RTOS_RET_ERROR);
+  }
+
+  if (iUCCPackets > RTOS_UCC_MAX_PACKETS)
+  {
+    RTLX_VERBOSE(0, "Error: %d UCC packets per cycle not supported\n", iUCCPackets);
+    return(RTOS_RET_ERROR);
+  }
+
+  prInst            = &RTLX_NicTimedInstances[iInstanceNo];
+  prInst->iNumPorts = boRedundancy ? 2 : 1;
+  prInst->boTxTime  = TRUE;
+
+  for (
+      iPort = 0;
+      iPort < prInst->iNumPorts;
+      iPort++
+    )
+  {
+    prInst->aiSocketId[iPort] = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+
+    if (prInst->aiSocketId[iPort] < 0)
+    {
+      RTLX_VERBOSE
+          (
+            0,
+            "Error %d (%s) creating NIC-timed socket for port %d\n",
+            errno,
+            strerror(errno),
+            iPort
+          );
+      return(RTOS_RET_ERROR);
+    }
+
+    (VOID)memset(&prInst->arAddr[iPort], 0, sizeof(prInst->arAddr[iPort]));
+    prInst->arAddr[iPort].sll_family  = AF_PACKET;
+    prInst->arAddr[iPort].sll_ifindex = if_nametoindex(RTLX_GetNicName(iInstanceNo, iPort));
+    prInst->arAddr[iPort].sll_halen   = ETH_ALEN;
+
+    if (prInst->arAddr[iPort].sll_ifindex == 0)
+    {
+      RTLX_VERBOSE(0, "Error: Unknown adapter %s\n", RTLX_GetNicName(iInstanceNo, iPort));
+      return(RTOS_RET_ERROR);
+    }
+
+    // Get hardware MAC address of port P
+    if (iPort == 0)
+    {
+      (VOID)memset(&rIfReq, 0, sizeof(rIfReq));
+      (VOID)strncpy(rIfReq.ifr_name, RTLX_GetNicName(iInstanceNo, iPort), IFNAMSIZ - 1);
+
+      if (ioctl(prInst->aiSocketId[iPort], SIOCGIFHWADDR, &rIfReq) < 0)
+      {
+        RTLX_VERBOSE(0, "Error %d (%s) reading MAC address\n", errno, strerror(errno));
+        return(RTOS_RET_ERROR);
+      }
+      (VOID)memcpy(pucMAC, rIfReq.ifr_hwaddr.sa_data, 6);
+    }
+
+    // Launch time enforced by kernel only with suitable queueing discipline
+    if (!RTLX_NicTimedCheckQdisc(prInst->arAddr[iPort].sll_ifindex))
+    {
+      prInst->boTxTime = FALSE;
+    }
+
+    (VOID)memset(&rTxTime, 0, sizeof(rTxTime));
+    rTxTime.clockid = RTOS_NIC_TIMED_CLOCK;
+    rTxTime.flags   = SOF_TXTIME_REPORT_ERRORS;
+
+    iRet = setsockopt
+        (
+          prInst->aiSocketId[iPort],
+          SOL_SOCKET,
+          SO_TXTIME,
+          &rTxTime,
+          sizeof(rTxTime)
+        );
+
+    if (iRet < 0)
+    {
+      RTLX_VERBOSE(1, "SO_TXTIME not available (%s)\n", strerror(errno));
+      prInst->boTxTime = FALSE;
+    }
+  }
+
+  RTLX_VERBOSE
+      (
+        0,
+        "NIC-timed transmission on %s%s%s: %s launch time\n",
+        RTLX_GetNicName(iInstanceNo, 0),
+        (prInst->iNumPorts > 1) ? "/" : "",
+        (prInst->iNumPorts > 1) ? RTLX_GetNicName(iInstanceNo, 1) : "",
+        prInst->boTxTime ? "kernel (ETF)" : "software"
+      );
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn VOID RTLX_CloseNicTimedTransmission(
+ *              INT iInstanceNo,
+ *              BOOL boRedundancy
+ *          )
+ *
+ * \brief   Closes the transmit sockets for NIC-timed transmission.
+ *
+ * \param[in]   iInstanceNo     Sercos IP core emulation instance number
+ * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
+ *
+ * \ingroup RTLX
+ */
+VOID RTLX_CloseNicTimedTransmission
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy
+    )
+{
+  INT iPort = 0;
+
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    return;
+  }
+
+  for (
+      iPort = 0;
+      iPort < RTLX_NicTimedInstances[iInstanceNo].iNumPorts;
+      iPort++
+    )
+  {
+    (VOID)close(RTLX_NicTimedInstances[iInstanceNo].aiSocketId[iPort]);
+  }
+  RTLX_NicTimedInstances[iInstanceNo].iNumPorts = 0;
+}
+
+/**
+ * \fn INT RTLX_TxPacketsNicTimed(
+ *              INT iInstanceNo,
+ *              RTOS_NIC_TIMED_PACKET_STRUCT* prPacketStruct,
+ *              USHORT usIFG
+ *          )
+ *
+ * \brief   Transmits the MDTs, ATs and UCC packets of a Sercos cycle at their
+ *          offsets relative to the cycle start.
+ *
+ * \param[in]   iInstanceNo     Sercos IP core emulation instance number
+ * \param[in]   prPacketStruct  Packets and their timing offsets
+ * \param[in]   usIFG           Required inter frame gap, packets of a group
+ *                              are transmitted back-to-back
+ *
+ * \note    With launch times enforced by the kernel, the function returns
+ *          right after handing over all packets. Otherwise, it returns after
+ *          transmission of the last group.
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ */
+INT RTLX_TxPacketsNicTimed
+    (
+      INT iInstanceNo,
+      RTOS_NIC_TIMED_PACKET_STRUCT* prPacketStruct,
+      USHORT usIFG
+    )
+{
+  RTLX_NIC_TIMED_INSTANCE* prInst = NULL;
+  RTLX_NIC_TIMED_PACKET    arPackets[RTLX_NIC_TIMED_MAX_PACKETS];
+  RTLX_NIC_TIMED_PACKET    rTmp;
+  RTOS_NIC_TIMED_SERCOS_PACKETS* aprSercos[2];
+  ULONGLONG                ullBaseNs = 0;
+  INT                      iNum      = 0;
+  INT                      iGroup    = 0;
+  INT                      iCnt      = 0;
+  INT                      iPort     = 0;
+  INT                      iIdx      = 0;
+
+  if (
+      (iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) ||
+      (prPacketStruct == NULL)
+    )
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  prInst = &RTLX_NicTimedInstances[iInstanceNo];
+
+  if (prInst->iNumPorts == 0)
+  {
+    RTLX_VERBOSE(0, "Error: NIC-timed transmission not initialized\n");
+    return(RTOS_RET_ERROR);
+  }
+
+  // Cycle start: last timer expiry, or now if no timer is running
+  if (prInst->boTimerRunning)
+  {
+    ullBaseNs = prInst->ullCycleStartNs;
+  }
+  else
+  {
+    ullBaseNs = RTLX_NicTimedNow();
+  }
+  ullBaseNs += RTOS_TIME_SHIFT_NIC_TIMED;
+
+  // Collect MDTs and ATs
+  aprSercos[0] = &prPacketStruct->rMDT;
+  aprSercos[1] = &prPacketStruct->rAT;
+
+  for (
+      iGroup = 0;
+      iGroup < 2;
+      iGroup++
+    )
+  {
+    for (
+        iCnt = 0;
+        (iCnt < aprSercos[iGroup]->usNum) && (iCnt < CSMD_MAX_TEL);
+        iCnt++
+      )
+    {
+      for (
+          iPort = 0;
+          iPort < (prPacketStruct->boRedundancy ? prInst->iNumPorts : 1);
+          iPort++
+        )
+      {
+        arPackets[iNum].pucData     = aprSercos[iGroup]->aapucPacket[iCnt][iPort];
+        arPackets[iNum].usLen       = aprSercos[iGroup]->ausLen[iCnt];
+        arPackets[iNum].iPort       = iPort;
+        arPackets[iNum].ullLaunchNs = ullBaseNs + aprSercos[iGroup]->ulOffsetNs;
+        iNum++;
+      }
+    }
+  }
+
+  // Collect UCC packets
+  for (
+      iCnt = 0;
+      (iCnt < prPacketStruct->rUCC.usNum) && (iCnt < RTOS_UCC_MAX_PACKETS);
+      iCnt++
+    )
+  {
+    if (prPacketStruct->rUCC.aucPort[iCnt] >= prInst->iNumPorts)
+    {
+      RTLX_VERBOSE(0, "Error: UCC packet for unused port %u\n", prPacketStruct->rUCC.aucPort[iCnt]);
+      continue;
+    }
+    arPackets[iNum].pucData     = prPacketStruct->rUCC.apucPacket[iCnt];
+    arPackets[iNum].usLen       = prPacketStruct->rUCC.ausLen[iCnt];
+    arPackets[iNum].iPort       = prPacketStruct->rUCC.aucPort[iCnt];
+    arPackets[iNum].ullLaunchNs = ullBaseNs + prPacketStruct->rUCC.ulOffsetNs;
+    iNum++;
+  }
+
+  // Order by launch time, keeping the order within a group (insertion sort)
+  for (
+      iCnt = 1;
+      iCnt < iNum;
+      iCnt++
+    )
+  {
+    rTmp = arPackets[iCnt];
+    iIdx = iCnt - 1;
+    while ((iIdx >= 0) && (arPackets[iIdx].ullLaunchNs > rTmp.ullLaunchNs))
+    {
+      arPackets[iIdx + 1] = arPackets[iIdx];
+      iIdx--;
+    }
+    arPackets[iIdx + 1] = rTmp;
+  }
+
+  return(RTLX_NicTimedSend(prInst, arPackets, iNum));
+}
+
+/**
+ * \fn INT RTLX_InitTimerNic(
+ *              INT iInstanceNo,
+ *              ULONG ulTimeNs,
+ *              VOID* pAlarmFunc
+ *          )
+ *
+ * \brief   Starts the cycle timer used as time base for NIC-timed
+ *          transmission. The timer is emulated by a thread with priority
+ *          RTOS_THREAD_PRIORITY_TIMER.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   ulTimeNs    Timer period (Sercos cycle time) in ns
+ * \param[in]   pAlarmFunc  Function called on each timer expiry, 'NULL' for
+ *                          none
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ */
+INT RTLX_InitTimerNic
+    (
+      INT iInstanceNo,
+      ULONG ulTimeNs,
+      VOID* pAlarmFunc
+    )
+{
+  RTLX_NIC_TIMED_INSTANCE* prInst = NULL;
+
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) || (ulTimeNs == 0))
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  prInst = &RTLX_NicTimedInstances[iInstanceNo];
+
+  if (prInst->boTimerRunning)
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  prInst->pAlarmFunc      = (VOID (*)(VOID))pAlarmFunc;
+  prInst->ulCycleTimeNs   = ulTimeNs;
+  prInst->ullCycleStartNs = RTLX_NicTimedNow();
+  prInst->boTimerRunning  = TRUE;
+
+  if (
+      RTLX_CreateThread
+          (
+            (VOID*)RTLX_NicTimerThread,
+            &prInst->rTimerThread,
+            "RTLX_NicTimer",
+            prInst
+          ) != RTOS_RET_OK
+    )
+  {
+    prInst->boTimerRunning = FALSE;
+    return(RTOS_RET_ERROR);
+  }
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn INT RTLX_SetTimerNic(
+ *              INT iInstanceNo,
+ *              ULONG ulTimeNs
+ *          )
+ *
+ * \brief   Changes the period of the cycle timer, effective after the next
+ *          expiry.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   ulTimeNs    Timer period (Sercos cycle time) in ns
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ */
+INT RTLX_SetTimerNic
+    (
+      INT iInstanceNo,
+      ULONG ulTimeNs
+    )
+{
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) || (ulTimeNs == 0))
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  RTLX_NicTimedInstances[iInstanceNo].ulCycleTimeNs = ulTimeNs;
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn VOID RTLX_CloseTimerNic(
+ *              INT iInstanceNo
+ *          )
+ *
+ * \brief   Stops the cycle timer and waits for the timer thread to end.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ *
+ * \ingroup RTLX
+ */
+VOID RTLX_CloseTimerNic
+    (
+      INT iInstanceNo
+    )
+{
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    return;
+  }
+
+  if (RTLX_NicTimedInstances[iInstanceNo].boTimerRunning)
+  {
+    RTLX_NicTimedInstances[iInstanceNo].boTimerRunning = FALSE;
+    (VOID)pthread_join(RTLX_NicTimedInstances[iInstanceNo].rTimerThread, NULL);
+  }
+}
+
+/**
+ * \fn static ULONGLONG RTLX_NicTimedNow(
+ *              VOID
+ *          )
+ *
+ * \brief   Reads the clock used for launch times.
+ *
+ * \return  Current time of RTOS_NIC_TIMED_CLOCK in ns
+ *
+ * \ingroup RTLX
+ */
+static ULONGLONG RTLX_NicTimedNow
+    (
+      VOID
+    )
+{
+  struct timespec rNow;
+
+  (VOID)clock_gettime(RTOS_NIC_TIMED_CLOCK, &rNow);
+
+  return((ULONGLONG)rNow.tv_sec * RTLX_NSEC_PER_SEC + (ULONGLONG)rNow.tv_nsec);
+}
+
+/**
+ * \fn static VOID* RTLX_NicTimerThread(
+ *              VOID* pvArg
+ *          )
+ *
+ * \brief   Timer thread: sleeps until each absolute timer expiry, stores the
+ *          expiry time as cycle start and calls the alarm function.
+ *
+ * \param[in]   pvArg   Pointer to NIC-timed instance
+ *
+ * \return  NULL
+ *
+ * \ingroup RTLX
+ */
+static VOID* RTLX_NicTimerThread
+    (
+      VOID* pvArg
+    )
+{
+  RTLX_NIC_TIMED_INSTANCE* prInst = (RTLX_NIC_TIMED_INSTANCE*)pvArg;
+  ULONGLONG                ullNextNs;
+  struct timespec          rNext;
+
+  (VOID)RTLX_SetThreadPriority(RTOS_THREAD_PRIORITY_TIMER);
+
+  ullNextNs = prInst->ullCycleStartNs;
+
+  while (prInst->boTimerRunning)
+  {
+    ullNextNs += prInst->ulCycleTimeNs;
+
+    rNext.tv_sec  = (time_t)(ullNextNs / RTLX_NSEC_PER_SEC);
+    rNext.tv_nsec = (long)(ullNextNs % RTLX_NSEC_PER_SEC);
+
+    while (
+        clock_nanosleep
+            (
+              RTOS_NIC_TIMED_CLOCK,
+              TIMER_ABSTIME,
+              &rNext,
+              NULL
+            ) == EINTR
+      )
+    {
+    }
+
+    prInst->ullCycleStartNs = ullNextNs;
+
+    if (prInst->pAlarmFunc != NULL)
+    {
+      prInst->pAlarmFunc();
+    }
+  }
+
+  return(NULL);
+}
+
+/**
+ * \fn static BOOL RTLX_NicTimedCheckQdisc(
+ *              INT iIfIndex
+ *          )
+ *
+ * \brief   Checks via netlink whether a queueing discipline that enforces
+ *          launch times (etf or taprio) is installed on the adapter.
+ *
+ * \param[in]   iIfIndex    Interface index of adapter
+ *
+ * \return  TRUE if launch times are enforced, FALSE otherwise
+ *
+ * \ingroup RTLX
+ */
+static BOOL RTLX_NicTimedCheckQdisc
+    (
+      INT iIfIndex
+    )
+{
+  struct
+  {
+    struct nlmsghdr rHdr;
+    struct tcmsg    rTc;
+  } rReq;
+  UCHAR            aucBuf[8192];
+  struct nlmsghdr* prMsg   = NULL;
+  struct tcmsg*    prTc    = NULL;
+  struct rtattr*   prAttr  = NULL;
+  INT              iAttrLen;
+  INT              iLen;
+  INT              iSock;
+  BOOL             boFound = FALSE;
+  BOOL             boDone  = FALSE;
+
+  iSock = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+  if (iSock < 0)
+  {
+    return(FALSE);
+  }
+
+  (VOID)memset(&rReq, 0, sizeof(rReq));
+  rReq.rHdr.nlmsg_len   = NLMSG_LENGTH(sizeof(struct tcmsg));
+  rReq.rHdr.nlmsg_type  = RTM_GETQDISC;
+  rReq.rHdr.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+  rReq.rTc.tcm_family   = AF_UNSPEC;
+
+  if (send(iSock, &rReq, rReq.rHdr.nlmsg_len, 0) < 0)
+  {
+    (VOID)close(iSock);
+    return(FALSE);
+  }
+
+  while (!boDone)
+  {
+    iLen = recv(iSock, aucBuf, sizeof(aucBuf), 0);
+    if (iLen <= 0)
+    {
+      break;
+    }
+
+    for (
+        prMsg = (struct nlmsghdr*)aucBuf;
+        NLMSG_OK(prMsg, (ULONG)iLen);
+        prMsg = NLMSG_NEXT(prMsg, iLen)
+      )
+    {
+      if ((prMsg->nlmsg_type == NLMSG_DONE) || (prMsg->nlmsg_type == NLMSG_ERROR))
+      {
+        boDone = TRUE;
+        break;
+      }
+
+      prTc = (struct tcmsg*)NLMSG_DATA(prMsg);
+      if (prTc->tcm_ifindex != iIfIndex)
+      {
+        continue;
+      }
+
+      iAttrLen = (INT)prMsg->nlmsg_len - (INT)NLMSG_LENGTH(sizeof(struct tcmsg));
+      for (
+          prAttr = (struct rtattr*)((UCHAR*)prTc + NLMSG_ALIGN(sizeof(struct tcmsg)));
+          RTA_OK(prAttr, iAttrLen);
+          prAttr = RTA_NEXT(prAttr, iAttrLen)
+        )
+      {
+        if (
+            (prAttr->rta_type == TCA_KIND)                      &&
+            (
+              (strcmp((CHAR*)RTA_DATA(prAttr), "etf") == 0)     ||
+              (strcmp((CHAR*)RTA_DATA(prAttr), "taprio") == 0)
+            )
+          )
+        {
+          boFound = TRUE;
+        }
+      }
+    }
+  }
+
+  (VOID)close(iSock);
+
+  return(boFound);
+}
+
+/**
+ * \fn static INT RTLX_NicTimedSend(
+ *              RTLX_NIC_TIMED_INSTANCE* prInst,
+ *              RTLX_NIC_TIMED_PACKET* prPackets,
+ *              INT iNum
+ *          )
+ *
+ * \brief   Transmits packets ordered by launch time. Consecutive packets for
+ *          the same port are handed over with a single sendmmsg() call. In
+ *          software mode, the function sleeps until the launch time of each
+ *          group before.
+ *
+ * \param[in]   prInst      NIC-timed instance
+ * \param[in]   prPackets   Packets ordered by launch time
+ * \param[in]   iNum        Number of packets
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ */
+static INT RTLX_NicTimedSend
+    (
+      RTLX_NIC_TIMED_INSTANCE* prInst,
+      RTLX_NIC_TIMED_PACKET* prPackets,
+      INT iNum
+    )
+{
+  struct mmsghdr  arMsg[RTLX_NIC_TIMED_MAX_PACKETS];
+  struct iovec    arIov[RTLX_NIC_TIMED_MAX_PACKETS];
+  UCHAR           aaucCtrl[RTLX_NIC_TIMED_MAX_PACKETS][CMSG_SPACE(sizeof(ULONGLONG))];
+  struct cmsghdr* prCmsg  = NULL;
+  struct timespec rLaunch;
+  INT             iStart  = 0;
+  INT             iEnd    = 0;
+  INT             iCnt    = 0;
+  INT             iSent   = 0;
+  INT             iRet    = 0;
+
+  while (iStart < iNum)
+  {
+    // Group: consecutive packets for the same port, in software mode also
+    // with the same launch time
+    iEnd = iStart + 1;
+    while (
+        (iEnd < iNum)                                                 &&
+        (prPackets[iEnd].iPort == prPackets[iStart].iPort)            &&
+        (prInst->boTxTime || (prPackets[iEnd].ullLaunchNs == prPackets[iStart].ullLaunchNs))
+      )
+    {
+      iEnd++;
+    }
+
+    if (!prInst->boTxTime)
+    {
+      rLaunch.tv_sec  = (time_t)(prPackets[iStart].ullLaunchNs / RTLX_NSEC_PER_SEC);
+      rLaunch.tv_nsec = (long)(prPackets[iStart].ullLaunchNs % RTLX_NSEC_PER_SEC);
+
+      while (
+          clock_nanosleep
+              (
+                RTOS_NIC_TIMED_CLOCK,
+                TIMER_ABSTIME,
+                &rLaunch,
+                NULL
+              ) == EINTR
+        )
+      {
+      }
+    }
+
+    for (
+        iCnt = iStart;
+        iCnt < iEnd;
+        iCnt++
+      )
+    {
+      arIov[iCnt].iov_base = prPackets[iCnt].pucData;
+      arIov[iCnt].iov_len  = prPackets[iCnt].usLen;
+
+      (VOID)memset(&arMsg[iCnt], 0, sizeof(arMsg[iCnt]));
+      arMsg[iCnt].msg_hdr.msg_name    = &prInst->arAddr[prPackets[iCnt].iPort];
+      arMsg[iCnt].msg_hdr.msg_namelen = sizeof(prInst->arAddr[prPackets[iCnt].iPort]);
+      arMsg[iCnt].msg_hdr.msg_iov     = &arIov[iCnt];
+      arMsg[iCnt].msg_hdr.msg_iovlen  = 1;
+
+      if (prInst->boTxTime)
+      {
+        arMsg[iCnt].msg_hdr.msg_control    = aaucCtrl[iCnt];
+        arMsg[iCnt].msg_hdr.msg_controllen = sizeof(aaucCtrl[iCnt]);
+
+        prCmsg             = CMSG_FIRSTHDR(&arMsg[iCnt].msg_hdr);
+        prCmsg->cmsg_level = SOL_SOCKET;
+        prCmsg->cmsg_type  = SCM_TXTIME;
+        prCmsg->cmsg_len   = CMSG_LEN(sizeof(ULONGLONG));
+        (VOID)memcpy(CMSG_DATA(prCmsg), &prPackets[iCnt].ullLaunchNs, sizeof(ULONGLONG));
+      }
+    }
+
+    iSent = iStart;
+    while (iSent < iEnd)
+    {
+      iRet = sendmmsg
+          (
+            prInst->aiSocketId[prPackets[iStart].iPort],
+            &arMsg[iSent],
+            iEnd - iSent,
+            0
+          );
+      if (iRet <= 0)
+      {
+        RTLX_VERBOSE
+            (
+              0,
+              "Error %d (%s) in NIC-timed transmission on port %d\n",
+              errno,
+              strerror(errno),
+              prPackets[iStart].iPort
+            );
+        return(RTOS_RET_ERROR);
+      }
+      iSent += iRet;
+    }
+
+    iStart = iEnd;
+  }
+
+  return(RTOS_RET_OK);
+}
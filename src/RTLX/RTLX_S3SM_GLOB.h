@@ -109,6 +109,39 @@
  */
 #define RTOS_TIMING_NIC                     (4)
 
+/**
+ * \def     RTOS_MAX_PORTS
+ *
+ * \brief   Number of Sercos ports per instance (P and S).
+ */
+#define RTOS_MAX_PORTS                      (2)
+
+/**
+ * \def     RTOS_TX_BATCH_MAX_PACKETS
+ *
+ * \brief   Maximum number of packets handed over to the kernel with a single
+ *          call in RTLX_TxPacketBatch(). Larger batches are split.
+ */
+#define RTOS_TX_BATCH_MAX_PACKETS           (4 * CSMD_MAX_TEL)
+
+// Macros for the layout of the memory-mapped receive ring. The selection may
+// be done with the macro RTOS_RX_RING_VERSION in RTxx_USER.h
+
+/**
+ * \def     RTOS_RX_RING_V2
+ *
+ * \brief   Receive ring with one slot per frame (TPACKET_V2).
+ */
+#define RTOS_RX_RING_V2                     (2)
+
+/**
+ * \def     RTOS_RX_RING_V3
+ *
+ * \brief   Receive ring with variable-sized frames packed in blocks
+ *          (TPACKET_V3).
+ */
+#define RTOS_RX_RING_V3                     (3)
+
 //---- type definitions -------------------------------------------------------
 
 #define RTOS_TIMERSPEC RTLX_TIMERSPEC
@@ -181,12 +214,29 @@ extern "C" {
 
 // Socket functions (RTLX_S3SM_SOCK.c)
 
+#ifdef RTOS_XDP
+#define         RTOS_OpenTxSocket           RTLX_XdpOpenTxSocket
+#define         RTOS_OpenRxSocket           RTLX_XdpOpenRxSocket
+#define         RTOS_TxPacket               RTLX_XdpTxPacket
+#define         RTOS_TxPacketBatch          RTLX_XdpTxPacketBatch
+#define         RTOS_CloseRxSocket          RTLX_XdpCloseRxSocket
+#define         RTOS_RxPacket               RTLX_XdpRxPacket
+#define         RTOS_CloseTxSocket          RTLX_XdpCloseTxSocket
+#define         RTOS_XdpAllocTxFrame        RTLX_XdpAllocTxFrame
+#else
 #define         RTOS_OpenTxSocket           RTLX_OpenTxSocket
 #define         RTOS_OpenRxSocket           RTLX_OpenRxSocket
 #define         RTOS_TxPacket               RTLX_TxPacket
+#define         RTOS_TxPacketBatch          RTLX_TxPacketBatch
 #define         RTOS_CloseRxSocket          RTLX_CloseRxSocket
 #define         RTOS_RxPacket               RTLX_RxPacket
 #define         RTOS_CloseTxSocket          RTLX_CloseTxSocket
+#endif
+#define         RTOS_SetRxRing              RTLX_SetRxRing
+#define         RTOS_SetNicName             RTLX_SetNicName
+#define         RTOS_GetNicName             RTLX_GetNicName
+#define         RTOS_GetRxTimestamp         RTLX_GetRxTimestamp
+#define         RTOS_GetTxTimestamp         RTLX_GetTxTimestamp
 
 SOURCE INT RTLX_OpenTxSocket
     (
@@ -210,6 +260,18 @@ SOURCE INT RTLX_TxPacket
       USHORT usIFG
     );
 
+SOURCE INT RTLX_TxPacketBatch
+    (
+      INT iInstanceNo,
+      UCHAR** apucFrame,
+      USHORT* ausLen,
+      UCHAR** apucPayload,
+      USHORT* ausPayloadLen,
+      UCHAR* aucPort,
+      USHORT usNum,
+      USHORT usIFG
+    );
+
 SOURCE VOID RTLX_CloseRxSocket
     (
       INT iInstanceNo,
@@ -230,6 +292,101 @@ SOURCE VOID RTLX_CloseTxSocket
       BOOL boRedundancy
     );
 
+SOURCE INT RTLX_SetRxRing
+    (
+      INT iInstanceNo,
+      BOOL boEnable
+    );
+
+SOURCE INT RTLX_SetNicName
+    (
+      INT iInstanceNo,
+      CHAR* pcNicName
+    );
+
+SOURCE CHAR* RTLX_GetNicName
+    (
+      INT iInstanceNo,
+      INT iPort
+    );
+
+SOURCE INT RTLX_GetRxTimestamp
+    (
+      INT iInstanceNo,
+      INT iPort,
+      ULONGLONG* pullTimeNs
+    );
+
+SOURCE INT RTLX_GetTxTimestamp
+    (
+      INT iInstanceNo,
+      INT iPort,
+      ULONGLONG* pullTimeNs
+    );
+
+// AF_XDP functions (RTLX_XDP.c)
+
+SOURCE INT RTLX_XdpOpenTxSocket
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy,
+      UCHAR* pucMAC
+    );
+
+SOURCE INT RTLX_XdpOpenRxSocket
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy
+    );
+
+SOURCE INT RTLX_XdpTxPacket
+    (
+      INT iInstanceNo,
+      INT iPort,
+      UCHAR* pucFrame,
+      USHORT usLen,
+      USHORT usIFG
+    );
+
+SOURCE INT RTLX_XdpTxPacketBatch
+    (
+      INT iInstanceNo,
+      UCHAR** apucFrame,
+      USHORT* ausLen,
+      UCHAR** apucPayload,
+      USHORT* ausPayloadLen,
+      UCHAR* aucPort,
+      USHORT usNum,
+      USHORT usIFG
+    );
+
+SOURCE VOID RTLX_XdpCloseRxSocket
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy
+    );
+
+SOURCE INT RTLX_XdpRxPacket
+    (
+      INT iInstanceNo,
+      INT iPort,
+      UCHAR* pucFrame,
+      UCHAR** ppucFrame
+    );
+
+SOURCE VOID RTLX_XdpCloseTxSocket
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy
+    );
+
+SOURCE VOID* RTLX_XdpAllocTxFrame
+    (
+      INT iInstanceNo,
+      INT iPort,
+      ULONG ulSize
+    );
+
 // Timing functions (RTLX_S3SM_TIME.c)
 
 #define         RTOS_NanoSleepRel           RTLX_NanoSleepRel
@@ -239,6 +396,7 @@ SOURCE VOID RTLX_CloseTxSocket
 #define         RTOS_SetTimerTime           RTLX_SetTimerTime
 #define         RTOS_CloseTimer             RTLX_CloseTimer
 #define         RTOS_CyclesToTime           RTLX_CyclesToTime
+#define         RTOS_GetOverruns            RTLX_GetOverruns
 
 SOURCE VOID RTLX_NanoSleepRel
     (
@@ -280,12 +438,19 @@ SOURCE VOID RTLX_CyclesToTime
       RTLX_TIMESPEC *tReqCycle
     );
 
+SOURCE ULONG RTLX_GetOverruns
+    (
+      INT iInstanceNo
+    );
+
 // Functions for Nic-based timing transmission (RTLX_NIC_TIMED.c)
 
 #define         RTOS_InitTimerNic          RTLX_InitTimerNic
 #define         RTOS_CloseTimerNic         RTLX_CloseTimerNic
 #define         RTOS_SetTimerNic           RTLX_SetTimerNic
 #define         RTOS_TxPacketsNicTimed     RTLX_TxPacketsNicTimed
+#define         RTOS_InitNicTimedTransmission   RTLX_InitNicTimedTransmission
+#define         RTOS_CloseNicTimedTransmission  RTLX_CloseNicTimedTransmission
 
 SOURCE INT RTLX_InitTimerNic
     (
@@ -326,12 +491,6 @@ SOURCE VOID RTLX_CloseNicTimedTransmission
       BOOL boRedundancy
     );
 
-SOURCE INT RTLX_SetNicName
-    (
-      INT iInstanceNo,
-      CHAR* pcNicName
-    );
-
 
 // Functions for UCC support (RTLX_S3SM_UCC.c)
 
@@ -121,6 +121,31 @@
  */
 #define RTOS_NANOSLEEP_CORR_FACTOR          (0.2)
 
+/**
+ * \def     RTOS_NANOSLEEP_DYN_CORR
+ *
+ * \brief   If activated, the timing correction value of timing mode
+ *          RTOS_TIMING_REL_NANOSLEEP_COMP is adapted after each correction
+ *          interval (RTOS_NANOSLEEP_CORR_INTERVAL).
+ */
+#define RTOS_NANOSLEEP_DYN_CORR
+
+/**
+ * \def     RTOS_NANOSLEEP_SPIN_NS
+ *
+ * \brief   Initial time in ns before a deadline at which the sleeping thread
+ *          is woken up in order to spin until the deadline. The time is
+ *          calibrated to the observed wake-up latency at runtime.
+ */
+#define RTOS_NANOSLEEP_SPIN_NS              (20 * 1000)
+
+/**
+ * \def     RTOS_NANOSLEEP_SPIN_MAX_NS
+ *
+ * \brief   Upper limit of the calibrated spin time in ns.
+ */
+#define RTOS_NANOSLEEP_SPIN_MAX_NS          (100 * 1000)
+
 /**
  * \def     RTOS_UCC_MAX_PACKETS
  *
@@ -136,6 +161,15 @@
  */
 #define RTOS_TIME_SHIFT_NIC_TIMED           (200 * 1000)
 
+/**
+ * \def     RTOS_NIC_TIMED_CLOCK
+ *
+ * \brief   Clock used for the NIC timer and packet launch times in NIC-timed
+ *          transmission mode. Needs to match the clock configured in the ETF
+ *          or taprio queueing discipline (CLOCK_TAI).
+ */
+#define RTOS_NIC_TIMED_CLOCK                (CLOCK_TAI)
+
 /**
  * \def     RTOS_FILTER_SERCOS_ETHERTYPE
  *
@@ -145,6 +179,84 @@
  */
 #undef RTOS_FILTER_SERCOS_ETHERTYPE
 
+/**
+ * \def     RTOS_RX_FILTER
+ *
+ * \brief   If activated, a BPF program is attached to the receive sockets
+ *          that drops all packets other than Sercos telegrams and, without
+ *          RTOS_FILTER_SERCOS_ETHERTYPE, packets for the UC channel (unicast
+ *          to the adapter, broadcast and multicast) in the kernel.
+ *
+ * \attention Unicast packets for the UC channel are only accepted for the
+ *            MAC address of the adapter. If the UC channel uses a different
+ *            MAC address, its unicast packets are dropped without notice.
+ */
+#undef RTOS_RX_FILTER
+
+/**
+ * \def     RTOS_RX_FILTER_OUTGOING
+ *
+ * \brief   If activated together with RTOS_RX_FILTER, packets transmitted by
+ *          this host, e.g. the own MDTs, are not received on the port.
+ */
+#undef RTOS_RX_FILTER_OUTGOING
+
+/**
+ * \def     RTOS_RX_BUSY_POLL_US
+ *
+ * \brief   If larger than 0, busy polling of the adapter (SO_BUSY_POLL) is
+ *          requested for the receive sockets for the given time in us. Only
+ *          effective for adapters whose drivers support busy polling, and
+ *          only without receive ring. See also SICE_RX_BUSY_POLL.
+ */
+#define RTOS_RX_BUSY_POLL_US                (0)
+
+/**
+ * \def     RTOS_XDP
+ *
+ * \brief   If activated, the Sercos telegrams are transmitted and received
+ *          with AF_XDP sockets (RTLX_XDP.c) instead of raw packet sockets.
+ *          The emulated IP core builds its telegrams directly in the UMEM.
+ *          Requires a kernel with AF_XDP support and CAP_NET_ADMIN/CAP_BPF.
+ *          Packets of the adapter's other queues are not received, so the
+ *          Sercos traffic needs to be steered to RTOS_XDP_QUEUE (e.g. with
+ *          ethtool) on multi-queue adapters.
+ */
+#undef RTOS_XDP
+
+/**
+ * \def     RTOS_XDP_QUEUE
+ *
+ * \brief   Adapter queue the AF_XDP sockets are bound to.
+ */
+#define RTOS_XDP_QUEUE                      (0)
+
+/**
+ * \def     RTOS_XDP_DRV_MODE
+ *
+ * \brief   If activated, the XDP program runs in the driver (native mode),
+ *          otherwise in generic mode, which works with every adapter.
+ */
+#undef RTOS_XDP_DRV_MODE
+
+/**
+ * \def     RTOS_XDP_ZEROCOPY
+ *
+ * \brief   If activated, the AF_XDP sockets are bound in zero-copy mode.
+ *          Requires RTOS_XDP_DRV_MODE and driver support.
+ */
+#undef RTOS_XDP_ZEROCOPY
+
+/**
+ * \def     RTOS_MAX_INSTANCES
+ *
+ * \brief   Maximum number of Sercos master instances. Each instance uses its
+ *          own network adapter(s), which are assigned at runtime using
+ *          RTLX_SetNicName(). Without assignment, the first instance uses
+ *          eth0 for port P and eth1 for port S.
+ */
+#define RTOS_MAX_INSTANCES                  (2)
+
 /**
  * \def     RTOS_BIND_NIC
  *
@@ -152,6 +264,115 @@
  */
 #define RTOS_BIND_NIC
 
+/**
+ * \def     RTOS_RX_RING
+ *
+ * \brief   If activated, Sercos packets are received through a memory-mapped
+ *          AF_PACKET receive ring (PACKET_MMAP) instead of one recvfrom() call
+ *          per packet. RTLX_RxPacket() then returns a pointer into the ring.
+ *          The ring may be switched off per instance at initialization time
+ *          using RTLX_SetRxRing(). In case the ring cannot be set up, the
+ *          socket falls back to recvfrom().
+ */
+#undef RTOS_RX_RING
+
+/**
+ * \def     RTOS_RX_RING_VERSION
+ *
+ * \brief   Layout used for the receive ring, either RTOS_RX_RING_V2 or
+ *          RTOS_RX_RING_V3. V2 hands over each frame as soon as it has
+ *          been received. V3 hands over whole blocks, which are
+ *          released by the kernel when full or when RTOS_RX_RING_BLOCK_TMO
+ *          expires, adding up to that time of latency.
+ */
+#define RTOS_RX_RING_VERSION                (RTOS_RX_RING_V2)
+
+/**
+ * \def     RTOS_RX_RING_BLOCK_SIZE
+ *
+ * \brief   Size of a receive ring block in bytes. Needs to be a multiple of
+ *          the page size and of RTOS_RX_RING_FRAME_SIZE.
+ */
+#define RTOS_RX_RING_BLOCK_SIZE             (4096)
+
+/**
+ * \def     RTOS_RX_RING_BLOCK_NUM
+ *
+ * \brief   Number of blocks of the receive ring per port.
+ */
+#define RTOS_RX_RING_BLOCK_NUM              (64)
+
+/**
+ * \def     RTOS_RX_RING_FRAME_SIZE
+ *
+ * \brief   Size of a receive ring frame slot in bytes, including the packet
+ *          header of the kernel. Needs to hold a frame of maximum size.
+ */
+#define RTOS_RX_RING_FRAME_SIZE             (2048)
+
+/**
+ * \def     RTOS_RX_RING_BLOCK_TMO
+ *
+ * \brief   Block retire timeout in ms, only used for RTOS_RX_RING_V3.
+ */
+#define RTOS_RX_RING_BLOCK_TMO              (1)
+
+/**
+ * \def     RTOS_TIMESTAMPING
+ *
+ * \brief   If activated, transmit and receive timestamps are requested for
+ *          the Sercos sockets (SO_TIMESTAMPING), see RTLX_GetTxTimestamp() and
+ *          RTLX_GetRxTimestamp().
+ */
+#undef RTOS_TIMESTAMPING
+
+/**
+ * \def     RTOS_TIMESTAMPING_HW
+ *
+ * \brief   If activated together with RTOS_TIMESTAMPING, hardware
+ *          timestamping is switched on in the adapters. Software timestamps
+ *          are used for adapters without support. In ring topology with two
+ *          adapters, their clocks need to be synchronized (e.g. phc2sys).
+ */
+#undef RTOS_TIMESTAMPING_HW
+
+/**
+ * \def     RTOS_TX_RING
+ *
+ * \brief   If activated, packets are transmitted through a memory-mapped
+ *          AF_PACKET transmit ring (PACKET_TX_RING). All packets of a batch
+ *          (RTLX_TxPacketBatch()) are then handed over to the kernel with a
+ *          single system call. If the ring cannot be set up, sendmmsg() is
+ *          used for batches instead.
+ */
+#undef RTOS_TX_RING
+
+/**
+ * \def     RTOS_TX_RING_FRAME_NUM
+ *
+ * \brief   Number of frame slots of the transmit ring. Needs to be a multiple
+ *          of the number of frames per block (RTOS_TX_RING_BLOCK_SIZE /
+ *          RTOS_TX_RING_FRAME_SIZE) and larger than the number of packets
+ *          per Sercos cycle.
+ */
+#define RTOS_TX_RING_FRAME_NUM              (64)
+
+/**
+ * \def     RTOS_TX_RING_BLOCK_SIZE
+ *
+ * \brief   Size of a transmit ring block in bytes. Needs to be a multiple of
+ *          the page size and of RTOS_TX_RING_FRAME_SIZE.
+ */
+#define RTOS_TX_RING_BLOCK_SIZE             (4096)
+
+/**
+ * \def     RTOS_TX_RING_FRAME_SIZE
+ *
+ * \brief   Size of a transmit ring frame slot in bytes, including the packet
+ *          header of the kernel. Needs to hold a frame of maximum size.
+ */
+#define RTOS_TX_RING_FRAME_SIZE             (2048)
+
 //---- type definitions -------------------------------------------------------
 
 //---- variable declarations --------------------------------------------------
@@ -22,6 +22,9 @@
 
 //---- includes ---------------------------------------------------------------
 
+#include <errno.h>
+#include <time.h>
+
 #define SOURCE_RTLX
 
 #include "../RTLX/RTLX_GLOB.h"
@@ -160,6 +163,59 @@ INT RTLX_TrySemaphore
   }
 }
 
+/**
+ * \fn INT RTLX_WaitForSemaphoreTimeout(
+ *              RTLX_SEMAPHORE *pSem,
+ *              ULONG ulTimeoutMs
+ *          )
+ *
+ * \brief   Waits for semaphore to be freed, at most for the given time
+ *
+ * \param[in]   pSem        Pointer to RTLX_SEMAPHORE
+ * \param[in]   ulTimeoutMs Maximum waiting time in ms
+ *
+ * \return
+ * - 0: Success
+ * - Error otherwise, also if the time has elapsed
+ *
+ * \ingroup RTLX
+ */
+INT RTLX_WaitForSemaphoreTimeout
+    (
+      RTLX_SEMAPHORE *pSem,
+      ULONG ulTimeoutMs
+    )
+{
+  struct timespec rTimeout;
+  INT iRet = 0;
+
+  // sem_timedwait() expects an absolute time of CLOCK_REALTIME
+  (VOID)clock_gettime(CLOCK_REALTIME, &rTimeout);
+
+  rTimeout.tv_sec  += (time_t)(ulTimeoutMs / 1000);
+  rTimeout.tv_nsec += (long)(ulTimeoutMs % 1000) * 1000000L;
+  if (rTimeout.tv_nsec >= 1000000000L)
+  {
+    rTimeout.tv_sec++;
+    rTimeout.tv_nsec -= 1000000000L;
+  }
+
+  do
+  {
+    iRet = sem_timedwait(pSem, &rTimeout);
+  }
+  while ((iRet != 0) && (errno == EINTR));
+
+  if (iRet == 0)
+  {
+    return(RTOS_RET_OK);
+  }
+  else
+  {
+    return(RTOS_RET_ERROR);
+  }
+}
+
 /**
  * \fn INT RTLX_PostSemaphore(
  *              RTLX_SEMAPHORE *pSem
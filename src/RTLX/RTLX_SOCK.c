@@ -23,13 +23,21 @@
 
 #define SOURCE_RTLX
 
+#define _GNU_SOURCE
+
 /*lint -save -w0 */
 #include <sys/socket.h>
+#include <net/if.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <asm-generic/errno-base.h>
 #include <errno.h>
+#include <linux/net_tstamp.h>
+#include <linux/sockios.h>
+#include <linux/errqueue.h>
+#include <linux/filter.h>
 /*lint -restore */
 
 #include "../RTLX/RTLX_GLOB.h"
@@ -42,7 +50,9 @@
 
 //---- defines ----------------------------------------------------------------
 
-#define RTLX_MAX_SOCKET_INSTANCES  (1)
+#define RTLX_BPF_MAX_INSTR      (16)        /**< Maximum length of receive filter */
+#define RTLX_BPF_ACCEPT         (0xFE)      /**< Jump placeholder: accept packet */
+#define RTLX_BPF_DROP           (0xFF)      /**< Jump placeholder: drop packet */
 
 //---- type definitions -------------------------------------------------------
 
@@ -52,17 +62,119 @@ typedef struct
 	INT                iRxSocketId;         /**< TX socket handle */
 	INT                iTxSocketId;         /**< RX socket handle */
 	CHAR               acName[IFNAMSIZ];    /**< Interface name */
+#ifdef RTOS_RX_RING
+	BOOL               boNoRxRing;          /**< RX ring switched off */
+	UCHAR*             pucRxRing;           /**< Mapped RX ring, NULL if not used */
+	size_t             ulRxRingSize;        /**< Size of mapped RX ring */
+	ULONG              ulRxRingNum;         /**< Number of ring slots (frames for V2, blocks for V3) */
+	ULONG              ulRxRingSlotSize;    /**< Size of a ring slot */
+	ULONG              ulRxRingIdx;         /**< Current ring slot */
+	UCHAR*             pucRxRingPkt;        /**< V3: Current packet within block */
+	ULONG              ulRxRingPktLeft;     /**< V3: Packets left in current block */
+	BOOL               boRxRingPending;     /**< Frame handed out, release on next call */
+#endif
+#ifdef RTOS_TX_RING
+	UCHAR*             pucTxRing;           /**< Mapped TX ring, NULL if not used */
+	size_t             ulTxRingSize;        /**< Size of mapped TX ring */
+	ULONG              ulTxRingIdx;         /**< Next TX ring frame slot */
+#endif
+#ifdef RTOS_TIMESTAMPING
+	BOOL               boHwStamp;           /**< Hardware timestamps in use */
+	ULONGLONG          ullRxStampNs;        /**< Timestamp of last received packet, 0 if none */
+#endif
+} RTLX_SOCKET_PORT;
+
+typedef struct
+{
+	RTLX_SOCKET_PORT   arPort[RTOS_MAX_PORTS];  /**< Sockets of Sercos ports P and S */
+	INT                iNumTxPorts;         /**< Number of opened TX sockets */
+	INT                iNumRxPorts;         /**< Number of opened RX sockets */
 } RTLX_SOCKET_INSTANCE;
 
 //---- variable declarations --------------------------------------------------
 
-// Structure with socket instances. Initialization of the socket names.
-static RTLX_SOCKET_INSTANCE RTLX_SocketInstances[RTLX_MAX_SOCKET_INSTANCES] =
-{{.acName = {"eth0"}}
+// Structure with socket instances. Initialization of the default interface
+// names of the first instance, all others are set with RTLX_SetNicName().
+static RTLX_SOCKET_INSTANCE RTLX_SocketInstances[RTOS_MAX_INSTANCES] =
+{
+		{.arPort = {{.acName = {"eth0"}}, {.acName = {"eth1"}}}}
 };
 
 //---- function declarations --------------------------------------------------
 
+static INT RTLX_OpenTxPort
+(
+		RTLX_SOCKET_PORT* prSocket,
+		UCHAR* pucMAC
+);
+
+static INT RTLX_TxPortPackets
+(
+		RTLX_SOCKET_PORT* prSocket,
+		UCHAR** apucFrame,
+		USHORT* ausLen,
+		UCHAR** apucPayload,
+		USHORT* ausPayloadLen,
+		USHORT usNum
+);
+
+#ifdef RTOS_TIMESTAMPING
+static VOID RTLX_EnableTimestamping
+(
+		RTLX_SOCKET_PORT* prSocket,
+		INT iSocketId,
+		BOOL boTx
+);
+
+static ULONGLONG RTLX_GetCmsgTimestamp
+(
+		RTLX_SOCKET_PORT* prSocket,
+		struct msghdr* prMsg
+);
+#endif
+
+#ifdef RTOS_RX_FILTER
+static INT RTLX_AttachRxFilter
+(
+		RTLX_SOCKET_PORT* prSocket
+);
+#endif
+
+#ifdef RTOS_RX_RING
+static INT RTLX_OpenRxRing
+(
+		RTLX_SOCKET_PORT* prSocket
+);
+
+static VOID RTLX_CloseRxRing
+(
+		RTLX_SOCKET_PORT* prSocket
+);
+
+static INT RTLX_RxRingPacket
+(
+		RTLX_SOCKET_PORT* prSocket,
+		UCHAR** ppucFrame
+);
+#endif
+
+#ifdef RTOS_TX_RING
+static INT RTLX_OpenTxRing
+(
+		RTLX_SOCKET_PORT* prSocket
+);
+
+static INT RTLX_TxRingPackets
+(
+		RTLX_SOCKET_PORT* prSocket,
+		UCHAR** apucFrame,
+		USHORT* ausLen,
+		UCHAR** apucPayload,
+		USHORT* ausPayloadLen,
+		USHORT usNum
+);
+#endif
+
 //---- function implementations -----------------------------------------------
 INT RTLX_Init
 (
@@ -83,6 +195,106 @@ INT RTLX_Close
 	return(RTOS_RET_OK);
 }
 
+/**
+ * \fn INT RTLX_SetNicName(
+ *              INT iInstanceNo,
+ *              CHAR* pcNicName
+ *          )
+ *
+ * \brief   Sets the network adapter(s) of an instance. Needs to be called
+ *          before the sockets of the instance are opened.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   pcNicName   Interface name of port P, optionally followed by
+ *                          ',' and the interface name of port S
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_SetNicName
+(
+		INT iInstanceNo,
+		CHAR* pcNicName
+)
+{
+	CHAR* pcSep = NULL;
+	INT   iLen  = 0;
+
+	if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) || (pcNicName == NULL))
+	{
+		RTLX_VERBOSE
+		(
+				0,
+				"RTLX_SetNicName() instance %d too large, only %d available\n",
+				iInstanceNo,
+				RTOS_MAX_INSTANCES
+		);
+		return(RTOS_RET_ERROR);
+	}
+
+	pcSep = strchr(pcNicName, ',');
+	iLen  = (pcSep != NULL) ? (INT)(pcSep - pcNicName) : (INT)strlen(pcNicName);
+
+	if (
+			(iLen == 0) || (iLen >= IFNAMSIZ) ||
+			((pcSep != NULL) && ((strlen(pcSep + 1) == 0) || (strlen(pcSep + 1) >= IFNAMSIZ)))
+	)
+	{
+		RTLX_VERBOSE(0, "Error: Invalid adapter name(s) \"%s\"\n", pcNicName);
+		return(RTOS_RET_ERROR);
+	}
+
+	(VOID)memset(RTLX_SocketInstances[iInstanceNo].arPort[0].acName, 0, IFNAMSIZ);
+	(VOID)memcpy(RTLX_SocketInstances[iInstanceNo].arPort[0].acName, pcNicName, iLen);
+
+	// Without a second adapter, both ports refer to the same one
+	(VOID)memset(RTLX_SocketInstances[iInstanceNo].arPort[1].acName, 0, IFNAMSIZ);
+	(VOID)strcpy
+			(
+					RTLX_SocketInstances[iInstanceNo].arPort[1].acName,
+					(pcSep != NULL) ? (pcSep + 1) : RTLX_SocketInstances[iInstanceNo].arPort[0].acName
+			);
+
+	return(RTOS_RET_OK);
+}
+
+/**
+ * \fn CHAR* RTLX_GetNicName(
+ *              INT iInstanceNo,
+ *              INT iPort
+ *          )
+ *
+ * \brief   Returns the name of the network adapter of a port.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   iPort       Port number
+ *
+ * \return  Interface name, 'NULL' for invalid instance or port
+ *
+ * \ingroup RTLX
+ *
+ */
+CHAR* RTLX_GetNicName
+(
+		INT iInstanceNo,
+		INT iPort
+)
+{
+	if (
+			(iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) ||
+			(iPort < 0) || (iPort >= RTOS_MAX_PORTS)
+	)
+	{
+		return(NULL);
+	}
+
+	return(RTLX_SocketInstances[iInstanceNo].arPort[iPort].acName);
+}
+
 /**
  * \fn INT RTLX_OpenTxSocket(
  *              INT iInstanceNo,
@@ -92,9 +304,11 @@ INT RTLX_Close
  *
  * \param[in]   iInstanceNo     Sercos IP core emulation instance number
  * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
- * \param[out]  pucMAC          MAC address
+ * \param[out]  pucMAC          MAC address of port P
  *
- * \brief   Opens raw Ethernet transmit socket and retrieves MAC address.
+ * \brief   Opens raw Ethernet transmit socket(s) and retrieves MAC address.
+ *          With redundancy, one socket per port is opened on the adapter of
+ *          the port.
  *
  * \todo    Take care of inter-frame gap. Possible outside of driver?
  *
@@ -111,95 +325,58 @@ INT RTLX_OpenTxSocket
 		UCHAR* pucMAC
 )
 {
+	UCHAR aucPortMAC[ETH_ALEN];
+	INT   iPortCnt = 1;
+	INT   iPort    = 0;
 
-
-	struct  ifreq rIfReq;
-	UCHAR   *pucTempMAC;
-
-	if (iInstanceNo > RTLX_MAX_SOCKET_INSTANCES)
+	if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
 	{
 		RTLX_VERBOSE
 		(
 				0,
 				"RTLX_OpenTxSocket() instance %d too large, only %d available\n",
 				iInstanceNo,
-				RTLX_MAX_SOCKET_INSTANCES
+				RTOS_MAX_INSTANCES
 		);
 		return(RTOS_RET_ERROR);
 	}
 
-	// Socket descriptor
-	RTLX_SocketInstances[iInstanceNo].iTxSocketId = socket
-			(
-					AF_PACKET,                  // Packet mode
-					SOCK_RAW,                   // Raw socket
-#ifdef RTOS_FILTER_SERCOS_ETHERTYPE
-					htons(SICE_SIII_ETHER_TYPE) // Sercos ether type
-#else
-					htons(ETH_P_ALL)
-#endif
-			);
-
-	if (RTLX_SocketInstances[iInstanceNo].iTxSocketId == -1)
+	if (boRedundancy)
 	{
-		return(RTOS_RET_ERROR);
+		iPortCnt = 2;
 	}
-	else
-	{
-		// Communication family, always AF_PACKET
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_family = AF_PACKET;
-
-		// Physical protocol, set to Sercos ether type
-#ifdef RTOS_FILTER_SERCOS_ETHERTYPE
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_protocol = htons(SICE_SIII_ETHER_TYPE);
-#endif
-
-#ifdef RTOS_BIND_NIC
-		// Index of network device, hard-coded to first hardware device
-		//RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_ifindex = 2;
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_ifindex =
-				if_nametoindex(RTLX_SocketInstances[iInstanceNo].acName);
-#endif
-
-		// Header type
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_hatype = ARPHRD_ETHER;
-
-		// Packet type
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_pkttype = PACKET_OTHERHOST;
-
-		// Length of address
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_halen = ETH_ALEN;
-
-		// Get hardware MAC address (\todo: correct?)
-		ioctl
-		(
-				RTLX_SocketInstances[iInstanceNo].iTxSocketId,
-				SIOCGIFHWADDR,
-				&rIfReq
-		);
 
-		// Set hardware MAC address to Ethernet source address
-		pucTempMAC = (UCHAR *)rIfReq.ifr_hwaddr.sa_data;
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_addr[0] = pucTempMAC[0];
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_addr[1] = pucTempMAC[1];
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_addr[2] = pucTempMAC[2];
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_addr[3] = pucTempMAC[3];
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_addr[4] = pucTempMAC[4];
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_addr[5] = pucTempMAC[5];
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_addr[6] = 0x00; // not used
-		RTLX_SocketInstances[iInstanceNo].rTxSocketAddress.sll_addr[7] = 0x00; // not used
-
-		// Return obtained MAC address of adapter
-		(VOID)memcpy
+	for (
+			iPort = 0;
+			iPort < iPortCnt;
+			iPort ++
+	)
+	{
+		if (
+				RTLX_OpenTxPort
 				(
-						pucMAC,
-						pucTempMAC,
-						6
-				);
+						&RTLX_SocketInstances[iInstanceNo].arPort[iPort],
+						(iPort == 0) ? pucMAC : aucPortMAC
+				) != RTOS_RET_OK
+		)
+		{
+			RTLX_VERBOSE
+			(
+					0,
+					"Error opening transmit socket for port %d on %s\n",
+					iPort,
+					RTLX_SocketInstances[iInstanceNo].arPort[iPort].acName
+			);
+			// Close sockets of preceding ports
+			RTLX_SocketInstances[iInstanceNo].iNumTxPorts = iPort;
+			RTLX_CloseTxSocket(iInstanceNo, boRedundancy);
+			return(RTOS_RET_ERROR);
+		}
 	}
-	return(RTOS_RET_OK);
 
+	RTLX_SocketInstances[iInstanceNo].iNumTxPorts = iPortCnt;
 
+	return(RTOS_RET_OK);
 }
 
 /**
@@ -211,7 +388,7 @@ INT RTLX_OpenTxSocket
  * \param[in]   iInstanceNo     Sercos IP core emulation instance number
  * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
  *
- * \brief   Closes transmit socket
+ * \brief   Closes transmit socket(s)
  *
  */
 VOID RTLX_CloseTxSocket
@@ -220,21 +397,45 @@ VOID RTLX_CloseTxSocket
 		BOOL boRedundancy
 )
 {
+	RTLX_SOCKET_PORT* prSocket = NULL;
+	INT               iPort    = 0;
 
-	if (iInstanceNo >= RTLX_MAX_SOCKET_INSTANCES)
+	if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
 	{
 		RTLX_VERBOSE
 		(
 				0,
 				"RTLX_CloseTxSocket() instance %d too large, only %d available\n",
 				iInstanceNo,
-				RTLX_MAX_SOCKET_INSTANCES
+				RTOS_MAX_INSTANCES
 		);
+		return;
 	}
 
-	close(RTLX_SocketInstances[iInstanceNo].iTxSocketId);
+	for (
+			iPort = 0;
+			iPort < RTLX_SocketInstances[iInstanceNo].iNumTxPorts;
+			iPort ++
+	)
+	{
+		prSocket = &RTLX_SocketInstances[iInstanceNo].arPort[iPort];
+
+#ifdef RTOS_TX_RING
+		if (prSocket->pucTxRing != NULL)
+		{
+			(VOID)munmap
+					(
+							prSocket->pucTxRing,
+							prSocket->ulTxRingSize
+					);
+			prSocket->pucTxRing = NULL;
+		}
+#endif
 
+		(VOID)close(prSocket->iTxSocketId);
+	}
 
+	RTLX_SocketInstances[iInstanceNo].iNumTxPorts = 0;
 }
 
 /**
@@ -243,7 +444,7 @@ VOID RTLX_CloseTxSocket
  *              BOOL boRedundancy
  *          )
  *
- * \brief   Opens raw Ethernet receive socket
+ * \brief   Opens raw Ethernet receive socket(s), one per port
  *
  * \param[in]   iInstanceNo     Sercos IP core emulation instance number
  * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
@@ -261,10 +462,11 @@ INT RTLX_OpenRxSocket
 		BOOL boRedundancy
 )
 {
-	INT iFlags   = 0;
-	INT iRet     = 0;
-	INT iPortCnt = 1;
-	INT iPort    = 0;
+	RTLX_SOCKET_PORT*  prSocket = NULL;
+	INT                iFlags   = 0;
+	INT                iRet     = 0;
+	INT                iPortCnt = 1;
+	INT                iPort    = 0;
 	struct sockaddr_ll rSockAddr;
 
 	if (boRedundancy)
@@ -272,13 +474,14 @@ INT RTLX_OpenRxSocket
 		iPortCnt = 2;
 	}
 
-	if (iPortCnt * iInstanceNo >= RTLX_MAX_SOCKET_INSTANCES)
+	if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
 	{
 		RTLX_VERBOSE
 		(
 				0,
-				"RTLX_OpenRxSocket() instance %d too large\n",
-				iInstanceNo
+				"RTLX_OpenRxSocket() instance %d too large, only %d available\n",
+				iInstanceNo,
+				RTOS_MAX_INSTANCES
 		);
 		return(RTOS_RET_ERROR);
 	}
@@ -289,9 +492,10 @@ INT RTLX_OpenRxSocket
 			iPort ++
 	)
 	{
+		prSocket = &RTLX_SocketInstances[iInstanceNo].arPort[iPort];
 
 		// Socket descriptor
-		RTLX_SocketInstances[2*iInstanceNo + iPort].iRxSocketId = socket
+		prSocket->iRxSocketId = socket
 				(
 						AF_PACKET,                    // Packet-based socket
 						SOCK_RAW,                     // Raw Ethernet socket
@@ -302,7 +506,7 @@ INT RTLX_OpenRxSocket
 #endif
 				);
 
-		if (RTLX_SocketInstances[2*iInstanceNo + iPort].iRxSocketId < 0)
+		if (prSocket->iRxSocketId < 0)
 		{
 			RTLX_VERBOSE
 			(
@@ -313,15 +517,19 @@ INT RTLX_OpenRxSocket
 					iPort
 			);
 
+			// Close sockets of preceding ports
+			RTLX_SocketInstances[iInstanceNo].iNumRxPorts = iPort;
+			RTLX_CloseRxSocket(iInstanceNo, boRedundancy);
 			return(RTOS_RET_ERROR);
 		}
 		else
 		{
+			RTLX_SocketInstances[iInstanceNo].iNumRxPorts = iPort + 1;
+
 			iFlags = fcntl
 					(
-							RTLX_SocketInstances[2*iInstanceNo + iPort].iRxSocketId,
-							// Socket
-							F_GETFL                                         // Get flags command
+							prSocket->iRxSocketId,      // Socket
+							F_GETFL                     // Get flags command
 					);
 
 			// Activate non-blocking mode
@@ -329,11 +537,101 @@ INT RTLX_OpenRxSocket
 
 			(VOID)fcntl
 					(
-							RTLX_SocketInstances[2*iInstanceNo + iPort].iRxSocketId,
-							// Socket
-							F_SETFL,                                        // Set flags command
-							iFlags                                          // Flags
+							prSocket->iRxSocketId,      // Socket
+							F_SETFL,                    // Set flags command
+							iFlags                      // Flags
+					);
+
+#ifdef RTOS_RX_FILTER
+			// Drop non-Sercos traffic in the kernel
+			if (RTLX_AttachRxFilter(prSocket) != RTOS_RET_OK)
+			{
+				RTLX_VERBOSE
+				(
+						0,
+						"Warning: Receive filter not available for port %d\n",
+						iPort
+				);
+			}
+#endif
+
+#if (RTOS_RX_BUSY_POLL_US > 0)
+			// Poll adapter directly when receiving
+			iFlags = RTOS_RX_BUSY_POLL_US;
+
+			if (setsockopt(prSocket->iRxSocketId, SOL_SOCKET, SO_BUSY_POLL, &iFlags, sizeof(iFlags)) < 0)
+			{
+				RTLX_VERBOSE
+				(
+						0,
+						"Warning: Busy polling not available for port %d (%s)\n",
+						iPort,
+						strerror(errno)
+				);
+			}
+#endif
+
+#ifdef RTOS_RX_RING
+			// Set up ring before binding, so that no packet is queued
+			// outside of the ring
+			if (!prSocket->boNoRxRing)
+			{
+				if (RTLX_OpenRxRing(prSocket) != RTOS_RET_OK)
+				{
+					RTLX_VERBOSE
+					(
+							0,
+							"Warning: RX ring not available for port %d, using recvfrom()\n",
+							iPort
+					);
+				}
+			}
+#endif
+
+#ifdef RTOS_TIMESTAMPING
+			RTLX_EnableTimestamping(prSocket, prSocket->iRxSocketId, FALSE);
+#endif
+
+#ifdef RTOS_BIND_NIC
+			// Receive from adapter of port only
+			(VOID)memset(&rSockAddr, 0, sizeof(rSockAddr));
+			rSockAddr.sll_family   = AF_PACKET;
+#ifdef RTOS_FILTER_SERCOS_ETHERTYPE
+			rSockAddr.sll_protocol = htons(SICE_SIII_ETHER_TYPE);
+#else
+			rSockAddr.sll_protocol = htons(ETH_P_ALL);
+#endif
+			rSockAddr.sll_ifindex  = if_nametoindex(prSocket->acName);
+			if (rSockAddr.sll_ifindex == 0)
+			{
+				// Index 0 would receive from all adapters
+				RTLX_VERBOSE(0, "Error: Network adapter \"%s\" not found\n", prSocket->acName);
+				RTLX_CloseRxSocket(iInstanceNo, boRedundancy);
+				return(RTOS_RET_ERROR);
+			}
+
+			iRet = bind
+					(
+							prSocket->iRxSocketId,
+							(struct sockaddr*) &rSockAddr,
+							sizeof(rSockAddr)
 					);
+			if (iRet < 0)
+			{
+				RTLX_VERBOSE
+				(
+						0,
+						"Error %d (%s) binding receive socket for port %d to %s\n",
+						errno,
+						strerror(errno),
+						iPort,
+						prSocket->acName
+				);
+
+				RTLX_CloseRxSocket(iInstanceNo, boRedundancy);
+				return(RTOS_RET_ERROR);
+			}
+#endif
 		}
 	}  // for all ports
 
@@ -349,7 +647,7 @@ INT RTLX_OpenRxSocket
  * \param[in]   iInstanceNo     Sercos IP core emulation instance number
  * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
  *
- * \brief   Closes receive socket
+ * \brief   Closes receive socket(s)
  *
  */
 VOID RTLX_CloseRxSocket
@@ -358,33 +656,33 @@ VOID RTLX_CloseRxSocket
 		BOOL boRedundancy
 )
 {
-	INT iPortCnt = 1;
-	INT iPort    = 0;
-
-
-	if (boRedundancy)
-	{
-		iPortCnt = 2;
-	}
+	INT iPort = 0;
 
-	if (iPortCnt * iInstanceNo >= RTLX_MAX_SOCKET_INSTANCES)
+	if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
 	{
 		RTLX_VERBOSE
 		(
 				0,
 				"RTLX_CloseRxSocket() instance %d too large, only %d available\n",
 				iInstanceNo,
-				RTLX_MAX_SOCKET_INSTANCES
+				RTOS_MAX_INSTANCES
 		);
+		return;
 	}
+
 	for (
 			iPort = 0;
-			iPort < iPortCnt;
+			iPort < RTLX_SocketInstances[iInstanceNo].iNumRxPorts;
 			iPort ++
 	)
 	{
-		(VOID)close(RTLX_SocketInstances[2*iInstanceNo + iPort].iRxSocketId);
+#ifdef RTOS_RX_RING
+		RTLX_CloseRxRing(&RTLX_SocketInstances[iInstanceNo].arPort[iPort]);
+#endif
+		(VOID)close(RTLX_SocketInstances[iInstanceNo].arPort[iPort].iRxSocketId);
 	}
+
+	RTLX_SocketInstances[iInstanceNo].iNumRxPorts = 0;
 }
 
 /**
@@ -405,7 +703,8 @@ VOID RTLX_CloseRxSocket
  * \param[in]   usIFG       Required inter frame gap
  *
  * \note    Tx socket needs to be opened using RTLX_OpenRxSocket() before using
- *          this function.
+ *          this function. Without redundancy, only port P is opened and a
+ *          packet for port S is rejected.
  *
  * \note    Inter frame gap not yet taken into account
  *
@@ -425,115 +724,293 @@ INT RTLX_TxPacket
 		USHORT usIFG
 )
 {
-	INT iTxFlags  = 0;
-	INT iRet      = 0;
+	INT iRet = 0;
 
-	if (iInstanceNo >= RTLX_MAX_SOCKET_INSTANCES)
+	if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
 	{
 		RTLX_VERBOSE
 		(
 				0,
 				"RTLX_TxPacket() instance %d too large, only %d available\n",
 				iInstanceNo,
-				RTLX_MAX_SOCKET_INSTANCES
+				RTOS_MAX_INSTANCES
 		);
 		return(RTOS_RET_ERROR);
 	}
 
-	iRet = sendto
-			(
-					RTLX_SocketInstances[iInstanceNo].iTxSocketId, // Socket
-					pucFrame,                                      // Pointer to data
-					usLen,                                         // Length in bytes
-					iTxFlags,                                      // Flags
-					(struct sockaddr*) &(RTLX_SocketInstances[iInstanceNo].rTxSocketAddress),
-					// Address descriptor
-					sizeof(RTLX_SocketInstances[iInstanceNo].rTxSocketAddress)
-					// Size of address descriptor
-			);
-
-	if (iRet >= 0)
-	{
-		return(iRet);
-	}
-	else
+	if ((iPort < 0) || (iPort >= RTLX_SocketInstances[iInstanceNo].iNumTxPorts))
 	{
+		RTLX_VERBOSE
+		(
+				0,
+				"RTLX_TxPacket() instance %d port %d not opened\n",
+				iInstanceNo,
+				iPort
+		);
 		return(RTOS_RET_ERROR);
 	}
+
+	iRet = RTLX_TxPortPackets
+			(
+					&RTLX_SocketInstances[iInstanceNo].arPort[iPort],
+					&pucFrame,
+					&usLen,
+					NULL,
+					NULL,
+					1
+			);
+
+	return((iRet == 1) ? (INT)usLen : RTOS_RET_ERROR);
 }
 
 /**
- * \fn INT RTLX_RxPacket(
+ * \fn INT RTLX_TxPacketBatch(
  *              INT iInstanceNo,
- *              INT iPort,
- *              UCHAR* pucFrame,
- *              UCHAR** ppucFrame
+ *              UCHAR** apucFrame,
+ *              USHORT* ausLen,
+ *              UCHAR** apucPayload,
+ *              USHORT* ausPayloadLen,
+ *              UCHAR* aucPort,
+ *              USHORT usNum,
+ *              USHORT usIFG
  *          )
  *
- * \brief   Receives raw Ethernet packet. Function is non-blocking.
+ * \brief   Transmits a batch of raw Ethernet packets in the given order with
+ *          as few system calls as possible: each run of consecutive packets
+ *          for the same port is handed over with one send() kick in case of a
+ *          transmit ring (RTOS_TX_RING), otherwise with one sendmmsg() call
+ *          per RTOS_TX_BATCH_MAX_PACKETS packets.
  *
- * \note    This function may be implemented in two ways on a certain operating
- *          system in order to optimize buffer handling. It may either (1)
- *          return a pointer to an existing buffer in ppucFrame containing the
- *          received packet, or (2) use a buffer allocated by the calling
- *          entity. If the function returns a 'NULL' in ppucFrame, (2) is used,
- *          otherwise (1).
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   apucFrame   Array of pointers to packet buffers
+ * \param[in]   ausLen      Array of packet lengths
+ * \param[in]   apucPayload Array of pointers to the second parts of the
+ *                          packets, entries may be NULL. May be NULL if no
+ *                          packet consists of two parts.
+ * \param[in]   ausPayloadLen Array of lengths of the second parts
+ * \param[in]   aucPort     Array of port numbers
+ * \param[in]   usNum       Number of packets
+ * \param[in]   usIFG       Required inter frame gap
  *
- * \note    Tx socket needs to be opened using RTLX_OpenRxSocket() before using
- *          this function. Buffer pucFrame needs to be large enough to hold an
- *          entire Ethernet frame of maximum size (ETHERNET_MAX_FRAMEBUF_LEN).
+ * \note    Tx socket needs to be opened using RTLX_OpenTxSocket() before using
+ *          this function. Without redundancy, only port P is opened and a
+ *          batch with a packet for port S is rejected.
  *
- * \param[in]   iInstanceNo Sercos IP core emulation instance number
- * \param[in]   iPort       Port number
- * \param[out]  pucFrame    Pointer to packet buffer
- * \param[out]  ppucFrame   Pointer to pointer to packet buffer
+ * \note    A packet with a second part is transmitted as the concatenation of
+ *          both parts, e.g. a header of its own followed by a payload shared
+ *          with another packet of the batch.
+ *
+ * \note    Inter frame gap not yet taken into account
  *
  * \return
- * - >0: Number of received bytes
- * - -1: Error
+ * - >=0: Number of packets transmitted
+ * - <0: Error
  *
  * \ingroup RTLX
  *
  */
-INT RTLX_RxPacket
+INT RTLX_TxPacketBatch
 (
 		INT iInstanceNo,
-		INT iPort,
-		UCHAR* pucFrame,
-		UCHAR** ppucFrame
+		UCHAR** apucFrame,
+		USHORT* ausLen,
+		UCHAR** apucPayload,
+		USHORT* ausPayloadLen,
+		UCHAR* aucPort,
+		USHORT usNum,
+		USHORT usIFG
 )
 {
-	INT       iRxFlags              = 0;
-	INT       iRet                  = 0;
-	struct    sockaddr rRXSrcAddr;
-	socklen_t iRxSrcAddrLen         = sizeof(struct sockaddr);
+	RTLX_SOCKET_INSTANCE* prInstance = NULL;
+	USHORT                usStart    = 0;
+	USHORT                usEnd      = 0;
+	INT                   iPort      = 0;
+	INT                   iRet       = 0;
 
-	if (2* iInstanceNo >= RTLX_MAX_SOCKET_INSTANCES)
+	if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
 	{
 		RTLX_VERBOSE
 		(
 				0,
-				"RTLX_RxPacket() instance %d too large, only %d available\n",
+				"RTLX_TxPacketBatch() instance %d too large, only %d available\n",
 				iInstanceNo,
-				RTLX_MAX_SOCKET_INSTANCES
+				RTOS_MAX_INSTANCES
 		);
 		return(RTOS_RET_ERROR);
 	}
 
-	rRXSrcAddr.sa_family = AF_PACKET;
+	prInstance = &RTLX_SocketInstances[iInstanceNo];
 
-	iRet = recvfrom
+	while (usStart < usNum)
+	{
+		iPort = (INT)aucPort[usStart];
+		if (iPort >= prInstance->iNumTxPorts)
+		{
+			RTLX_VERBOSE
 			(
-					RTLX_SocketInstances[2* iInstanceNo + iPort].iRxSocketId,  // Socket
-					pucFrame,                                       // Pointer to buffer
-					SICE_ETH_FRAMEBUF_LEN,                          // Buffer size
-					iRxFlags,                                       // Flags
-					&rRXSrcAddr,                                    // RX source address to filter for
-					&iRxSrcAddrLen                                  // Length of RX source address
-			);
+					0,
+					"RTLX_TxPacketBatch() instance %d port %d not opened\n",
+					iInstanceNo,
+					iPort
+			);
+			return(RTOS_RET_ERROR);
+		}
+
+		// Run of packets leaving through the same socket
+		usEnd = usStart + 1;
+		while (
+				(usEnd < usNum) &&
+				((INT)aucPort[usEnd] == iPort)
+		)
+		{
+			usEnd++;
+		}
+
+		iRet = RTLX_TxPortPackets
+				(
+						&prInstance->arPort[iPort],
+						&apucFrame[usStart],
+						&ausLen[usStart],
+						(apucPayload != NULL) ? &apucPayload[usStart] : NULL,
+						(apucPayload != NULL) ? &ausPayloadLen[usStart] : NULL,
+						usEnd - usStart
+				);
+		if (iRet < 0)
+		{
+			return(RTOS_RET_ERROR);
+		}
+		usStart += (USHORT)iRet;
+
+		if (usStart < usEnd)
+		{
+			// Partial transmission
+			break;
+		}
+	}
+
+	return((INT)usStart);
+}
+
+/**
+ * \fn INT RTLX_RxPacket(
+ *              INT iInstanceNo,
+ *              INT iPort,
+ *              UCHAR* pucFrame,
+ *              UCHAR** ppucFrame
+ *          )
+ *
+ * \brief   Receives raw Ethernet packet. Function is non-blocking.
+ *
+ * \note    This function may be implemented in two ways on a certain operating
+ *          system in order to optimize buffer handling. It may either (1)
+ *          return a pointer to an existing buffer in ppucFrame containing the
+ *          received packet, or (2) use a buffer allocated by the calling
+ *          entity. If the function returns a 'NULL' in ppucFrame, (2) is used,
+ *          otherwise (1).
+ *
+ * \note    With RTOS_RX_RING, (1) is used and ppucFrame points into the
+ *          memory-mapped receive ring. The frame is handed back to the kernel
+ *          with the next call for the same port, so it must not be accessed
+ *          afterwards.
+ *
+ * \note    Tx socket needs to be opened using RTLX_OpenRxSocket() before using
+ *          this function. Buffer pucFrame needs to be large enough to hold an
+ *          entire Ethernet frame of maximum size (ETHERNET_MAX_FRAMEBUF_LEN).
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   iPort       Port number
+ * \param[out]  pucFrame    Pointer to packet buffer
+ * \param[out]  ppucFrame   Pointer to pointer to packet buffer
+ *
+ * \return
+ * - >0: Number of received bytes
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_RxPacket
+(
+		INT iInstanceNo,
+		INT iPort,
+		UCHAR* pucFrame,
+		UCHAR** ppucFrame
+)
+{
+	RTLX_SOCKET_PORT* prSocket      = NULL;
+	INT       iRxFlags              = 0;
+	INT       iRet                  = 0;
+#ifdef RTOS_TIMESTAMPING
+	struct    msghdr rMsg;
+	struct    iovec rIov;
+	UCHAR     aucCtrl[CMSG_SPACE(sizeof(struct scm_timestamping))];
+#else
+	struct    sockaddr rRXSrcAddr;
+	socklen_t iRxSrcAddrLen         = sizeof(struct sockaddr);
+#endif
+
+	if (
+			(iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) ||
+			(iPort < 0) || (iPort >= RTLX_SocketInstances[iInstanceNo].iNumRxPorts)
+	)
+	{
+		RTLX_VERBOSE
+		(
+				0,
+				"RTLX_RxPacket() instance %d port %d not opened\n",
+				iInstanceNo,
+				iPort
+		);
+		return(RTOS_RET_ERROR);
+	}
+
+	prSocket = &RTLX_SocketInstances[iInstanceNo].arPort[iPort];
+
+#ifdef RTOS_RX_RING
+	if (prSocket->pucRxRing != NULL)
+	{
+		return(RTLX_RxRingPacket(prSocket, ppucFrame));
+	}
+#endif
+
+#ifdef RTOS_TIMESTAMPING
+	// Timestamp is delivered as control message
+	rIov.iov_base = pucFrame;
+	rIov.iov_len  = SICE_ETH_FRAMEBUF_LEN;
+
+	(VOID)memset(&rMsg, 0, sizeof(rMsg));
+	rMsg.msg_iov        = &rIov;
+	rMsg.msg_iovlen     = 1;
+	rMsg.msg_control    = aucCtrl;
+	rMsg.msg_controllen = sizeof(aucCtrl);
+
+	iRet = recvmsg
+			(
+					prSocket->iRxSocketId,      // Socket
+					&rMsg,                      // Message
+					iRxFlags                    // Flags
+			);
+
+	if (iRet >= 0)
+	{
+		prSocket->ullRxStampNs = RTLX_GetCmsgTimestamp(prSocket, &rMsg);
+	}
+#else
+	rRXSrcAddr.sa_family = AF_PACKET;
+
+	iRet = recvfrom
+			(
+					prSocket->iRxSocketId,      // Socket
+					pucFrame,                   // Pointer to buffer
+					SICE_ETH_FRAMEBUF_LEN,      // Buffer size
+					iRxFlags,                   // Flags
+					&rRXSrcAddr,                // RX source address to filter for
+					&iRxSrcAddrLen              // Length of RX source address
+			);
+#endif
 
 	// Signal that provided buffer was used, not own one
-	ppucFrame = NULL;
+	*ppucFrame = NULL;
 
 	if (iRet >= 0)
 	{
@@ -559,3 +1036,1217 @@ INT RTLX_RxPacket
 	}
 }
 
+
+/**
+ * \fn INT RTLX_SetRxRing(
+ *              INT iInstanceNo,
+ *              BOOL boEnable
+ *          )
+ *
+ * \brief   Selects whether the memory-mapped receive ring is used for the
+ *          given instance. Needs to be called before RTLX_OpenRxSocket().
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   boEnable    TRUE for ring reception, FALSE for recvfrom()
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error, e.g. ring not compiled in (RTOS_RX_RING)
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_SetRxRing
+(
+		INT iInstanceNo,
+		BOOL boEnable
+)
+{
+#ifdef RTOS_RX_RING
+	INT iPort = 0;
+
+	if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+	{
+		RTLX_VERBOSE
+		(
+				0,
+				"RTLX_SetRxRing() instance %d too large, only %d available\n",
+				iInstanceNo,
+				RTOS_MAX_INSTANCES
+		);
+		return(RTOS_RET_ERROR);
+	}
+
+	for (
+			iPort = 0;
+			iPort < RTOS_MAX_PORTS;
+			iPort ++
+	)
+	{
+		RTLX_SocketInstances[iInstanceNo].arPort[iPort].boNoRxRing = !boEnable;
+	}
+	return(RTOS_RET_OK);
+#else
+	if (boEnable)
+	{
+		return(RTOS_RET_ERROR);
+	}
+	return(RTOS_RET_OK);
+#endif
+}
+
+/**
+ * \fn INT RTLX_GetRxTimestamp(
+ *              INT iInstanceNo,
+ *              INT iPort,
+ *              ULONGLONG* pullTimeNs
+ *          )
+ *
+ * \brief   Returns the reception timestamp of the packet last returned by
+ *          RTLX_RxPacket() for the port.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   iPort       Port number
+ * \param[out]  pullTimeNs  Timestamp in ns
+ *
+ * \note    Hardware timestamps refer to the clock of the adapter, software
+ *          timestamps to CLOCK_REALTIME. Only timestamps of the same port
+ *          configuration may be compared, see RTOS_TIMESTAMPING_HW.
+ *
+ * \return
+ * - 1: Timestamp available
+ * - 0: No timestamp available
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_GetRxTimestamp
+(
+		INT iInstanceNo,
+		INT iPort,
+		ULONGLONG* pullTimeNs
+)
+{
+	if (
+			(iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) ||
+			(iPort < 0) || (iPort >= RTLX_SocketInstances[iInstanceNo].iNumRxPorts)
+	)
+	{
+		return(RTOS_RET_ERROR);
+	}
+
+#ifdef RTOS_TIMESTAMPING
+	*pullTimeNs = RTLX_SocketInstances[iInstanceNo].arPort[iPort].ullRxStampNs;
+
+	return((*pullTimeNs != 0) ? 1 : 0);
+#else
+	*pullTimeNs = 0;
+	return(0);
+#endif
+}
+
+/**
+ * \fn INT RTLX_GetTxTimestamp(
+ *              INT iInstanceNo,
+ *              INT iPort,
+ *              ULONGLONG* pullTimeNs
+ *          )
+ *
+ * \brief   Reads all transmit timestamps reported since the last call for
+ *          the port and returns the earliest one, which belongs to the first
+ *          packet transmitted in that time.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   iPort       Port number
+ * \param[out]  pullTimeNs  Earliest timestamp in ns
+ *
+ * \note    The timestamps are reported asynchronously by the kernel through
+ *          the error queue of the socket, so the function is called once per
+ *          cycle to keep the queue short.
+ *
+ * \return
+ * - 1: Timestamp available
+ * - 0: No timestamp available
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_GetTxTimestamp
+(
+		INT iInstanceNo,
+		INT iPort,
+		ULONGLONG* pullTimeNs
+)
+{
+#ifdef RTOS_TIMESTAMPING
+	RTLX_SOCKET_PORT* prSocket = NULL;
+	struct msghdr     rMsg;
+	struct iovec      rIov;
+	UCHAR             aucData[64];
+	UCHAR             aucCtrl[CMSG_SPACE(sizeof(struct scm_timestamping)) +
+	                          CMSG_SPACE(sizeof(struct sock_extended_err))];
+	ULONGLONG         ullStamp = 0;
+#endif
+
+	if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+	{
+		return(RTOS_RET_ERROR);
+	}
+
+	*pullTimeNs = 0;
+
+#ifdef RTOS_TIMESTAMPING
+	if ((iPort < 0) || (iPort >= RTLX_SocketInstances[iInstanceNo].iNumTxPorts))
+	{
+		return(RTOS_RET_ERROR);
+	}
+
+	prSocket = &RTLX_SocketInstances[iInstanceNo].arPort[iPort];
+
+	for (;;)
+	{
+		rIov.iov_base = aucData;
+		rIov.iov_len  = sizeof(aucData);
+
+		(VOID)memset(&rMsg, 0, sizeof(rMsg));
+		rMsg.msg_iov        = &rIov;
+		rMsg.msg_iovlen     = 1;
+		rMsg.msg_control    = aucCtrl;
+		rMsg.msg_controllen = sizeof(aucCtrl);
+
+		if (recvmsg(prSocket->iTxSocketId, &rMsg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+		{
+			break;
+		}
+
+		ullStamp = RTLX_GetCmsgTimestamp(prSocket, &rMsg);
+
+		if ((ullStamp != 0) && ((*pullTimeNs == 0) || (ullStamp < *pullTimeNs)))
+		{
+			*pullTimeNs = ullStamp;
+		}
+	}
+#endif
+
+	return((*pullTimeNs != 0) ? 1 : 0);
+}
+
+/**
+ * \fn static INT RTLX_OpenTxPort(
+ *              RTLX_SOCKET_PORT* prSocket,
+ *              UCHAR* pucMAC
+ *          )
+ *
+ * \brief   Opens the raw Ethernet transmit socket of a port and retrieves the
+ *          MAC address of its adapter.
+ *
+ * \param[in,out]   prSocket    Socket of port
+ * \param[out]      pucMAC      MAC address of adapter
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_OpenTxPort
+(
+		RTLX_SOCKET_PORT* prSocket,
+		UCHAR* pucMAC
+)
+{
+	struct  ifreq rIfReq;
+	UCHAR   *pucTempMAC;
+
+	// Socket descriptor
+	prSocket->iTxSocketId = socket
+			(
+					AF_PACKET,                  // Packet mode
+					SOCK_RAW,                   // Raw socket
+#ifdef RTOS_FILTER_SERCOS_ETHERTYPE
+					htons(SICE_SIII_ETHER_TYPE) // Sercos ether type
+#else
+					htons(ETH_P_ALL)
+#endif
+			);
+
+	if (prSocket->iTxSocketId == -1)
+	{
+		return(RTOS_RET_ERROR);
+	}
+
+	(VOID)memset(&prSocket->rTxSocketAddress, 0, sizeof(prSocket->rTxSocketAddress));
+
+	// Communication family, always AF_PACKET
+	prSocket->rTxSocketAddress.sll_family = AF_PACKET;
+
+	// Physical protocol, set to Sercos ether type
+#ifdef RTOS_FILTER_SERCOS_ETHERTYPE
+	prSocket->rTxSocketAddress.sll_protocol = htons(SICE_SIII_ETHER_TYPE);
+#endif
+
+#ifdef RTOS_BIND_NIC
+	// Index of network device of port
+	prSocket->rTxSocketAddress.sll_ifindex = if_nametoindex(prSocket->acName);
+	if (prSocket->rTxSocketAddress.sll_ifindex == 0)
+	{
+		RTLX_VERBOSE(0, "Error: Network adapter \"%s\" not found\n", prSocket->acName);
+		(VOID)close(prSocket->iTxSocketId);
+		return(RTOS_RET_ERROR);
+	}
+#endif
+
+	// Header type
+	prSocket->rTxSocketAddress.sll_hatype = ARPHRD_ETHER;
+
+	// Packet type
+	prSocket->rTxSocketAddress.sll_pkttype = PACKET_OTHERHOST;
+
+	// Length of address
+	prSocket->rTxSocketAddress.sll_halen = ETH_ALEN;
+
+	// Get hardware MAC address of adapter
+	(VOID)memset(&rIfReq, 0, sizeof(rIfReq));
+	(VOID)strncpy(rIfReq.ifr_name, prSocket->acName, IFNAMSIZ - 1);
+
+	if (
+			ioctl
+			(
+					prSocket->iTxSocketId,
+					SIOCGIFHWADDR,
+					&rIfReq
+			) < 0
+	)
+	{
+		RTLX_VERBOSE
+		(
+				0,
+				"Error %d (%s) reading MAC address of %s\n",
+				errno,
+				strerror(errno),
+				prSocket->acName
+		);
+		(VOID)close(prSocket->iTxSocketId);
+		return(RTOS_RET_ERROR);
+	}
+
+	// Set hardware MAC address to Ethernet source address
+	pucTempMAC = (UCHAR *)rIfReq.ifr_hwaddr.sa_data;
+	(VOID)memcpy(prSocket->rTxSocketAddress.sll_addr, pucTempMAC, ETH_ALEN);
+
+	// Return obtained MAC address of adapter
+	(VOID)memcpy
+			(
+					pucMAC,
+					pucTempMAC,
+					ETH_ALEN
+			);
+
+#ifdef RTOS_TX_RING
+	if (RTLX_OpenTxRing(prSocket) != RTOS_RET_OK)
+	{
+		RTLX_VERBOSE(0, "Warning: TX ring not available on %s, using sendmmsg()\n", prSocket->acName);
+	}
+#endif
+
+#ifdef RTOS_TIMESTAMPING
+	RTLX_EnableTimestamping(prSocket, prSocket->iTxSocketId, TRUE);
+#endif
+
+	return(RTOS_RET_OK);
+}
+
+/**
+ * \fn static INT RTLX_TxPortPackets(
+ *              RTLX_SOCKET_PORT* prSocket,
+ *              UCHAR** apucFrame,
+ *              USHORT* ausLen,
+ *              UCHAR** apucPayload,
+ *              USHORT* ausPayloadLen,
+ *              USHORT usNum
+ *          )
+ *
+ * \brief   Transmits packets on the socket of one port, through the transmit
+ *          ring if mapped, otherwise with sendmmsg(). The kernel gathers
+ *          packets with a second part from two I/O vectors.
+ *
+ * \param[in,out]   prSocket    Socket of port
+ * \param[in]       apucFrame   Array of pointers to packet buffers
+ * \param[in]       ausLen      Array of packet lengths
+ * \param[in]       apucPayload Array of pointers to second parts or NULL
+ * \param[in]       ausPayloadLen Array of lengths of second parts
+ * \param[in]       usNum       Number of packets
+ *
+ * \return
+ * - >=0: Number of packets transmitted
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_TxPortPackets
+(
+		RTLX_SOCKET_PORT* prSocket,
+		UCHAR** apucFrame,
+		USHORT* ausLen,
+		UCHAR** apucPayload,
+		USHORT* ausPayloadLen,
+		USHORT usNum
+)
+{
+	struct mmsghdr arMsg[RTOS_TX_BATCH_MAX_PACKETS];
+	struct iovec   arIov[2 * RTOS_TX_BATCH_MAX_PACKETS];
+	USHORT         usSent   = 0;
+	USHORT         usChunk  = 0;
+	USHORT         usCnt    = 0;
+	INT            iRet     = 0;
+
+#ifdef RTOS_TX_RING
+	// Once a TX ring is set up, the kernel takes all packets from the ring
+	if (prSocket->pucTxRing != NULL)
+	{
+		return(RTLX_TxRingPackets
+				(
+						prSocket,
+						apucFrame,
+						ausLen,
+						apucPayload,
+						ausPayloadLen,
+						usNum
+				));
+	}
+#endif
+
+	while (usSent < usNum)
+	{
+		usChunk = usNum - usSent;
+		if (usChunk > RTOS_TX_BATCH_MAX_PACKETS)
+		{
+			usChunk = RTOS_TX_BATCH_MAX_PACKETS;
+		}
+
+		for (
+				usCnt = 0;
+				usCnt < usChunk;
+				usCnt++
+		)
+		{
+			arIov[2 * usCnt].iov_base = apucFrame[usSent + usCnt];
+			arIov[2 * usCnt].iov_len  = ausLen[usSent + usCnt];
+
+			(VOID)memset(&arMsg[usCnt], 0, sizeof(arMsg[usCnt]));
+			arMsg[usCnt].msg_hdr.msg_name    = &prSocket->rTxSocketAddress;
+			arMsg[usCnt].msg_hdr.msg_namelen = sizeof(prSocket->rTxSocketAddress);
+			arMsg[usCnt].msg_hdr.msg_iov     = &arIov[2 * usCnt];
+			arMsg[usCnt].msg_hdr.msg_iovlen  = 1;
+
+			// Second part, e.g. payload shared with the packet for the other port
+			if ((apucPayload != NULL) && (apucPayload[usSent + usCnt] != NULL))
+			{
+				arIov[2 * usCnt + 1].iov_base = apucPayload[usSent + usCnt];
+				arIov[2 * usCnt + 1].iov_len  = ausPayloadLen[usSent + usCnt];
+				arMsg[usCnt].msg_hdr.msg_iovlen = 2;
+			}
+		}
+
+		iRet = sendmmsg
+				(
+						prSocket->iTxSocketId,      // Socket
+						arMsg,                      // Messages
+						usChunk,                    // Number of messages
+						0                           // Flags
+				);
+
+		// Partial transmission is continued with the first packet not sent
+		if (iRet <= 0)
+		{
+			RTLX_VERBOSE
+			(
+					0,
+					"Error %d (%s) in sendmmsg() after %u packets\n",
+					errno,
+					strerror(errno),
+					usSent
+			);
+			return(RTOS_RET_ERROR);
+		}
+		usSent += (USHORT)iRet;
+	}
+
+	return((INT)usSent);
+}
+
+#ifdef RTOS_RX_RING
+/**
+ * \fn static INT RTLX_OpenRxRing(
+ *              RTLX_SOCKET_PORT* prSocket
+ *          )
+ *
+ * \brief   Sets up and maps the PACKET_MMAP receive ring of an opened, not
+ *          yet bound receive socket.
+ *
+ * \param[in,out]   prSocket    Socket instance
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error, socket is left without ring
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_OpenRxRing
+(
+		RTLX_SOCKET_PORT* prSocket
+)
+{
+#if (RTOS_RX_RING_VERSION == RTOS_RX_RING_V3)
+	INT  iVersion = TPACKET_V3;
+#else
+	INT  iVersion = TPACKET_V2;
+#endif
+	INT  iRet     = 0;
+	VOID *pvRing  = NULL;
+#if (RTOS_RX_RING_VERSION == RTOS_RX_RING_V3)
+	struct tpacket_req3 rReq;
+#else
+	struct tpacket_req  rReq;
+#endif
+
+	iRet = setsockopt
+			(
+					prSocket->iRxSocketId,
+					SOL_PACKET,
+					PACKET_VERSION,
+					&iVersion,
+					sizeof(iVersion)
+			);
+	if (iRet < 0)
+	{
+		RTLX_VERBOSE(0, "Error %d (%s) setting PACKET_VERSION\n", errno, strerror(errno));
+		return(RTOS_RET_ERROR);
+	}
+
+	(VOID)memset(&rReq, 0, sizeof(rReq));
+	rReq.tp_block_size = RTOS_RX_RING_BLOCK_SIZE;
+	rReq.tp_block_nr   = RTOS_RX_RING_BLOCK_NUM;
+	rReq.tp_frame_size = RTOS_RX_RING_FRAME_SIZE;
+	rReq.tp_frame_nr   = (RTOS_RX_RING_BLOCK_SIZE / RTOS_RX_RING_FRAME_SIZE) *
+			RTOS_RX_RING_BLOCK_NUM;
+#if (RTOS_RX_RING_VERSION == RTOS_RX_RING_V3)
+	rReq.tp_retire_blk_tov = RTOS_RX_RING_BLOCK_TMO;
+#endif
+
+	iRet = setsockopt
+			(
+					prSocket->iRxSocketId,
+					SOL_PACKET,
+					PACKET_RX_RING,
+					&rReq,
+					sizeof(rReq)
+			);
+	if (iRet < 0)
+	{
+		RTLX_VERBOSE(0, "Error %d (%s) setting PACKET_RX_RING\n", errno, strerror(errno));
+		return(RTOS_RET_ERROR);
+	}
+
+	prSocket->ulRxRingSize = (size_t)rReq.tp_block_size * rReq.tp_block_nr;
+
+	pvRing = mmap
+			(
+					NULL,
+					prSocket->ulRxRingSize,
+					PROT_READ | PROT_WRITE,
+					MAP_SHARED,
+					prSocket->iRxSocketId,
+					0
+			);
+	if (pvRing == MAP_FAILED)
+	{
+		RTLX_VERBOSE(0, "Error %d (%s) mapping RX ring\n", errno, strerror(errno));
+
+		// Release ring in kernel again
+		(VOID)memset(&rReq, 0, sizeof(rReq));
+		(VOID)setsockopt
+				(
+						prSocket->iRxSocketId,
+						SOL_PACKET,
+						PACKET_RX_RING,
+						&rReq,
+						sizeof(rReq)
+				);
+		return(RTOS_RET_ERROR);
+	}
+
+	prSocket->pucRxRing       = (UCHAR*)pvRing;
+	prSocket->ulRxRingIdx     = 0;
+	prSocket->pucRxRingPkt    = NULL;
+	prSocket->ulRxRingPktLeft = 0;
+	prSocket->boRxRingPending = FALSE;
+#if (RTOS_RX_RING_VERSION == RTOS_RX_RING_V3)
+	prSocket->ulRxRingNum      = rReq.tp_block_nr;
+	prSocket->ulRxRingSlotSize = rReq.tp_block_size;
+#else
+	prSocket->ulRxRingNum      = rReq.tp_frame_nr;
+	prSocket->ulRxRingSlotSize = rReq.tp_frame_size;
+#endif
+
+	RTLX_VERBOSE
+	(
+			1,
+			"RX ring on %s: %u slots of %u bytes\n",
+			prSocket->acName,
+			prSocket->ulRxRingNum,
+			prSocket->ulRxRingSlotSize
+	);
+
+	return(RTOS_RET_OK);
+}
+
+/**
+ * \fn static VOID RTLX_CloseRxRing(
+ *              RTLX_SOCKET_PORT* prSocket
+ *          )
+ *
+ * \brief   Unmaps the receive ring of a socket, if any.
+ *
+ * \param[in,out]   prSocket    Socket instance
+ *
+ * \ingroup RTLX
+ *
+ */
+static VOID RTLX_CloseRxRing
+(
+		RTLX_SOCKET_PORT* prSocket
+)
+{
+	if (prSocket->pucRxRing != NULL)
+	{
+		(VOID)munmap(prSocket->pucRxRing, prSocket->ulRxRingSize);
+		prSocket->pucRxRing = NULL;
+	}
+}
+
+/**
+ * \fn static INT RTLX_RxRingPacket(
+ *              RTLX_SOCKET_PORT* prSocket,
+ *              UCHAR** ppucFrame
+ *          )
+ *
+ * \brief   Releases the frame handed out by the previous call and returns the
+ *          next received frame of the receive ring, if any. No system call is
+ *          used.
+ *
+ * \param[in,out]   prSocket    Socket instance with mapped ring
+ * \param[out]      ppucFrame   Pointer to frame within ring
+ *
+ * \return
+ * - >0: Number of received bytes
+ * - 0: No frame available
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_RxRingPacket
+(
+		RTLX_SOCKET_PORT* prSocket,
+		UCHAR** ppucFrame
+)
+{
+#if (RTOS_RX_RING_VERSION == RTOS_RX_RING_V3)
+	struct tpacket_block_desc* prBlock;
+	struct tpacket3_hdr*       prHdr;
+
+	prBlock = (struct tpacket_block_desc*)
+			(prSocket->pucRxRing + prSocket->ulRxRingIdx * prSocket->ulRxRingSlotSize);
+
+	// Release previous frame, and with the last frame the whole block
+	if (prSocket->boRxRingPending)
+	{
+		prSocket->boRxRingPending = FALSE;
+
+		if (--prSocket->ulRxRingPktLeft > 0)
+		{
+			prSocket->pucRxRingPkt +=
+					((struct tpacket3_hdr*)prSocket->pucRxRingPkt)->tp_next_offset;
+		}
+		else
+		{
+			prSocket->pucRxRingPkt = NULL;
+			__atomic_store_n(&prBlock->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+			prSocket->ulRxRingIdx = (prSocket->ulRxRingIdx + 1) % prSocket->ulRxRingNum;
+			prBlock = (struct tpacket_block_desc*)
+					(prSocket->pucRxRing + prSocket->ulRxRingIdx * prSocket->ulRxRingSlotSize);
+		}
+	}
+
+	// Open next block
+	while (prSocket->pucRxRingPkt == NULL)
+	{
+		if (!(__atomic_load_n(&prBlock->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER))
+		{
+			*ppucFrame = NULL;
+			return(0);
+		}
+
+		prSocket->ulRxRingPktLeft = prBlock->hdr.bh1.num_pkts;
+
+		if (prSocket->ulRxRingPktLeft > 0)
+		{
+			prSocket->pucRxRingPkt = (UCHAR*)prBlock + prBlock->hdr.bh1.offset_to_first_pkt;
+		}
+		else
+		{
+			// Empty block, hand back immediately
+			__atomic_store_n(&prBlock->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+			prSocket->ulRxRingIdx = (prSocket->ulRxRingIdx + 1) % prSocket->ulRxRingNum;
+			prBlock = (struct tpacket_block_desc*)
+					(prSocket->pucRxRing + prSocket->ulRxRingIdx * prSocket->ulRxRingSlotSize);
+		}
+	}
+
+	prHdr = (struct tpacket3_hdr*)prSocket->pucRxRingPkt;
+
+#ifdef RTOS_TIMESTAMPING
+	prSocket->ullRxStampNs =
+			(!prSocket->boHwStamp || (prHdr->tp_status & TP_STATUS_TS_RAW_HARDWARE)) ?
+			((ULONGLONG)prHdr->tp_sec * 1000000000ULL + prHdr->tp_nsec) : 0;
+#endif
+
+	prSocket->boRxRingPending = TRUE;
+	*ppucFrame = prSocket->pucRxRingPkt + prHdr->tp_mac;
+
+	return((INT)prHdr->tp_snaplen);
+#else
+	struct tpacket2_hdr* prHdr;
+
+	prHdr = (struct tpacket2_hdr*)
+			(prSocket->pucRxRing + prSocket->ulRxRingIdx * prSocket->ulRxRingSlotSize);
+
+	// Hand previous frame back to kernel
+	if (prSocket->boRxRingPending)
+	{
+		prSocket->boRxRingPending = FALSE;
+		__atomic_store_n(&prHdr->tp_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+		prSocket->ulRxRingIdx = (prSocket->ulRxRingIdx + 1) % prSocket->ulRxRingNum;
+		prHdr = (struct tpacket2_hdr*)
+				(prSocket->pucRxRing + prSocket->ulRxRingIdx * prSocket->ulRxRingSlotSize);
+	}
+
+	if (!(__atomic_load_n(&prHdr->tp_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER))
+	{
+		*ppucFrame = NULL;
+		return(0);
+	}
+
+#ifdef RTOS_TIMESTAMPING
+	prSocket->ullRxStampNs =
+			(!prSocket->boHwStamp || (prHdr->tp_status & TP_STATUS_TS_RAW_HARDWARE)) ?
+			((ULONGLONG)prHdr->tp_sec * 1000000000ULL + prHdr->tp_nsec) : 0;
+#endif
+
+	prSocket->boRxRingPending = TRUE;
+	*ppucFrame = (UCHAR*)prHdr + prHdr->tp_mac;
+
+	return((INT)prHdr->tp_snaplen);
+#endif
+}
+#endif
+
+#ifdef RTOS_TX_RING
+/**
+ * \fn static INT RTLX_OpenTxRing(
+ *              RTLX_SOCKET_PORT* prSocket
+ *          )
+ *
+ * \brief   Sets up and maps the PACKET_MMAP transmit ring of an opened
+ *          transmit socket.
+ *
+ * \param[in,out]   prSocket    Socket instance
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error, socket is left without ring
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_OpenTxRing
+(
+		RTLX_SOCKET_PORT* prSocket
+)
+{
+	INT  iVersion = TPACKET_V2;
+	INT  iRet     = 0;
+	VOID *pvRing  = NULL;
+	struct tpacket_req rReq;
+
+	iRet = setsockopt
+			(
+					prSocket->iTxSocketId,
+					SOL_PACKET,
+					PACKET_VERSION,
+					&iVersion,
+					sizeof(iVersion)
+			);
+	if (iRet < 0)
+	{
+		RTLX_VERBOSE(0, "Error %d (%s) setting PACKET_VERSION\n", errno, strerror(errno));
+		return(RTOS_RET_ERROR);
+	}
+
+	(VOID)memset(&rReq, 0, sizeof(rReq));
+	rReq.tp_block_size = RTOS_TX_RING_BLOCK_SIZE;
+	rReq.tp_frame_size = RTOS_TX_RING_FRAME_SIZE;
+	rReq.tp_frame_nr   = RTOS_TX_RING_FRAME_NUM;
+	rReq.tp_block_nr   = (RTOS_TX_RING_FRAME_NUM * RTOS_TX_RING_FRAME_SIZE) /
+			RTOS_TX_RING_BLOCK_SIZE;
+
+	iRet = setsockopt
+			(
+					prSocket->iTxSocketId,
+					SOL_PACKET,
+					PACKET_TX_RING,
+					&rReq,
+					sizeof(rReq)
+			);
+	if (iRet < 0)
+	{
+		RTLX_VERBOSE(0, "Error %d (%s) setting PACKET_TX_RING\n", errno, strerror(errno));
+		return(RTOS_RET_ERROR);
+	}
+
+	prSocket->ulTxRingSize = (size_t)rReq.tp_block_size * rReq.tp_block_nr;
+
+	pvRing = mmap
+			(
+					NULL,
+					prSocket->ulTxRingSize,
+					PROT_READ | PROT_WRITE,
+					MAP_SHARED,
+					prSocket->iTxSocketId,
+					0
+			);
+	if (pvRing == MAP_FAILED)
+	{
+		RTLX_VERBOSE(0, "Error %d (%s) mapping TX ring\n", errno, strerror(errno));
+
+		// Release ring in kernel again, so that sendto() works as before
+		(VOID)memset(&rReq, 0, sizeof(rReq));
+		(VOID)setsockopt
+				(
+						prSocket->iTxSocketId,
+						SOL_PACKET,
+						PACKET_TX_RING,
+						&rReq,
+						sizeof(rReq)
+				);
+		return(RTOS_RET_ERROR);
+	}
+
+	prSocket->pucTxRing   = (UCHAR*)pvRing;
+	prSocket->ulTxRingIdx = 0;
+
+	return(RTOS_RET_OK);
+}
+
+/**
+ * \fn static INT RTLX_TxRingPackets(
+ *              RTLX_SOCKET_PORT* prSocket,
+ *              UCHAR** apucFrame,
+ *              USHORT* ausLen,
+ *              UCHAR** apucPayload,
+ *              USHORT* ausPayloadLen,
+ *              USHORT usNum
+ *          )
+ *
+ * \brief   Copies packets into consecutive slots of the transmit ring and
+ *          kicks transmission with a single system call. The kernel
+ *          transmits the slots in ring order.
+ *
+ * \param[in,out]   prSocket    Socket instance with mapped ring
+ * \param[in]       apucFrame   Array of pointers to packet buffers
+ * \param[in]       ausLen      Array of packet lengths
+ * \param[in]       apucPayload Array of pointers to second parts or NULL
+ * \param[in]       ausPayloadLen Array of lengths of second parts
+ * \param[in]       usNum       Number of packets
+ *
+ * \return
+ * - >=0: Number of packets transmitted
+ * - -1: Error, e.g. ring slots still occupied by previous transmission
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_TxRingPackets
+(
+		RTLX_SOCKET_PORT* prSocket,
+		UCHAR** apucFrame,
+		USHORT* ausLen,
+		UCHAR** apucPayload,
+		USHORT* ausPayloadLen,
+		USHORT usNum
+)
+{
+	struct tpacket2_hdr* prHdr;
+	ULONG                ulStatus;
+	UCHAR*               pucSlot;
+	USHORT               usLen;
+	USHORT               usPayloadLen;
+	USHORT               usCnt = 0;
+	INT                  iRet  = 0;
+
+	for (
+			usCnt = 0;
+			usCnt < usNum;
+			usCnt++
+	)
+	{
+		prHdr = (struct tpacket2_hdr*)(prSocket->pucTxRing +
+				prSocket->ulTxRingIdx * RTOS_TX_RING_FRAME_SIZE);
+
+		// Slot still in use by kernel? Then the NIC does not keep up.
+		ulStatus = __atomic_load_n(&prHdr->tp_status, __ATOMIC_ACQUIRE);
+		if ((ulStatus != TP_STATUS_AVAILABLE) && (ulStatus != TP_STATUS_WRONG_FORMAT))
+		{
+			RTLX_VERBOSE(0, "Error: TX ring full\n");
+			break;
+		}
+
+		usPayloadLen = ((apucPayload != NULL) && (apucPayload[usCnt] != NULL)) ?
+				ausPayloadLen[usCnt] : 0;
+		usLen        = ausLen[usCnt] + usPayloadLen;
+
+		if (usLen > RTOS_TX_RING_FRAME_SIZE - TPACKET_ALIGN(sizeof(struct tpacket2_hdr)))
+		{
+			RTLX_VERBOSE(0, "Error: Packet of %u bytes exceeds TX ring slot\n", usLen);
+			break;
+		}
+
+		pucSlot = (UCHAR*)prHdr + TPACKET_ALIGN(sizeof(struct tpacket2_hdr));
+		(VOID)memcpy(pucSlot, apucFrame[usCnt], ausLen[usCnt]);
+		if (usPayloadLen != 0)
+		{
+			(VOID)memcpy(pucSlot + ausLen[usCnt], apucPayload[usCnt], usPayloadLen);
+		}
+		prHdr->tp_len = usLen;
+
+		__atomic_store_n(&prHdr->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+
+		prSocket->ulTxRingIdx = (prSocket->ulTxRingIdx + 1) % RTOS_TX_RING_FRAME_NUM;
+	}
+
+	// Kick transmission of all requested slots, do not wait for completion
+	iRet = sendto
+			(
+					prSocket->iTxSocketId,
+					NULL,
+					0,
+					MSG_DONTWAIT,
+					(struct sockaddr*) &prSocket->rTxSocketAddress,
+					sizeof(prSocket->rTxSocketAddress)
+			);
+
+	if ((iRet < 0) || (usCnt < usNum))
+	{
+		if (iRet < 0)
+		{
+			RTLX_VERBOSE(0, "Error %d (%s) kicking TX ring\n", errno, strerror(errno));
+		}
+		return(RTOS_RET_ERROR);
+	}
+
+	return((INT)usCnt);
+}
+#endif
+
+#ifdef RTOS_TIMESTAMPING
+/**
+ * \fn static VOID RTLX_EnableTimestamping(
+ *              RTLX_SOCKET_PORT* prSocket,
+ *              INT iSocketId,
+ *              BOOL boTx
+ *          )
+ *
+ * \brief   Requests transmit or receive timestamps for a socket. With
+ *          RTOS_TIMESTAMPING_HW, hardware timestamping is switched on in the
+ *          adapter; if this fails, software timestamps are used.
+ *
+ * \param[in,out]   prSocket    Socket of port
+ * \param[in]       iSocketId   Socket handle (TX or RX)
+ * \param[in]       boTx        TRUE for transmit, FALSE for receive
+ *
+ * \ingroup RTLX
+ *
+ */
+static VOID RTLX_EnableTimestamping
+(
+		RTLX_SOCKET_PORT* prSocket,
+		INT iSocketId,
+		BOOL boTx
+)
+{
+	INT iFlags = SOF_TIMESTAMPING_SOFTWARE;
+#ifdef RTOS_TIMESTAMPING_HW
+	struct ifreq           rIfReq;
+	struct hwtstamp_config rHwConfig;
+
+	(VOID)memset(&rHwConfig, 0, sizeof(rHwConfig));
+	rHwConfig.tx_type   = HWTSTAMP_TX_ON;
+	rHwConfig.rx_filter = HWTSTAMP_FILTER_ALL;
+
+	(VOID)memset(&rIfReq, 0, sizeof(rIfReq));
+	(VOID)snprintf(rIfReq.ifr_name, IFNAMSIZ, "%s", prSocket->acName);
+	rIfReq.ifr_data = (VOID*)&rHwConfig;
+
+	prSocket->boHwStamp = (ioctl(iSocketId, SIOCSHWTSTAMP, &rIfReq) == 0);
+	if (!prSocket->boHwStamp)
+	{
+		RTLX_VERBOSE
+		(
+				0,
+				"Warning: No hardware timestamps on %s (%s), using software timestamps\n",
+				prSocket->acName,
+				strerror(errno)
+		);
+	}
+#else
+	prSocket->boHwStamp = FALSE;
+#endif
+
+	if (prSocket->boHwStamp)
+	{
+		iFlags = SOF_TIMESTAMPING_RAW_HARDWARE;
+	}
+
+	if (boTx)
+	{
+		iFlags |= (prSocket->boHwStamp ? SOF_TIMESTAMPING_TX_HARDWARE : SOF_TIMESTAMPING_TX_SOFTWARE) |
+				SOF_TIMESTAMPING_OPT_TSONLY;
+	}
+	else
+	{
+		iFlags |= (prSocket->boHwStamp ? SOF_TIMESTAMPING_RX_HARDWARE : SOF_TIMESTAMPING_RX_SOFTWARE);
+	}
+
+	if (setsockopt(iSocketId, SOL_SOCKET, SO_TIMESTAMPING, &iFlags, sizeof(iFlags)) < 0)
+	{
+		RTLX_VERBOSE(0, "Error %d (%s) setting SO_TIMESTAMPING\n", errno, strerror(errno));
+		return;
+	}
+
+#ifdef RTOS_RX_RING
+	// Receive ring reports hardware timestamps only if requested separately
+	if (!boTx && prSocket->boHwStamp)
+	{
+		iFlags = SOF_TIMESTAMPING_RAW_HARDWARE;
+		(VOID)setsockopt(iSocketId, SOL_PACKET, PACKET_TIMESTAMP, &iFlags, sizeof(iFlags));
+	}
+#endif
+}
+
+/**
+ * \fn static ULONGLONG RTLX_GetCmsgTimestamp(
+ *              RTLX_SOCKET_PORT* prSocket,
+ *              struct msghdr* prMsg
+ *          )
+ *
+ * \brief   Extracts the timestamp from the control messages of a received
+ *          message or error queue entry.
+ *
+ * \param[in]   prSocket    Socket of port
+ * \param[in]   prMsg       Message with control messages
+ *
+ * \return  Timestamp in ns, 0 if none
+ *
+ * \ingroup RTLX
+ *
+ */
+static ULONGLONG RTLX_GetCmsgTimestamp
+(
+		RTLX_SOCKET_PORT* prSocket,
+		struct msghdr* prMsg
+)
+{
+	struct cmsghdr*          prCmsg;
+	struct scm_timestamping* prStamps;
+	struct timespec*         prStamp;
+
+	for (
+			prCmsg = CMSG_FIRSTHDR(prMsg);
+			prCmsg != NULL;
+			prCmsg = CMSG_NXTHDR(prMsg, prCmsg)
+	)
+	{
+		if ((prCmsg->cmsg_level == SOL_SOCKET) && (prCmsg->cmsg_type == SCM_TIMESTAMPING))
+		{
+			prStamps = (struct scm_timestamping*)CMSG_DATA(prCmsg);
+
+			// Index 0: software, index 2: raw hardware timestamp
+			prStamp  = prSocket->boHwStamp ? &prStamps->ts[2] : &prStamps->ts[0];
+
+			return((ULONGLONG)prStamp->tv_sec * 1000000000ULL + (ULONGLONG)prStamp->tv_nsec);
+		}
+	}
+
+	return(0);
+}
+#endif
+
+#ifdef RTOS_RX_FILTER
+/**
+ * \fn static INT RTLX_AttachRxFilter(
+ *              RTLX_SOCKET_PORT* prSocket
+ *          )
+ *
+ * \brief   Attaches a classic BPF program to the receive socket of a port
+ *          that accepts Sercos telegrams and, unless
+ *          RTOS_FILTER_SERCOS_ETHERTYPE is set, packets for the UC channel
+ *          (addressed to the adapter or to a group address). All other
+ *          packets are dropped in the kernel. With RTOS_RX_FILTER_OUTGOING,
+ *          packets transmitted by this host are dropped as well.
+ *
+ * \param[in]   prSocket    Socket of port, receive socket opened
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error, socket is left unfiltered
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_AttachRxFilter
+(
+		RTLX_SOCKET_PORT* prSocket
+)
+{
+	struct sock_filter arCode[RTLX_BPF_MAX_INSTR];
+	struct sock_fprog  rProg;
+	INT                iLen = 0;
+	INT                iCnt;
+#ifndef RTOS_FILTER_SERCOS_ETHERTYPE
+	struct ifreq       rIfReq;
+	UCHAR*             pucMAC;
+
+	// Own MAC address for unicast UCC packets
+	(VOID)memset(&rIfReq, 0, sizeof(rIfReq));
+	(VOID)strncpy(rIfReq.ifr_name, prSocket->acName, IFNAMSIZ - 1);
+
+	if (ioctl(prSocket->iRxSocketId, SIOCGIFHWADDR, &rIfReq) < 0)
+	{
+		RTLX_VERBOSE
+		(
+				0,
+				"Error %d (%s) getting MAC address of %s\n",
+				errno,
+				strerror(errno),
+				prSocket->acName
+		);
+		return(RTOS_RET_ERROR);
+	}
+	pucMAC = (UCHAR*)rIfReq.ifr_hwaddr.sa_data;
+#endif
+
+#ifdef RTOS_RX_FILTER_OUTGOING
+	// Packets transmitted by this host, e.g. own MDTs
+	arCode[iLen++] = (struct sock_filter)
+			BPF_STMT(BPF_LD | BPF_W | BPF_ABS, SKF_AD_OFF + SKF_AD_PKTTYPE);
+	arCode[iLen++] = (struct sock_filter)
+			BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, PACKET_OUTGOING, RTLX_BPF_DROP, 0);
+#endif
+
+	// Sercos ether type
+	arCode[iLen++] = (struct sock_filter)
+			BPF_STMT(BPF_LD | BPF_H | BPF_ABS, 12);
+#ifdef RTOS_FILTER_SERCOS_ETHERTYPE
+	arCode[iLen++] = (struct sock_filter)
+			BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, SICE_SIII_ETHER_TYPE, RTLX_BPF_ACCEPT, RTLX_BPF_DROP);
+#else
+	arCode[iLen++] = (struct sock_filter)
+			BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, SICE_SIII_ETHER_TYPE, RTLX_BPF_ACCEPT, 0);
+
+	// UCC: Broadcast and multicast
+	arCode[iLen++] = (struct sock_filter)
+			BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 0);
+	arCode[iLen++] = (struct sock_filter)
+			BPF_JUMP(BPF_JMP | BPF_JSET | BPF_K, 0x01, RTLX_BPF_ACCEPT, 0);
+
+	// UCC: Unicast to own MAC address
+	arCode[iLen++] = (struct sock_filter)
+			BPF_STMT(BPF_LD | BPF_W | BPF_ABS, 2);
+	arCode[iLen++] = (struct sock_filter)
+			BPF_JUMP
+			(
+					BPF_JMP | BPF_JEQ | BPF_K,
+					((ULONG)pucMAC[2] << 24) | ((ULONG)pucMAC[3] << 16) |
+					((ULONG)pucMAC[4] << 8)  |  (ULONG)pucMAC[5],
+					0,
+					RTLX_BPF_DROP
+			);
+	arCode[iLen++] = (struct sock_filter)
+			BPF_STMT(BPF_LD | BPF_H | BPF_ABS, 0);
+	arCode[iLen++] = (struct sock_filter)
+			BPF_JUMP
+			(
+					BPF_JMP | BPF_JEQ | BPF_K,
+					((ULONG)pucMAC[0] << 8) | (ULONG)pucMAC[1],
+					RTLX_BPF_ACCEPT,
+					RTLX_BPF_DROP
+			);
+#endif
+
+	// Accept whole packet / drop
+	arCode[iLen++] = (struct sock_filter) BPF_STMT(BPF_RET | BPF_K, 0xFFFFFFFF);
+	arCode[iLen++] = (struct sock_filter) BPF_STMT(BPF_RET | BPF_K, 0);
+
+	// Resolve jump placeholders to relative offsets
+	for (
+			iCnt = 0;
+			iCnt < iLen;
+			iCnt++
+	)
+	{
+		if (BPF_CLASS(arCode[iCnt].code) == BPF_JMP)
+		{
+			if (arCode[iCnt].jt == RTLX_BPF_ACCEPT)
+			{
+				arCode[iCnt].jt = (UCHAR)(iLen - 2 - iCnt - 1);
+			}
+			else if (arCode[iCnt].jt == RTLX_BPF_DROP)
+			{
+				arCode[iCnt].jt = (UCHAR)(iLen - 1 - iCnt - 1);
+			}
+
+			if (arCode[iCnt].jf == RTLX_BPF_ACCEPT)
+			{
+				arCode[iCnt].jf = (UCHAR)(iLen - 2 - iCnt - 1);
+			}
+			else if (arCode[iCnt].jf == RTLX_BPF_DROP)
+			{
+				arCode[iCnt].jf = (UCHAR)(iLen - 1 - iCnt - 1);
+			}
+		}
+	}
+
+	rProg.len    = (USHORT)iLen;
+	rProg.filter = arCode;
+
+	if (setsockopt(prSocket->iRxSocketId, SOL_SOCKET, SO_ATTACH_FILTER, &rProg, sizeof(rProg)) < 0)
+	{
+		RTLX_VERBOSE
+		(
+				0,
+				"Error %d (%s) attaching receive filter on %s\n",
+				errno,
+				strerror(errno),
+				prSocket->acName
+		);
+		return(RTOS_RET_ERROR);
+	}
+
+	return(RTOS_RET_OK);
+}
+#endif
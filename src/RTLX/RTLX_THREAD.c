@@ -208,6 +208,36 @@ VOID RTLX_DestroyThreadData
     // Nothing to do on Linux systems, as RTLX_THREAD is a static structure
 }
 
+/**
+ * \fn INT RTLX_JoinThread(
+ *              RTLX_THREAD *pThread
+ *          )
+ *
+ * \brief   Waits until the thread given as parameter has terminated.
+ *
+ * \param[in]    pThread Thread to be waited for
+ *
+ * \return
+ * - 0 for success
+ * - -1 for error
+ *
+ * \ingroup RTLX
+ */
+INT RTLX_JoinThread
+    (
+      RTLX_THREAD *pThread
+    )
+{
+  if (pthread_join(*pThread, NULL) == 0)
+  {
+    return(RTOS_RET_OK);
+  }
+  else
+  {
+    return(RTOS_RET_ERROR);
+  }
+}
+
 /**
  * \fn INT RTLX_SetThreadPriority(
  *              INT iPriority
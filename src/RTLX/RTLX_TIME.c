@@ -31,21 +31,83 @@
 #include <time.h>   // needs rt-library; Project Explorer: Properties ->
                     // C/C++ Build -> GCC C++ Linker -> Libraries
 #include <sys/time.h>
+#include <errno.h>
+#include <pthread.h>
 /*lint -restore */
 
 #include "../RTLX/RTLX_GLOB.h"
 #include "../RTLX/RTLX_PRIV.h"
+#include "../RTLX/RTLX_S3SM_GLOB.h"
+#include "../RTLX/RTLX_S3SM_USER.h"
 #include "../GLOB/GLOB_DEFS.h"
 #include "../GLOB/GLOB_TYPE.h"
 
 //---- defines ----------------------------------------------------------------
 
+#define RTLX_NSEC_PER_SEC   (1000LL*1000*1000)
+
 //---- type definitions -------------------------------------------------------
 
+/**
+ * \struct  RTLX_CYCLE_CLOCK
+ *
+ * \brief   State of a cyclic sequence of absolute deadlines
+ */
+typedef struct
+{
+  LONGLONG        llNextNs;       /**< Next deadline in ns, 0 if not started */
+  ULONG           ulPeriodNs;     /**< Cycle period in ns */
+  volatile ULONG  ulOverruns;     /**< Number of missed deadlines */
+} RTLX_CYCLE_CLOCK;
+
+/**
+ * \struct  RTLX_CYCLE_TIMER
+ *
+ * \brief   Cyclic timer emulated by a thread
+ */
+typedef struct
+{
+  RTLX_CYCLE_CLOCK  rClock;       /**< Deadlines of timer */
+  RTLX_THREAD       rThread;      /**< Timer thread */
+  volatile BOOL     boRunning;    /**< Timer thread active */
+  volatile ULONG    ulNewPeriodNs;/**< Period to be taken over, 0 for none */
+  VOID              (*pAlarmFunc)(VOID);
+                                  /**< Function called on timer expiry */
+} RTLX_CYCLE_TIMER;
+
 //---- variable declarations --------------------------------------------------
 
+// Cyclic timers, one per instance
+static RTLX_CYCLE_TIMER RTLX_arCycleTimer[RTOS_MAX_INSTANCES];
+
+// Deadlines of RTLX_NanoSleepAbs(), not bound to an instance
+static RTLX_CYCLE_CLOCK RTLX_rSleepClock;
+
+// Calibrated spin time before deadlines in ns
+static LONG RTLX_lSpinNs = RTOS_NANOSLEEP_SPIN_NS;
+
 //---- function declarations --------------------------------------------------
 
+static LONGLONG RTLX_GetMonotonicNs
+    (
+      VOID
+    );
+
+static VOID RTLX_SleepUntilNs
+    (
+      LONGLONG llDeadlineNs
+    );
+
+static VOID RTLX_WaitCycle
+    (
+      RTLX_CYCLE_CLOCK *prClock
+    );
+
+static VOID* RTLX_CycleTimerThread
+    (
+      VOID *pvArg
+    );
+
 //---- function implementations -----------------------------------------------
 
 /**
@@ -122,7 +184,7 @@ VOID RTLX_IncTime
   else
   {
     pSystemTime->tv_nsec += lNanoSec;
-    if (pSystemTime->tv_nsec > 1000*1000*1000)
+    if (pSystemTime->tv_nsec >= 1000*1000*1000)
     {
       pSystemTime->tv_nsec -= 1000*1000*1000;
       pSystemTime->tv_sec++;
@@ -135,7 +197,8 @@ VOID RTLX_IncTime
  *              RTLX_TIMESPEC *pTargetTime
  *          )
  *
- * \brief   Waits until a certain system time
+ * \brief   Waits until a certain system time. The thread sleeps until
+ *          shortly before and spins for the rest of the time.
  *
  * \param[in]   pTargetTime Point of system time to wait for
  *
@@ -147,27 +210,11 @@ VOID RTLX_WaitForSystemTime
       RTLX_TIMESPEC *pTargetTime
     )
 {
-  RTLX_TIMESPEC tSystemTime;
-  BOOL boDone = FALSE;
-
-  do
-  {
-    (VOID)clock_gettime(CLOCK_MONOTONIC, &tSystemTime);
-
-    if (tSystemTime.tv_sec > pTargetTime->tv_sec)
-    {
-      boDone = TRUE;
-    }
-    else if (tSystemTime.tv_sec < pTargetTime->tv_sec)
-    {
-      boDone = FALSE;
-    }
-    else if (tSystemTime.tv_nsec > pTargetTime->tv_nsec)
-    {
-      boDone = TRUE;
-    }
-
-  } while (!boDone);
+  RTLX_SleepUntilNs
+      (
+        (LONGLONG)pTargetTime->tv_sec * RTLX_NSEC_PER_SEC +
+        (LONGLONG)pTargetTime->tv_nsec
+      );
 }
 
 /**
@@ -259,5 +306,513 @@ LONG RTLX_GetTimeS
   return(pTime->tv_sec);
 }
 
+/**
+ * \fn ULONGLONG RTLX_GetTaiTime(
+ *              VOID
+ *          )
+ *
+ * \brief   Reads the international atomic time (CLOCK_TAI).
+ *
+ * \return  TAI in ns
+ *
+ * \note    CLOCK_TAI only follows PTP if it is synchronized to the PTP
+ *          hardware clock, e.g. with phc2sys, and the TAI offset of the
+ *          kernel is set.
+ *
+ * \ingroup RTLX
+ *
+ */
+ULONGLONG RTLX_GetTaiTime
+    (
+      VOID
+    )
+{
+  struct timespec rNow;
+
+  (VOID)clock_gettime(CLOCK_TAI, &rNow);
+
+  return((ULONGLONG)rNow.tv_sec * RTLX_NSEC_PER_SEC + (ULONGLONG)rNow.tv_nsec);
+}
+
+/**
+ * \fn VOID RTLX_NanoSleepRel(
+ *              ULONG ulNanoSec
+ *          )
+ *
+ * \brief   Waits for a time relative to the call.
+ *
+ * \param[in]   ulNanoSec   Waiting time in ns
+ *
+ * \ingroup RTLX
+ *
+ */
+VOID RTLX_NanoSleepRel
+    (
+      ULONG ulNanoSec
+    )
+{
+  RTLX_SleepUntilNs(RTLX_GetMonotonicNs() + ulNanoSec);
+}
+
+/**
+ * \fn VOID RTLX_NanoSleepAbs(
+ *              ULONG ulNanoSec
+ *          )
+ *
+ * \brief   Waits for the next absolute deadline of a cycle with the given
+ *          period. The first call starts the cycle. Since the deadlines are
+ *          independent of the time of the call, the cycle does not drift.
+ *
+ * \param[in]   ulNanoSec   Cycle period in ns
+ *
+ * \note    Missed deadlines are skipped and counted, see RTLX_GetOverruns().
+ *
+ * \ingroup RTLX
+ *
+ */
+VOID RTLX_NanoSleepAbs
+    (
+      ULONG ulNanoSec
+    )
+{
+  RTLX_rSleepClock.ulPeriodNs = ulNanoSec;
+  RTLX_WaitCycle(&RTLX_rSleepClock);
+}
+
+/**
+ * \fn VOID RTLX_NanoSleep(
+ *              ULONG ulNanoSec
+ *          )
+ *
+ * \brief   Waits for the next Sercos cycle according to the timing mode
+ *          selected with RTOS_TIMING_MODE.
+ *
+ * \param[in]   ulNanoSec   Sercos cycle time in ns
+ *
+ * \note    In mode RTOS_TIMING_REL_NANOSLEEP_COMP, the waiting time is
+ *          corrected by a value per cycle, which is adapted after every
+ *          RTOS_NANOSLEEP_CORR_INTERVAL cycles with RTOS_NANOSLEEP_DYN_CORR.
+ *
+ * \ingroup RTLX
+ *
+ */
+VOID RTLX_NanoSleep
+    (
+      ULONG ulNanoSec
+    )
+{
+#if (RTOS_TIMING_MODE == RTOS_TIMING_ABS_NANOSLEEP)
+  RTLX_NanoSleepAbs(ulNanoSec);
+#elif (RTOS_TIMING_MODE == RTOS_TIMING_REL_NANOSLEEP_COMP)
+  static LONG     lCorrNs       = RTOS_NANOSLEEP_INIT_CORR_VALUE;
+  static ULONG    ulCycleCnt    = 0;
+  static LONGLONG llIntervalNs  = 0;
+  LONGLONG        llNowNs;
+  LONG            lErrNs;
+
+  RTLX_SleepUntilNs
+      (
+        RTLX_GetMonotonicNs() + (LONGLONG)ulNanoSec + lCorrNs
+      );
+
+  llNowNs = RTLX_GetMonotonicNs();
+
+  if (llIntervalNs == 0)
+  {
+    llIntervalNs = llNowNs;
+  }
+  else if (++ulCycleCnt >= RTOS_NANOSLEEP_CORR_INTERVAL)
+  {
+    // Deviation per cycle from the nominal cycle time in last interval
+    lErrNs = (LONG)((llNowNs - llIntervalNs -
+        (LONGLONG)ulNanoSec * RTOS_NANOSLEEP_CORR_INTERVAL) /
+        RTOS_NANOSLEEP_CORR_INTERVAL);
+
+    if (lErrNs > (LONG)ulNanoSec)
+    {
+      RTLX_rSleepClock.ulOverruns++;
+    }
+#ifdef RTOS_NANOSLEEP_DYN_CORR
+    lCorrNs -= (LONG)(RTOS_NANOSLEEP_CORR_FACTOR * lErrNs);
+#endif
+    RTLX_VERBOSE(2, "Timing deviation %d ns per cycle, correction %d ns\n", lErrNs, lCorrNs);
+
+    ulCycleCnt   = 0;
+    llIntervalNs = llNowNs;
+  }
+#else
+  RTLX_NanoSleepRel(ulNanoSec);
+#endif
+}
+
+/**
+ * \fn INT RTLX_InitTimer(
+ *              INT iInstanceNo,
+ *              ULONG ulTimeNs,
+ *              VOID* pAlarmFunc
+ *          )
+ *
+ * \brief   Starts a cyclic timer for timing mode RTOS_TIMING_TIMER. The timer
+ *          is emulated by a thread with priority RTOS_THREAD_PRIORITY_TIMER
+ *          that calls the alarm function at absolute deadlines.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   ulTimeNs    Timer period in ns
+ * \param[in]   pAlarmFunc  Function called on each timer expiry
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_InitTimer
+    (
+      INT iInstanceNo,
+      ULONG ulTimeNs,
+      VOID* pAlarmFunc
+    )
+{
+  RTLX_CYCLE_TIMER *prTimer;
+
+  if (
+      (iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) ||
+      (ulTimeNs == 0) || (pAlarmFunc == NULL)
+    )
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  prTimer = &RTLX_arCycleTimer[iInstanceNo];
+
+  if (prTimer->boRunning)
+  {
+    RTLX_VERBOSE(0, "Error: Timer of instance %d already running\n", iInstanceNo);
+    return(RTOS_RET_ERROR);
+  }
+
+  prTimer->pAlarmFunc         = (VOID (*)(VOID))pAlarmFunc;
+  prTimer->ulNewPeriodNs      = 0;
+  prTimer->rClock.ulPeriodNs  = ulTimeNs;
+  prTimer->rClock.llNextNs    = 0;
+  prTimer->rClock.ulOverruns  = 0;
+  prTimer->boRunning          = TRUE;
+
+  if (
+      RTLX_CreateThread
+          (
+            (VOID*)RTLX_CycleTimerThread,
+            &prTimer->rThread,
+            "RTLX_Timer",
+            prTimer
+          ) != RTOS_RET_OK
+    )
+  {
+    prTimer->boRunning = FALSE;
+    return(RTOS_RET_ERROR);
+  }
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn INT RTLX_SetTimerTime(
+ *              INT iInstanceNo,
+ *              ULONG ulTimeNs
+ *          )
+ *
+ * \brief   Changes the period of a running timer. The new period starts with
+ *          the next timer expiry.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   ulTimeNs    Timer period in ns
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_SetTimerTime
+    (
+      INT iInstanceNo,
+      ULONG ulTimeNs
+    )
+{
+  if (
+      (iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) ||
+      (ulTimeNs == 0) || !RTLX_arCycleTimer[iInstanceNo].boRunning
+    )
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  RTLX_arCycleTimer[iInstanceNo].ulNewPeriodNs = ulTimeNs;
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn VOID RTLX_CloseTimer(
+ *              INT iInstanceNo
+ *          )
+ *
+ * \brief   Stops a timer and waits for the end of the timer thread.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ *
+ * \ingroup RTLX
+ *
+ */
+VOID RTLX_CloseTimer
+    (
+      INT iInstanceNo
+    )
+{
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    return;
+  }
+
+  if (RTLX_arCycleTimer[iInstanceNo].boRunning)
+  {
+    RTLX_arCycleTimer[iInstanceNo].boRunning = FALSE;
+    (VOID)pthread_join(RTLX_arCycleTimer[iInstanceNo].rThread, NULL);
+  }
+}
+
+/**
+ * \fn VOID RTLX_CyclesToTime(
+ *              ULONG ulCycleTime,
+ *              ULONG ulNoOfCycles,
+ *              RTLX_TIMESPEC *tReqCycle
+ *          )
+ *
+ * \brief   Converts a number of cycles to a time.
+ *
+ * \param[in]   ulCycleTime     Cycle time in ns
+ * \param[in]   ulNoOfCycles    Number of cycles
+ * \param[out]  tReqCycle       Time of all cycles
+ *
+ * \ingroup RTLX
+ *
+ */
+VOID RTLX_CyclesToTime
+    (
+      ULONG ulCycleTime,
+      ULONG ulNoOfCycles,
+      RTLX_TIMESPEC *tReqCycle
+    )
+{
+  LONGLONG llTimeNs = (LONGLONG)ulCycleTime * ulNoOfCycles;
+
+  tReqCycle->tv_sec  = (time_t)(llTimeNs / RTLX_NSEC_PER_SEC);
+  tReqCycle->tv_nsec = (long)(llTimeNs % RTLX_NSEC_PER_SEC);
+}
+
+/**
+ * \fn ULONG RTLX_GetOverruns(
+ *              INT iInstanceNo
+ *          )
+ *
+ * \brief   Returns the number of missed cycle deadlines of the timer of an
+ *          instance. The deadlines missed in RTLX_NanoSleep() and
+ *          RTLX_NanoSleepAbs(), which are not bound to an instance, are
+ *          added for instance 0.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ *
+ * \return  Number of missed deadlines
+ *
+ * \ingroup RTLX
+ *
+ */
+ULONG RTLX_GetOverruns
+    (
+      INT iInstanceNo
+    )
+{
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    return(0);
+  }
+
+  if (iInstanceNo == 0)
+  {
+    return(RTLX_arCycleTimer[0].rClock.ulOverruns + RTLX_rSleepClock.ulOverruns);
+  }
+
+  return(RTLX_arCycleTimer[iInstanceNo].rClock.ulOverruns);
+}
+
+/**
+ * \fn static LONGLONG RTLX_GetMonotonicNs(
+ *              VOID
+ *          )
+ *
+ * \brief   Reads the monotonic system time.
+ *
+ * \return  System time in ns
+ *
+ * \ingroup RTLX
+ *
+ */
+static LONGLONG RTLX_GetMonotonicNs
+    (
+      VOID
+    )
+{
+  struct timespec rNow;
 
+  (VOID)clock_gettime(CLOCK_MONOTONIC, &rNow);
 
+  return((LONGLONG)rNow.tv_sec * RTLX_NSEC_PER_SEC + rNow.tv_nsec);
+}
+
+/**
+ * \fn static VOID RTLX_SleepUntilNs(
+ *              LONGLONG llDeadlineNs
+ *          )
+ *
+ * \brief   Waits until an absolute point of monotonic system time. The thread
+ *          sleeps until the calibrated spin time before the deadline and
+ *          spins for the rest of the time. The spin time follows the observed
+ *          wake-up latency: it is increased at once if the thread woke up too
+ *          late, otherwise slowly decreased.
+ *
+ * \param[in]   llDeadlineNs    Deadline in ns
+ *
+ * \ingroup RTLX
+ *
+ */
+static VOID RTLX_SleepUntilNs
+    (
+      LONGLONG llDeadlineNs
+    )
+{
+  struct timespec rWake;
+  LONGLONG        llWakeNs;
+  LONGLONG        llNowNs;
+  LONG            lLateNs;
+
+  llWakeNs = llDeadlineNs - RTLX_lSpinNs;
+  llNowNs  = RTLX_GetMonotonicNs();
+
+  if (llWakeNs > llNowNs)
+  {
+    rWake.tv_sec  = (time_t)(llWakeNs / RTLX_NSEC_PER_SEC);
+    rWake.tv_nsec = (long)(llWakeNs % RTLX_NSEC_PER_SEC);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &rWake, NULL) == EINTR)
+    {
+    }
+
+    llNowNs = RTLX_GetMonotonicNs();
+
+    // Calibrate spin time to wake-up latency
+    lLateNs = (LONG)(llNowNs - llWakeNs);
+    if (lLateNs > RTLX_lSpinNs)
+    {
+      RTLX_lSpinNs = lLateNs;
+    }
+    else
+    {
+      RTLX_lSpinNs -= (RTLX_lSpinNs - lLateNs) / 64;
+    }
+    if (RTLX_lSpinNs > RTOS_NANOSLEEP_SPIN_MAX_NS)
+    {
+      RTLX_lSpinNs = RTOS_NANOSLEEP_SPIN_MAX_NS;
+    }
+  }
+
+  while (llNowNs < llDeadlineNs)
+  {
+    llNowNs = RTLX_GetMonotonicNs();
+  }
+}
+
+/**
+ * \fn static VOID RTLX_WaitCycle(
+ *              RTLX_CYCLE_CLOCK *prClock
+ *          )
+ *
+ * \brief   Waits for the next deadline of a cycle. If the deadline has
+ *          already passed by one or more periods, the missed deadlines are
+ *          counted and skipped, so that the cycle stays aligned to its start.
+ *
+ * \param[in,out]   prClock Cycle state
+ *
+ * \ingroup RTLX
+ *
+ */
+static VOID RTLX_WaitCycle
+    (
+      RTLX_CYCLE_CLOCK *prClock
+    )
+{
+  LONGLONG llNowNs = RTLX_GetMonotonicNs();
+  LONGLONG llMissed;
+
+  if (prClock->llNextNs == 0)
+  {
+    prClock->llNextNs = llNowNs;
+  }
+
+  prClock->llNextNs += prClock->ulPeriodNs;
+
+  if (prClock->llNextNs <= llNowNs)
+  {
+    llMissed = (llNowNs - prClock->llNextNs) / prClock->ulPeriodNs + 1;
+
+    prClock->ulOverruns += (ULONG)llMissed;
+    prClock->llNextNs   += llMissed * prClock->ulPeriodNs;
+
+    RTLX_VERBOSE(1, "Cycle deadline missed, %d cycle(s) skipped\n", (INT)llMissed);
+  }
+
+  RTLX_SleepUntilNs(prClock->llNextNs);
+}
+
+/**
+ * \fn static VOID* RTLX_CycleTimerThread(
+ *              VOID *pvArg
+ *          )
+ *
+ * \brief   Timer thread: calls the alarm function at each deadline.
+ *
+ * \param[in]   pvArg   Pointer to timer
+ *
+ * \return  NULL
+ *
+ * \ingroup RTLX
+ *
+ */
+static VOID* RTLX_CycleTimerThread
+    (
+      VOID *pvArg
+    )
+{
+  RTLX_CYCLE_TIMER *prTimer = (RTLX_CYCLE_TIMER*)pvArg;
+
+  (VOID)RTLX_SetThreadPriority(RTOS_THREAD_PRIORITY_TIMER);
+
+  while (prTimer->boRunning)
+  {
+    if (prTimer->ulNewPeriodNs != 0)
+    {
+      prTimer->rClock.ulPeriodNs = prTimer->ulNewPeriodNs;
+      prTimer->ulNewPeriodNs     = 0;
+    }
+
+    RTLX_WaitCycle(&prTimer->rClock);
+
+    if (prTimer->boRunning)
+    {
+      prTimer->pAlarmFunc();
+    }
+  }
+
+  return(NULL);
+}
@@ -53,6 +53,23 @@
  */
 #define RTOS_MEM_PAGE_SIZE                  (4096)
 
+/**
+ * \def     RTOS_HUGE_PAGES
+ *
+ * \brief   If defined, RTLX_AllocLockedMem() maps huge pages of
+ *          RTOS_HUGE_PAGE_SIZE to avoid TLB misses. Huge pages have to be
+ *          reserved, e.g. with /proc/sys/vm/nr_hugepages. Otherwise, normal
+ *          pages are used.
+ */
+#define RTOS_HUGE_PAGES
+
+/**
+ * \def     RTOS_HUGE_PAGE_SIZE
+ *
+ * \brief   Size of a huge page in bytes.
+ */
+#define RTOS_HUGE_PAGE_SIZE                 (2 * 1024 * 1024)
+
 //---- type definitions -------------------------------------------------------
 
 //---- variable declarations --------------------------------------------------
@@ -0,0 +1,1433 @@
+/**
+ * \file      RTLX_XDP.c
+ *
+ * \brief     Real-time operating system abstraction layer for Linux RT-Preempt:
+ *            AF_XDP packet transmission and reception for Sercos soft master
+ *
+ * \attention Prototype status! Only for demo purposes! Not to be used in
+ *            machines, only in controlled safe environments! Risk of unwanted
+ *            machine movement!
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS"; WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY;
+ * FITNESS FOR A PERTICULAR PURPOSE AND NONINFRINGEMENT. THE AUTHORS OR COPYRIGHT
+ * HOLDERS SHALL NOT BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE;
+ * UNLESS STIPULATED BY MANDATORY LAW.
+ *
+ * \details   Replaces the raw socket functions of RTLX_SOCK.c if RTOS_XDP is
+ *            activated. Each port uses one AF_XDP socket bound to queue
+ *            RTOS_XDP_QUEUE of its adapter, with one UMEM for transmission
+ *            and reception. A small XDP program redirects the Sercos
+ *            telegrams (or, without RTOS_FILTER_SERCOS_ETHERTYPE, all packets)
+ *            of that queue to the socket.
+ *
+ *            The UMEM of a port is divided into receive frames, transmit
+ *            frames for packets handed over from outside of the UMEM, and
+ *            frames for the packet buffers of the Sercos IP core emulation,
+ *            see RTLX_XdpAllocTxFrame(). Packets located in the UMEM are
+ *            transmitted without copying.
+ *
+ *            No library is needed: the XDP program is loaded with the bpf()
+ *            system call and attached with rtnetlink.
+ *
+ * \ingroup   RTLX
+ */
+
+//---- includes ---------------------------------------------------------------
+
+#define SOURCE_RTLX
+
+#define _GNU_SOURCE
+
+/*lint -save -w0 */
+#include <stddef.h>
+#include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <net/if.h>
+#include <unistd.h>
+#include <errno.h>
+#include <linux/if_xdp.h>
+#include <linux/if_link.h>
+#include <linux/bpf.h>
+#include <linux/rtnetlink.h>
+/*lint -restore */
+
+#include "../RTLX/RTLX_GLOB.h"
+#include "../RTLX/RTLX_PRIV.h"
+#include "../RTLX/RTLX_S3SM_GLOB.h"
+#include "../RTLX/RTLX_S3SM_USER.h"
+#include "../GLOB/GLOB_DEFS.h"
+#include "../GLOB/GLOB_TYPE.h"
+#include "../SICE/SICE_GLOB.h"
+
+#ifdef RTOS_XDP
+
+//---- defines ----------------------------------------------------------------
+
+#define RTLX_XDP_FRAME_SIZE       (2048)    /**< Size of a UMEM frame in bytes */
+#define RTLX_XDP_NUM_RX_FRAMES    (64)      /**< UMEM frames for reception */
+#define RTLX_XDP_NUM_TX_FRAMES    (32)      /**< UMEM frames for copied transmit packets */
+#define RTLX_XDP_NUM_APP_FRAMES   (2 * CSMD_MAX_TEL)
+                                            /**< UMEM frames for IP core emulation */
+#define RTLX_XDP_NUM_FRAMES       (RTLX_XDP_NUM_RX_FRAMES + RTLX_XDP_NUM_TX_FRAMES + \
+                                   RTLX_XDP_NUM_APP_FRAMES)
+#define RTLX_XDP_RING_SIZE        (64)      /**< Entries per ring, power of 2 */
+
+#define RTLX_XDP_TX_BASE          ((ULONGLONG)RTLX_XDP_NUM_RX_FRAMES * RTLX_XDP_FRAME_SIZE)
+#define RTLX_XDP_APP_BASE         ((ULONGLONG)(RTLX_XDP_NUM_RX_FRAMES + RTLX_XDP_NUM_TX_FRAMES) * \
+                                   RTLX_XDP_FRAME_SIZE)
+
+#ifdef RTOS_XDP_DRV_MODE
+  #define RTLX_XDP_ATTACH_MODE    (XDP_FLAGS_DRV_MODE)
+#else
+  #define RTLX_XDP_ATTACH_MODE    (XDP_FLAGS_SKB_MODE)
+#endif
+
+#ifdef RTOS_XDP_ZEROCOPY
+  #define RTLX_XDP_BIND_MODE      (XDP_ZEROCOPY)
+#else
+  #define RTLX_XDP_BIND_MODE      (XDP_COPY)
+#endif
+
+//---- type definitions -------------------------------------------------------
+
+/**
+ * \struct  RTLX_XDP_RING
+ *
+ * \brief   Single producer/single consumer ring shared with the kernel
+ */
+typedef struct
+{
+  ULONG*    pulProducer;                    /**< Producer index */
+  ULONG*    pulConsumer;                    /**< Consumer index */
+  ULONG*    pulFlags;                       /**< Ring flags (need wakeup) */
+  VOID*     pvDesc;                         /**< Descriptor array */
+  VOID*     pvMap;                          /**< Mapped memory */
+  size_t    ulMapLen;                       /**< Length of mapped memory */
+} RTLX_XDP_RING;
+
+/**
+ * \struct  RTLX_XDP_PORT
+ *
+ * \brief   AF_XDP socket and UMEM of one port
+ */
+typedef struct
+{
+  INT           iSocketId;                  /**< AF_XDP socket handle */
+  INT           iMapFd;                     /**< XSKMAP handle */
+  INT           iProgFd;                    /**< XDP program handle */
+  INT           iIfIndex;                   /**< Interface index */
+  UCHAR*        pucUmem;                    /**< UMEM base address */
+  RTLX_XDP_RING rFill;                      /**< Fill ring */
+  RTLX_XDP_RING rComp;                      /**< Completion ring */
+  RTLX_XDP_RING rRx;                        /**< Receive ring */
+  RTLX_XDP_RING rTx;                        /**< Transmit ring */
+  ULONGLONG     aullTxFree[RTLX_XDP_NUM_TX_FRAMES];
+                                            /**< Free transmit frames */
+  INT           iTxFreeNum;                 /**< Number of free transmit frames */
+  INT           iAppFramesUsed;             /**< Frames handed out by RTLX_XdpAllocTxFrame() */
+  BOOL          boRxPending;                /**< Receive frame to be returned to fill ring */
+  ULONGLONG     ullRxPendingAddr;           /**< Address of that frame */
+} RTLX_XDP_PORT;
+
+typedef struct
+{
+  RTLX_XDP_PORT arPort[RTOS_MAX_PORTS];     /**< Ports */
+  INT           iNumPorts;                  /**< Number of opened ports */
+  BOOL          boTxOpen;                   /**< Opened by RTLX_XdpOpenTxSocket() */
+  BOOL          boRxOpen;                   /**< Opened by RTLX_XdpOpenRxSocket() */
+} RTLX_XDP_INSTANCE;
+
+//---- variable declarations --------------------------------------------------
+
+static RTLX_XDP_INSTANCE RTLX_XdpInstances[RTOS_MAX_INSTANCES];
+
+//---- function declarations --------------------------------------------------
+
+static INT RTLX_XdpOpen
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy
+    );
+
+static VOID RTLX_XdpClose
+    (
+      INT iInstanceNo
+    );
+
+static INT RTLX_XdpOpenPort
+    (
+      RTLX_XDP_PORT* prPort,
+      CHAR* pcName
+    );
+
+static VOID RTLX_XdpClosePort
+    (
+      RTLX_XDP_PORT* prPort
+    );
+
+static INT RTLX_XdpMapRing
+    (
+      RTLX_XDP_PORT* prPort,
+      RTLX_XDP_RING* prRing,
+      struct xdp_ring_offset* prOffset,
+      ULONGLONG ullPgOff,
+      size_t ulDescSize
+    );
+
+static INT RTLX_XdpLoadProgram
+    (
+      RTLX_XDP_PORT* prPort
+    );
+
+static INT RTLX_XdpAttachProgram
+    (
+      INT iIfIndex,
+      INT iProgFd,
+      ULONG ulFlags
+    );
+
+static VOID RTLX_XdpReapCompletions
+    (
+      RTLX_XDP_PORT* prPort
+    );
+
+static INT RTLX_XdpQueuePacket
+    (
+      RTLX_XDP_PORT* prPort,
+      UCHAR* pucFrame,
+      USHORT usLen,
+      UCHAR* pucPayload,
+      USHORT usPayloadLen
+    );
+
+static VOID RTLX_XdpKickTx
+    (
+      RTLX_XDP_PORT* prPort
+    );
+
+//---- function implementation ------------------------------------------------
+
+/**
+ * \fn INT RTLX_XdpOpenTxSocket(
+ *              INT iInstanceNo,
+ *              BOOL boRedundancy,
+ *              UCHAR* pucMAC
+ *          )
+ *
+ * \brief   Opens the AF_XDP sockets of the instance, one per port, and
+ *          returns the MAC address of the adapter of port P.
+ *
+ * \param[in]   iInstanceNo     Sercos IP core emulation instance number
+ * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
+ * \param[out]  pucMAC          Buffer for MAC address (6 bytes)
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_XdpOpenTxSocket
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy,
+      UCHAR* pucMAC
+    )
+{
+  struct ifreq rIfReq;
+  INT          iSocketId;
+  INT          iRet;
+
+  if (RTLX_XdpOpen(iInstanceNo, boRedundancy) != RTOS_RET_OK)
+  {
+    return(RTOS_RET_ERROR);
+  }
+  RTLX_XdpInstances[iInstanceNo].boTxOpen = TRUE;
+
+  // AF_XDP sockets do not support interface ioctls
+  iSocketId = socket(AF_INET, SOCK_DGRAM, 0);
+  if (iSocketId < 0)
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  (VOID)memset(&rIfReq, 0, sizeof(rIfReq));
+  (VOID)strncpy(rIfReq.ifr_name, RTLX_GetNicName(iInstanceNo, 0), IFNAMSIZ - 1);
+
+  iRet = ioctl(iSocketId, SIOCGIFHWADDR, &rIfReq);
+  (VOID)close(iSocketId);
+
+  if (iRet < 0)
+  {
+    RTLX_VERBOSE(0, "Error %d (%s) getting MAC address\n", errno, strerror(errno));
+    return(RTOS_RET_ERROR);
+  }
+
+  (VOID)memcpy(pucMAC, rIfReq.ifr_hwaddr.sa_data, 6);
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn INT RTLX_XdpOpenRxSocket(
+ *              INT iInstanceNo,
+ *              BOOL boRedundancy
+ *          )
+ *
+ * \brief   Opens the AF_XDP sockets of the instance, if not yet done by
+ *          RTLX_XdpOpenTxSocket(). Transmission and reception share the
+ *          socket of a port.
+ *
+ * \param[in]   iInstanceNo     Sercos IP core emulation instance number
+ * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_XdpOpenRxSocket
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy
+    )
+{
+  if (RTLX_XdpOpen(iInstanceNo, boRedundancy) != RTOS_RET_OK)
+  {
+    return(RTOS_RET_ERROR);
+  }
+  RTLX_XdpInstances[iInstanceNo].boRxOpen = TRUE;
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn VOID RTLX_XdpCloseTxSocket(
+ *              INT iInstanceNo,
+ *              BOOL boRedundancy
+ *          )
+ *
+ * \brief   Closes the transmit side. The sockets are closed as soon as
+ *          transmit and receive side are closed.
+ *
+ * \param[in]   iInstanceNo     Sercos IP core emulation instance number
+ * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
+ *
+ * \ingroup RTLX
+ *
+ */
+VOID RTLX_XdpCloseTxSocket
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy
+    )
+{
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    return;
+  }
+
+  RTLX_XdpInstances[iInstanceNo].boTxOpen = FALSE;
+  if (!RTLX_XdpInstances[iInstanceNo].boRxOpen)
+  {
+    RTLX_XdpClose(iInstanceNo);
+  }
+}
+
+/**
+ * \fn VOID RTLX_XdpCloseRxSocket(
+ *              INT iInstanceNo,
+ *              BOOL boRedundancy
+ *          )
+ *
+ * \brief   Closes the receive side. The sockets are closed as soon as
+ *          transmit and receive side are closed.
+ *
+ * \param[in]   iInstanceNo     Sercos IP core emulation instance number
+ * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
+ *
+ * \ingroup RTLX
+ *
+ */
+VOID RTLX_XdpCloseRxSocket
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy
+    )
+{
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    return;
+  }
+
+  RTLX_XdpInstances[iInstanceNo].boRxOpen = FALSE;
+  if (!RTLX_XdpInstances[iInstanceNo].boTxOpen)
+  {
+    RTLX_XdpClose(iInstanceNo);
+  }
+}
+
+/**
+ * \fn VOID* RTLX_XdpAllocTxFrame(
+ *              INT iInstanceNo,
+ *              INT iPort,
+ *              ULONG ulSize
+ *          )
+ *
+ * \brief   Hands out a UMEM frame of the port for a packet buffer that is
+ *          transmitted repeatedly. Packets built in such a buffer are
+ *          transmitted without copying.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   iPort       Port number
+ * \param[in]   ulSize      Size of buffer in bytes
+ *
+ * \note    The buffer is released when the sockets are closed. It must not be
+ *          changed while a transmission is in progress, which is given as
+ *          the telegrams are updated once per cycle.
+ *
+ * \return  Pointer to buffer, NULL if no frame is available
+ *
+ * \ingroup RTLX
+ *
+ */
+VOID* RTLX_XdpAllocTxFrame
+    (
+      INT iInstanceNo,
+      INT iPort,
+      ULONG ulSize
+    )
+{
+  RTLX_XDP_PORT* prPort;
+  VOID*          pvFrame;
+
+  if (
+      (iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) ||
+      (ulSize > RTLX_XDP_FRAME_SIZE)
+    )
+  {
+    return(NULL);
+  }
+
+  if ((iPort < 0) || (iPort >= RTLX_XdpInstances[iInstanceNo].iNumPorts))
+  {
+    iPort = 0;
+  }
+
+  prPort = &RTLX_XdpInstances[iInstanceNo].arPort[iPort];
+
+  if ((prPort->pucUmem == NULL) || (prPort->iAppFramesUsed >= RTLX_XDP_NUM_APP_FRAMES))
+  {
+    return(NULL);
+  }
+
+  pvFrame = prPort->pucUmem + RTLX_XDP_APP_BASE +
+      ((ULONGLONG)prPort->iAppFramesUsed * RTLX_XDP_FRAME_SIZE);
+  prPort->iAppFramesUsed++;
+
+  (VOID)memset(pvFrame, 0, ulSize);
+
+  return(pvFrame);
+}
+
+/**
+ * \fn INT RTLX_XdpTxPacket(
+ *              INT iInstanceNo,
+ *              INT iPort,
+ *              UCHAR* pucFrame,
+ *              USHORT usLen,
+ *              USHORT usIFG
+ *          )
+ *
+ * \brief   Transmits a raw Ethernet packet on the AF_XDP socket of the port
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   iPort       Port number
+ * \param[in]   pucFrame    Pointer to packet buffer
+ * \param[in]   usLen       Packet length
+ * \param[in]   usIFG       Required inter frame gap
+ *
+ * \note    Inter frame gap not yet taken into account
+ *
+ * \return
+ * - >0: Number of bytes transmitted
+ * - <0: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_XdpTxPacket
+    (
+      INT iInstanceNo,
+      INT iPort,
+      UCHAR* pucFrame,
+      USHORT usLen,
+      USHORT usIFG
+    )
+{
+  RTLX_XDP_PORT* prPort;
+
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  // Without redundancy, packets for port S are transmitted on port P
+  if ((iPort < 0) || (iPort >= RTLX_XdpInstances[iInstanceNo].iNumPorts))
+  {
+    iPort = 0;
+  }
+
+  prPort = &RTLX_XdpInstances[iInstanceNo].arPort[iPort];
+
+  RTLX_XdpReapCompletions(prPort);
+
+  if (RTLX_XdpQueuePacket(prPort, pucFrame, usLen, NULL, 0) != RTOS_RET_OK)
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  RTLX_XdpKickTx(prPort);
+
+  return((INT)usLen);
+}
+
+/**
+ * \fn INT RTLX_XdpTxPacketBatch(
+ *              INT iInstanceNo,
+ *              UCHAR** apucFrame,
+ *              USHORT* ausLen,
+ *              UCHAR** apucPayload,
+ *              USHORT* ausPayloadLen,
+ *              UCHAR* aucPort,
+ *              USHORT usNum,
+ *              USHORT usIFG
+ *          )
+ *
+ * \brief   Transmits a batch of raw Ethernet packets in the given order.
+ *          All packets are placed in the transmit rings first, then each
+ *          port is kicked once.
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   apucFrame   Array of pointers to packet buffers
+ * \param[in]   ausLen      Array of packet lengths
+ * \param[in]   apucPayload Array of pointers to the second parts of the
+ *                          packets, entries may be NULL. May be NULL if no
+ *                          packet consists of two parts.
+ * \param[in]   ausPayloadLen Array of lengths of the second parts
+ * \param[in]   aucPort     Array of port numbers
+ * \param[in]   usNum       Number of packets
+ * \param[in]   usIFG       Required inter frame gap
+ *
+ * \note    Packets with a second part are assembled in a transmit frame of
+ *          the UMEM.
+ *
+ * \note    Inter frame gap not yet taken into account
+ *
+ * \return
+ * - >=0: Number of packets transmitted
+ * - <0: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_XdpTxPacketBatch
+    (
+      INT iInstanceNo,
+      UCHAR** apucFrame,
+      USHORT* ausLen,
+      UCHAR** apucPayload,
+      USHORT* ausPayloadLen,
+      UCHAR* aucPort,
+      USHORT usNum,
+      USHORT usIFG
+    )
+{
+  RTLX_XDP_INSTANCE* prInst;
+  INT                iPort;
+  USHORT             usCnt;
+  BOOL               aboUsed[RTOS_MAX_PORTS];
+
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  prInst = &RTLX_XdpInstances[iInstanceNo];
+
+  for (
+      iPort = 0;
+      iPort < prInst->iNumPorts;
+      iPort++
+    )
+  {
+    RTLX_XdpReapCompletions(&prInst->arPort[iPort]);
+    aboUsed[iPort] = FALSE;
+  }
+
+  for (
+      usCnt = 0;
+      usCnt < usNum;
+      usCnt++
+    )
+  {
+    iPort = (aucPort[usCnt] < prInst->iNumPorts) ? (INT)aucPort[usCnt] : 0;
+
+    if (
+        RTLX_XdpQueuePacket
+        (
+          &prInst->arPort[iPort],
+          apucFrame[usCnt],
+          ausLen[usCnt],
+          (apucPayload != NULL) ? apucPayload[usCnt] : NULL,
+          (apucPayload != NULL) ? ausPayloadLen[usCnt] : 0
+        ) != RTOS_RET_OK
+      )
+    {
+      break;
+    }
+    aboUsed[iPort] = TRUE;
+  }
+
+  for (
+      iPort = 0;
+      iPort < prInst->iNumPorts;
+      iPort++
+    )
+  {
+    if (aboUsed[iPort])
+    {
+      RTLX_XdpKickTx(&prInst->arPort[iPort]);
+    }
+  }
+
+  return((usCnt == usNum) ? (INT)usNum : RTOS_RET_ERROR);
+}
+
+/**
+ * \fn INT RTLX_XdpRxPacket(
+ *              INT iInstanceNo,
+ *              INT iPort,
+ *              UCHAR* pucFrame,
+ *              UCHAR** ppucFrame
+ *          )
+ *
+ * \brief   Receives a raw Ethernet packet from the AF_XDP socket of the port
+ *          without copying (non-blocking).
+ *
+ * \param[in]   iInstanceNo Sercos IP core emulation instance number
+ * \param[in]   iPort       Port number
+ * \param[in]   pucFrame    Provided packet buffer, not used
+ * \param[out]  ppucFrame   Pointer to packet in UMEM
+ *
+ * \note    The packet stays valid until the next call for the port.
+ *
+ * \return
+ * - >0: Number of bytes received
+ * - 0: No packet received
+ * - <0: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+INT RTLX_XdpRxPacket
+    (
+      INT iInstanceNo,
+      INT iPort,
+      UCHAR* pucFrame,
+      UCHAR** ppucFrame
+    )
+{
+  RTLX_XDP_PORT*   prPort;
+  struct xdp_desc* prDesc;
+  ULONG            ulProd;
+  ULONG            ulCons;
+
+  *ppucFrame = NULL;
+
+  if (
+      (iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES) ||
+      (iPort < 0) || (iPort >= RTLX_XdpInstances[iInstanceNo].iNumPorts)
+    )
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  prPort = &RTLX_XdpInstances[iInstanceNo].arPort[iPort];
+
+  // Return frame of previous packet to kernel. The fill ring has room for
+  // all receive frames, so it can not be full.
+  if (prPort->boRxPending)
+  {
+    ulProd = *prPort->rFill.pulProducer;
+    ((ULONGLONG*)prPort->rFill.pvDesc)[ulProd & (RTLX_XDP_RING_SIZE - 1)] = prPort->ullRxPendingAddr;
+    __atomic_store_n(prPort->rFill.pulProducer, ulProd + 1, __ATOMIC_RELEASE);
+    prPort->boRxPending = FALSE;
+  }
+
+  ulCons = *prPort->rRx.pulConsumer;
+  ulProd = __atomic_load_n(prPort->rRx.pulProducer, __ATOMIC_ACQUIRE);
+
+  if (ulCons == ulProd)
+  {
+    // Driver waits for fill ring entries
+    if (*prPort->rFill.pulFlags & XDP_RING_NEED_WAKEUP)
+    {
+      (VOID)recvfrom(prPort->iSocketId, NULL, 0, MSG_DONTWAIT, NULL, NULL);
+    }
+    return(0);
+  }
+
+  prDesc = &((struct xdp_desc*)prPort->rRx.pvDesc)[ulCons & (RTLX_XDP_RING_SIZE - 1)];
+
+  *ppucFrame                = prPort->pucUmem + prDesc->addr;
+  prPort->ullRxPendingAddr  = prDesc->addr & ~((ULONGLONG)RTLX_XDP_FRAME_SIZE - 1);
+  prPort->boRxPending       = TRUE;
+
+  __atomic_store_n(prPort->rRx.pulConsumer, ulCons + 1, __ATOMIC_RELEASE);
+
+  return((INT)prDesc->len);
+}
+
+/**
+ * \fn static INT RTLX_XdpOpen(
+ *              INT iInstanceNo,
+ *              BOOL boRedundancy
+ *          )
+ *
+ * \brief   Opens the AF_XDP sockets of all ports of the instance, if not
+ *          already open.
+ *
+ * \param[in]   iInstanceNo     Sercos IP core emulation instance number
+ * \param[in]   boRedundancy    Defines whether Sercos port redundancy is used
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_XdpOpen
+    (
+      INT iInstanceNo,
+      BOOL boRedundancy
+    )
+{
+  RTLX_XDP_INSTANCE* prInst;
+  INT                iPortCnt = boRedundancy ? 2 : 1;
+  INT                iPort;
+
+  if ((iInstanceNo < 0) || (iInstanceNo >= RTOS_MAX_INSTANCES))
+  {
+    RTLX_VERBOSE
+    (
+      0,
+      "RTLX_XdpOpen() instance %d too large, only %d available\n",
+      iInstanceNo,
+      RTOS_MAX_INSTANCES
+    );
+    return(RTOS_RET_ERROR);
+  }
+
+  prInst = &RTLX_XdpInstances[iInstanceNo];
+
+  if (prInst->iNumPorts > 0)
+  {
+    return(RTOS_RET_OK);
+  }
+
+  for (
+      iPort = 0;
+      iPort < iPortCnt;
+      iPort++
+    )
+  {
+    if (RTLX_XdpOpenPort(&prInst->arPort[iPort], RTLX_GetNicName(iInstanceNo, iPort)) != RTOS_RET_OK)
+    {
+      RTLX_XdpClose(iInstanceNo);
+      return(RTOS_RET_ERROR);
+    }
+    prInst->iNumPorts = iPort + 1;
+  }
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn static VOID RTLX_XdpClose(
+ *              INT iInstanceNo
+ *          )
+ *
+ * \brief   Closes the AF_XDP sockets of all ports of the instance.
+ *
+ * \param[in]   iInstanceNo     Sercos IP core emulation instance number
+ *
+ * \ingroup RTLX
+ *
+ */
+static VOID RTLX_XdpClose
+    (
+      INT iInstanceNo
+    )
+{
+  RTLX_XDP_INSTANCE* prInst = &RTLX_XdpInstances[iInstanceNo];
+  INT                iPort;
+
+  for (
+      iPort = 0;
+      iPort < RTOS_MAX_PORTS;
+      iPort++
+    )
+  {
+    RTLX_XdpClosePort(&prInst->arPort[iPort]);
+  }
+
+  prInst->iNumPorts = 0;
+}
+
+/**
+ * \fn static INT RTLX_XdpOpenPort(
+ *              RTLX_XDP_PORT* prPort,
+ *              CHAR* pcName
+ *          )
+ *
+ * \brief   Sets up UMEM, rings and XDP program of a port and binds the
+ *          AF_XDP socket to queue RTOS_XDP_QUEUE of the adapter.
+ *
+ * \param[out]  prPort      Port
+ * \param[in]   pcName      Name of adapter
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error, port is left closed
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_XdpOpenPort
+    (
+      RTLX_XDP_PORT* prPort,
+      CHAR* pcName
+    )
+{
+  struct xdp_umem_reg     rUmemReg;
+  struct xdp_mmap_offsets rOffsets;
+  struct sockaddr_xdp     rAddr;
+  socklen_t               iOptLen  = sizeof(rOffsets);
+  INT                     iRingSize = RTLX_XDP_RING_SIZE;
+  INT                     iKey      = RTOS_XDP_QUEUE;
+  INT                     iCnt;
+  union bpf_attr          rAttr;
+
+  (VOID)memset(prPort, 0, sizeof(RTLX_XDP_PORT));
+  prPort->iSocketId = -1;
+  prPort->iMapFd    = -1;
+  prPort->iProgFd   = -1;
+
+  prPort->iIfIndex = (INT)if_nametoindex(pcName);
+  if (prPort->iIfIndex == 0)
+  {
+    RTLX_VERBOSE(0, "Error: Unknown adapter %s\n", pcName);
+    return(RTOS_RET_ERROR);
+  }
+
+  prPort->iSocketId = socket(AF_XDP, SOCK_RAW, 0);
+  if (prPort->iSocketId < 0)
+  {
+    RTLX_VERBOSE(0, "Error %d (%s) creating AF_XDP socket\n", errno, strerror(errno));
+    return(RTOS_RET_ERROR);
+  }
+
+  // UMEM, locked to avoid page faults in the cycle
+  prPort->pucUmem = (UCHAR*)mmap
+      (
+        NULL,
+        (size_t)RTLX_XDP_NUM_FRAMES * RTLX_XDP_FRAME_SIZE,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE | MAP_LOCKED,
+        -1,
+        0
+      );
+  if (prPort->pucUmem == MAP_FAILED)
+  {
+    prPort->pucUmem = NULL;
+    RTLX_VERBOSE(0, "Error %d (%s) allocating UMEM\n", errno, strerror(errno));
+    RTLX_XdpClosePort(prPort);
+    return(RTOS_RET_ERROR);
+  }
+
+  (VOID)memset(&rUmemReg, 0, sizeof(rUmemReg));
+  rUmemReg.addr       = (ULONGLONG)(size_t)prPort->pucUmem;
+  rUmemReg.len        = (ULONGLONG)RTLX_XDP_NUM_FRAMES * RTLX_XDP_FRAME_SIZE;
+  rUmemReg.chunk_size = RTLX_XDP_FRAME_SIZE;
+  rUmemReg.headroom   = 0;
+
+  if (
+      (setsockopt(prPort->iSocketId, SOL_XDP, XDP_UMEM_REG, &rUmemReg, sizeof(rUmemReg)) < 0)                  ||
+      (setsockopt(prPort->iSocketId, SOL_XDP, XDP_UMEM_FILL_RING, &iRingSize, sizeof(iRingSize)) < 0)          ||
+      (setsockopt(prPort->iSocketId, SOL_XDP, XDP_UMEM_COMPLETION_RING, &iRingSize, sizeof(iRingSize)) < 0)    ||
+      (setsockopt(prPort->iSocketId, SOL_XDP, XDP_RX_RING, &iRingSize, sizeof(iRingSize)) < 0)                 ||
+      (setsockopt(prPort->iSocketId, SOL_XDP, XDP_TX_RING, &iRingSize, sizeof(iRingSize)) < 0)                 ||
+      (getsockopt(prPort->iSocketId, SOL_XDP, XDP_MMAP_OFFSETS, &rOffsets, &iOptLen) < 0)
+    )
+  {
+    RTLX_VERBOSE(0, "Error %d (%s) setting up AF_XDP rings\n", errno, strerror(errno));
+    RTLX_XdpClosePort(prPort);
+    return(RTOS_RET_ERROR);
+  }
+
+  if (
+      (RTLX_XdpMapRing(prPort, &prPort->rFill, &rOffsets.fr, XDP_UMEM_PGOFF_FILL_RING, sizeof(ULONGLONG)) != RTOS_RET_OK)             ||
+      (RTLX_XdpMapRing(prPort, &prPort->rComp, &rOffsets.cr, XDP_UMEM_PGOFF_COMPLETION_RING, sizeof(ULONGLONG)) != RTOS_RET_OK)       ||
+      (RTLX_XdpMapRing(prPort, &prPort->rRx, &rOffsets.rx, XDP_PGOFF_RX_RING, sizeof(struct xdp_desc)) != RTOS_RET_OK)                ||
+      (RTLX_XdpMapRing(prPort, &prPort->rTx, &rOffsets.tx, XDP_PGOFF_TX_RING, sizeof(struct xdp_desc)) != RTOS_RET_OK)
+    )
+  {
+    RTLX_XdpClosePort(prPort);
+    return(RTOS_RET_ERROR);
+  }
+
+  // Hand over all receive frames to the kernel
+  for (
+      iCnt = 0;
+      iCnt < RTLX_XDP_NUM_RX_FRAMES;
+      iCnt++
+    )
+  {
+    ((ULONGLONG*)prPort->rFill.pvDesc)[iCnt] = (ULONGLONG)iCnt * RTLX_XDP_FRAME_SIZE;
+  }
+  __atomic_store_n(prPort->rFill.pulProducer, (ULONG)RTLX_XDP_NUM_RX_FRAMES, __ATOMIC_RELEASE);
+
+  // All transmit frames are free
+  for (
+      iCnt = 0;
+      iCnt < RTLX_XDP_NUM_TX_FRAMES;
+      iCnt++
+    )
+  {
+    prPort->aullTxFree[iCnt] = RTLX_XDP_TX_BASE + ((ULONGLONG)iCnt * RTLX_XDP_FRAME_SIZE);
+  }
+  prPort->iTxFreeNum = RTLX_XDP_NUM_TX_FRAMES;
+
+  (VOID)memset(&rAddr, 0, sizeof(rAddr));
+  rAddr.sxdp_family   = AF_XDP;
+  rAddr.sxdp_ifindex  = (ULONG)prPort->iIfIndex;
+  rAddr.sxdp_queue_id = RTOS_XDP_QUEUE;
+  rAddr.sxdp_flags    = XDP_USE_NEED_WAKEUP | RTLX_XDP_BIND_MODE;
+
+  if (bind(prPort->iSocketId, (struct sockaddr*)&rAddr, sizeof(rAddr)) < 0)
+  {
+    RTLX_VERBOSE(0, "Error %d (%s) binding AF_XDP socket to %s\n", errno, strerror(errno), pcName);
+    RTLX_XdpClosePort(prPort);
+    return(RTOS_RET_ERROR);
+  }
+
+  // Redirect packets of the queue to the socket
+  if (RTLX_XdpLoadProgram(prPort) != RTOS_RET_OK)
+  {
+    RTLX_XdpClosePort(prPort);
+    return(RTOS_RET_ERROR);
+  }
+
+  (VOID)memset(&rAttr, 0, sizeof(rAttr));
+  rAttr.map_fd = (ULONG)prPort->iMapFd;
+  rAttr.key    = (ULONGLONG)(size_t)&iKey;
+  rAttr.value  = (ULONGLONG)(size_t)&prPort->iSocketId;
+
+  if (syscall(__NR_bpf, BPF_MAP_UPDATE_ELEM, &rAttr, sizeof(rAttr)) < 0)
+  {
+    RTLX_VERBOSE(0, "Error %d (%s) registering AF_XDP socket\n", errno, strerror(errno));
+    RTLX_XdpClosePort(prPort);
+    return(RTOS_RET_ERROR);
+  }
+
+  if (RTLX_XdpAttachProgram(prPort->iIfIndex, prPort->iProgFd, XDP_FLAGS_UPDATE_IF_NOEXIST | RTLX_XDP_ATTACH_MODE) != RTOS_RET_OK)
+  {
+    RTLX_VERBOSE(0, "Error: Could not attach XDP program to %s\n", pcName);
+    RTLX_XdpClosePort(prPort);
+    return(RTOS_RET_ERROR);
+  }
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn static VOID RTLX_XdpClosePort(
+ *              RTLX_XDP_PORT* prPort
+ *          )
+ *
+ * \brief   Detaches the XDP program and releases socket, rings and UMEM of a
+ *          port.
+ *
+ * \param[in,out]   prPort      Port
+ *
+ * \ingroup RTLX
+ *
+ */
+static VOID RTLX_XdpClosePort
+    (
+      RTLX_XDP_PORT* prPort
+    )
+{
+  RTLX_XDP_RING* aprRing[4];
+  INT            iCnt;
+
+  aprRing[0] = &prPort->rFill;
+  aprRing[1] = &prPort->rComp;
+  aprRing[2] = &prPort->rRx;
+  aprRing[3] = &prPort->rTx;
+
+  if (prPort->iProgFd > 0)
+  {
+    (VOID)RTLX_XdpAttachProgram(prPort->iIfIndex, -1, RTLX_XDP_ATTACH_MODE);
+    (VOID)close(prPort->iProgFd);
+  }
+  if (prPort->iMapFd > 0)
+  {
+    (VOID)close(prPort->iMapFd);
+  }
+
+  for (
+      iCnt = 0;
+      iCnt < 4;
+      iCnt++
+    )
+  {
+    if (aprRing[iCnt]->pvMap != NULL)
+    {
+      (VOID)munmap(aprRing[iCnt]->pvMap, aprRing[iCnt]->ulMapLen);
+    }
+  }
+
+  if (prPort->iSocketId > 0)
+  {
+    (VOID)close(prPort->iSocketId);
+  }
+  if (prPort->pucUmem != NULL)
+  {
+    (VOID)munmap(prPort->pucUmem, (size_t)RTLX_XDP_NUM_FRAMES * RTLX_XDP_FRAME_SIZE);
+  }
+
+  (VOID)memset(prPort, 0, sizeof(RTLX_XDP_PORT));
+  prPort->iSocketId = -1;
+  prPort->iMapFd    = -1;
+  prPort->iProgFd   = -1;
+}
+
+/**
+ * \fn static INT RTLX_XdpMapRing(
+ *              RTLX_XDP_PORT* prPort,
+ *              RTLX_XDP_RING* prRing,
+ *              struct xdp_ring_offset* prOffset,
+ *              ULONGLONG ullPgOff,
+ *              size_t ulDescSize
+ *          )
+ *
+ * \brief   Maps one of the rings of the AF_XDP socket.
+ *
+ * \param[in]   prPort      Port, socket opened and rings configured
+ * \param[out]  prRing      Ring
+ * \param[in]   prOffset    Offsets of ring members
+ * \param[in]   ullPgOff    Offset of ring for mmap()
+ * \param[in]   ulDescSize  Size of ring entry
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_XdpMapRing
+    (
+      RTLX_XDP_PORT* prPort,
+      RTLX_XDP_RING* prRing,
+      struct xdp_ring_offset* prOffset,
+      ULONGLONG ullPgOff,
+      size_t ulDescSize
+    )
+{
+  UCHAR* pucMap;
+
+  prRing->ulMapLen = (size_t)prOffset->desc + (RTLX_XDP_RING_SIZE * ulDescSize);
+
+  pucMap = (UCHAR*)mmap
+      (
+        NULL,
+        prRing->ulMapLen,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        prPort->iSocketId,
+        (off_t)ullPgOff
+      );
+  if (pucMap == MAP_FAILED)
+  {
+    RTLX_VERBOSE(0, "Error %d (%s) mapping AF_XDP ring\n", errno, strerror(errno));
+    return(RTOS_RET_ERROR);
+  }
+
+  prRing->pvMap       = pucMap;
+  prRing->pulProducer = (ULONG*)(pucMap + prOffset->producer);
+  prRing->pulConsumer = (ULONG*)(pucMap + prOffset->consumer);
+  prRing->pulFlags    = (ULONG*)(pucMap + prOffset->flags);
+  prRing->pvDesc      = pucMap + prOffset->desc;
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn static INT RTLX_XdpLoadProgram(
+ *              RTLX_XDP_PORT* prPort
+ *          )
+ *
+ * \brief   Creates the socket map and loads the XDP program of a port.
+ *
+ * \details The program redirects the packets of a queue to the socket
+ *          registered for the queue in the map. With
+ *          RTOS_FILTER_SERCOS_ETHERTYPE, packets with an other ether type are
+ *          passed to the network stack instead.
+ *
+ * \param[in,out]   prPort      Port
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_XdpLoadProgram
+    (
+      RTLX_XDP_PORT* prPort
+    )
+{
+  union bpf_attr   rAttr;
+  struct bpf_insn  arProg[] =
+  {
+    // Ether type check, only with RTOS_FILTER_SERCOS_ETHERTYPE
+    /* 0 */ { BPF_LDX | BPF_W | BPF_MEM, 2, 1, offsetof(struct xdp_md, data), 0 },
+    /* 1 */ { BPF_LDX | BPF_W | BPF_MEM, 3, 1, offsetof(struct xdp_md, data_end), 0 },
+    /* 2 */ { BPF_ALU64 | BPF_MOV | BPF_X, 4, 2, 0, 0 },
+    /* 3 */ { BPF_ALU64 | BPF_ADD | BPF_K, 4, 0, 0, 14 },
+    /* 4 */ { BPF_JMP | BPF_JGT | BPF_X, 4, 3, 8, 0 },
+    /* 5 */ { BPF_LDX | BPF_H | BPF_MEM, 4, 2, 12, 0 },
+    /* 6 */ { BPF_JMP | BPF_JNE | BPF_K, 4, 0, 6, htons(SICE_SIII_ETHER_TYPE) },
+    // Redirect to socket of queue, pass if there is none
+    /* 7 */ { BPF_LDX | BPF_W | BPF_MEM, 2, 1, offsetof(struct xdp_md, rx_queue_index), 0 },
+    /* 8 */ { BPF_LD | BPF_DW | BPF_IMM, 1, BPF_PSEUDO_MAP_FD, 0, 0 },
+    /* 9 */ { 0, 0, 0, 0, 0 },
+    /* 10 */{ BPF_ALU64 | BPF_MOV | BPF_K, 3, 0, 0, XDP_PASS },
+    /* 11 */{ BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map },
+    /* 12 */{ BPF_JMP | BPF_EXIT, 0, 0, 0, 0 },
+    // Pass to network stack, only with RTOS_FILTER_SERCOS_ETHERTYPE
+    /* 13 */{ BPF_ALU64 | BPF_MOV | BPF_K, 0, 0, 0, XDP_PASS },
+    /* 14 */{ BPF_JMP | BPF_EXIT, 0, 0, 0, 0 }
+  };
+#ifdef RTOS_FILTER_SERCOS_ETHERTYPE
+  INT              iStart = 0;
+  INT              iEnd   = 15;
+#else
+  INT              iStart = 7;
+  INT              iEnd   = 13;
+#endif
+
+  (VOID)memset(&rAttr, 0, sizeof(rAttr));
+  rAttr.map_type    = BPF_MAP_TYPE_XSKMAP;
+  rAttr.key_size    = sizeof(INT);
+  rAttr.value_size  = sizeof(INT);
+  rAttr.max_entries = RTOS_XDP_QUEUE + 1;
+
+  prPort->iMapFd = (INT)syscall(__NR_bpf, BPF_MAP_CREATE, &rAttr, sizeof(rAttr));
+  if (prPort->iMapFd < 0)
+  {
+    RTLX_VERBOSE(0, "Error %d (%s) creating XSKMAP\n", errno, strerror(errno));
+    return(RTOS_RET_ERROR);
+  }
+
+  arProg[8].imm = prPort->iMapFd;
+
+  (VOID)memset(&rAttr, 0, sizeof(rAttr));
+  rAttr.prog_type = BPF_PROG_TYPE_XDP;
+  rAttr.insns     = (ULONGLONG)(size_t)&arProg[iStart];
+  rAttr.insn_cnt  = (ULONG)(iEnd - iStart);
+  rAttr.license   = (ULONGLONG)(size_t)"Dual MIT/GPL";
+
+  prPort->iProgFd = (INT)syscall(__NR_bpf, BPF_PROG_LOAD, &rAttr, sizeof(rAttr));
+  if (prPort->iProgFd < 0)
+  {
+    RTLX_VERBOSE(0, "Error %d (%s) loading XDP program\n", errno, strerror(errno));
+    return(RTOS_RET_ERROR);
+  }
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn static INT RTLX_XdpAttachProgram(
+ *              INT iIfIndex,
+ *              INT iProgFd,
+ *              ULONG ulFlags
+ *          )
+ *
+ * \brief   Attaches an XDP program to an adapter, or detaches it, using
+ *          rtnetlink.
+ *
+ * \param[in]   iIfIndex    Interface index
+ * \param[in]   iProgFd     Program handle, -1 to detach
+ * \param[in]   ulFlags     XDP_FLAGS_*
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_XdpAttachProgram
+    (
+      INT iIfIndex,
+      INT iProgFd,
+      ULONG ulFlags
+    )
+{
+  struct
+  {
+    struct nlmsghdr   rHdr;
+    struct ifinfomsg  rIfInfo;
+    UCHAR             aucAttr[64];
+  } rReq;
+  struct sockaddr_nl rAddr;
+  struct rtattr*     prNest;
+  struct rtattr*     prAttr;
+  struct nlmsgerr*   prErr;
+  UCHAR              aucBuf[512];
+  INT                iSocketId;
+  INT                iLen;
+  INT                iRet = RTOS_RET_ERROR;
+
+  iSocketId = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+  if (iSocketId < 0)
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  (VOID)memset(&rReq, 0, sizeof(rReq));
+  rReq.rHdr.nlmsg_len       = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+  rReq.rHdr.nlmsg_type      = RTM_SETLINK;
+  rReq.rHdr.nlmsg_flags     = NLM_F_REQUEST | NLM_F_ACK;
+  rReq.rIfInfo.ifi_family   = AF_UNSPEC;
+  rReq.rIfInfo.ifi_index    = iIfIndex;
+
+  // IFLA_XDP { IFLA_XDP_FD, IFLA_XDP_FLAGS }
+  prNest = (struct rtattr*)((UCHAR*)&rReq + NLMSG_ALIGN(rReq.rHdr.nlmsg_len));
+  prNest->rta_type = NLA_F_NESTED | IFLA_XDP;
+  prNest->rta_len  = RTA_LENGTH(0);
+
+  prAttr = (struct rtattr*)((UCHAR*)prNest + RTA_ALIGN(prNest->rta_len));
+  prAttr->rta_type = IFLA_XDP_FD;
+  prAttr->rta_len  = RTA_LENGTH(sizeof(INT));
+  (VOID)memcpy(RTA_DATA(prAttr), &iProgFd, sizeof(INT));
+  prNest->rta_len += RTA_ALIGN(prAttr->rta_len);
+
+  prAttr = (struct rtattr*)((UCHAR*)prNest + RTA_ALIGN(prNest->rta_len));
+  prAttr->rta_type = IFLA_XDP_FLAGS;
+  prAttr->rta_len  = RTA_LENGTH(sizeof(ULONG));
+  (VOID)memcpy(RTA_DATA(prAttr), &ulFlags, sizeof(ULONG));
+  prNest->rta_len += RTA_ALIGN(prAttr->rta_len);
+
+  rReq.rHdr.nlmsg_len = NLMSG_ALIGN(rReq.rHdr.nlmsg_len) + RTA_ALIGN(prNest->rta_len);
+
+  (VOID)memset(&rAddr, 0, sizeof(rAddr));
+  rAddr.nl_family = AF_NETLINK;
+
+  if (sendto(iSocketId, &rReq, rReq.rHdr.nlmsg_len, 0, (struct sockaddr*)&rAddr, sizeof(rAddr)) >= 0)
+  {
+    iLen = (INT)recv(iSocketId, aucBuf, sizeof(aucBuf), 0);
+
+    if (iLen >= (INT)NLMSG_LENGTH(sizeof(struct nlmsgerr)))
+    {
+      prErr = (struct nlmsgerr*)NLMSG_DATA((struct nlmsghdr*)aucBuf);
+
+      if ((((struct nlmsghdr*)aucBuf)->nlmsg_type == NLMSG_ERROR) && (prErr->error == 0))
+      {
+        iRet = RTOS_RET_OK;
+      }
+      else
+      {
+        RTLX_VERBOSE(0, "Error %d (%s) from rtnetlink\n", -prErr->error, strerror(-prErr->error));
+      }
+    }
+  }
+
+  (VOID)close(iSocketId);
+
+  return(iRet);
+}
+
+/**
+ * \fn static VOID RTLX_XdpReapCompletions(
+ *              RTLX_XDP_PORT* prPort
+ *          )
+ *
+ * \brief   Takes the transmitted packets from the completion ring and
+ *          releases their transmit frames.
+ *
+ * \param[in,out]   prPort      Port
+ *
+ * \ingroup RTLX
+ *
+ */
+static VOID RTLX_XdpReapCompletions
+    (
+      RTLX_XDP_PORT* prPort
+    )
+{
+  ULONGLONG ullAddr;
+  ULONG     ulCons = *prPort->rComp.pulConsumer;
+  ULONG     ulProd = __atomic_load_n(prPort->rComp.pulProducer, __ATOMIC_ACQUIRE);
+
+  while (ulCons != ulProd)
+  {
+    ullAddr = ((ULONGLONG*)prPort->rComp.pvDesc)[ulCons & (RTLX_XDP_RING_SIZE - 1)];
+
+    // Frames of the IP core emulation are owned by SICE
+    if (
+        (ullAddr >= RTLX_XDP_TX_BASE) &&
+        (ullAddr <  RTLX_XDP_APP_BASE) &&
+        (prPort->iTxFreeNum < RTLX_XDP_NUM_TX_FRAMES)
+      )
+    {
+      prPort->aullTxFree[prPort->iTxFreeNum++] = ullAddr;
+    }
+    ulCons++;
+  }
+
+  __atomic_store_n(prPort->rComp.pulConsumer, ulCons, __ATOMIC_RELEASE);
+}
+
+/**
+ * \fn static INT RTLX_XdpQueuePacket(
+ *              RTLX_XDP_PORT* prPort,
+ *              UCHAR* pucFrame,
+ *              USHORT usLen,
+ *              UCHAR* pucPayload,
+ *              USHORT usPayloadLen
+ *          )
+ *
+ * \brief   Places a packet in the transmit ring of a port. Packets outside
+ *          of the UMEM and packets consisting of two parts are copied into a
+ *          free transmit frame.
+ *
+ * \param[in,out]   prPort      Port
+ * \param[in]       pucFrame    Pointer to packet
+ * \param[in]       usLen       Packet length
+ * \param[in]       pucPayload  Pointer to second part of packet or NULL
+ * \param[in]       usPayloadLen Length of second part
+ *
+ * \return
+ * - 0: OK
+ * - -1: Error, ring or transmit frames exhausted
+ *
+ * \ingroup RTLX
+ *
+ */
+static INT RTLX_XdpQueuePacket
+    (
+      RTLX_XDP_PORT* prPort,
+      UCHAR* pucFrame,
+      USHORT usLen,
+      UCHAR* pucPayload,
+      USHORT usPayloadLen
+    )
+{
+  struct xdp_desc* prDesc;
+  ULONGLONG        ullAddr;
+  ULONG            ulProd;
+
+  if ((prPort->pucUmem == NULL) || ((usLen + usPayloadLen) > RTLX_XDP_FRAME_SIZE))
+  {
+    return(RTOS_RET_ERROR);
+  }
+
+  ulProd = *prPort->rTx.pulProducer;
+  if ((ulProd - __atomic_load_n(prPort->rTx.pulConsumer, __ATOMIC_ACQUIRE)) >= RTLX_XDP_RING_SIZE)
+  {
+    RTLX_VERBOSE(0, "Error: AF_XDP transmit ring full\n");
+    return(RTOS_RET_ERROR);
+  }
+
+  if (
+      (pucPayload == NULL) &&
+      (pucFrame >= prPort->pucUmem) &&
+      (pucFrame <  (prPort->pucUmem + ((size_t)RTLX_XDP_NUM_FRAMES * RTLX_XDP_FRAME_SIZE)))
+    )
+  {
+    // Zero copy
+    ullAddr = (ULONGLONG)(pucFrame - prPort->pucUmem);
+  }
+  else
+  {
+    if (prPort->iTxFreeNum == 0)
+    {
+      RTLX_VERBOSE(0, "Error: No free AF_XDP transmit frame\n");
+      return(RTOS_RET_ERROR);
+    }
+    ullAddr = prPort->aullTxFree[--prPort->iTxFreeNum];
+    (VOID)memcpy(prPort->pucUmem + ullAddr, pucFrame, usLen);
+    if (pucPayload != NULL)
+    {
+      (VOID)memcpy(prPort->pucUmem + ullAddr + usLen, pucPayload, usPayloadLen);
+      usLen += usPayloadLen;
+    }
+  }
+
+  prDesc          = &((struct xdp_desc*)prPort->rTx.pvDesc)[ulProd & (RTLX_XDP_RING_SIZE - 1)];
+  prDesc->addr    = ullAddr;
+  prDesc->len     = usLen;
+  prDesc->options = 0;
+
+  __atomic_store_n(prPort->rTx.pulProducer, ulProd + 1, __ATOMIC_RELEASE);
+
+  return(RTOS_RET_OK);
+}
+
+/**
+ * \fn static VOID RTLX_XdpKickTx(
+ *              RTLX_XDP_PORT* prPort
+ *          )
+ *
+ * \brief   Triggers the transmission of the queued packets of a port, if
+ *          the kernel requests it.
+ *
+ * \param[in]   prPort      Port
+ *
+ * \ingroup RTLX
+ *
+ */
+static VOID RTLX_XdpKickTx
+    (
+      RTLX_XDP_PORT* prPort
+    )
+{
+  if (*prPort->rTx.pulFlags & XDP_RING_NEED_WAKEUP)
+  {
+    if (
+        (sendto(prPort->iSocketId, NULL, 0, MSG_DONTWAIT, NULL, 0) < 0) &&
+        (errno != EAGAIN) && (errno != EBUSY) && (errno != ENOBUFS)
+      )
+    {
+      RTLX_VERBOSE(0, "Error %d (%s) kicking AF_XDP transmission\n", errno, strerror(errno));
+    }
+  }
+}
+
+#endif
@@ -1,3 +1,6 @@
+#include <stdio.h>
+#include <stdlib.h>
+
 #include "rtapi.h"
 #include "rtapi_app.h"
 #include "hal.h"
@@ -20,6 +23,10 @@ MODULE_AUTHOR("Andreas Schiffler");
 MODULE_DESCRIPTION("HAL Driver for Sercos 3 Softmaster S3SM");
 MODULE_LICENSE("GPL");
 
+/* module parameters */
+static char *nic = S3SM_DEFAULT_NIC;
+RTAPI_MP_STRING(nic, "Network adapter(s) of Sercos ports, ethP[,ethS]");
+
 /* globals  */
 typedef struct {
 	hal_float_t			*pos;
@@ -64,26 +71,25 @@ VOID S3SM_Connection_Conf_Drive
 	CSMD_CONN_IDX_STRUCT     *prMasterConnIdx    = NULL;
 	CSMD_SLAVE_CONFIGURATION *prSlaveConfig      = NULL;
 	USHORT                   usConIdx            = 0;
-	ULONG                    ulSVCWriteData      = 0;
+	ULONG                    aulSVCWriteData[2];
+	SIII_SVC_REQUEST_STRUCT  arRequest[2];
 	SIII_FUNC_RET            S3FuncRet           = SIII_NO_ERROR;
 
 	S3SM_VERBOSE(0, "- MDT: S134, S36, S47\n");
 	S3SM_VERBOSE(0, "- AT : S135, S40, S51, S84\n");
 
 	// Set S-0-0032 of drive to selected drive operation mode
-	ulSVCWriteData      = S3SM_DRIVE_OP_MODE; // Position Control
+	aulSVCWriteData[0]  = S3SM_DRIVE_OP_MODE; // Position Control
 	S3SM_VERBOSE(0, "Setting 1st operation mode (S-0-0032) of device #%hu to %d\n",usDevIdx,S3SM_DRIVE_OP_MODE);
-	S3FuncRet = SIII_SVCWrite(prS3Instance,usDevIdx,TRUE,32,0,0,7,(USHORT*)&ulSVCWriteData,4);
-	if (S3FuncRet != SIII_NO_ERROR)
-	{
-		rtapi_print_msg(RTAPI_MSG_INFO,S3SM_MSG_PFX
-				"Error %d when trying to set OP Mode "
-				"for device #%d\n",
-				(INT) S3FuncRet,usDevIdx);
-	}
-	ulSVCWriteData      = 2;// Velocity Control
+	SIII_SVCInitRequest(&arRequest[0],SIII_SVC_WRITE,usDevIdx,TRUE,32,0,0,7,(USHORT*)&aulSVCWriteData[0],4,NULL,NULL);
+
+	// Set S-0-0033 of drive
+	aulSVCWriteData[1]  = 2;// Velocity Control
 	S3SM_VERBOSE(0, "Setting 2nd operation mode (S-0-0033) of device #%hu to %d\n",usDevIdx,2);
-	S3FuncRet = SIII_SVCWrite(prS3Instance,usDevIdx,TRUE,33,0,0,7,(USHORT*)&ulSVCWriteData,4);
+	SIII_SVCInitRequest(&arRequest[1],SIII_SVC_WRITE,usDevIdx,TRUE,33,0,0,7,(USHORT*)&aulSVCWriteData[1],4,NULL,NULL);
+
+	// Both writes in one batch, without idle cycle in between
+	S3FuncRet = SIII_SVCTransferBatch(prS3Instance,arRequest,2);
 	if (S3FuncRet != SIII_NO_ERROR)
 	{
 		rtapi_print_msg(RTAPI_MSG_INFO,S3SM_MSG_PFX
@@ -390,6 +396,202 @@ static int sercos_cycle_worker_func(void *arg, const hal_funct_args_t *fa)
 }
 
 
+/* Value of one parameter file item, stored with its declared length so
+ * that the SVC reads it in the native word order like any other buffer. */
+typedef union
+{
+	USHORT		usData;
+	ULONG		ulData;
+	ULONGLONG	ullData;
+} S3SM_PAR_VALUE_UNION;
+
+/* Parameter file for sercos-conf 'p', one SVC write per line:
+ *   <device index or *> <S|P> <IDN> <SI> <SE> <value> <bytes>
+ * Lines starting with '#' are comments. All writes are performed as one
+ * batch, the writes of different slaves in parallel. */
+static S3SM_FUNC_RET S3SM_LoadParFile
+(
+		SIII_INSTANCE_STRUCT *prS3Instance,
+		const char *pcFileName
+)
+{
+	FILE                    *prFile         = NULL;
+	SIII_SVC_REQUEST_STRUCT *parRequest     = NULL;
+	S3SM_PAR_VALUE_UNION    *parValue       = NULL;
+	VOID                    *pvNew          = NULL;
+	CHAR                    acLine[256];
+	CHAR                    acDev[8];
+	CHAR                    cStdPar         = 'S';
+	ULONG                   ulIdn           = 0;
+	ULONG                   ulSI            = 0;
+	ULONG                   ulSE            = 0;
+	ULONG                   ulLen           = 0;
+	ULONGLONG               ullValue        = 0;
+	INT                     iNumItems       = 0;
+	INT                     iMaxItems       = 0;
+	INT                     iLine           = 0;
+	INT                     iDev            = 0;
+	INT                     iFirstDev       = 0;
+	INT                     iLastDev        = 0;
+	INT                     iCnt            = 0;
+	CHAR*                   pcEnd           = NULL;
+	SIII_FUNC_RET           eS3Ret          = SIII_NO_ERROR;
+	S3SM_FUNC_RET           eRet            = S3SM_NO_ERROR;
+
+	prFile = fopen(pcFileName, "r");
+	if (prFile == NULL)
+	{
+		rtapi_print_msg(RTAPI_MSG_ERR,S3SM_MSG_PFX
+				"Cannot open parameter file %s\n",pcFileName);
+		return(S3SM_CONFIG_ERROR);
+	}
+
+	while ((eRet == S3SM_NO_ERROR) && (fgets(acLine, sizeof(acLine), prFile) != NULL))
+	{
+		iLine++;
+
+		if ((acLine[0] == '#') || (acLine[0] == '\n') || (acLine[0] == '\r'))
+		{
+			continue;
+		}
+
+		if (
+				(sscanf(acLine, "%7s %c %u %u %u %llu %u",
+						acDev, &cStdPar, &ulIdn, &ulSI, &ulSE, &ullValue, &ulLen) != 7) ||
+				((cStdPar != 'S') && (cStdPar != 'P')) ||
+				(ulIdn > 4095) || (ulSI > 255) || (ulSE > 255) ||
+				((ulLen != 2) && (ulLen != 4) && (ulLen != 8)) ||
+				((ulLen == 2) && (ullValue > 0xFFFFULL)) ||
+				((ulLen == 4) && (ullValue > 0xFFFFFFFFULL))
+		)
+		{
+			rtapi_print_msg(RTAPI_MSG_ERR,S3SM_MSG_PFX
+					"%s:%d: invalid line\n",pcFileName,iLine);
+			eRet = S3SM_CONFIG_ERROR;
+			break;
+		}
+
+		if ((acDev[0] == '*') && (acDev[1] == '\0'))
+		{
+			iFirstDev = 0;
+			iLastDev  = SIII_GetNoOfSlaves(prS3Instance) - 1;
+		}
+		else
+		{
+			iFirstDev = (INT) strtol(acDev, &pcEnd, 10);
+			if ((pcEnd == acDev) || (*pcEnd != '\0') ||
+					(iFirstDev < 0) || (iFirstDev >= SIII_MAX_SLAVES))
+			{
+				rtapi_print_msg(RTAPI_MSG_ERR,S3SM_MSG_PFX
+						"%s:%d: invalid device '%s'\n",pcFileName,iLine,acDev);
+				eRet = S3SM_CONFIG_ERROR;
+				break;
+			}
+			iLastDev  = iFirstDev;
+		}
+
+		for (iDev = iFirstDev; iDev <= iLastDev; iDev++)
+		{
+			if (iNumItems == iMaxItems)
+			{
+				// The batch size is passed as USHORT
+				if (iMaxItems >= 0xFFFF)
+				{
+					rtapi_print_msg(RTAPI_MSG_ERR,S3SM_MSG_PFX
+							"%s:%d: more than %d parameters\n",pcFileName,iLine,0xFFFF);
+					eRet = S3SM_CONFIG_ERROR;
+					break;
+				}
+				iMaxItems = (iMaxItems == 0) ? 64 : (2 * iMaxItems);
+				if (iMaxItems > 0xFFFF)
+				{
+					iMaxItems = 0xFFFF;
+				}
+
+				pvNew = realloc(parRequest, (size_t)iMaxItems * sizeof(SIII_SVC_REQUEST_STRUCT));
+				if (pvNew == NULL)
+				{
+					eRet = S3SM_SYSTEM_ERROR;
+					break;
+				}
+				parRequest = pvNew;
+
+				pvNew = realloc(parValue, (size_t)iMaxItems * sizeof(S3SM_PAR_VALUE_UNION));
+				if (pvNew == NULL)
+				{
+					eRet = S3SM_SYSTEM_ERROR;
+					break;
+				}
+				parValue = pvNew;
+			}
+
+			if (ulLen == 2)
+			{
+				parValue[iNumItems].usData  = (USHORT) ullValue;
+			}
+			else if (ulLen == 4)
+			{
+				parValue[iNumItems].ulData  = (ULONG) ullValue;
+			}
+			else
+			{
+				parValue[iNumItems].ullData = ullValue;
+			}
+
+			SIII_SVCInitRequest
+			(
+					&parRequest[iNumItems],
+					SIII_SVC_WRITE,
+					(USHORT) iDev,    // Device index
+					(cStdPar == 'S'), // Standard or specific parameter?
+					(USHORT) ulIdn,   // IDN
+					(USHORT) ulSI,    // Structural instance
+					(USHORT) ulSE,    // Structural element
+					(USHORT) 7,       // Element 7: Operational data
+					NULL,             // Data buffer, set after reading the file
+					(USHORT) ulLen,   // x bytes to write
+					NULL,
+					NULL
+			);
+			iNumItems++;
+		}
+	}
+	(VOID)fclose(prFile);
+
+	if ((eRet == S3SM_NO_ERROR) && (iNumItems > 0))
+	{
+		for (iCnt = 0; iCnt < iNumItems; iCnt++)
+		{
+			parRequest[iCnt].pusData = &parValue[iCnt].usData;
+		}
+
+		S3SM_VERBOSE(0, "Writing %d parameters from %s\n",iNumItems,pcFileName);
+
+		eS3Ret = SIII_SVCTransferBatch(prS3Instance,parRequest,(USHORT) iNumItems);
+
+		if (eS3Ret != SIII_NO_ERROR)
+		{
+			for (iCnt = 0; iCnt < iNumItems; iCnt++)
+			{
+				if (parRequest[iCnt].eFuncRet != SIII_NO_ERROR)
+				{
+					rtapi_print_msg(RTAPI_MSG_ERR,S3SM_MSG_PFX
+							"Error #%X writing IDN %u of device #%hu\n",
+							(INT) parRequest[iCnt].eFuncRet,
+							(parRequest[iCnt].ulIdent_Nbr & 0xFFF),
+							parRequest[iCnt].usDevIdx);
+				}
+			}
+			eRet = S3SM_SVC_ERROR;
+		}
+	}
+
+	free(parRequest);
+	free(parValue);
+
+	return(eRet);
+}
+
 S3SM_FUNC_RET   sercos_handle_conf(SIII_INSTANCE_STRUCT *prS3Instance, const char **argv, const int argc)
 {
 	CHAR          cBuffer         = ' ';      // Buffer for stdin operations
@@ -401,6 +603,8 @@ S3SM_FUNC_RET   sercos_handle_conf(SIII_INSTANCE_STRUCT *prS3Instance, const cha
 	USHORT        usDevIdx        = 0;        // Sercos device index
 	ULONG         ulSVCWriteData  = 0;        // Data to write via SVC
 	INT iCnt  = 0;		// Counter for number of found slave during auto config
+	SIII_SVC_REQUEST_STRUCT arRequest[SIII_MAX_SLAVES];	// S-0-1302.0.1 of all slaves
+	ULONG         aulFspType[SIII_MAX_SLAVES][2];
 
 	cBuffer = *(argv[0]);
 
@@ -529,6 +733,27 @@ S3SM_FUNC_RET   sercos_handle_conf(SIII_INSTANCE_STRUCT *prS3Instance, const cha
 
 
 
+		// Write slave parameters from file via SVC
+	case 'p':
+		if (SIII_GetSercosPhase(prS3Instance) >= SIII_PHASE_CP2)
+		{
+			if (argc == 2){ // example: p /etc/sercos/drives.par
+				(VOID)S3SM_LoadParFile(prS3Instance, argv[1]);
+			}
+			else
+			{
+				S3SM_VERBOSE(0, "Usage: p <parameter file>\n");
+			}
+		}
+		else
+		{
+			S3SM_VERBOSE(0, "Only possible in CP2 or higher\n");
+		}
+		return(S3SM_NO_ERROR);
+		/*lint -save -e527 */
+		break;
+		/*lint -restore */
+
 		// Go directly to phase 2 without connection configuration
 	case '2':
 		if (SIII_GetSercosPhase(prS3Instance) < SIII_PHASE_CP2)
@@ -615,39 +840,55 @@ S3SM_FUNC_RET   sercos_handle_conf(SIII_INSTANCE_STRUCT *prS3Instance, const cha
 						(INT)eS3Ret
 				);
 			}
-			// For each slave ...
+			// Read S-0-1302.0.1 of all slaves at once
 			for (
 					iCnt = 0;
 					iCnt < SIII_GetNoOfSlaves(prS3Instance);
 					iCnt++
 			)
 			{
-				// Read S-0-1302.0.1
-				eS3Ret = SIII_SVCRead
-						(
-								prS3Instance,     // SIII instance
-								iCnt,             // Device index
-								TRUE,             // Standard or specific parameter?
-								1302,             // IDN
-								0,                // Structural instance
-								1,                // Structural element
-								(USHORT) 7,       // Element 7: Operational data
-								prS3Instance->rMySVCResult.ausSVCData,
-								// Data pointer
-								(USHORT)SIII_SVC_BUF_SIZE
-								// Buffer size
-						);
-
-				if (eS3Ret != SIII_NO_ERROR)
-				{
-					rtapi_print_msg(RTAPI_MSG_INFO,S3SM_MSG_PFX
-							"Error #%X during SVC access.\n",
-							(INT)eS3Ret
+				aulFspType[iCnt][0] = 0;
+				SIII_SVCInitRequest
+				(
+						&arRequest[iCnt],
+						SIII_SVC_READ,
+						iCnt,             // Device index
+						TRUE,             // Standard or specific parameter?
+						1302,             // IDN
+						0,                // Structural instance
+						1,                // Structural element
+						(USHORT) 7,       // Element 7: Operational data
+						(USHORT*) aulFspType[iCnt],
+						(USHORT) sizeof(aulFspType[iCnt]),
+						NULL,
+						NULL
+				);
+			}
+
+			eS3Ret = SIII_SVCTransferBatch
+					(
+							prS3Instance,
+							arRequest,
+							(USHORT) iCnt
 					);
-				}
 
+			if (eS3Ret != SIII_NO_ERROR)
+			{
+				rtapi_print_msg(RTAPI_MSG_INFO,S3SM_MSG_PFX
+						"Error #%X during SVC access.\n",
+						(INT)eS3Ret
+				);
+			}
+
+			// For each slave ...
+			for (
+					iCnt = 0;
+					iCnt < SIII_GetNoOfSlaves(prS3Instance);
+					iCnt++
+			)
+			{
 				// Set callbacks accordingly
-				switch (prS3Instance->rMySVCResult.ausSVCData[1])
+				switch (((USHORT*) aulFspType[iCnt])[1])
 				{
 				case S3SM_S_1302_0_1_FSP_DRIVE:
 					S3SM_VERBOSE
@@ -965,6 +1206,15 @@ int rtapi_app_main(void)
 	rS3Pars.ulSwitchBackDelay    = S3SM_SWITCH_BACK_DELAY;
 	rS3Pars.ulSoftMasterJitterNs = S3SM_SOFT_MASTER_JITTER_NS;
 
+	// Assign network adapter(s) before sockets are opened
+	if (RTOS_SetNicName(0, nic) != RTOS_RET_OK)
+	{
+		rtapi_print_msg(RTAPI_MSG_ERR,
+				S3SM_MSG_PFX "invalid network adapter(s) nic=%s\n",nic);
+		hal_exit(comp_id);
+		return -1;
+	}
+
 	iRet = SIII_Init(&(s3sm_hal_data->rS3Instance),0,&rS3Pars);
 	if (iRet != SIII_NO_ERROR)
 	{
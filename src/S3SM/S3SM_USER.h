@@ -184,6 +184,14 @@
  */
 #define S3SM_MSG_PFX					"[S3SM] "
 
+/**
+ * \def		S3SM_DEFAULT_NIC
+ *
+ * \brief	Network adapter(s) of Sercos ports P and S, used unless given with
+ *			the module parameter nic (loadrt s3sm nic=ethP[,ethS])
+ */
+#define S3SM_DEFAULT_NIC				"eth0,eth1"
+
 //---- type definitions -------------------------------------------------------
 
 //---- variable declarations --------------------------------------------------
@@ -299,38 +299,8 @@ SICE_FUNC_RET SICE_Cycle_Prepare
 
     // Timer registers
 
-    // Is ET3 / EST for Sercos system time enabled?
-    if (
-        (prSiceInstance->prReg->ulTCSR & (((ULONG)1) << CSMD_HAL_TCSR_EST))
-        != ((ULONG) 0)
-      )
-    {
-      // System timer registers
-      prSiceInstance->prReg->ulSTNS += prSiceInstance->prReg->ulTCNTCYCR;
-      if (prSiceInstance->prReg->ulSTNS >= ((ULONG) 1000*1000*1000))
-      {
-        // Overflow
-        prSiceInstance->prReg->ulSTNS -= (ULONG) 1000*1000*1000;
-        prSiceInstance->prReg->ulSTSEC++;
-      }
-
-      SICE_VERBOSE
-          (
-            2,
-            "SICE time: %lu:%lu\n",
-            prSiceInstance->prReg->ulSTSEC,
-            prSiceInstance->prReg->ulSTNS
-          );
-
-      // Pre-calculated system timer registers
-      prSiceInstance->prReg->ulSTNSP += prSiceInstance->prReg->ulTCNTCYCR;
-      if (prSiceInstance->prReg->ulSTNSP >= ((ULONG) 1000*1000*1000))
-      {
-        // Overflow
-        prSiceInstance->prReg->ulSTNSP -= (ULONG) 1000*1000*1000;
-        prSiceInstance->prReg->ulSTSECP++;
-      }
-    }
+    // Sercos time and system timer registers, if enabled
+    SICE_UpdateSercosTime(prSiceInstance);
 
     // System timer readback register (STRBR)
     // \todo put time value into register
@@ -451,27 +421,16 @@ SICE_FUNC_RET SICE_Cycle_Prepare
     // in CP0 overwritten by receive function later
     prSiceInstance->prReg->ulSEQCNT = (ULONG) 0;
 
-    // RX buffer control/status register
-    // Currently, only buffer A with single buffering is supported
-    if (
-        (prSiceInstance->prReg->ulRXBUFCSR_A & ((ULONG) CSMD_HAL_RXBUFCSR_COUNT_MASK))
-        != ((ULONG) CSMD_HAL_SINGLE_BUFFER_SYSTEM)
-      )
-    {
-      SICE_VERBOSE
-          (
-            0,
-            "Error: Only receive buffer system A with single "
-            "buffering currently is supported by SICE.\n"
-          );
+    // RX/TX buffer control/status registers of buffer system A
+    // (single, double or triple buffering)
+    eSiceFuncRet = SICE_SwitchBufferSysA(prSiceInstance);
 
-      return(SICE_BUFFER_ERROR);
+    if (eSiceFuncRet != SICE_NO_ERROR)
+    {
+      return(eSiceFuncRet);
     }
 
-    prSiceInstance->prReg->ulRXBUFCSR_A &= ~((ULONG) CSMD_HAL_RXBUFCSR_NEW_DATA_P1);
-
-    prSiceInstance->prReg->ulRXBUFCSR_A &= ~((ULONG) CSMD_HAL_RXBUFCSR_NEW_DATA_P2);
-
+    // Buffer system B only with single buffering
     if (
         (prSiceInstance->prReg->ulRXBUFCSR_B & ((ULONG) CSMD_HAL_RXBUFCSR_COUNT_MASK))
         != ((ULONG) CSMD_HAL_SINGLE_BUFFER_SYSTEM)
@@ -480,30 +439,13 @@ SICE_FUNC_RET SICE_Cycle_Prepare
       SICE_VERBOSE
           (
             0,
-            "Error: Only receive buffer system A with single "
+            "Error: Only receive buffer system B with single "
             "buffering currently is supported by SICE.\n"
           );
       return(SICE_BUFFER_ERROR);
     }
     prSiceInstance->prReg->ulRXBUFCSR_B &= ~((ULONG) 0xFFFF0000);
 
-    // TX buffer control/status register
-    // Currently, only single buffering is supported
-    if (
-        (prSiceInstance->prReg->ulTXBUFCSR_A & ((ULONG) CSMD_HAL_TXBUFCSR_COUNT_MASK))
-        != ((ULONG) CSMD_HAL_SINGLE_BUFFER_SYSTEM)
-      )
-    {
-      SICE_VERBOSE
-          (
-            0,
-            "Error: Only single buffering currently is supported "
-            "by SICE.\n"
-          );
-
-      return(SICE_BUFFER_ERROR);
-    }
-
     if (
         (prSiceInstance->prReg->ulTXBUFCSR_B & ((ULONG) CSMD_HAL_TXBUFCSR_COUNT_MASK))
         != ((ULONG) CSMD_HAL_SINGLE_BUFFER_SYSTEM)
@@ -512,8 +454,8 @@ SICE_FUNC_RET SICE_Cycle_Prepare
       SICE_VERBOSE
           (
             0,
-            "Error: Only single buffering currently is supported "
-            "by SICE.\n"
+            "Error: Only transmit buffer system B with single "
+            "buffering currently is supported by SICE.\n"
           );
 
       return(SICE_BUFFER_ERROR);
@@ -663,6 +605,16 @@ SICE_FUNC_RET SICE_Cycle_Start
 
 #else
 
+  #ifdef SICE_MEASURE_RDLY
+    // Evaluate timestamps of MDT0 of previous cycle before new transmission
+    SICE_UpdateRdlySamples(prSiceInstance);
+  #endif
+
+  #ifdef SICE_TX_BATCH
+    // Start with empty transmit queue
+    prSiceInstance->rTxBatch.usNum = 0;
+  #endif
+
     if (prSiceInstance->ucTimingMethod == ((UCHAR) CSMD_METHOD_MDT_AT_IPC))
     {
       // Transmit Sercos MDT telegrams
@@ -674,6 +626,15 @@ SICE_FUNC_RET SICE_Cycle_Start
       }
 
   #if ((SICE_WAITING_TIME_TX_MDT_AT != 0) && (RTOS_TIMING_MODE != RTOS_TIMING_NIC))
+    #ifdef SICE_TX_BATCH
+      // Waiting time between MDTs and ATs requires separate batches
+      eSiceFuncRet = SICE_FlushTelegrams(prSiceInstance);
+
+      if (eSiceFuncRet != SICE_NO_ERROR)
+      {
+        return(eSiceFuncRet);
+      }
+    #endif
       RTOS_NanoSleepRel(SICE_WAITING_TIME_TX_MDT_AT);
   #endif
 
@@ -698,6 +659,15 @@ SICE_FUNC_RET SICE_Cycle_Start
       // In case NIC-timed transmission is not used and SICE_WAIT_TX_MDT_AT is
       // enabled, wait accordingly
   #if ((SICE_WAIT_TX_MDT_AT != 0) && (RTOS_TIMING_MODE != RTOS_TIMING_NIC))
+    #ifdef SICE_TX_BATCH
+      // Waiting time between ATs and MDTs requires separate batches
+      eSiceFuncRet = SICE_FlushTelegrams(prSiceInstance);
+
+      if (eSiceFuncRet != SICE_NO_ERROR)
+      {
+        return(eSiceFuncRet);
+      }
+    #endif
       RTOS_NanoSleepRel(SICE_WAIT_TX_MDT_AT);
   #endif
 
@@ -715,10 +685,32 @@ SICE_FUNC_RET SICE_Cycle_Start
       return(SICE_SERCOS_TIMING_MODE_ERROR);
     }
 
+  #ifdef SICE_TX_BATCH
+    // Transmit all queued Sercos telegrams of the cycle at once
+    eSiceFuncRet = SICE_FlushTelegrams(prSiceInstance);
+
+    if (eSiceFuncRet != SICE_NO_ERROR)
+    {
+      return(eSiceFuncRet);
+    }
+  #endif
+
 #endif    // SICE_USE_NIC_TIMED_TX
 
 #ifdef SICE_CALL_RX_RIGHT_AFTER_TX
 
+  #ifdef SICE_RX_BUSY_POLL
+    // Reference for deadline and arrival times
+    prSiceInstance->ullTxDoneNs = SICE_GetTimeNs();
+
+    (VOID)memset
+        (
+          prSiceInstance->aulRxArrivalNs,
+          (UCHAR)0x00,
+          sizeof(prSiceInstance->aulRxArrivalNs)
+        );
+  #endif
+
     // Take additional waiting time SICE_WAIT_RX_AFTER_TX into account if
     // defined in SICE_USER.h
     if (SICE_WAIT_RX_AFTER_TX > 0)
@@ -728,8 +720,13 @@ SICE_FUNC_RET SICE_Cycle_Start
 
     if (SICE_CheckPreCondsReceive(prSiceInstance) == SICE_NO_ERROR)
     {
+  #ifdef SICE_RX_BUSY_POLL
+      // Receive Sercos telegrams until all ATs have returned
+      eSiceFuncRet = SICE_ReceiveTelegramsBusyPoll(prSiceInstance);
+  #else
       // Receive Sercos telegrams
       eSiceFuncRet = SICE_ReceiveTelegrams(prSiceInstance);
+  #endif
 
       if (eSiceFuncRet != SICE_NO_ERROR)
       {
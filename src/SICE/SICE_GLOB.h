@@ -121,6 +121,13 @@
 #define SICE_ETH_PORT_S              (1)      /**< Secondary Sercos Ethernet port */
 #define SICE_ETH_PORT_BOTH           (2)      /**< Both Sercos Ethernet ports */
 
+// Memory layout constants
+
+#define SICE_CACHE_LINE              (64)     /**< Cache line size for separating data
+                                                   written by different parties */
+#define SICE_UCC_CACHE_LINE          SICE_CACHE_LINE
+                                              /**< Cache line size for separating ring indices */
+
 #ifdef SICE_REDUNDANCY
     #define SICE_REDUNDANCY_VAL      (2)      /**< 2 for redundancy mode, 1 otherwise */
     #define SICE_REDUNDANCY_BOOL     TRUE     /**< TRUE for redundancy mode, FALSE otherwise */
@@ -131,6 +138,15 @@
 
 //---- type definitions -------------------------------------------------------
 
+#ifdef SICE_WIRE_THREAD
+/**
+ * \typedef SICE_WIRE_STRUCT
+ *
+ * \brief   Wire thread of a SICE instance, defined in SICE_PRIV.h
+*/
+typedef struct SICE_WIRE_STR SICE_WIRE_STRUCT;
+#endif
+
 /**
  * \struct  SICE_SIII_PACKET_BUF
  *
@@ -140,24 +156,222 @@ typedef struct
 {
   USHORT usLen;                               /**< Total length of Sercos packet */
   BOOL   boEnable;                            /**< Is packet enabled? */
+  UCHAR* pucPayload;                          /**< Payload following the header
+                                                   in aucData, NULL if aucData
+                                                   holds the complete packet */
   UCHAR  aucData[SICE_ETH_FRAMEBUF_LEN];      /**< Sercos packet data */
 } SICE_SIII_PACKET_BUF;
 
+/**
+ * \struct  SICE_UCC_PACKET_SLOT
+ *
+ * \brief   Structure for a single slot of the UCC packet ring buffer
+*/
+typedef struct
+{
+  USHORT usLen;                               /**< Length of packet in slot */
+  UCHAR  ucPort;                              /**< Port information of packet */
+  UCHAR  aucData[SICE_ETH_FRAMEBUF_LEN];      /**< Packet data */
+} SICE_UCC_PACKET_SLOT;
+
 /**
  * \struct  SICE_UCC_PACKET_BUF
  *
  * \brief   Structure for UCC packet ring buffer
+ *
+ * \details Lock-free single-producer/single-consumer ring. The producer only
+ *          writes ulHead and its counters, the consumer only writes ulTail.
+ *          Both indices are free-running and masked with
+ *          (SICE_UCC_BUF_SIZE - 1) on access, so the buffer size has to be a
+ *          power of two. The indices are kept on separate cache lines to
+ *          avoid false sharing between the RT and the NRT thread. For the
+ *          receive ring, the RT cycle is the producer; for the transmit ring,
+ *          it is the consumer.
 */
 typedef struct
 {
-  UCHAR  aucBuf[SICE_UCC_BUF_SIZE][SICE_ETH_FRAMEBUF_LEN];
-                                              /**< UCC buffer */
-  USHORT usBufSize[SICE_UCC_BUF_SIZE];        /**< Size of packets in buffer */
-  UCHAR  ucBufPort[SICE_UCC_BUF_SIZE];        /**< Port information of packets in buffer */
-  UCHAR  ucBufPtrStart;                       /**< Start pointer in ring buffer */
-  UCHAR  ucBufPtrEnd;                         /**< End pointer in ring buffer */
+  ULONG  ulHead;                              /**< Producer index */
+  ULONG  ulDropCnt;                           /**< Packets dropped due to full ring */
+  ULONG  ulHighWater;                         /**< Maximum ring fill level */
+  UCHAR  aucPad1[SICE_UCC_CACHE_LINE - 3 * sizeof(ULONG)];
+                                              /**< Padding to next cache line */
+  ULONG  ulTail;                              /**< Consumer index */
+  UCHAR  aucPad2[SICE_UCC_CACHE_LINE - sizeof(ULONG)];
+                                              /**< Padding to next cache line */
+  SICE_UCC_PACKET_SLOT arSlot[SICE_UCC_BUF_SIZE];
+                                              /**< Packet slots */
 } SICE_UCC_PACKET_BUF;
 
+/**
+ * \struct  SICE_TX_BATCH_STRUCT
+ *
+ * \brief   Structure for Sercos packets queued for transmission as one batch
+*/
+typedef struct
+{
+  USHORT usNum;                               /**< Number of queued packets */
+  UCHAR* apucPacket[2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL];
+                                              /**< Pointer to packet data */
+  USHORT ausLen[2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL];
+                                              /**< Length of packets in bytes */
+  UCHAR  aucPort[2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL];
+                                              /**< Port of packets */
+#ifdef SICE_TX_SHARED_PAYLOAD
+  UCHAR* apucPayload[2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL];
+                                              /**< Pointer to payload following
+                                                   the packet data or NULL */
+  USHORT ausPayloadLen[2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL];
+                                              /**< Length of payload in bytes */
+#endif
+} SICE_TX_BATCH_STRUCT;
+
+/**
+ * \struct  SICE_SERCOS_TIME_STRUCT
+ *
+ * \brief   Sercos time counted by SICE as 64-bit nanoseconds. The system time
+ *          registers are derived from it once per cycle, the extended field of
+ *          MDT0 is generated once per cycle for all ports.
+*/
+typedef struct
+{
+  ULONGLONG ullTimeNs;                        /**< Sercos time (STSEC/STNS) in ns */
+  ULONGLONG ullTimePNs;                       /**< Pre-calculated Sercos time
+                                                   (STSECP/STNSP) in ns */
+  ULONG     ulCycleTimeNs;                    /**< Cycle time (TCNTCYCR) the
+                                                   increment is based on */
+  ULONG     ulIncNs;                          /**< Increment of Sercos time per cycle in ns */
+  ULONG     ulToggle;                         /**< Toggle bit of TCSR when the time was
+                                                   loaded from the registers */
+  BOOL      boRunning;                        /**< Sercos time counted in last cycle? */
+  BOOL      boLatched;                        /**< Time latched for transmission? */
+  USHORT    ausLatched[4];                    /**< Latched pre-calculated time in order of
+                                                   transmission: Seconds high and low word,
+                                                   nanoseconds high and low word */
+  BOOL      boExtField;                       /**< Extended field in MDT0 of this cycle? */
+  USHORT    ausExtField[2];                   /**< Extended field (C-Time and time) */
+#ifdef SICE_SERCOS_TIME_TAI
+  LONGLONG  llMinOffsetNs;                    /**< Minimum offset of CLOCK_TAI in window,
+                                                   not counting the pending correction */
+  ULONG     ulWindowCnt;                      /**< Cycles in current window */
+  LONGLONG  llPendingNs;                      /**< Correction not applied yet in ns */
+  LONG      lCorrNs;                          /**< Correction of increment per cycle in ns */
+#endif
+} SICE_SERCOS_TIME_STRUCT;
+
+#ifdef SICE_TX_INCREMENTAL
+/**
+ * \struct  SICE_TX_INCR_STRUCT
+ *
+ * \brief   State of the incremental build of the send frames. All data is
+ *          copied into the frames again whenever one of the values differs
+ *          from the previous cycle.
+*/
+typedef struct
+{
+  CSMD_HAL_TX_TRACK* prTrack;                 /**< TX RAM change tracking written
+                                                   by CoSeMa */
+  ULONG  ulConfigCnt;                         /**< Configuration count of tracking */
+  ULONG  ulPhase;                             /**< Communication phase including
+                                                   phase switch bit */
+  ULONG  ulPacketMask;                        /**< Packets built */
+  LONG   lBufSysAOffset;                      /**< Offset of TX buffer of system A */
+  BOOL   boCopyAll;                           /**< Copy all data in the next cycle */
+} SICE_TX_INCR_STRUCT;
+#endif
+
+/**
+ * \struct  SICE_DESC_SEG_STRUCT
+ *
+ * \brief   Structure for one copy segment of a compiled descriptor plan
+*/
+typedef struct
+{
+  UCHAR* apucBuf[SICE_REDUNDANCY_VAL];        /**< TX: source per transmit port,
+                                                   RX: destination per receive
+                                                   port, NULL if not copied */
+  UCHAR* pucBuf2;                             /**< RX: second destination for
+                                                   RTCC data, NULL if none */
+  USHORT usFrameOffset;                       /**< Offset in telegram data field */
+  USHORT usLen;                               /**< Number of bytes to be copied */
+  BOOL   boBufSysA;                           /**< apucBuf refers to buffer 0 of
+                                                   buffer system A and is moved
+                                                   to the active buffer */
+} SICE_DESC_SEG_STRUCT;
+
+/**
+ * \struct  SICE_DESC_GAP_STRUCT
+ *
+ * \brief   Structure for a part of the telegram data field not covered by
+ *          any copy segment, which is filled with zeros
+*/
+typedef struct
+{
+  USHORT usFrameOffset;                       /**< Offset in telegram data field */
+  USHORT usLen;                               /**< Number of bytes */
+} SICE_DESC_GAP_STRUCT;
+
+/**
+ * \struct  SICE_DESC_PKT_STRUCT
+ *
+ * \brief   Structure for the compiled descriptors of one Sercos packet
+*/
+typedef struct
+{
+  ULONG  ulIndexEntry;                        /**< Shadow of index table entry */
+  USHORT usFrameLen;                          /**< TX: Frame length incl. header */
+  USHORT usFirstSeg;                          /**< First segment in plan */
+  USHORT usNumSeg;                            /**< Number of segments */
+  USHORT usFirstDesc;                         /**< First descriptor in shadow */
+  USHORT usNumDesc;                           /**< Number of descriptors */
+  USHORT ausFirstGap[SICE_REDUNDANCY_VAL];    /**< TX: First gap in plan per port */
+  USHORT ausNumGap[SICE_REDUNDANCY_VAL];      /**< TX: Number of gaps per port */
+  BOOL   boSharedPayload;                     /**< TX: Same data for all ports */
+} SICE_DESC_PKT_STRUCT;
+
+/**
+ * \struct  SICE_DESC_PLAN_STRUCT
+ *
+ * \brief   Structure for a descriptor plan, i.e. the TX or RX descriptors of
+ *          the emulated IP core compiled to a flat list of copy segments.
+ *          Shadows of all inputs are kept to detect changes by CoSeMa.
+*/
+typedef struct
+{
+  BOOL   boValid;                             /**< Plan compiled successfully */
+  ULONG  ulPacketMask;                        /**< Compiled packets, bit per
+                                                   CSMD_DES_IDX_* */
+  ULONG  ulDECR;                              /**< Shadow of DECR register */
+  ULONG  aulTxBufBasePtr[CSMD_HAL_TX_BASE_PTR_NBR];
+                                              /**< Shadow of TX buffer base pointers */
+  ULONG  aulRxBufBasePtr[CSMD_HAL_RX_BASE_PTR_NBR];
+                                              /**< Shadow of RX buffer base pointers */
+  USHORT usNumSeg;                            /**< Number of used segments */
+  USHORT usNumDesc;                           /**< Number of used descriptors */
+  USHORT usNumGap;                            /**< Number of used gaps */
+  SICE_DESC_PKT_STRUCT arPkt[2*CSMD_MAX_TEL]; /**< Packets MDT0..3 and AT0..3 */
+  SICE_DESC_SEG_STRUCT arSeg[SICE_DESC_PLAN_MAX_SEG];
+                                              /**< Copy segments */
+  ULONG  aulDesc[SICE_DESC_PLAN_MAX_DESC];    /**< Shadow of descriptors */
+  SICE_DESC_GAP_STRUCT arGap[SICE_REDUNDANCY_VAL * (SICE_DESC_PLAN_MAX_SEG + 2*CSMD_MAX_TEL)];
+                                              /**< Gaps, at most one more per
+                                                   packet and port than segments */
+} SICE_DESC_PLAN_STRUCT;
+
+#ifdef SICE_MEASURE_RDLY
+/**
+ * \struct  SICE_RDLY_MEAS_STRUCT
+ *
+ * \brief   Structure for ring delay measurement of one port
+*/
+typedef struct
+{
+  ULONG     aulSample[SICE_RDLY_FILTER_LEN];  /**< Ring delay samples in ns */
+  USHORT    usIdx;                            /**< Next sample to be overwritten */
+  USHORT    usNum;                            /**< Number of valid samples */
+  ULONGLONG ullRxStampNs;                     /**< Receive timestamp of returned MDT0, 0 if none */
+} SICE_RDLY_MEAS_STRUCT;
+#endif
+
 /**
  * \struct  SICE_EMUL_MEM_STRUCT
  *
@@ -180,6 +394,42 @@ typedef struct
   UCHAR  aucRxRAM     [SICE_RAM_RX_SIZE];     /**< RX memory area */
 } SICE_EMUL_MEM_STRUCT;
 
+/**
+ * \union   SICE_FRAME_SLOT
+ *
+ * \brief   Sercos packet buffer padded to a multiple of the cache line size,
+ *          so that neighboring frames, and in particular the frames of port P
+ *          and port S, never share a cache line
+ */
+typedef union
+{
+  SICE_SIII_PACKET_BUF  rFrame;               /**< Packet buffer */
+  UCHAR                 aucAlign[(sizeof(SICE_SIII_PACKET_BUF) + SICE_CACHE_LINE - 1) &
+                                 ~(SICE_CACHE_LINE - 1)];
+                                              /**< Padding to cache line size */
+} SICE_FRAME_SLOT;
+
+/**
+ * \struct  SICE_ARENA_STRUCT
+ *
+ * \brief   Memory used in the Sercos cycle. It is allocated in one piece with
+ *          RTOS_AllocLockedMem(), which keeps it locked in RAM and aligned to
+ *          a cache line. The emulated IP core memory, including the TX and RX
+ *          RAM holding the CoSeMa telegram buffers, is directly followed by
+ *          the send frames, so the data copied in each cycle is contiguous.
+ *
+ * \note    The sizes of all members are multiples of SICE_CACHE_LINE. With
+ *          RTOS_XDP, the send frames are located in the UMEM instead and
+ *          arSendFrame is unused.
+ */
+typedef struct
+{
+  SICE_EMUL_MEM_STRUCT  rMemory;              /**< Sercos master IP core emulation memory */
+  SICE_FRAME_SLOT       arSendFrame[2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL];
+                                              /**< Frames of port P, followed by
+                                                   frames of port S */
+} SICE_ARENA_STRUCT;
+
 /**
  * \struct  SICE_UCC_CONFIG_STRUCT
  *
@@ -208,7 +458,7 @@ typedef struct
 typedef struct
 {
   INT                         iInstanceNo;    /**< Instance number of SICE */
-  SICE_EMUL_MEM_STRUCT        rMemory;        /**< Sercos master IP core emulation memory */
+  SICE_ARENA_STRUCT*          prArena;        /**< Memory used in the Sercos cycle */
   ULONG                       ulBaseCRC;      /**< Base CRC of Sercos packet */
   SICE_SIII_PACKET_BUF*       aprSendFrame[2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL];
                                               /**< Packet buffer for all Sercos packets of one cycle */
@@ -225,8 +475,34 @@ typedef struct
   UCHAR                       ucWDAlarm;      /**< Watchdog alarm mode: Do not send packets at all */
   CSMD_EVENT*                 prEvents;       /**< TCNT event registers*/
   UCHAR                       ucCycleCnt;     /**< Current Sercos cycle counter value */
-  BOOL                        boSercosTimeEn; /**< Sercos time enabled? */
-  CSMD_SERCOSTIME             ulLatchedTime;  /**< Sercos time latched for transmission */
+  SICE_SERCOS_TIME_STRUCT     rSercosTime;    /**< Sercos time */
+  SICE_DESC_PLAN_STRUCT       rTxPlan;        /**< Compiled TX descriptors */
+#ifdef SICE_TX_INCREMENTAL
+  SICE_TX_INCR_STRUCT         rTxIncr;        /**< State of incremental frame build */
+#endif
+  SICE_DESC_PLAN_STRUCT       rRxPlan;        /**< Compiled RX descriptors */
+  USHORT                      usTxBufSysA;    /**< TX buffer of system A being transmitted */
+  USHORT                      ausRxBufSysA[SICE_REDUNDANCY_VAL];
+                                              /**< RX buffer of system A being written
+                                                   per receive port */
+#ifdef SICE_TX_BATCH
+  SICE_TX_BATCH_STRUCT        rTxBatch;       /**< Packets queued for transmission */
+#endif
+#ifdef SICE_WIRE_THREAD
+  SICE_WIRE_STRUCT*           prWire;         /**< Wire thread transmitting and
+                                                   receiving the Sercos telegrams */
+#endif
+#ifdef SICE_MEASURE_RDLY
+  SICE_RDLY_MEAS_STRUCT       arRdlyMeas[SICE_REDUNDANCY_VAL];
+                                              /**< Ring delay measurement per transmit port */
+#endif
+#ifdef SICE_RX_BUSY_POLL
+  ULONGLONG                   ullTxDoneNs;    /**< Time of transmission of the cycle in ns */
+  ULONG                       aulRxArrivalNs[SICE_REDUNDANCY_VAL][2*CSMD_MAX_TEL];
+                                              /**< Arrival time of MDT0..3 and AT0..3 per
+                                                   port after transmission in ns, 0 if not
+                                                   received in the cycle */
+#endif
 #ifdef SICE_UC_CHANNEL
   SICE_UCC_CONFIG_STRUCT      rUCCConfig;     /**< UCC configuration structure */
   SICE_UCC_PACKET_BUF         rUCCRxBuf;      /**< UCC receive ring buffer */
@@ -365,6 +641,40 @@ SOURCE SICE_FUNC_RET SICE_UCC_GetPacket
       USHORT* pusLen
     );
 
+SOURCE SICE_FUNC_RET SICE_UCC_ReservePacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      UCHAR** ppucFrame
+    );
+
+SOURCE SICE_FUNC_RET SICE_UCC_CommitPacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      UCHAR ucPort,
+      USHORT usLen
+    );
+
+SOURCE SICE_FUNC_RET SICE_UCC_PeekPacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      UCHAR* pucPort,
+      UCHAR** ppucFrame,
+      USHORT* pusLen
+    );
+
+SOURCE SICE_FUNC_RET SICE_UCC_ReleasePacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    );
+
+SOURCE SICE_FUNC_RET SICE_UCC_GetQueueStats
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      BOOL boTxQueue,
+      ULONG* pulDropCnt,
+      ULONG* pulHighWater
+    );
+
 #ifdef __cplusplus
 }
 #endif
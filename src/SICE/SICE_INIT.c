@@ -173,6 +173,10 @@ SICE_FUNC_RET SICE_Init
   }
 
   prSiceInstance->iInstanceNo = prSiceInit->iInstanceNo;
+  prSiceInstance->prArena     = NULL;
+#ifdef SICE_WIRE_THREAD
+  prSiceInstance->prWire      = NULL;
+#endif
 
   SICE_VERBOSE(1, "Obtaining transmit socket ...\n");
 
@@ -219,15 +223,57 @@ SICE_FUNC_RET SICE_Init
     SICE_VERBOSE(1, "  Done.\n");
   }
 
-  // Allocate Sercos frames
+#ifdef SICE_USE_NIC_TIMED_TX
+  SICE_VERBOSE(1, "Initializing NIC-timed transmission ...\n");
+  iRet = RTOS_InitNicTimedTransmission
+      (
+        prSiceInstance->iInstanceNo,    // Instance number
+        SICE_REDUNDANCY_BOOL,           // Is redundancy used?
+        RTOS_UCC_MAX_PACKETS,           // Maximum number of UCC packets
+        prSiceInstance->aucMyMAC        // Buffer for MAC address
+      );
+  if (iRet != RTOS_RET_OK)
+  {
+    SICE_VERBOSE(0, "Error: Could not initialize NIC-timed transmission!\n");
+    return(SICE_SOCKET_ERROR);
+  }
+  else
+  {
+    SICE_VERBOSE(1, "  Done.\n");
+  }
+#endif
+
+  // Allocate memory used in the Sercos cycle, locked in RAM
+  prSiceInstance->prArena =
+      (SICE_ARENA_STRUCT*) RTOS_AllocLockedMem(sizeof (SICE_ARENA_STRUCT));
+
+  if (prSiceInstance->prArena == NULL)
+  {
+    SICE_VERBOSE(0, "Error: Could not allocate SICE memory!\n");
+    return(SICE_MEM_ERROR);
+  }
+
+  // Assign Sercos frames
   for (
       iCnt = 0;
       iCnt < (2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL);
       iCnt++
     )
   {
+#ifdef RTOS_XDP
+    // Telegrams are built directly in the UMEM of the port they are
+    // transmitted on
+    prSiceInstance->aprSendFrame[iCnt] =
+        (SICE_SIII_PACKET_BUF*) RTOS_XdpAllocTxFrame
+        (
+          prSiceInstance->iInstanceNo,
+          (iCnt < (2*CSMD_MAX_TEL)) ? SICE_ETH_PORT_P : SICE_ETH_PORT_S,
+          sizeof (SICE_SIII_PACKET_BUF)
+        );
+#else
     prSiceInstance->aprSendFrame[iCnt] =
-        (SICE_SIII_PACKET_BUF*) malloc(sizeof (SICE_SIII_PACKET_BUF));
+        &prSiceInstance->prArena->arSendFrame[iCnt].rFrame;
+#endif
 
     if (prSiceInstance->aprSendFrame[iCnt] == NULL)
     {
@@ -242,6 +288,15 @@ SICE_FUNC_RET SICE_Init
     return(eSiceRet);
   }
 
+#ifdef SICE_WIRE_THREAD
+  SICE_VERBOSE(1, "Starting wire thread ...\n");
+  eSiceRet = SICE_WireStart(prSiceInstance);
+  if (eSiceRet != SICE_NO_ERROR)
+  {
+    return(eSiceRet);
+  }
+#endif
+
 #ifdef SICE_UC_CHANNEL
 
   SICE_VERBOSE(1, "Initializing UCC ...\n");
@@ -325,7 +380,7 @@ SICE_FUNC_RET SICE_SoftReset
   // Initialize memory
   (VOID)memset
       (
-        &prSiceInstance->rMemory,
+        &prSiceInstance->prArena->rMemory,
         (UCHAR)0x00,
         sizeof(SICE_EMUL_MEM_STRUCT)
       );
@@ -335,9 +390,40 @@ SICE_FUNC_RET SICE_SoftReset
   prSiceInstance->usNumRecogDevs          = (USHORT) 0;
   prSiceInstance->ucWDAlarm               = (UCHAR) SICE_WD_ALARM_NONE;
   prSiceInstance->ucCycleCnt              = (UCHAR) 0;
-  prSiceInstance->ulLatchedTime.ulSeconds = (ULONG) 0;
-  prSiceInstance->ulLatchedTime.ulNanos   = (ULONG) 0;
-  prSiceInstance->boSercosTimeEn          = FALSE;
+
+  // Sercos time counted by SICE
+  (VOID)memset
+      (
+        &prSiceInstance->rSercosTime,
+        (UCHAR)0x00,
+        sizeof(SICE_SERCOS_TIME_STRUCT)
+      );
+
+  // Discard compiled descriptors
+  prSiceInstance->rTxPlan.boValid         = FALSE;
+  prSiceInstance->rRxPlan.boValid         = FALSE;
+
+  // Buffer 0 of buffer system A being transmitted and received
+  prSiceInstance->usTxBufSysA             = (USHORT) 0;
+
+  for (
+      iCnt = 0;
+      iCnt < SICE_REDUNDANCY_VAL;
+      iCnt++
+    )
+  {
+    prSiceInstance->ausRxBufSysA[iCnt]    = (USHORT) 0;
+  }
+
+#ifdef SICE_MEASURE_RDLY
+  // Discard ring delay samples
+  (VOID)memset
+      (
+        prSiceInstance->arRdlyMeas,
+        (UCHAR)0x00,
+        sizeof(prSiceInstance->arRdlyMeas)
+      );
+#endif
 
   // Initialize Sercos frames
   for (
@@ -347,7 +433,8 @@ SICE_FUNC_RET SICE_SoftReset
     )
   {
     // De-activate frame
-    prSiceInstance->aprSendFrame[iCnt]->boEnable = FALSE;
+    prSiceInstance->aprSendFrame[iCnt]->boEnable   = FALSE;
+    prSiceInstance->aprSendFrame[iCnt]->pucPayload = NULL;
 
     // Get frame pointer and fill frame with constant header values
     puSercosFrame = (SICE_SIII_FRAME *)prSiceInstance->aprSendFrame[iCnt]->aucData;
@@ -385,13 +472,13 @@ SICE_FUNC_RET SICE_SoftReset
 
   // Get pointers to Sercos IP core memory segments to reduce typing overhead
   prSiceInstance->prReg =
-      (CSMD_HAL_SERCFPGA_REGISTER*) prSiceInstance->rMemory.aucRegister;
+      (CSMD_HAL_SERCFPGA_REGISTER*) prSiceInstance->prArena->rMemory.aucRegister;
   prSiceInstance->prSVC_Ram =
-      (CSMD_HAL_SVC_RAM*) prSiceInstance->rMemory.aucSvc;
+      (CSMD_HAL_SVC_RAM*) prSiceInstance->prArena->rMemory.aucSvc;
   prSiceInstance->prTX_Ram =
-      (CSMD_HAL_TX_RAM*) prSiceInstance->rMemory.aucTxRAM;
+      (CSMD_HAL_TX_RAM*) prSiceInstance->prArena->rMemory.aucTxRAM;
   prSiceInstance->prRX_Ram =
-      (CSMD_HAL_RX_RAM*) prSiceInstance->rMemory.aucRxRAM;
+      (CSMD_HAL_RX_RAM*) prSiceInstance->prArena->rMemory.aucRxRAM;
 
   // Initialize Sercos IP core registers
 
@@ -554,6 +641,20 @@ SICE_FUNC_RET SICE_SoftReset
     prSiceInstance->prEvents[iCnt].usType         = (USHORT) 0;
   }
 
+#ifdef SICE_TX_INCREMENTAL
+  // TX RAM change tracking is mapped to the memory interface as well,
+  // cleared above
+  /*lint -save -e513 -e826 const! */
+  prSiceInstance->rTxIncr.prTrack =
+      (CSMD_HAL_TX_TRACK*)  (
+                ((UCHAR*)prSiceInstance->prReg) +
+                CSMD_HAL_SOFT_MASTER_REG_TX_TRACK_OFFSET
+              );
+  /*lint -restore const! */
+  prSiceInstance->rTxIncr.prTrack->ulEnabled = (ULONG) 1;
+  prSiceInstance->rTxIncr.boCopyAll = TRUE;
+#endif
+
   // Initialize UC channel
 #ifdef SICE_UC_CHANNEL
 
@@ -617,6 +718,11 @@ SICE_FUNC_RET SICE_Close
 
   SICE_VERBOSE(3, "SICE_Close()\n");
 
+#ifdef SICE_WIRE_THREAD
+  // Stop wire thread before its sockets are closed
+  SICE_WireStop(prSiceInstance);
+#endif
+
   //Close UC channel
 #ifdef SICE_UC_CHANNEL
 
@@ -638,16 +744,27 @@ SICE_FUNC_RET SICE_Close
         prSiceInstance->iInstanceNo,
         SICE_REDUNDANCY_BOOL
       );
+#ifdef SICE_USE_NIC_TIMED_TX
+  RTOS_CloseNicTimedTransmission
+      (
+        prSiceInstance->iInstanceNo,
+        SICE_REDUNDANCY_BOOL
+      );
+#endif
 
-  // Free allocated frame buffers
+  // Release frame buffers. With RTOS_XDP, they have been released together
+  // with the UMEM when closing the sockets.
   for (
       iCnt = 0;
       iCnt < (2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL);
       iCnt++
     )
   {
-    free(prSiceInstance->aprSendFrame[iCnt]);
+    prSiceInstance->aprSendFrame[iCnt] = NULL;
   }
 
+  RTOS_FreeLockedMem(prSiceInstance->prArena);
+  prSiceInstance->prArena = NULL;
+
 return(SICE_NO_ERROR);
 }
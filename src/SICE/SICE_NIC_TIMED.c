@@ -144,7 +144,6 @@ SICE_FUNC_RET SICE_SendTelegramsNicTimed
 #ifdef SICE_USE_NIC_TIMED_TX
   INT                           iRet                = 0;
   INT                           iCnt                = 0;
-  USHORT                        usPacketIdx         = 0;
   USHORT                        usIFG               = CSMD_HAL_TXIFG_BASE;  // Base value for IFG
   USHORT                        usReqIFG            = 0;
   RTOS_NIC_TIMED_PACKET_STRUCT  rNicTimedPacketStruct;
@@ -188,13 +187,16 @@ SICE_FUNC_RET SICE_SendTelegramsNicTimed
 
   iCnt = 0;
 
-  while (prSiceInstance->aprSendFrame[iCnt]->boEnable)
+  while (
+      (iCnt < CSMD_MAX_TEL) &&
+      prSiceInstance->aprSendFrame[iCnt]->boEnable
+    )
   {
     rNicTimedPacketStruct.rMDT.usNum++;
     rNicTimedPacketStruct.rMDT.aapucPacket[iCnt][0] =
         prSiceInstance->aprSendFrame[iCnt]->aucData;
     rNicTimedPacketStruct.rMDT.ausLen[iCnt] =
-        prSiceInstance->aprSendFrame[usPacketIdx]->usLen;
+        prSiceInstance->aprSendFrame[iCnt]->usLen;
 
     // In case of redundancy is used, transmit also packets to the other port
     if (SICE_REDUNDANCY_BOOL)
@@ -212,13 +214,16 @@ SICE_FUNC_RET SICE_SendTelegramsNicTimed
 
   iCnt = 0;
 
-  while (prSiceInstance->aprSendFrame[iCnt + CSMD_MAX_TEL]->boEnable)
+  while (
+      (iCnt < CSMD_MAX_TEL) &&
+      prSiceInstance->aprSendFrame[iCnt + CSMD_MAX_TEL]->boEnable
+    )
   {
     rNicTimedPacketStruct.rAT.usNum++;
     rNicTimedPacketStruct.rAT.aapucPacket[iCnt][0] =
         prSiceInstance->aprSendFrame[iCnt + CSMD_MAX_TEL]->aucData;
     rNicTimedPacketStruct.rAT.ausLen[iCnt] =
-        prSiceInstance->aprSendFrame[usPacketIdx + CSMD_MAX_TEL]->usLen;
+        prSiceInstance->aprSendFrame[iCnt + CSMD_MAX_TEL]->usLen;
 
     // In case of redundancy is used, transmit also packets to the other port
     if (SICE_REDUNDANCY_BOOL)
@@ -250,6 +255,7 @@ SICE_FUNC_RET SICE_SendTelegramsNicTimed
     ULONG ulRemUCCDuration = 0;
     ULONG ulUCCStart       = 0;
     ULONG ulUCCEnd         = 0;
+    SICE_UCC_PACKET_SLOT* prSlot = NULL;
 
     // Transmit UCC packets
     if (SICE_UCC_GetTxQueueSize(prSiceInstance) > 0)
@@ -264,13 +270,15 @@ SICE_FUNC_RET SICE_SendTelegramsNicTimed
       // for the next packet within the remaining UCC interval as well as the
       // maximum number of UCC packets per cycle is not exceeded
 
+      prSlot = SICE_UCC_RingPeek(&prSiceInstance->rUCCTxBuf, 0);
+
       while (
-              (SICE_UCC_GetTxQueueSize(prSiceInstance) > 0)           &&
+              (prSlot != NULL)                                        &&
               (SICE_CalcPacketDuration
                    (
                      prSiceInstance,
-                     SICE_UCC_GetTxNextPacketSize(prSiceInstance)
-                    ) <= ulRemUCCDuration
+                     prSlot->usLen
+                   ) <= ulRemUCCDuration
                )                                                      &&
                (rNicTimedPacketStruct.rUCC.usNum < RTOS_UCC_MAX_PACKETS)
             )
@@ -279,25 +287,28 @@ SICE_FUNC_RET SICE_SendTelegramsNicTimed
         ulRemUCCDuration -= SICE_CalcPacketDuration
             (
               prSiceInstance,
-              SICE_UCC_GetTxNextPacketSize(prSiceInstance)
+              prSlot->usLen
             );
 
         rNicTimedPacketStruct.rUCC.ausLen[rNicTimedPacketStruct.rUCC.usNum] =
-            prSiceInstance->rUCCTxBuf.usBufSize[prSiceInstance->rUCCTxBuf.ucBufPtrStart];
+            prSlot->usLen;
 
         // Todo: in non-redundancy mode signal error message in case port 1 is used
         rNicTimedPacketStruct.rUCC.aucPort[rNicTimedPacketStruct.rUCC.usNum] =
-            prSiceInstance->rUCCTxBuf.ucBufPort[prSiceInstance->rUCCTxBuf.ucBufPtrStart];
+            prSlot->ucPort;
 
+        // Transmit directly from ring slot. The slots are released only after
+        // the transmission below, so the producer cannot overwrite them.
         rNicTimedPacketStruct.rUCC.apucPacket[rNicTimedPacketStruct.rUCC.usNum] =
-            prSiceInstance->rUCCTxBuf.aucBuf[prSiceInstance->rUCCTxBuf.ucBufPtrStart];
+            prSlot->aucData;
 
         rNicTimedPacketStruct.rUCC.usNum++;
 
-        // ToDo: Blocking needed to avoid overwriting buffer by new packets?
-        prSiceInstance->rUCCTxBuf.ucBufPtrStart =
-            (prSiceInstance->rUCCTxBuf.ucBufPtrStart +1) % SICE_UCC_BUF_SIZE;
-
+        prSlot = SICE_UCC_RingPeek
+            (
+              &prSiceInstance->rUCCTxBuf,
+              rNicTimedPacketStruct.rUCC.usNum
+            );
       }
     }
   }
@@ -311,6 +322,15 @@ SICE_FUNC_RET SICE_SendTelegramsNicTimed
         usIFG                           // Inter-frame gap
       );
 
+#ifdef SICE_UC_CHANNEL
+  // Hand transmitted UCC slots back to producer
+  SICE_UCC_RingRelease
+      (
+        &prSiceInstance->rUCCTxBuf,
+        rNicTimedPacketStruct.rUCC.usNum
+      );
+#endif
+
   if (iRet != RTOS_RET_OK)
   {
     SICE_VERBOSE(0, "Error transmitting packets\n");
@@ -404,6 +424,7 @@ SICE_FUNC_RET SICE_SendUccTelegramsNicTimedNRT
   USHORT                        usIFG               = CSMD_HAL_TXIFG_BASE;  // Base value for IFG
   RTOS_NIC_TIMED_PACKET_STRUCT  rNicTimedPacketStruct;
   ULONG                         ulRemUCCDuration    = prSiceInstance->rUCCConfig.ulUccIntNRT;
+  SICE_UCC_PACKET_SLOT*         prSlot              = NULL;
 
   SICE_VERBOSE(3, "SICE_SendUccTelegramsNicTimedNRT()\n");
 
@@ -442,41 +463,45 @@ SICE_FUNC_RET SICE_SendUccTelegramsNicTimedNRT
     // for the next packet within the remaining UCC interval as well as the
     // maximum number of UCC packets per cycle is not exceeded
 
+    prSlot = SICE_UCC_RingPeek(&prSiceInstance->rUCCTxBuf, 0);
+
     while (
-            (SICE_UCC_GetTxQueueSize(prSiceInstance) > 0)           &&
+            (prSlot != NULL)                                        &&
             (SICE_CalcPacketDuration
                  (
                    prSiceInstance,
-                   SICE_UCC_GetTxNextPacketSize(prSiceInstance)
+                   prSlot->usLen
                  ) <= ulRemUCCDuration
              )                                                      &&
              (rNicTimedPacketStruct.rUCC.usNum < RTOS_UCC_MAX_PACKETS)
           )
     {
-
       // Calculate new remaining time of UCC interval
       ulRemUCCDuration -= SICE_CalcPacketDuration
           (
             prSiceInstance,
-            SICE_UCC_GetTxNextPacketSize(prSiceInstance)
+            prSlot->usLen
           );
 
       rNicTimedPacketStruct.rUCC.ausLen[rNicTimedPacketStruct.rUCC.usNum] =
-          prSiceInstance->rUCCTxBuf.usBufSize[prSiceInstance->rUCCTxBuf.ucBufPtrStart];
+          prSlot->usLen;
 
       // Todo: in non-redundancy mode signal error message in case port 1 is used
       rNicTimedPacketStruct.rUCC.aucPort[rNicTimedPacketStruct.rUCC.usNum] =
-          prSiceInstance->rUCCTxBuf.ucBufPort[prSiceInstance->rUCCTxBuf.ucBufPtrStart];
+          prSlot->ucPort;
 
+      // Transmit directly from ring slot. The slots are released only after
+      // the transmission below, so the producer cannot overwrite them.
       rNicTimedPacketStruct.rUCC.apucPacket[rNicTimedPacketStruct.rUCC.usNum] =
-          prSiceInstance->rUCCTxBuf.aucBuf[prSiceInstance->rUCCTxBuf.ucBufPtrStart];
+          prSlot->aucData;
 
       rNicTimedPacketStruct.rUCC.usNum++;
 
-      // ToDo: Blocking needed to avoid overwriting buffer by new packets?
-      prSiceInstance->rUCCTxBuf.ucBufPtrStart =
-          (prSiceInstance->rUCCTxBuf.ucBufPtrStart +1) % SICE_UCC_BUF_SIZE;
-
+      prSlot = SICE_UCC_RingPeek
+          (
+            &prSiceInstance->rUCCTxBuf,
+            rNicTimedPacketStruct.rUCC.usNum
+          );
     }
   }
 
@@ -488,6 +513,13 @@ SICE_FUNC_RET SICE_SendUccTelegramsNicTimedNRT
         usIFG                           // Inter-frame gap
       );
 
+  // Hand transmitted UCC slots back to producer
+  SICE_UCC_RingRelease
+      (
+        &prSiceInstance->rUCCTxBuf,
+        rNicTimedPacketStruct.rUCC.usNum
+      );
+
   if (iRet != RTOS_RET_OK)
   {
     SICE_VERBOSE(0, "Error transmitting packets\n");
@@ -131,6 +131,17 @@
                                         }                                       \
                                         /*lint -restore */
 
+#ifdef SICE_MEASURE_RDLY
+  #ifndef RTOS_TIMESTAMPING
+    #error SICE_MEASURE_RDLY requires RTOS_TIMESTAMPING!
+  #endif
+  #ifdef SICE_USE_NIC_TIMED_TX
+    #error SICE_MEASURE_RDLY is not available in NIC-timed transmission mode!
+  #endif
+#endif
+
+#define SICE_NSEC_PER_SEC   (1000ULL*1000*1000)
+
 #define SICE_RX_PACKET_CNT  (0)
 #define SICE_TX_PACKET_CNT  (1)
 #define SICE_RX_UCC_CNT     (2)
@@ -138,6 +149,13 @@
 #define SICE_RX_UCC_DISC    (4)
 #define SICE_TX_UCC_DISC    (5)
 
+// Memory ordering primitives for lock-free ring buffers shared between the
+// RT cycle and NRT threads
+
+#define SICE_LOAD_ACQUIRE(_p)       __atomic_load_n((_p), __ATOMIC_ACQUIRE)
+#define SICE_STORE_RELEASE(_p, _v)  __atomic_store_n((_p), (_v), __ATOMIC_RELEASE)
+#define SICE_EXCHANGE_ACQ_REL(_p, _v) __atomic_exchange_n((_p), (_v), __ATOMIC_ACQ_REL)
+
 
 // Check for configuration inconsistencies
 
@@ -147,11 +165,6 @@
     CoSeMa version (has to be at least 5V3.11).
 #endif
 
-#if ((CSMD_MAX_TX_BUFFER > 1) || (CSMD_MAX_RX_BUFFER > 1)) //only single buffering supported
-#error SICE_PRIV.h: Sercos master IP core emulation only supports single \
-    buffering (CSMD_MAX_TX_BUFFER, CSMD_MAX_RX_BUFFER).
-#endif
-
 #if (CSMD_MAX_HW_CONTAINER != 0) // Only soft SVCs supported
 #error SICE_PRIV.h: Sercos master IP core emulation only supports soft SVCs \
     (CSMD_MAX_HW_CONTAINER).
@@ -188,6 +201,10 @@
 #endif
 #endif
 
+#if ((SICE_UCC_BUF_SIZE) & ((SICE_UCC_BUF_SIZE) - 1)) != 0
+#error SICE_PRIV.h: SICE_UCC_BUF_SIZE has to be a power of two.
+#endif
+
 #ifdef SICE_USE_NIC_TIMED_TX
     #if (RTOS_TIMING_MODE != RTOS_TIMING_NIC)
     #error SICE_PRIV.h: For SICE_USE_NIC_TIMED_TX, the RTOS timing mode   \
@@ -199,6 +216,47 @@
     #endif
 #endif
 
+#ifdef SICE_RX_BUSY_POLL
+    #ifndef SICE_CALL_RX_RIGHT_AFTER_TX
+    #error SICE_PRIV.h: SICE_RX_BUSY_POLL requires SICE_CALL_RX_RIGHT_AFTER_TX.
+    #endif
+#endif
+
+#ifdef SICE_TX_SHARED_PAYLOAD
+    #ifndef SICE_TX_BATCH
+    #error SICE_PRIV.h: SICE_TX_SHARED_PAYLOAD requires SICE_TX_BATCH.
+    #endif
+    #ifdef SICE_USE_NIC_TIMED_TX
+    #error SICE_PRIV.h: SICE_TX_SHARED_PAYLOAD is not available in NIC-timed \
+            transmission mode!
+    #endif
+#endif
+
+#if (defined SICE_TX_INCREMENTAL) && (!defined CSMD_SOFT_MASTER)
+    #error SICE_PRIV.h: SICE_TX_INCREMENTAL requires CSMD_SOFT_MASTER.
+#endif
+
+#ifdef SICE_WIRE_THREAD
+    #ifndef SICE_TX_BATCH
+    #error SICE_PRIV.h: SICE_WIRE_THREAD requires SICE_TX_BATCH.
+    #endif
+    #ifdef SICE_USE_NIC_TIMED_TX
+    #error SICE_PRIV.h: SICE_WIRE_THREAD is not available in NIC-timed \
+            transmission mode!
+    #endif
+    #ifdef SICE_CALL_RX_RIGHT_AFTER_TX
+    #error SICE_PRIV.h: SICE_WIRE_THREAD already receives right after \
+            transmission, SICE_CALL_RX_RIGHT_AFTER_TX has to be undefined.
+    #endif
+    #ifdef SICE_MEASURE_RDLY
+    #error SICE_PRIV.h: SICE_MEASURE_RDLY is not available with SICE_WIRE_THREAD!
+    #endif
+    #if (SICE_WAITING_TIME_TX_MDT_AT != 0)
+    #error SICE_PRIV.h: SICE_WIRE_THREAD transmits all telegrams of a cycle \
+            at once, SICE_WAITING_TIME_TX_MDT_AT has to be 0.
+    #endif
+#endif
+
 // Constants for Sercos header
 
 #define SICE_TEL_CP_MASK            (0x0F)              /**< Bit in phase field to signal communication phase */
@@ -236,6 +294,8 @@
 #define SICE_TEL_DESC_IDX_SHIFT     (0x02)              /**< Telegram type shift in telegram lists, e.g. IP core descriptors */
 #define SICE_TEL_DESC_OFFSET_MASK   (0x00003FFC)        /**< Mask for RX/TX descriptor offsets */
 #define SICE_TEL_DESC_ENABLE_MASK   (0x00000001)        /**< Mask for enabling RX/TX descriptors for the current packet */
+#define SICE_TEL_DESC_TYPE_END      (0x04)              /**< RX/TX descriptor type marking the end of the list */
+#define SICE_DESC_GAP_MERGE_LEN     (64)                /**< Gaps of a TX packet closer than this are zeroed by a single memset() */
 
 #define SICE_IFG_REG_MASK           (0x000003FF)        /**< Mask for IFG in IP core IFG register */
 
@@ -244,12 +304,20 @@
 
 #define SICE_CRC_POLY               (0xEDB88320)        /**< Generator polynom of CRC32 calculation */
 #define SICE_CRC_TABLE_SIZE         (256)               /**< Size of pre-calculated CRC32 table */
+#define SICE_CRC_TABLE_SLICES       (8)                 /**< Number of CRC32 tables for slice-by-8 calculation */
 
 #define SICE_SERC3_TEL_HEADER       (20)                /**< Size of Sercos 3 telegram header */
 #define SICE_SERC3_MAX_DATA_LENGTH  (1494)              /**< Maximum size of Sercos 3 telegram data length */
 
 #define SICE_SERC3_MAC_ADR_SIZE     (6)                 /**< Length of Ethernet MAC address */
 
+#define SICE_WIRE_NUM_BUF           (3)                 /**< Number of images of a wire thread triple buffer */
+#define SICE_WIRE_BUF_IDX_MASK      (0x03)              /**< Image index in triple buffer exchange value */
+#define SICE_WIRE_BUF_NEW           (0x04)              /**< Flag in triple buffer exchange value for an image not yet taken over */
+#define SICE_WIRE_TX_FRAMES         (2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL)
+                                                        /**< Maximum number of frames transmitted by the wire thread per cycle */
+#define SICE_WIRE_IDLE_NS           (1000 * 1000)       /**< Polling interval in ns of the wire thread before the first handover */
+
 //---- type definitions -------------------------------------------------------
 
 /**
@@ -274,6 +342,98 @@ typedef union
                                                         /**< Raw packet data */
 } SICE_SIII_FRAME;
 
+#ifdef SICE_WIRE_THREAD
+/**
+ * \struct  SICE_WIRE_TRIPLE_STRUCT
+ *
+ * \brief   Indices of a lock-free triple buffer between the wire thread and
+ *          the thread calling SICE.
+ *
+ * \details The producer owns image ulWrite, the consumer image ulRead. The
+ *          third image is exchanged atomically in ulMiddle, together with
+ *          SICE_WIRE_BUF_NEW as long as the consumer has not taken it over.
+ *          Neither side ever waits, the consumer always gets the latest
+ *          complete image. ulMiddle is kept on a cache line of its own.
+*/
+typedef struct
+{
+  ULONG  ulMiddle;                              /**< Exchanged image and flag */
+  UCHAR  aucPad1[SICE_UCC_CACHE_LINE - sizeof(ULONG)];
+                                                /**< Padding to next cache line */
+  ULONG  ulWrite;                               /**< Image owned by producer */
+  UCHAR  aucPad2[SICE_UCC_CACHE_LINE - sizeof(ULONG)];
+                                                /**< Padding to next cache line */
+  ULONG  ulRead;                                /**< Image owned by consumer */
+} SICE_WIRE_TRIPLE_STRUCT;
+
+/**
+ * \struct  SICE_WIRE_TX_IMAGE
+ *
+ * \brief   Telegrams of one cycle handed over to the wire thread
+*/
+typedef struct
+{
+  ULONG  ulCycleTimeNs;                         /**< Sercos cycle time in ns */
+  ULONG  ulRxWindowNs;                          /**< Maximum reception time after
+                                                     transmission in ns */
+  ULONG  ulExpectedAT;                          /**< ATs expected back, bit per
+                                                     telegram number */
+  USHORT usIFG;                                 /**< Inter-frame gap */
+  USHORT usNum;                                 /**< Number of frames */
+  USHORT ausLen[SICE_WIRE_TX_FRAMES];           /**< Length of frames in bytes */
+  UCHAR  aucPort[SICE_WIRE_TX_FRAMES];          /**< Transmit port of frames */
+  UCHAR* apucData[SICE_WIRE_TX_FRAMES];         /**< Pointer to frames for
+                                                     RTOS_TxPacketBatch() */
+  UCHAR  aaucData[SICE_WIRE_TX_FRAMES][SICE_ETH_FRAMEBUF_LEN];
+                                                /**< Frame data */
+} SICE_WIRE_TX_IMAGE;
+
+/**
+ * \struct  SICE_WIRE_RX_IMAGE
+ *
+ * \brief   Frames received by the wire thread in one cycle
+*/
+typedef struct
+{
+  USHORT usNum;                                 /**< Number of frames */
+  USHORT ausLen[SICE_WIRE_RX_FRAMES];           /**< Length of frames in bytes */
+  UCHAR  aucPort[SICE_WIRE_RX_FRAMES];          /**< Receive port of frames */
+  UCHAR  aaucData[SICE_WIRE_RX_FRAMES][SICE_ETH_FRAMEBUF_LEN];
+                                                /**< Frame data */
+} SICE_WIRE_RX_IMAGE;
+
+/**
+ * \struct  SICE_WIRE_STR
+ *
+ * \brief   Wire thread of a SICE instance with its handover buffers. The
+ *          counters are only written by the wire thread.
+*/
+struct SICE_WIRE_STR
+{
+  SICE_INSTANCE_STRUCT*   prSiceInstance;       /**< SICE instance */
+  RTOS_THREAD             rThread;              /**< Wire thread */
+  volatile BOOL           boRunning;            /**< Wire thread active */
+  SICE_WIRE_TRIPLE_STRUCT rTxBuf;               /**< Calling thread -> wire thread */
+  SICE_WIRE_TX_IMAGE      arTxImage[SICE_WIRE_NUM_BUF];
+                                                /**< Telegrams to be transmitted */
+  SICE_WIRE_TRIPLE_STRUCT rRxBuf;               /**< Wire thread -> calling thread */
+  SICE_WIRE_RX_IMAGE      arRxImage[SICE_WIRE_NUM_BUF];
+                                                /**< Received frames */
+  USHORT                  ausRxNext[SICE_REDUNDANCY_VAL];
+                                                /**< Next frame of taken over receive
+                                                     image per port */
+  UCHAR                   aucRxDiscard[SICE_ETH_FRAMEBUF_LEN];
+                                                /**< Buffer for frames dropped due
+                                                     to a full receive image */
+  volatile ULONG          ulTxSkipped;          /**< Cycles without new telegrams */
+  volatile ULONG          ulTxErrors;           /**< Failed transmissions */
+  volatile ULONG          ulRxErrors;           /**< Failed receptions */
+  volatile ULONG          ulRxDropped;          /**< Frames dropped due to full
+                                                     receive image */
+  volatile ULONG          ulOverruns;           /**< Missed transmission instants */
+};
+#endif
+
 //---- variable declarations --------------------------------------------------
 
 //---- function declarations --------------------------------------------------
@@ -328,18 +488,30 @@ SOURCE UCHAR SICE_SercosTypeField
       UCHAR ucChannel
     );
 
-SOURCE SICE_FUNC_RET SICE_CopyTxData
+SOURCE SICE_FUNC_RET SICE_CompileTxPlan
     (
       SICE_INSTANCE_STRUCT* prSiceInstance,
-      SICE_SIII_FRAME* puSercosFrameP1,
-      SICE_SIII_FRAME* puSercosFrameP2,
-      UCHAR ucDescType,
-      UCHAR ucBufSel,
-      USHORT usLastBufOffset,
-      USHORT usLastFrameOffset,
-      USHORT usFrameOffset
+      ULONG ulPacketMask
     );
 
+#ifdef SICE_TX_INCREMENTAL
+SOURCE VOID SICE_CopyTxSegment
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      UCHAR *pucDest,
+      UCHAR *pucSrc,
+      USHORT usLen,
+      BOOL boCopyAll
+    );
+#endif
+
+#ifdef SICE_TX_SHARED_PAYLOAD
+SOURCE VOID SICE_ShareTxPayload
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      USHORT usPacketIdx
+    );
+#endif
 
 SOURCE SICE_FUNC_RET SICE_SendMDTTelegrams
     (
@@ -351,17 +523,22 @@ SOURCE SICE_FUNC_RET SICE_SendATTelegrams
       SICE_INSTANCE_STRUCT *prSiceInstance
     );
 
+#ifdef SICE_TX_BATCH
+SOURCE SICE_FUNC_RET SICE_FlushTelegrams
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    );
+#endif
+
 SOURCE SICE_FUNC_RET SICE_CheckPreCondsSend
     (
       SICE_INSTANCE_STRUCT *prSiceInstance
     );
 
-SOURCE SICE_FUNC_RET SICE_GenExtField
+SOURCE VOID SICE_GenExtField
     (
       SICE_INSTANCE_STRUCT *prSiceInstance,
-      USHORT *pusExtField,
-      UCHAR ucPhaseAll,
-      USHORT usPacketIdx
+      UCHAR ucPhaseAll
     );
 
 SOURCE SICE_FUNC_RET SICE_SendTelegramsNicTimed
@@ -381,6 +558,20 @@ SOURCE SICE_FUNC_RET SICE_ReceiveTelegrams
       SICE_INSTANCE_STRUCT *prSiceInstance
     );
 
+#ifdef SICE_RX_BUSY_POLL
+SOURCE SICE_FUNC_RET SICE_ReceiveTelegramsBusyPoll
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    );
+#endif
+
+#if (defined SICE_RX_BUSY_POLL) || (defined SICE_WIRE_THREAD)
+SOURCE ULONGLONG SICE_GetTimeNs
+    (
+      VOID
+    );
+#endif
+
 SOURCE SICE_FUNC_RET SICE_CheckPreCondsReceive
     (
       SICE_INSTANCE_STRUCT *prSiceInstance
@@ -391,6 +582,20 @@ SOURCE INT SICE_CalcNoOfSlaves
       SICE_INSTANCE_STRUCT *prSiceInstance
     );
 
+SOURCE SICE_FUNC_RET SICE_CompileRxPlan
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      ULONG ulPacketMask
+    );
+
+SOURCE SICE_FUNC_RET SICE_CopyRxData
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      SICE_SIII_FRAME *puSercosFrame,
+      INT iPort,
+      UCHAR ucPacketNoIndex
+    );
+
 // SICE_UTIL.c
 
 SOURCE ULONG SICE_GetEventTime
@@ -404,11 +609,40 @@ SOURCE SICE_FUNC_RET SICE_CheckTimingMethod
       SICE_INSTANCE_STRUCT *prSiceInstance
     );
 
+SOURCE VOID SICE_UpdateSercosTime
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    );
+
 SOURCE SICE_FUNC_RET SICE_CalcRingDelay
     (
       SICE_INSTANCE_STRUCT *prSiceInstance
     );
 
+SOURCE SICE_FUNC_RET SICE_SwitchBufferSysA
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    );
+
+#ifdef SICE_MEASURE_RDLY
+SOURCE VOID SICE_StoreRdlyRxStamp
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      INT iRxPort,
+      INT iTxPort
+    );
+
+SOURCE VOID SICE_UpdateRdlySamples
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    );
+
+SOURCE ULONG SICE_GetRdlyMedian
+    (
+      SICE_RDLY_MEAS_STRUCT *prRdlyMeas
+    );
+#endif
+
 #ifdef CSMD_HW_WATCHDOG
 SOURCE SICE_FUNC_RET SICE_UpdateWatchdogStatus
     (
@@ -431,6 +665,81 @@ SOURCE ULONG SICE_CalcPacketDuration
       USHORT usPacketLen
     );
 
+SOURCE VOID SICE_DescPlanStart
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      SICE_DESC_PLAN_STRUCT *prPlan
+    );
+
+SOURCE BOOL SICE_DescPlanFetch
+    (
+      SICE_DESC_PLAN_STRUCT *prPlan,
+      UCHAR *pucRam,
+      USHORT usIndexTableOffset,
+      USHORT usPacketIdx,
+      BOOL boCheckEnable
+    );
+
+SOURCE BOOL SICE_DescPlanAddSeg
+    (
+      SICE_DESC_PLAN_STRUCT *prPlan,
+      USHORT usPacketIdx,
+      UCHAR* apucBuf[],
+      UCHAR* pucBuf2,
+      USHORT usFrameOffset,
+      USHORT usLen,
+      BOOL boBufSysA
+    );
+
+SOURCE VOID SICE_DescPlanBuildGaps
+    (
+      SICE_DESC_PLAN_STRUCT *prPlan,
+      USHORT usPacketIdx,
+      USHORT usDataLen
+    );
+
+SOURCE BOOL SICE_DescPlanIsValid
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      SICE_DESC_PLAN_STRUCT *prPlan,
+      UCHAR *pucRam,
+      USHORT usIndexTableOffset,
+      ULONG ulPacketMask
+    );
+
+#ifdef SICE_WIRE_THREAD
+// SICE_WIRE.c
+
+SOURCE SICE_FUNC_RET SICE_WireStart
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    );
+
+SOURCE VOID SICE_WireStop
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    );
+
+SOURCE INT SICE_WireHandOverTx
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      USHORT usIFG
+    );
+
+SOURCE VOID SICE_WireFetchRx
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    );
+
+SOURCE INT SICE_WireRxPacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      INT iPort,
+      UCHAR **ppucPacket
+    );
+
+#endif
+
 // SICE_UCC.c
 
 SOURCE SICE_FUNC_RET SICE_UCC_Init
@@ -472,6 +781,38 @@ SOURCE ULONG SICE_UCC_GetTxNextPacketSize
       SICE_INSTANCE_STRUCT *prSiceInstance
     );
 
+SOURCE VOID SICE_UCC_RingReset
+    (
+      SICE_UCC_PACKET_BUF *prRing
+    );
+
+SOURCE SICE_UCC_PACKET_SLOT* SICE_UCC_RingReserve
+    (
+      SICE_UCC_PACKET_BUF *prRing
+    );
+
+SOURCE VOID SICE_UCC_RingCommit
+    (
+      SICE_UCC_PACKET_BUF *prRing
+    );
+
+SOURCE SICE_UCC_PACKET_SLOT* SICE_UCC_RingPeek
+    (
+      SICE_UCC_PACKET_BUF *prRing,
+      ULONG ulOffset
+    );
+
+SOURCE VOID SICE_UCC_RingRelease
+    (
+      SICE_UCC_PACKET_BUF *prRing,
+      ULONG ulNum
+    );
+
+SOURCE ULONG SICE_UCC_RingLevel
+    (
+      SICE_UCC_PACKET_BUF *prRing
+    );
+
 #ifdef __cplusplus
 }
 #endif
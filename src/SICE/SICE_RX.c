@@ -166,19 +166,71 @@
                                                 ((UCHAR)0x0C))
 
 /**
- * \def     SICE_TGSR(_Port)
+ * \def     SICE_RX_CLASS_IDX(_SercosType)
  *
- * \brief   Macro for accessing the TGSR register depending on the port number
+ * \brief   Macro for the index into arRxClass from the Sercos type field of a
+ *          received packet: telegram number in bits 0..1, AT in bit 2 and
+ *          S channel in bit 3
  */
-#define SICE_TGSR(_Port)                        *(&prSiceInstance->ulTGSR1 + _Port *    \
-                                                (&prSiceInstance->ulTGSR2 -             \
-                                                &prSiceInstance->ulTGSR1))
+#define SICE_RX_CLASS_IDX(_SercosType)          (   (((UCHAR)_SercosType) & ((UCHAR)SICE_TEL_NO_MASK))       | \
+                                                    ((((UCHAR)_SercosType) & ((UCHAR)SICE_TEL_TYPE_MASK)) >> 4) | \
+                                                    ((((UCHAR)_SercosType) & ((UCHAR)SICE_TEL_CHANNEL_MASK)) >> 4))
 
+/**
+ * \def     SICE_RX_CLASS_NUM
+ *
+ * \brief   Number of entries of arRxClass
+ */
+#define SICE_RX_CLASS_NUM                       (16)
 
 //---- type definitions -------------------------------------------------------
 
+/**
+ * \struct  SICE_RX_CLASS_STRUCT
+ *
+ * \brief   Classification of a received Sercos packet by its Sercos type field
+ */
+typedef struct
+{
+  ULONG  ulTGSR;                              /**< Bits to be set in TGSR */
+  UCHAR  ucPacketIdx;                         /**< Packet type CSMD_DES_IDX_*, also
+                                                   selecting the RX copy plan */
+  BOOL   boCopy;                              /**< Copy data as compiled from the RX
+                                                   descriptors? Only for ATs */
+} SICE_RX_CLASS_STRUCT;
+
 //---- variable declarations --------------------------------------------------
 
+/**
+ * \var     arRxClass
+ *
+ * \brief   Classification of received packets, indexed by
+ *          SICE_RX_CLASS_IDX(). An MDT0 signals a valid MST, on the S channel
+ *          additionally the secondary telegram.
+ */
+static const SICE_RX_CLASS_STRUCT arRxClass[SICE_RX_CLASS_NUM] =
+{
+  // P channel
+  {CSMD_HAL_TGSR_MDT0 | CSMD_HAL_TGSR_MST_VALID,  CSMD_DES_IDX_MDT0,  FALSE},
+  {CSMD_HAL_TGSR_MDT1,                            CSMD_DES_IDX_MDT1,  FALSE},
+  {CSMD_HAL_TGSR_MDT2,                            CSMD_DES_IDX_MDT2,  FALSE},
+  {CSMD_HAL_TGSR_MDT3,                            CSMD_DES_IDX_MDT3,  FALSE},
+  {CSMD_HAL_TGSR_AT0,                             CSMD_DES_IDX_AT0,   TRUE},
+  {CSMD_HAL_TGSR_AT1,                             CSMD_DES_IDX_AT1,   TRUE},
+  {CSMD_HAL_TGSR_AT2,                             CSMD_DES_IDX_AT2,   TRUE},
+  {CSMD_HAL_TGSR_AT3,                             CSMD_DES_IDX_AT3,   TRUE},
+  // S channel
+  {CSMD_HAL_TGSR_MDT0 | CSMD_HAL_TGSR_MST_VALID | CSMD_HAL_TGSR_SEC_TEL,
+                                                  CSMD_DES_IDX_MDT0,  FALSE},
+  {CSMD_HAL_TGSR_MDT1,                            CSMD_DES_IDX_MDT1,  FALSE},
+  {CSMD_HAL_TGSR_MDT2,                            CSMD_DES_IDX_MDT2,  FALSE},
+  {CSMD_HAL_TGSR_MDT3,                            CSMD_DES_IDX_MDT3,  FALSE},
+  {CSMD_HAL_TGSR_AT0,                             CSMD_DES_IDX_AT0,   TRUE},
+  {CSMD_HAL_TGSR_AT1,                             CSMD_DES_IDX_AT1,   TRUE},
+  {CSMD_HAL_TGSR_AT2,                             CSMD_DES_IDX_AT2,   TRUE},
+  {CSMD_HAL_TGSR_AT3,                             CSMD_DES_IDX_AT3,   TRUE}
+};
+
 //---- function declarations --------------------------------------------------
 
 //---- function implementations -----------------------------------------------
@@ -209,9 +261,11 @@
  *          are set depending on the type of the received packet. Only ATs are
  *          processed further, MDTs are discarded. The packets are copied to
  *          the RX RAM or other buffers according to the settings in the RX
- *          descriptors.
+ *          descriptors. The packet type is looked up in arRxClass, TGSR bits,
+ *          packet counters and CRC warnings are applied once per port.
  *
- * \note    The function is non-blocking.
+ * \note    The function is non-blocking. With SICE_WIRE_THREAD, the frames
+ *          are taken from the latest receive image of the wire thread.
  *
  * \author  GMy, partially based on earlier work by SBe
  *
@@ -237,24 +291,17 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
   SICE_SIII_FRAME*      puSercosFrame       = NULL;
   UCHAR*                pucPacketBuf        = NULL;
   UCHAR                 ucPhase             = 0;
-  UCHAR                 ucTelSercosType     = 0;
   INT                   iRet                = 0;
-  UCHAR                 ucPacketNoIndex     = 0;
-  USHORT                usIndexTableOffset  = 0;
-  ULONG                 ulRXDescTableOffset = 0;
-  ULONG                 ulCurDesc           = 0;
-  USHORT                usCurDescOffset     = 0;
-  USHORT                usFrameOffset       = 0;
-  UCHAR                 ucDescType          = 0;
-  USHORT                usBufOffset         = 0;
-  UCHAR                 ucBufSel            = 0;
-  USHORT                usLastFrameOffset   = 0;
-  USHORT                usLastBufOffset     = 0;
-  USHORT                usLen               = 0;
   ULONG                 ulTmpCRC            = 0;
-  USHORT                usBufSysOffset      = 0;
   INT                   iPort;
-  BOOL                  boIsPortP           = TRUE;
+  SICE_FUNC_RET         eSiceRet            = SICE_NO_ERROR;
+  const SICE_RX_CLASS_STRUCT* prClass;
+  ULONG                 ulTGSR;
+  INT                   iRxOk;
+  INT                   iRxCrcErr;
+#ifdef SICE_UC_CHANNEL
+  SICE_UCC_PACKET_SLOT* prUCCSlot           = NULL;
+#endif
 
   SICE_VERBOSE(3, "SICE_ReceiveTelegrams()\n");
 
@@ -263,6 +310,15 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
     return(SICE_PARAMETER_ERROR);
   }
 
+#ifdef SICE_WIRE_THREAD
+  // Frames received by the wire thread in its latest cycle
+  SICE_WireFetchRx(prSiceInstance);
+#endif
+
+  // Retrieve current Sercos phase
+  ucPhase = (UCHAR)(prSiceInstance->prReg->ulPHASECR
+          & ((ULONG) CSMD_HAL_PHASECR_PHASE_MASK));
+
   // Do for all ports (1 in case without redundancy, 2 in case of redundancy)
   // being used
   for (
@@ -271,7 +327,21 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
       iPort++
     )
   {
+    // TGSR bits and packet counters are collected for all packets of the
+    // port and applied once
+    ulTGSR    = 0;
+    iRxOk     = 0;
+    iRxCrcErr = 0;
+
     // Attempt to receive frame (non-blocking)
+#ifdef SICE_WIRE_THREAD
+    iRet = SICE_WireRxPacket
+        (
+          prSiceInstance,               // SICE instance
+          iPort,                        // Port index
+          &pucPacketBuf                 // pointer to frame in receive image
+        );
+#else
     iRet = RTOS_RxPacket
         (
           prSiceInstance->iInstanceNo,  // SICE instance
@@ -279,6 +349,7 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
           rReceiveFrame.aucData,        // provided data buffer
           &pucPacketBuf                 // pointer to foreign data buffer
         );
+#endif
     if (iRet < 0)
     {
       SICE_VERBOSE
@@ -294,18 +365,12 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
     // Do while more frames are in receive buffer
     while (iRet > 0)
     {
-      SICE_VERBOSE(2, "Received a telegram.\n");
-
       // Get pointer to received frame
       prReceiveFrame = &rReceiveFrame;
 
       // Get length of received frame
       rReceiveFrame.usLen = (USHORT) iRet;
 
-      // Retrieve current Sercos phase
-      ucPhase = (UCHAR)(prSiceInstance->prReg->ulPHASECR
-              & ((ULONG) CSMD_HAL_PHASECR_PHASE_MASK));
-
       // Get frame pointer
       // Does receive function use own or provided packet buffer?
       if (pucPacketBuf != NULL)
@@ -335,34 +400,39 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
 #ifdef SICE_UC_CHANNEL
         SICE_VERBOSE(1, "Writing UC packet to queue.\n");
 
-        // Copy packet data to buffer
-        memcpy
-            (
-              prSiceInstance->rUCCRxBuf.aucBuf[prSiceInstance->rUCCRxBuf.ucBufPtrEnd],
-              puSercosFrame->aucRaw,
-              usLen
-            );
-
-        //Store frame size
-        prSiceInstance->rUCCRxBuf.usBufSize[prSiceInstance->rUCCRxBuf.ucBufPtrEnd] = usLen;
+        prUCCSlot = SICE_UCC_RingReserve(&prSiceInstance->rUCCRxBuf);
 
-        // Store port index
-        prSiceInstance->rUCCTxBuf.ucBufPort[prSiceInstance->rUCCTxBuf.ucBufPtrEnd] = (UCHAR)iPort;
+        if (prUCCSlot != NULL)
+        {
+          // Copy packet data to slot and publish it to the consumer
+          (VOID)memcpy
+              (
+                prUCCSlot->aucData,
+                puSercosFrame->aucRaw,
+                rReceiveFrame.usLen
+              );
 
-        // Increase ring buffer pointer
-        prSiceInstance->rUCCRxBuf.ucBufPtrEnd =
-            (prSiceInstance->rUCCRxBuf.ucBufPtrEnd + 1) % SICE_UCC_BUF_SIZE;
+          prUCCSlot->usLen  = rReceiveFrame.usLen;
+          prUCCSlot->ucPort = (UCHAR) iPort;
 
-        // Ring buffer overflow?
-        if (prSiceInstance->rUCCRxBuf.ucBufPtrEnd == prSiceInstance->rUCCRxBuf.ucBufPtrStart)
+          SICE_UCC_RingCommit(&prSiceInstance->rUCCRxBuf);
+        }
+        else
         {
-          SICE_VERBOSE(0, "Error: UCC RX Buffer overflow!");
+          // Ring buffer overflow, drop packet but continue reception of
+          // Sercos packets
+          SICE_VERBOSE(1, "Warning: UCC RX Buffer overflow!\n");
 
-          // Overwrite oldest packet
-          prSiceInstance->rUCCRxBuf.ucBufPtrStart =
-              (prSiceInstance->rUCCRxBuf.ucBufPtrStart + 1) % SICE_UCC_BUF_SIZE;
+          prSiceInstance->rUCCRxBuf.ulDropCnt++;
 
-          return(SICE_BUFFER_ERROR);
+          (VOID)SICE_IncPacketCounter
+              (
+                prSiceInstance,           // SICE instance structure
+                SICE_RX_UCC_DISC,         // Discarded receive packet
+                FALSE,                    // Error
+                iPort,                    // Port
+                1                         // One packet
+              );
         }
 
 #endif
@@ -382,448 +452,91 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
         // Is CRC of received frame correct?
         if (ulTmpCRC == puSercosFrame->rTel.ulCRC)
         {
-          (VOID)SICE_IncPacketCounter
-              (
-                prSiceInstance,     // SICE instance
-                SICE_RX_PACKET_CNT, // RX
-                TRUE,               // Packet is OK
-                iPort,              // Port number
-                1                   // Single packet
-              );
+          iRxOk++;
 
-          // Un-mask Sercos telegram type
-          ucTelSercosType =
-              puSercosFrame->rTel.ucSercosType &
-              (
-                ((UCHAR) SICE_TEL_NO_MASK)      |   // Telegram number
-                ((UCHAR) SICE_TEL_TYPE_MASK)    |   // MDT or AT
-                ((UCHAR) SICE_TEL_CHANNEL_MASK)     // S/P channel
-              );
+          // Classify packet by telegram number, MDT / AT and P / S channel
+          prClass = &arRxClass[SICE_RX_CLASS_IDX(puSercosFrame->rTel.ucSercosType)];
 
-          if ((ucTelSercosType & ((UCHAR)SICE_TEL_CHANNEL_MASK)) == (UCHAR)0)
-          {
-            boIsPortP = TRUE;
-          }
-          else
+          // Signal packet reception in TGSR
+          ulTGSR |= prClass->ulTGSR;
+
+#ifdef SICE_MEASURE_RDLY
+          if (prClass->ucPacketIdx == (UCHAR) CSMD_DES_IDX_MDT0)
           {
-            boIsPortP = FALSE;
+            // P telegrams are sent on port P, S telegrams on port S
+            SICE_StoreRdlyRxStamp
+                (
+                  prSiceInstance,
+                  iPort,
+                  ((prClass->ulTGSR & (ULONG) CSMD_HAL_TGSR_SEC_TEL) == (ULONG) 0) ?
+                      SICE_ETH_PORT_P : SICE_ETH_PORT_S
+                );
           }
+#endif
 
-          // Check type of Sercos telegram
-          switch (ucTelSercosType & ~((UCHAR) SICE_TEL_CHANNEL_MASK))
+          // In CP0, evaluate sequence counter value of AT0
+          if (  (prClass->ucPacketIdx == (UCHAR) CSMD_DES_IDX_AT0) &&
+                (ucPhase == ((UCHAR) CSMD_SERC_PHASE_0)))
           {
-            // MDT0
-            case (SICE_TEL_TYPE_MDT + CSMD_TELEGRAM_NBR_0):
-              // Signal packet reception in TGSR: MDT0 and valid MST
-              SICE_TGSR(iPort) |= (ULONG) CSMD_HAL_TGSR_MDT0 | (ULONG) CSMD_HAL_TGSR_MST_VALID;
-
-              //if ((ucTelSercosType & ((UCHAR) SICE_TEL_CHANNEL_MASK)) != (UCHAR) 0)
-              if (boIsPortP == FALSE)
-              {
-                SICE_TGSR(iPort) |= (ULONG) CSMD_HAL_TGSR_SEC_TEL;
-              }
-              ucPacketNoIndex    =  (UCHAR) CSMD_DES_IDX_MDT0;
-
-              SICE_VERBOSE
-                  (
-                    3,
-                    "Received packet type: MDT0 (P/S: %d) on Port %d\n",
-                    boIsPortP,
-                    iPort
-                  );
-              break;
-
-            // MDT1
-            case (SICE_TEL_TYPE_MDT + CSMD_TELEGRAM_NBR_1):
-              // Signal packet reception in TGSR
-              SICE_TGSR(iPort) |= (ULONG) CSMD_HAL_TGSR_MDT1;
-              ucPacketNoIndex  =  (UCHAR) CSMD_DES_IDX_MDT1;
-
-              SICE_VERBOSE
-                  (
-                    3,
-                    "Received packet type: MDT1 (P/S: %d) on Port %d\n",
-                    boIsPortP,
-                    iPort
-                  );
-              break;
-
-            // MDT2
-            case (SICE_TEL_TYPE_MDT + CSMD_TELEGRAM_NBR_2):
-              // Signal packet reception in TGSR
-              SICE_TGSR(iPort) |= (ULONG) CSMD_HAL_TGSR_MDT2;
-              ucPacketNoIndex  =  (UCHAR) CSMD_DES_IDX_MDT2;
-              SICE_VERBOSE
-                  (
-                    3,
-                    "Received packet type: MDT2 (P/S: %d) on Port %d\n",
-                    boIsPortP,
-                    iPort
-                  );
-              break;
-
-            // MDT3
-            case (SICE_TEL_TYPE_MDT + CSMD_TELEGRAM_NBR_3):
-              // Signal packet reception in TGSR
-              SICE_TGSR(iPort) |= (ULONG) CSMD_HAL_TGSR_MDT3;
-              ucPacketNoIndex  =  (UCHAR) CSMD_DES_IDX_MDT3;
-              SICE_VERBOSE
-                  (
-                    3,
-                    "Received packet type: MDT3 (P/S: %d) on Port %d\n",
-                    boIsPortP,
-                    iPort
-                  );
-              break;
-
-            // AT0
-            case (SICE_TEL_TYPE_AT + CSMD_TELEGRAM_NBR_0):
-              // Signal packet reception in TGSR
-              SICE_TGSR(iPort) |= (ULONG) CSMD_HAL_TGSR_AT0;
-              ucPacketNoIndex  =  (UCHAR) CSMD_DES_IDX_AT0;
-              SICE_VERBOSE
-                  (
-                    3,
-                    "Received packet type: AT0 (P/S: %d) on Port %d\n",
-                    boIsPortP,
-                    iPort
-                  );
-
-              // In CP0, evaluate sequence counter value
-              if (ucPhase == ((UCHAR) CSMD_SERC_PHASE_0))
-              {
-                // Set sequence counter register (SEQCNT)
-                // \todo OK for big endian?
-                if (iPort == 0)
-                {
-                  prSiceInstance->prReg->ulSEQCNT =
-                      (prSiceInstance->prReg->ulSEQCNT & (ULONG) 0xFFFF0000)    |
-                      (ULONG)((USHORT)*((USHORT *)puSercosFrame->rTel.aucData));
-                }
-                else
-                {
-                  prSiceInstance->prReg->ulSEQCNT =
-                      (prSiceInstance->prReg->ulSEQCNT & (ULONG) 0x0000FFFF)    |
-                      (((ULONG)((USHORT)*((USHORT *)puSercosFrame->rTel.aucData))) << 16);
-                }
-
-                // Store number of recognized slaves.
-                prSiceInstance->usNumRecogDevs = (USHORT) SICE_CalcNoOfSlaves(prSiceInstance);
-              }
-              break;
-
-            // AT1
-            case (SICE_TEL_TYPE_AT + CSMD_TELEGRAM_NBR_1):
-              // Signal packet reception in TGSR
-              SICE_TGSR(iPort) |= (ULONG) CSMD_HAL_TGSR_AT1;
-              ucPacketNoIndex  =  (UCHAR) CSMD_DES_IDX_AT1;
-              SICE_VERBOSE
-                  (
-                    3,
-                    "Received packet type: AT1 (P/S: %d) on Port %d\n",
-                    boIsPortP,
-                    iPort
-                  );
-              break;
-
-            // AT2
-            case (SICE_TEL_TYPE_AT + CSMD_TELEGRAM_NBR_2):
-              // Signal packet reception in TGSR
-              SICE_TGSR(iPort) |= (ULONG) CSMD_HAL_TGSR_AT2;
-              ucPacketNoIndex  =  (UCHAR) CSMD_DES_IDX_AT2;
-              SICE_VERBOSE
-                  (
-                    3,
-                    "Received packet type: AT2 (P/S: %d) on Port %d\n",
-                    boIsPortP,
-                    iPort
-                  );
-              break;
-
-            // AT3
-            case (SICE_TEL_TYPE_AT + CSMD_TELEGRAM_NBR_3):
-              // Signal packet reception in TGSR
-              SICE_TGSR(iPort) |= (ULONG) CSMD_HAL_TGSR_AT3;
-              ucPacketNoIndex     =  (UCHAR) CSMD_DES_IDX_AT3;
-              SICE_VERBOSE
-                  (
-                    3,
-                    "Received packet type: AT3 (P/S: %d) on Port %d\n",
-                    boIsPortP,
-                    iPort
-                  );
-              break;
-
-            default:
-              SICE_VERBOSE
-                  (
-                    0,
-                    "Warning: Received illegal Sercos packet type\n"
-                  );
-              break;
+            // Set sequence counter register (SEQCNT)
+            // \todo OK for big endian?
+            if (iPort == 0)
+            {
+              prSiceInstance->prReg->ulSEQCNT =
+                  (prSiceInstance->prReg->ulSEQCNT & (ULONG) 0xFFFF0000)    |
+                  (ULONG)((USHORT)*((USHORT *)puSercosFrame->rTel.aucData));
+            }
+            else
+            {
+              prSiceInstance->prReg->ulSEQCNT =
+                  (prSiceInstance->prReg->ulSEQCNT & (ULONG) 0x0000FFFF)    |
+                  (((ULONG)((USHORT)*((USHORT *)puSercosFrame->rTel.aucData))) << 16);
+            }
+
+            // Store number of recognized slaves.
+            prSiceInstance->usNumRecogDevs = (USHORT) SICE_CalcNoOfSlaves(prSiceInstance);
           }
 
+#ifdef SICE_RX_BUSY_POLL
+          // Arrival time of telegram after transmission
+          prSiceInstance->aulRxArrivalNs[iPort][prClass->ucPacketIdx] =
+              (ULONG) (SICE_GetTimeNs() - prSiceInstance->ullTxDoneNs);
+#endif
+
           // Only copy data from AT frames
-          if ((puSercosFrame->rTel.ucSercosType & ((UCHAR) SICE_TEL_TYPE_MASK))
-              == ((UCHAR) SICE_TEL_TYPE_AT))
+          if (prClass->boCopy)
           {
-            // Find corresponding descriptors for receive frame
-
-            // RX index table offset
-            usIndexTableOffset  =
-                prSiceInstance->prReg->rDECR.rDesIdx.usOffsetRxRam;
-
-            /*lint -save -e826 */
-            ulRXDescTableOffset =
-                *(
-                  (ULONG*)(
-                        (UCHAR *)prSiceInstance->prRX_Ram
-                        + ((ULONG) usIndexTableOffset)
-                        + ((ULONG) ucPacketNoIndex) * ((ULONG) sizeof(ULONG))
-                      )
+            // Copy data as compiled from the RX descriptors
+            eSiceRet = SICE_CopyRxData
+                (
+                  prSiceInstance,           // SICE instance
+                  puSercosFrame,            // Received frame
+                  iPort,                    // Port number
+                  prClass->ucPacketIdx      // Packet type
                 );
-            /*lint -restore */
 
-            // Descriptor enable bit, currently ignored
-            // (the same in current Sercos master 'hard' ip core)
-            // byRXDescTableEnabled = ulTXDescTableOffset & SIII_TEL_DESC_ENABLE_MASK;
-
-            // De-mask
-            ulRXDescTableOffset =
-                ulRXDescTableOffset & ((ULONG) SICE_TEL_DESC_OFFSET_MASK);
-
-            usCurDescOffset = (USHORT) ulRXDescTableOffset;
-
-            // Browse through all descriptors for this packet
-            do
+            if (eSiceRet != SICE_NO_ERROR)
             {
-              // Get RX descriptor
-              /*lint -save -e826 */
-              ulCurDesc =
-                  *(
-                    (ULONG*)((UCHAR *)prSiceInstance->prRX_Ram +
-                          (ULONG) usCurDescOffset)
-                  );
-              /*lint -restore */
-
-              usCurDescOffset += (USHORT) sizeof(ULONG);
-
-              usFrameOffset = (USHORT) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_TEL_OFFS))
-                        >> CSMD_HAL_DES_SHIFT_TEL_OFFS);
-              ucDescType    = (UCHAR) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_TYPE))
-                        >> CSMD_HAL_DES_SHIFT_TYPE);
-              usBufOffset   = (USHORT) (ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_BUFF_OFFS));
-              ucBufSel      = (UCHAR) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_BUFF_SYS_SEL))
-                        >> CSMD_HAL_DES_SHIFT_BUFF_SYS_SEL);
-
-              // Is it first descriptor of descriptor pair?
-              if (SICE_RX_DESC_START_DESC(ucDescType))
-              {
-                // Store start offsets for frame and buffer
-                usLastFrameOffset = usFrameOffset;
-                usLastBufOffset   = usBufOffset;
-              }
-              // Second descriptor of descriptor pair
-              else
-              {
-                // Calculate length of data to be copied
-                usLen = (usFrameOffset - usLastFrameOffset) +
-                    ((USHORT) sizeof(USHORT));     // USHORT alignment
-
-                // Real-time data
-                if (SICE_RX_DESC_RT_DATA(ucDescType))
-                {
-                  switch (ucBufSel)
-                  {
-                    case 0:
-                      if (iPort == 0)
-                      {
-                        usBufSysOffset = (USHORT) CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_A;
-                      }
-                      else
-                      {
-                        usBufSysOffset = (USHORT) CSMD_HAL_IDX_RX_P2_BUFF_0_SYS_A;
-                      }
-                      break;
-                    case 1:
-                      if (iPort == 0)
-                      {
-                        usBufSysOffset = (USHORT) CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_B;
-                      }
-                      else
-                      {
-                        usBufSysOffset = (USHORT) CSMD_HAL_IDX_RX_P2_BUFF_0_SYS_B;
-                      }
-                      break;
-                    default:
-                      SICE_VERBOSE
-                          (
-                            0,
-                            "Error in RX descriptor: Selected buffer "
-                            "system %c is not supported.",
-                            ucBufSel
-                          );
-
-                      return(SICE_RX_DESCRIPTOR_ERROR);
-                      /*lint -save -e527 */
-                      break;
-                      /*lint -restore */
-                  }
-                  (VOID)memcpy
-                      (
-                        (UCHAR *)prSiceInstance->prRX_Ram +
-                          prSiceInstance->prReg->aulRxBufBasePtr[usBufSysOffset] +
-                          usLastBufOffset,
-                        &puSercosFrame->rTel.aucData[usLastFrameOffset],
-                        usLen
-                      );
-                }
-                // SVC data
-                else if (SICE_RX_DESC_SVC_DATA(ucDescType))
-                {
-                  if (iPort == 0)
-                  {
-                    usBufSysOffset = CSMD_HAL_IDX_RX_P1_BUFF_SVC;
-                  }
-                  else
-                  {
-                    usBufSysOffset = CSMD_HAL_IDX_RX_P2_BUFF_SVC;
-                  }
-                  (VOID)memcpy
-                      (
-                        (UCHAR *)prSiceInstance->prRX_Ram +
-                          prSiceInstance->prReg->aulRxBufBasePtr[usBufSysOffset] +
-                          usLastBufOffset,
-                        &puSercosFrame->rTel.aucData[usLastFrameOffset],
-                        usLen
-                      );
-                }
-                // Port-specific CC data
-                else if (SICE_RX_DESC_PORTCC_DATA(ucDescType))
-                {
-                  // Written to TX RAM, not RX RAM
-                  // \todo send out again on other port in case of double line
-                  (VOID)memcpy
-                      (
-                        (UCHAR *)prSiceInstance->prTX_Ram +
-                          prSiceInstance->prReg->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_PORT_WR_TX] +
-                          usLastBufOffset,
-                        &puSercosFrame->rTel.aucData[usLastFrameOffset],
-                        usLen
-                      );
-
-                  if (SICE_RX_DESC_DATA_DELAY(ucDescType))
-                  {
-                    // \todo set data field delay accordingly
-                    // Currently not needed, as only single line supported
-                  }
-                }
-                // Real-time CC data
-                else if (SICE_RX_DESC_RTCC_DATA(ucDescType))
-                {
-                  // Written to TX RAM with buffer base pointer of port specific buffer,
-                  // but buffer offset of RTD
-                  // \todo send out again on other port in case of double line
-                  switch (ucBufSel)
-                  {
-                    case 0:
-                      usBufSysOffset = (USHORT) CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_A;
-                      break;
-                    case 1:
-                      usBufSysOffset = (USHORT) CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_B;
-                      break;
-                    default:
-                      SICE_VERBOSE
-                          (
-                            0,
-                            "Error in RX descriptor: Selected buffer "
-                            "system %d is not supported.",
-                            usBufSysOffset
-                          );
-
-                      return(SICE_RX_DESCRIPTOR_ERROR);
-                      /*lint -save -e527 */
-                      break;
-                      /*lint -restore */
-                  }
-
-                  (VOID)memcpy
-                      (
-                        (UCHAR *)prSiceInstance->prRX_Ram +
-                          prSiceInstance->prReg->aulRxBufBasePtr[usBufSysOffset] +
-                          usLastBufOffset,
-                        &puSercosFrame->rTel.aucData[usLastFrameOffset],
-                        usLen
-                      );
-
-                  (VOID)memcpy
-                      (
-                        (UCHAR *)prSiceInstance->prTX_Ram +
-                          prSiceInstance->prReg->aulTxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_PORT_WR_TX] +
-                          usLastBufOffset,
-                        &puSercosFrame->rTel.aucData[usLastFrameOffset],
-                        usLen
-                      );
-
-                  if (SICE_RX_DESC_DATA_DELAY(ucDescType))
-                  {
-                    // \todo set data field delay accordingly
-                    // Currently not needed, as only single line supported
-                  }
-                }
-                else if (!SICE_RX_DESC_FRAME_END(ucDescType))
-                {
-                  SICE_VERBOSE
-                      (
-                        0,
-                        "Error: Unknown RX descriptor type\n"
-                      );
-                  return(SICE_RX_DESCRIPTOR_ERROR);
-                }
-              }
-
-              // Packet done
-              if (SICE_RX_DESC_FRAME_END(ucDescType))
-              {
-                /*
-                TODO
-                set only if rxbuftr & tgsr == rxbuftr (+ masken),
-                i.e. all configured telegrams were received
-                */
-                // Signal new data flag
-                if (iPort == 0)
-                {
-                  prSiceInstance->prReg->ulRXBUFCSR_A |=
-                      (ULONG) CSMD_HAL_RXBUFCSR_NEW_DATA_P1;
-                }
-                else
-                {
-                  prSiceInstance->prReg->ulRXBUFCSR_A |=
-                      (ULONG) CSMD_HAL_RXBUFCSR_NEW_DATA_P2;
-                }
-                SICE_VERBOSE(2, "Packet copied to RX RAM\n");
-              }
-            } while (!SICE_RX_DESC_FRAME_END(ucDescType));
+              return(eSiceRet);
+            }
           }// if AT frame
         }
         else
         {
-          SICE_VERBOSE(0, "Warning: Received Sercos packet with broken CRC\n");
-
-          // Increase error counter
-          (VOID)SICE_IncPacketCounter
-              (
-                prSiceInstance,     // SICE instance
-                SICE_RX_PACKET_CNT, // RX
-                FALSE,              // Packet is erroneus
-                iPort,              // Port number
-                1                   // Single packet
-              );
-
+          // Reported once per port below
+          iRxCrcErr++;
         } // check frame CRC
       } // if received frame is Sercos packet
 
       // Receive following frame (non-blocking)
+#ifdef SICE_WIRE_THREAD
+      iRet = SICE_WireRxPacket
+          (
+            prSiceInstance,               // SICE instance
+            iPort,                        // Port index
+            &pucPacketBuf                 // pointer to frame in receive image
+          );
+#else
       iRet = RTOS_RxPacket
           (
             prSiceInstance->iInstanceNo,  // SICE instance
@@ -831,6 +544,7 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
             rReceiveFrame.aucData,        // provided data buffer
             &pucPacketBuf                 // pointer to foreign data buffer
           );
+#endif
 
       if (iRet < 0)
       {
@@ -844,6 +558,48 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
         return(SICE_SOCKET_ERROR);
       }
     } // While (iRet > 0)
+
+    if (iPort == SICE_ETH_PORT_P)
+    {
+      prSiceInstance->ulTGSR1 |= ulTGSR;
+    }
+    else
+    {
+      prSiceInstance->ulTGSR2 |= ulTGSR;
+    }
+
+    if (iRxOk > 0)
+    {
+      (VOID)SICE_IncPacketCounter
+          (
+            prSiceInstance,     // SICE instance
+            SICE_RX_PACKET_CNT, // RX
+            TRUE,               // Packets are OK
+            iPort,              // Port number
+            iRxOk               // Number of packets
+          );
+    }
+
+    if (iRxCrcErr > 0)
+    {
+      SICE_VERBOSE
+          (
+            0,
+            "Warning: Received %d Sercos packet(s) with broken CRC on port %d\n",
+            iRxCrcErr,
+            iPort
+          );
+
+      // Increase error counter
+      (VOID)SICE_IncPacketCounter
+          (
+            prSiceInstance,     // SICE instance
+            SICE_RX_PACKET_CNT, // RX
+            FALSE,              // Packets are erroneous
+            iPort,              // Port number
+            iRxCrcErr           // Number of packets
+          );
+    }
   } // For all ports
 
   prSiceInstance->prReg->ulTGSR1 = prSiceInstance->ulTGSR1;
@@ -852,6 +608,78 @@ SICE_FUNC_RET SICE_ReceiveTelegrams
   return(SICE_NO_ERROR);
 }
 
+#ifdef SICE_RX_BUSY_POLL
+/**
+ * \fn SICE_FUNC_RET SICE_ReceiveTelegramsBusyPoll(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ *
+ * \brief   This function receives Sercos telegrams right after transmission
+ *          until all enabled ATs of the cycle have been received on any port
+ *          or the deadline has passed.
+ *
+ * \return  See SICE_ReceiveTelegrams()
+ *
+ * \details The deadline is the larger ring delay of both ports plus
+ *          SICE_RX_BUSY_POLL_MARGIN after prSiceInstance->ullTxDoneNs. At
+ *          least one reception attempt is made.
+ *
+ * \ingroup SICE
+ */
+SICE_FUNC_RET SICE_ReceiveTelegramsBusyPoll
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    )
+{
+  SICE_FUNC_RET eSiceFuncRet;
+  ULONG         ulExpected    = 0;
+  ULONG         ulRingDelay;
+  ULONGLONG     ullDeadlineNs;
+  USHORT        usCnt;
+
+  // Enabled ATs of port P, the TGSR bits are in the same order
+  for (
+      usCnt = 0;
+      usCnt < (USHORT) CSMD_MAX_TEL;
+      usCnt++
+    )
+  {
+    if (prSiceInstance->aprSendFrame[CSMD_MAX_TEL + usCnt]->boEnable)
+    {
+      ulExpected |= ((ULONG) CSMD_HAL_TGSR_AT0) << usCnt;
+    }
+  }
+
+  ulRingDelay = (prSiceInstance->prReg->ulRDLY1 > prSiceInstance->prReg->ulRDLY2) ?
+      prSiceInstance->prReg->ulRDLY1 : prSiceInstance->prReg->ulRDLY2;
+
+  ullDeadlineNs = prSiceInstance->ullTxDoneNs +
+      (ULONGLONG) ulRingDelay + (ULONGLONG) SICE_RX_BUSY_POLL_MARGIN;
+
+  do
+  {
+    eSiceFuncRet = SICE_ReceiveTelegrams(prSiceInstance);
+
+    if (eSiceFuncRet != SICE_NO_ERROR)
+    {
+      return(eSiceFuncRet);
+    }
+
+    if (((prSiceInstance->ulTGSR1 | prSiceInstance->ulTGSR2) & ulExpected) == ulExpected)
+    {
+      break;
+    }
+  } while (SICE_GetTimeNs() < ullDeadlineNs);
+
+  return(SICE_NO_ERROR);
+}
+#endif
+
 /**
  * \fn SICE_FUNC_RET SICE_CheckPreCondsReceive(
  *              SICE_INSTANCE_STRUCT *prSiceInstance
@@ -998,3 +826,457 @@ INT SICE_CalcNoOfSlaves
   return(iNumSlaves);
 }
 
+/**
+ * \fn SICE_FUNC_RET SICE_CompileRxPlan(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              ULONG ulPacketMask
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[in]       ulPacketMask    Packets to be compiled, bit per
+ *                                  CSMD_DES_IDX_*
+ *
+ * \brief   This function compiles the RX descriptors of the given packets to
+ *          a list of copy segments from the received frame to the RX RAM or
+ *          other buffers, for each receive port.
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:            No error
+ *          - SICE_RX_DESCRIPTOR_ERROR: Problem with RX descriptors has
+ *                                      occurred, such as the signaling of an
+ *                                      unsupported buffering mechanism
+ *
+ * \ingroup SICE
+ */
+SICE_FUNC_RET SICE_CompileRxPlan
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      ULONG ulPacketMask
+    )
+{
+  SICE_DESC_PLAN_STRUCT*  prPlan              = &prSiceInstance->rRxPlan;
+  SICE_DESC_PKT_STRUCT*   prPkt;
+  UCHAR*                  apucDst[SICE_REDUNDANCY_VAL];
+  UCHAR*                  pucDst2;
+  UCHAR*                  pucRxRam            = (UCHAR *)prSiceInstance->prRX_Ram;
+  UCHAR*                  pucTxRam            = (UCHAR *)prSiceInstance->prTX_Ram;
+  USHORT                  usPacketIdx;
+  USHORT                  usDescIdx;
+  ULONG                   ulCurDesc;
+  USHORT                  usFrameOffset;
+  UCHAR                   ucDescType;
+  USHORT                  usBufOffset;
+  UCHAR                   ucBufSel;
+  USHORT                  usLastFrameOffset   = 0;
+  USHORT                  usLastBufOffset     = 0;
+  USHORT                  usLen;
+  BOOL                    boBufSysA;
+
+  SICE_VERBOSE(2, "SICE_CompileRxPlan()\n");
+
+  SICE_DescPlanStart(prSiceInstance, prPlan);
+
+  for (
+      usPacketIdx = 0;
+      usPacketIdx < 2*CSMD_MAX_TEL;
+      usPacketIdx++
+    )
+  {
+    if ((ulPacketMask & (((ULONG) 1) << usPacketIdx)) == (ULONG) 0)
+    {
+      continue;
+    }
+
+    // Descriptor enable bit, currently ignored
+    // (the same in current Sercos master 'hard' ip core)
+    if  (
+        !SICE_DescPlanFetch
+        (
+          prPlan,
+          pucRxRam,
+          prSiceInstance->prReg->rDECR.rDesIdx.usOffsetRxRam,
+          usPacketIdx,
+          FALSE
+        )
+      )
+    {
+      return(SICE_RX_DESCRIPTOR_ERROR);
+    }
+
+    prPkt = &prPlan->arPkt[usPacketIdx];
+
+    for (
+        usDescIdx = prPkt->usFirstDesc;
+        usDescIdx < prPkt->usFirstDesc + prPkt->usNumDesc;
+        usDescIdx++
+      )
+    {
+      ulCurDesc = prPlan->aulDesc[usDescIdx];
+
+      usFrameOffset = (USHORT) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_TEL_OFFS))
+                >> CSMD_HAL_DES_SHIFT_TEL_OFFS);
+      ucDescType    = (UCHAR) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_TYPE))
+                >> CSMD_HAL_DES_SHIFT_TYPE);
+      usBufOffset   = (USHORT) (ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_BUFF_OFFS));
+      ucBufSel      = (UCHAR) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_BUFF_SYS_SEL))
+                >> CSMD_HAL_DES_SHIFT_BUFF_SYS_SEL);
+
+      // Is it first descriptor of descriptor pair?
+      if (SICE_RX_DESC_START_DESC(ucDescType))
+      {
+        // Store start offsets for frame and buffer
+        usLastFrameOffset = usFrameOffset;
+        usLastBufOffset   = usBufOffset;
+        continue;
+      }
+
+      // End of descriptor list
+      if (SICE_RX_DESC_FRAME_END(ucDescType))
+      {
+        continue;
+      }
+
+      // Calculate length of data to be copied
+      usLen = (usFrameOffset - usLastFrameOffset) +
+          ((USHORT) sizeof(USHORT));     // USHORT alignment
+
+      pucDst2   = NULL;
+      boBufSysA = FALSE;
+
+      // Real-time data
+      if (SICE_RX_DESC_RT_DATA(ucDescType))
+      {
+        switch (ucBufSel)
+        {
+          case 0:
+            apucDst[0] = pucRxRam +
+                prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_A] +
+                usLastBufOffset;
+            boBufSysA  = TRUE;
+
+            if (SICE_REDUNDANCY_BOOL)
+            {
+              apucDst[SICE_REDUNDANCY_VAL - 1] = pucRxRam +
+                  prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P2_BUFF_0_SYS_A] +
+                  usLastBufOffset;
+            }
+            break;
+          case 1:
+            apucDst[0] = pucRxRam +
+                prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_B] +
+                usLastBufOffset;
+
+            if (SICE_REDUNDANCY_BOOL)
+            {
+              apucDst[SICE_REDUNDANCY_VAL - 1] = pucRxRam +
+                  prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P2_BUFF_0_SYS_B] +
+                  usLastBufOffset;
+            }
+            break;
+          default:
+            SICE_VERBOSE
+                (
+                  0,
+                  "Error in RX descriptor: Selected buffer "
+                  "system %c is not supported.",
+                  ucBufSel
+                );
+
+            return(SICE_RX_DESCRIPTOR_ERROR);
+            /*lint -save -e527 */
+            break;
+            /*lint -restore */
+        }
+      }
+      // SVC data
+      else if (SICE_RX_DESC_SVC_DATA(ucDescType))
+      {
+        apucDst[0] = pucRxRam +
+            prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_SVC] +
+            usLastBufOffset;
+
+        if (SICE_REDUNDANCY_BOOL)
+        {
+          apucDst[SICE_REDUNDANCY_VAL - 1] = pucRxRam +
+              prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P2_BUFF_SVC] +
+              usLastBufOffset;
+        }
+      }
+      // Port-specific CC data
+      else if (SICE_RX_DESC_PORTCC_DATA(ucDescType))
+      {
+        // Written to TX RAM, not RX RAM
+        // \todo send out again on other port in case of double line
+        // \todo set data field delay accordingly
+        apucDst[0] = pucTxRam +
+            prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_PORT_WR_TX] +
+            usLastBufOffset;
+
+        if (SICE_REDUNDANCY_BOOL)
+        {
+          apucDst[SICE_REDUNDANCY_VAL - 1] = apucDst[0];
+        }
+      }
+      // Real-time CC data
+      else if (SICE_RX_DESC_RTCC_DATA(ucDescType))
+      {
+        // Written to RX RAM like RTD and to TX RAM with buffer base pointer
+        // of port specific buffer, but buffer offset of RTD
+        // \todo send out again on other port in case of double line
+        // \todo set data field delay accordingly
+        switch (ucBufSel)
+        {
+          case 0:
+            apucDst[0] = pucRxRam +
+                prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_A] +
+                usLastBufOffset;
+            boBufSysA  = TRUE;
+
+            if (SICE_REDUNDANCY_BOOL)
+            {
+              apucDst[SICE_REDUNDANCY_VAL - 1] = pucRxRam +
+                  prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P2_BUFF_0_SYS_A] +
+                  usLastBufOffset;
+            }
+            break;
+          case 1:
+            apucDst[0] = pucRxRam +
+                prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_B] +
+                usLastBufOffset;
+
+            if (SICE_REDUNDANCY_BOOL)
+            {
+              apucDst[SICE_REDUNDANCY_VAL - 1] = pucRxRam +
+                  prPlan->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P2_BUFF_0_SYS_B] +
+                  usLastBufOffset;
+            }
+            break;
+          default:
+            SICE_VERBOSE
+                (
+                  0,
+                  "Error in RX descriptor: Selected buffer "
+                  "system %c is not supported.",
+                  ucBufSel
+                );
+
+            return(SICE_RX_DESCRIPTOR_ERROR);
+            /*lint -save -e527 */
+            break;
+            /*lint -restore */
+        }
+
+        pucDst2 = pucTxRam +
+            prPlan->aulTxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_PORT_WR_TX] +
+            usLastBufOffset;
+      }
+      else
+      {
+        SICE_VERBOSE
+            (
+              0,
+              "Error: Unknown RX descriptor type\n"
+            );
+        return(SICE_RX_DESCRIPTOR_ERROR);
+      }
+
+      if  (
+          !SICE_DescPlanAddSeg
+          (
+            prPlan,
+            usPacketIdx,
+            apucDst,
+            pucDst2,
+            usLastFrameOffset,
+            usLen,
+            boBufSysA
+          )
+        )
+      {
+        return(SICE_RX_DESCRIPTOR_ERROR);
+      }
+    }
+
+    SICE_VERBOSE
+        (
+          2,
+          "RX packet #%hu: %hu descriptors compiled to %hu segments\n",
+          usPacketIdx,
+          prPkt->usNumDesc,
+          prPkt->usNumSeg
+        );
+  }
+
+  prPlan->ulPacketMask  = ulPacketMask;
+  prPlan->boValid       = TRUE;
+
+  return(SICE_NO_ERROR);
+}
+
+/**
+ * \fn SICE_FUNC_RET SICE_CopyRxData(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              SICE_SIII_FRAME *puSercosFrame,
+ *              INT iPort,
+ *              UCHAR ucPacketNoIndex
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[in]       puSercosFrame   Received Sercos frame
+ * \param[in]       iPort           Receive port index
+ * \param[in]       ucPacketNoIndex Packet type CSMD_DES_IDX_*
+ *
+ * \brief   This function copies the data of a received AT to the RX RAM or
+ *          other buffers according to the RX descriptors and signals new data
+ *          and the active buffer of buffer system A in the RXBUFCSR register.
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:            No error
+ *          - SICE_RX_DESCRIPTOR_ERROR: Problem with RX descriptors has
+ *                                      occurred
+ *
+ * \details The RX descriptors are only decoded again by SICE_CompileRxPlan()
+ *          when they have been changed or the packet type has not been
+ *          received before.
+ *
+ * \ingroup SICE
+ */
+SICE_FUNC_RET SICE_CopyRxData
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      SICE_SIII_FRAME *puSercosFrame,
+      INT iPort,
+      UCHAR ucPacketNoIndex
+    )
+{
+  SICE_DESC_PLAN_STRUCT*  prPlan        = &prSiceInstance->rRxPlan;
+  SICE_DESC_PKT_STRUCT*   prPkt;
+  SICE_DESC_SEG_STRUCT*   prSeg;
+  ULONG                   ulPacketMask  = ((ULONG) 1) << ucPacketNoIndex;
+  USHORT                  usSegIdx;
+  USHORT                  usBufSysOffset;
+  LONG                    lBufSysAOffset;
+  UCHAR*                  pucDst;
+  SICE_FUNC_RET           eSiceRet;
+
+  SICE_VERBOSE(3, "SICE_CopyRxData()\n");
+
+  // Compile RX descriptors again in case CoSeMa has changed them
+  if  (
+      !SICE_DescPlanIsValid
+      (
+        prSiceInstance,
+        prPlan,
+        (UCHAR *)prSiceInstance->prRX_Ram,
+        prSiceInstance->prReg->rDECR.rDesIdx.usOffsetRxRam,
+        ulPacketMask
+      )
+    )
+  {
+    // Keep packets compiled before
+    if (prPlan->boValid)
+    {
+      ulPacketMask |= prPlan->ulPacketMask;
+    }
+
+    eSiceRet = SICE_CompileRxPlan
+        (
+          prSiceInstance,
+          ulPacketMask
+        );
+
+    if (eSiceRet != SICE_NO_ERROR)
+    {
+      return(eSiceRet);
+    }
+  }
+
+  prPkt = &prPlan->arPkt[ucPacketNoIndex];
+
+  // Segments of buffer system A are compiled for buffer 0, move them to
+  // the buffer being written in case of double or triple buffering
+  if (iPort == 0)
+  {
+    usBufSysOffset = (USHORT) CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_A;
+  }
+#ifdef SICE_REDUNDANCY
+  else
+  {
+    usBufSysOffset = (USHORT) CSMD_HAL_IDX_RX_P2_BUFF_0_SYS_A;
+  }
+#endif
+
+  lBufSysAOffset =
+      (LONG) prPlan->aulRxBufBasePtr
+          [usBufSysOffset + prSiceInstance->ausRxBufSysA[iPort]] -
+      (LONG) prPlan->aulRxBufBasePtr[usBufSysOffset];
+
+  for (
+      usSegIdx = prPkt->usFirstSeg;
+      usSegIdx < prPkt->usFirstSeg + prPkt->usNumSeg;
+      usSegIdx++
+    )
+  {
+    prSeg   = &prPlan->arSeg[usSegIdx];
+    pucDst  = prSeg->apucBuf[iPort];
+
+    if (prSeg->boBufSysA)
+    {
+      pucDst += lBufSysAOffset;
+    }
+
+    (VOID)memcpy
+        (
+          pucDst,
+          &puSercosFrame->rTel.aucData[prSeg->usFrameOffset],
+          prSeg->usLen
+        );
+
+    if (prSeg->pucBuf2 != NULL)
+    {
+      (VOID)memcpy
+          (
+            prSeg->pucBuf2,
+            &puSercosFrame->rTel.aucData[prSeg->usFrameOffset],
+            prSeg->usLen
+          );
+    }
+  }
+
+  /*
+  TODO
+  set only if rxbuftr & tgsr == rxbuftr (+ masken),
+  i.e. all configured telegrams were received
+  */
+  // Signal new data flag, the buffer being written is usable for CoSeMa
+  // after reception
+  if (iPort == 0)
+  {
+    prSiceInstance->prReg->ulRXBUFCSR_A =
+        (prSiceInstance->prReg->ulRXBUFCSR_A &
+            ~((ULONG) CSMD_HAL_RXBUFCSR_ACT_BUF_P1_MASK)) |
+        ((ULONG) prSiceInstance->ausRxBufSysA[iPort] <<
+            CSMD_HAL_RXBUFCSR_ACT_BUF_P1_SHIFT) |
+        (ULONG) CSMD_HAL_RXBUFCSR_NEW_DATA_P1;
+  }
+#ifdef SICE_REDUNDANCY
+  else
+  {
+    prSiceInstance->prReg->ulRXBUFCSR_A =
+        (prSiceInstance->prReg->ulRXBUFCSR_A &
+            ~((ULONG) CSMD_HAL_RXBUFCSR_ACT_BUF_P2_MASK)) |
+        ((ULONG) prSiceInstance->ausRxBufSysA[iPort] <<
+            CSMD_HAL_RXBUFCSR_ACT_BUF_P2_SHIFT) |
+        (ULONG) CSMD_HAL_RXBUFCSR_NEW_DATA_P2;
+  }
+#endif
+  SICE_VERBOSE(2, "Packet copied to RX RAM\n");
+
+  return(SICE_NO_ERROR);
+}
@@ -47,19 +47,269 @@
 #include "../SICE/SICE_GLOB.h"
 #include "../SICE/SICE_PRIV.h"
 
+#ifdef SICE_CRC32_HW_ACCEL
+  #if defined (__x86_64__) && defined (__GNUC__)
+    #define SICE_CRC32_PCLMUL
+    /*lint -save -w0 */
+    #include <wmmintrin.h>      // for _mm_clmulepi64_si128
+    /*lint -restore */
+  #elif defined (__aarch64__) && defined (__GNUC__) && defined (__linux__)
+    #define SICE_CRC32_ARMV8
+    /*lint -save -w0 */
+    #include <arm_acle.h>       // for __crc32d etc.
+    #include <sys/auxv.h>       // for getauxval(), HWCAP_CRC32
+    /*lint -restore */
+  #endif
+#endif
+
 //---- defines ----------------------------------------------------------------
 
 //---- type definitions -------------------------------------------------------
 
+/** Function type of CRC32 calculation engine, working on the non-inverted
+ *  CRC register */
+typedef ULONG (*SICE_CRC32_ENGINE)
+    (
+      const UCHAR *pucBuffer,
+      INT iSize,
+      ULONG ulCRC
+    );
+
 //---- variable declarations --------------------------------------------------
 
-/** Array for pre-calculated CRC32 table */
-static ULONG    aulCRC32Table[SICE_CRC_TABLE_SIZE];
+/** Array for pre-calculated CRC32 tables for slice-by-8 calculation */
+static ULONG    aaulCRC32Table[SICE_CRC_TABLE_SLICES][SICE_CRC_TABLE_SIZE];
 
 //---- function declarations --------------------------------------------------
 
+static ULONG SICE_CRC32Slice8
+    (
+      const UCHAR *pucBuffer,
+      INT iSize,
+      ULONG ulCRC
+    );
+
+/** CRC32 calculation engine selected by SICE_CRC32BuildTable() */
+static SICE_CRC32_ENGINE pfCRC32Engine = SICE_CRC32Slice8;
+
 //---- function implementations -----------------------------------------------
 
+/**
+ * \fn static ULONG SICE_CRC32Slice8(
+ *              const UCHAR *pucBuffer,
+ *              INT iSize,
+ *              ULONG ulCRC
+ *          )
+ *
+ * \private
+ *
+ * \brief   Calculates CRC32 using the slice-by-8 tables, processing 8 bytes
+ *          per step. The data is read bytewise, so this works independently
+ *          of alignment and endianness.
+ *
+ * \param[in]   pucBuffer   Buffer for checksum calculation
+ * \param[in]   iSize       Size of buffer
+ * \param[in]   ulCRC       Current (non-inverted) CRC register
+ *
+ * \return  Updated (non-inverted) CRC register
+ *
+ * \ingroup SICE
+ */
+static ULONG SICE_CRC32Slice8
+    (
+      const UCHAR *pucBuffer,
+      INT iSize,
+      ULONG ulCRC
+    )
+{
+  ULONG ulLow;
+  ULONG ulHigh;
+
+  while (iSize >= 8)
+  {
+    ulLow  = ulCRC ^
+        (
+          (((ULONG) pucBuffer[0]) << 0)  |
+          (((ULONG) pucBuffer[1]) << 8)  |
+          (((ULONG) pucBuffer[2]) << 16) |
+          (((ULONG) pucBuffer[3]) << 24)
+        );
+    ulHigh =
+        (
+          (((ULONG) pucBuffer[4]) << 0)  |
+          (((ULONG) pucBuffer[5]) << 8)  |
+          (((ULONG) pucBuffer[6]) << 16) |
+          (((ULONG) pucBuffer[7]) << 24)
+        );
+
+    ulCRC = aaulCRC32Table[7][ ulLow         & (ULONG) 0xFF] ^
+            aaulCRC32Table[6][(ulLow  >> 8)  & (ULONG) 0xFF] ^
+            aaulCRC32Table[5][(ulLow  >> 16) & (ULONG) 0xFF] ^
+            aaulCRC32Table[4][ ulLow  >> 24                ] ^
+            aaulCRC32Table[3][ ulHigh        & (ULONG) 0xFF] ^
+            aaulCRC32Table[2][(ulHigh >> 8)  & (ULONG) 0xFF] ^
+            aaulCRC32Table[1][(ulHigh >> 16) & (ULONG) 0xFF] ^
+            aaulCRC32Table[0][ ulHigh >> 24                ];
+
+    pucBuffer += 8;
+    iSize     -= 8;
+  }
+
+  while (iSize > 0)
+  {
+    ulCRC = (ulCRC >> 8) ^ aaulCRC32Table[0][(ulCRC ^ *pucBuffer) & (ULONG) 0xFF];
+    pucBuffer++;
+    iSize--;
+  }
+
+  return(ulCRC);
+}
+
+#ifdef SICE_CRC32_PCLMUL
+/**
+ * \fn static ULONG SICE_CRC32Pclmul(
+ *              const UCHAR *pucBuffer,
+ *              INT iSize,
+ *              ULONG ulCRC
+ *          )
+ *
+ * \private
+ *
+ * \brief   Calculates CRC32 by folding 16-byte blocks with carry-less
+ *          multiplication (PCLMULQDQ), followed by a Barrett reduction to
+ *          32 bits. Remaining bytes are processed by SICE_CRC32Slice8().
+ *
+ * \param[in]   pucBuffer   Buffer for checksum calculation
+ * \param[in]   iSize       Size of buffer
+ * \param[in]   ulCRC       Current (non-inverted) CRC register
+ *
+ * \return  Updated (non-inverted) CRC register
+ *
+ * \ingroup SICE
+ */
+__attribute__((target("pclmul,sse2")))
+static ULONG SICE_CRC32Pclmul
+    (
+      const UCHAR *pucBuffer,
+      INT iSize,
+      ULONG ulCRC
+    )
+{
+  // Folding constants x^(128+32) mod P, x^(128-32) mod P and x^64 mod P as
+  // well as Barrett constants for reflected polynomial SICE_CRC_POLY
+  const __m128i rK3K4  = _mm_set_epi64x(0x00CCAA009ELL, 0x01751997D0LL);
+  const __m128i rK5K0  = _mm_set_epi64x(0x0000000000LL, 0x0163CD6124LL);
+  const __m128i rPoly  = _mm_set_epi64x(0x01F7011641LL, 0x01DB710641LL);
+  const __m128i rMask  = _mm_setr_epi32(~0, 0, ~0, 0);
+  __m128i       rAcc;
+  __m128i       rTmp1;
+  __m128i       rTmp2;
+
+  if (iSize < 16)
+  {
+    return(SICE_CRC32Slice8(pucBuffer, iSize, ulCRC));
+  }
+
+  rAcc = _mm_xor_si128
+      (
+        _mm_loadu_si128((const __m128i*) pucBuffer),
+        _mm_cvtsi32_si128((INT) ulCRC)
+      );
+  pucBuffer += 16;
+  iSize     -= 16;
+
+  // Fold 16-byte blocks
+  while (iSize >= 16)
+  {
+    rTmp1 = _mm_clmulepi64_si128(rAcc, rK3K4, 0x00);
+    rAcc  = _mm_clmulepi64_si128(rAcc, rK3K4, 0x11);
+    rAcc  = _mm_xor_si128(rAcc, _mm_loadu_si128((const __m128i*) pucBuffer));
+    rAcc  = _mm_xor_si128(rAcc, rTmp1);
+    pucBuffer += 16;
+    iSize     -= 16;
+  }
+
+  // Fold 128 bits to 64 bits
+  rTmp1 = _mm_clmulepi64_si128(rAcc, rK3K4, 0x10);
+  rAcc  = _mm_xor_si128(_mm_srli_si128(rAcc, 8), rTmp1);
+  rTmp1 = _mm_srli_si128(rAcc, 4);
+  rAcc  = _mm_clmulepi64_si128(_mm_and_si128(rAcc, rMask), rK5K0, 0x00);
+  rAcc  = _mm_xor_si128(rAcc, rTmp1);
+
+  // Barrett reduction to 32 bits
+  rTmp2 = _mm_clmulepi64_si128(_mm_and_si128(rAcc, rMask), rPoly, 0x10);
+  rTmp2 = _mm_clmulepi64_si128(_mm_and_si128(rTmp2, rMask), rPoly, 0x00);
+  rAcc  = _mm_xor_si128(rAcc, rTmp2);
+
+  ulCRC = (ULONG) _mm_cvtsi128_si32(_mm_srli_si128(rAcc, 4));
+
+  return(SICE_CRC32Slice8(pucBuffer, iSize, ulCRC));
+}
+#endif
+
+#ifdef SICE_CRC32_ARMV8
+/**
+ * \fn static ULONG SICE_CRC32Armv8(
+ *              const UCHAR *pucBuffer,
+ *              INT iSize,
+ *              ULONG ulCRC
+ *          )
+ *
+ * \private
+ *
+ * \brief   Calculates CRC32 using the ARMv8 CRC32 instructions, which
+ *          implement the reflected polynomial SICE_CRC_POLY.
+ *
+ * \param[in]   pucBuffer   Buffer for checksum calculation
+ * \param[in]   iSize       Size of buffer
+ * \param[in]   ulCRC       Current (non-inverted) CRC register
+ *
+ * \return  Updated (non-inverted) CRC register
+ *
+ * \ingroup SICE
+ */
+__attribute__((target("+crc")))
+static ULONG SICE_CRC32Armv8
+    (
+      const UCHAR *pucBuffer,
+      INT iSize,
+      ULONG ulCRC
+    )
+{
+  ULONGLONG ullData;
+  ULONG     ulData;
+  USHORT    usData;
+
+  while (iSize >= 8)
+  {
+    (VOID)memcpy(&ullData, pucBuffer, 8);
+    ulCRC = __crc32d(ulCRC, ullData);
+    pucBuffer += 8;
+    iSize     -= 8;
+  }
+  if (iSize >= 4)
+  {
+    (VOID)memcpy(&ulData, pucBuffer, 4);
+    ulCRC = __crc32w(ulCRC, ulData);
+    pucBuffer += 4;
+    iSize     -= 4;
+  }
+  if (iSize >= 2)
+  {
+    (VOID)memcpy(&usData, pucBuffer, 2);
+    ulCRC = __crc32h(ulCRC, usData);
+    pucBuffer += 2;
+    iSize     -= 2;
+  }
+  if (iSize > 0)
+  {
+    ulCRC = __crc32b(ulCRC, *pucBuffer);
+  }
+
+  return(ulCRC);
+}
+#endif
+
 /**
  * \fn SICE_FUNC_RET SICE_CRC32BuildTable(
  *              VOID
@@ -67,7 +317,9 @@ static ULONG    aulCRC32Table[SICE_CRC_TABLE_SIZE];
  *
  * \private
  *
- * \brief   Builds table for CRC32 checksum calculation.
+ * \brief   Builds tables for CRC32 checksum calculation and selects the
+ *          calculation engine depending on the CPU features available at
+ *          runtime (see SICE_CRC32_HW_ACCEL).
  *
  * \return  Always SICE_NO_ERROR
  *
@@ -87,7 +339,6 @@ SICE_FUNC_RET SICE_CRC32BuildTable
 {
   INT   i,j;
   ULONG ulCRC;
-  ULONG ulTemp;
 
   SICE_VERBOSE(3, "SICE_CRC32BuildTable()\n");
 
@@ -104,19 +355,55 @@ SICE_FUNC_RET SICE_CRC32BuildTable
         j--
       )
     {
-      ulTemp = ulCRC / ((ULONG) 2);
-
       if (ulCRC & ((ULONG) 1))
       {
-        ulCRC = ulTemp ^ ((ULONG)SICE_CRC_POLY);
+        ulCRC = (ulCRC >> 1) ^ ((ULONG)SICE_CRC_POLY);
       }
       else
       {
-        ulCRC = ulTemp;
+        ulCRC = ulCRC >> 1;
       }
     }
-    aulCRC32Table[i] = ulCRC;
+    aaulCRC32Table[0][i] = ulCRC;
+  }
+
+  // Table k holds the CRC of byte i followed by k zero bytes
+  for (
+      j = 1;
+      j < SICE_CRC_TABLE_SLICES;
+      j++
+    )
+  {
+    for (
+        i = 0;
+        i <= SICE_CRC_TABLE_SIZE - 1;
+        i++
+      )
+    {
+      ulCRC = aaulCRC32Table[j - 1][i];
+      aaulCRC32Table[j][i] =
+          (ulCRC >> 8) ^ aaulCRC32Table[0][ulCRC & (ULONG) 0xFF];
+    }
   }
+
+  pfCRC32Engine = SICE_CRC32Slice8;
+
+#ifdef SICE_CRC32_PCLMUL
+  if (__builtin_cpu_supports("pclmul"))
+  {
+    pfCRC32Engine = SICE_CRC32Pclmul;
+    SICE_VERBOSE(1, "Using PCLMULQDQ for CRC32 calculation\n");
+  }
+#endif
+
+#ifdef SICE_CRC32_ARMV8
+  if (getauxval(AT_HWCAP) & HWCAP_CRC32)
+  {
+    pfCRC32Engine = SICE_CRC32Armv8;
+    SICE_VERBOSE(1, "Using ARMv8 CRC32 instructions for CRC32 calculation\n");
+  }
+#endif
+
   return(SICE_NO_ERROR);
 }
 
@@ -133,7 +420,9 @@ SICE_FUNC_RET SICE_CRC32BuildTable
  *
  * \param[in]   pucBuffer   Buffer for checksum calculation
  * \param[in]   iSize       Size of buffer
- * \param[in]   ulStartCRC  CRC calculation initialization value
+ * \param[in]   ulStartCRC  CRC calculation initialization value. The CRC
+ *                          of a preceding buffer may be passed to continue
+ *                          the calculation.
  *
  * \return  Calculated CRC
  *
@@ -153,27 +442,17 @@ ULONG SICE_CRC32Calc
       ULONG ulStartCRC
     )
 {
-  INT   i;
-  ULONG ulCRC;
-  ULONG ulTemp1;
-  ULONG ulTemp2;
-
   SICE_VERBOSE(3, "SICE_CRC32Calc()\n");
 
-  ulCRC = ulStartCRC ^ (ULONG) 0xFFFFFFFF;
-  for (
-      i = 0;
-      i < iSize;
-      i++
-    )
-  {
-    ulTemp1 = (ulCRC / (ULONG) 256) & (ULONG) 0xFFFFFF;
-    ulTemp2 = (ULONG)pucBuffer[i];
-    ulTemp2 = aulCRC32Table[(ulCRC ^ ulTemp2) & (ULONG) 0xFF];
-    ulCRC   = ulTemp1 ^ ulTemp2;
-  }
-  ulCRC = ulCRC ^ (ULONG)0xFFFFFFFF;
-  return(ulCRC);
+  return
+      (
+        pfCRC32Engine
+            (
+              pucBuffer,
+              iSize,
+              ulStartCRC ^ (ULONG) 0xFFFFFFFF
+            ) ^ (ULONG) 0xFFFFFFFF
+      );
 }
 
 /**
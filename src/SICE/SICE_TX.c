@@ -186,7 +186,9 @@
  * \details The tx descriptors are interpreted. Depending on the descriptors,
  *          the telegrams to be sent are built from the different buffers with
  *          the corresponding offsets. The telegram data is stored in the array
- *          aprSendFrame of the SICE instance to be send out later.
+ *          aprSendFrame of the SICE instance to be send out later. The
+ *          descriptors are only decoded again by SICE_CompileTxPlan() when
+ *          they have been changed.
  *
  * \author  GMy, partially based on earlier work by SBe
  *
@@ -211,22 +213,23 @@ SICE_FUNC_RET SICE_PrepareTelegrams
       SICE_INSTANCE_STRUCT *prSiceInstance
     )
 {
-  UCHAR               ucPhaseAll;
-  SICE_SIII_FRAME*    puSercosFrameP1         = NULL;
-  SICE_SIII_FRAME*    puSercosFrameP2         = NULL;
-  USHORT              usPacketIdx;
-  USHORT              usIndexTableOffset;
-  ULONG               ulTXDescTableOffset     = 0;
-  BOOL                boTXDescTableEnabled    = FALSE;
-  USHORT              usCurDescOffset         = 0;
-  ULONG               ulCurDesc               = 0;
-  USHORT              usFrameOffset           = 0;
-  UCHAR               ucDescType              = 0;
-  USHORT              usBufOffset             = 0;
-  UCHAR               ucBufSel                = 0;
-  USHORT              usLastFrameOffset       = 0;
-  USHORT              usLastBufOffset         = 0;
-  SICE_FUNC_RET       eSiceRet                = SICE_NO_ERROR;
+  UCHAR                 ucPhaseAll;
+  SICE_SIII_FRAME*      puSercosFrameP1         = NULL;
+  SICE_SIII_FRAME*      puSercosFrameP2         = NULL;
+  SICE_DESC_PKT_STRUCT* prPkt;
+  SICE_DESC_SEG_STRUCT* prSeg;
+  USHORT                usPacketIdx;
+  USHORT                usSegIdx;
+  USHORT                usGapIdx;
+  ULONG                 ulPacketMask            = 0;
+  LONG                  lBufSysAOffset;
+  LONG                  lSegOffset;
+  SICE_FUNC_RET         eSiceRet                = SICE_NO_ERROR;
+#ifdef SICE_TX_INCREMENTAL
+  SICE_TX_INCR_STRUCT*  prIncr;
+  ULONG                 ulPhase;
+  BOOL                  boCopyAll;
+#endif
 
   SICE_VERBOSE(3, "SICE_PrepareTelegrams()\n");
 
@@ -237,17 +240,13 @@ SICE_FUNC_RET SICE_PrepareTelegrams
 
   ucPhaseAll = (UCHAR)(prSiceInstance->prReg->ulPHASECR & ((ULONG)SICE_PHASECR_ALL_MASK));
 
-  // TX index table offset
-  usIndexTableOffset = prSiceInstance->prReg->rDECR.rDesIdx.usOffsetTxRam;
-
-  // For all Sercos telegrams MDT0, MDT1, ... , AT3 ...
+  // Collect packets enabled in SFCR register
   for (
       usPacketIdx = 0;
       usPacketIdx < 2*CSMD_MAX_TEL;
       usPacketIdx++
     )
   {
-    // Check SFCR register for packet enable bit
     if  (
         SICE_CheckPacketSfcrTxEnabled
         (
@@ -255,6 +254,87 @@ SICE_FUNC_RET SICE_PrepareTelegrams
           usPacketIdx
         )
       )
+    {
+      ulPacketMask |= ((ULONG) 1) << usPacketIdx;
+    }
+  }
+
+  // Compile TX descriptors again in case CoSeMa has changed them
+  if  (
+      !SICE_DescPlanIsValid
+      (
+        prSiceInstance,
+        &prSiceInstance->rTxPlan,
+        (UCHAR *)prSiceInstance->prTX_Ram,
+        prSiceInstance->prReg->rDECR.rDesIdx.usOffsetTxRam,
+        ulPacketMask
+      )
+    )
+  {
+    eSiceRet = SICE_CompileTxPlan
+        (
+          prSiceInstance,
+          ulPacketMask
+        );
+
+    if (eSiceRet != SICE_NO_ERROR)
+    {
+      return(eSiceRet);
+    }
+
+#ifdef SICE_TX_INCREMENTAL
+    prSiceInstance->rTxIncr.boCopyAll = TRUE;
+#endif
+  }
+
+  // Segments of buffer system A are compiled for buffer 0, move them to
+  // the buffer being transmitted in case of double or triple buffering
+  lBufSysAOffset =
+      (LONG) prSiceInstance->rTxPlan.aulTxBufBasePtr
+          [CSMD_HAL_IDX_TX_BUFF_0_SYS_A + prSiceInstance->usTxBufSysA] -
+      (LONG) prSiceInstance->rTxPlan.aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_0_SYS_A];
+
+#ifdef SICE_TX_INCREMENTAL
+  // The frames still hold the data of the previous cycle. Changes of the
+  // connection data are tracked by CoSeMa in CP4 only.
+  prIncr  = &prSiceInstance->rTxIncr;
+  ulPhase = prSiceInstance->prReg->ulPHASECR &
+      (CSMD_HAL_PHASECR_PHASE_MASK | (1UL << CSMD_HAL_PHASECR_PS));
+
+  boCopyAll =
+      prIncr->boCopyAll                                               ||
+      (ulPhase != (((ULONG) CSMD_SERC_PHASE_4) << CSMD_HAL_PHASECR_PHASE_SHIFT)) ||
+      (ulPhase != prIncr->ulPhase)                                    ||
+      (ulPacketMask != prIncr->ulPacketMask)                          ||
+      (lBufSysAOffset != prIncr->lBufSysAOffset)                      ||
+      (prIncr->prTrack->ulConfigCnt != prIncr->ulConfigCnt);
+
+  // Frames are incomplete until the end of this function
+  prIncr->boCopyAll       = TRUE;
+  prIncr->ulPhase         = ulPhase;
+  prIncr->ulPacketMask    = ulPacketMask;
+  prIncr->lBufSysAOffset  = lBufSysAOffset;
+  prIncr->ulConfigCnt     = prIncr->prTrack->ulConfigCnt;
+#endif
+
+#if (defined CSMD_SERCOS_TIME) || (CSMD_DRV_VERSION > 5)
+  // Generate extended field of MDT0 once for all ports
+  SICE_GenExtField
+      (
+        prSiceInstance,
+        ucPhaseAll
+      );
+#endif
+
+  // For all Sercos telegrams MDT0, MDT1, ... , AT3 ...
+  for (
+      usPacketIdx = 0;
+      usPacketIdx < 2*CSMD_MAX_TEL;
+      usPacketIdx++
+    )
+  {
+    // Packet enabled in SFCR register?
+    if ((ulPacketMask & (((ULONG) 1) << usPacketIdx)) != (ULONG) 0)
     {
       SICE_VERBOSE
           (
@@ -263,63 +343,50 @@ SICE_FUNC_RET SICE_PrepareTelegrams
             usPacketIdx
           );
 
-      // Use packet index as an ULONG offset for finding corresponding
-      // TX descriptors
-      /*lint -save -e826 */
-      ulTXDescTableOffset =
-          *((ULONG*)  (
-                  (UCHAR *)prSiceInstance->prTX_Ram +
-                  ((ULONG) usIndexTableOffset) +
-                  ((ULONG) usPacketIdx) * ((ULONG) sizeof(ULONG)))
-                );
-      /*lint -restore */
-
-      boTXDescTableEnabled = ulTXDescTableOffset & ((ULONG) SICE_TEL_DESC_ENABLE_MASK);
-      ulTXDescTableOffset  = ulTXDescTableOffset & ((ULONG) SICE_TEL_DESC_OFFSET_MASK);
+      prPkt = &prSiceInstance->rTxPlan.arPkt[usPacketIdx];
 
       //Is this packet type enabled in descriptor?
-      if (boTXDescTableEnabled)
+      if ((prPkt->ulIndexEntry & ((ULONG) SICE_TEL_DESC_ENABLE_MASK)) != (ULONG) 0)
       {
-        usCurDescOffset   = (USHORT) ulTXDescTableOffset;
-
         prSiceInstance->aprSendFrame[usPacketIdx]->boEnable = TRUE;
 
-        // Pre-fill packet buffer (except for header) with zeros
-        (VOID)memset
-            (
-              prSiceInstance->aprSendFrame[usPacketIdx]->aucData + SICE_SERC3_TEL_HEADER,
-              (UCHAR)0x00,
-              SICE_ETH_FRAMEBUF_LEN - SICE_SERC3_TEL_HEADER
-            );
-
         // Pointer to already allocated frame
         puSercosFrameP1 = (SICE_SIII_FRAME *) prSiceInstance->aprSendFrame[usPacketIdx]->aucData;
 
-        // Set Sercos type field in packet header
-        puSercosFrameP1->rTel.ucSercosType = SICE_SercosTypeField
-            (
-              usPacketIdx,
-              SICE_TEL_P_CHANNEL
-            );
+        // Fill parts of packet not written by descriptors with zeros
+        for (
+            usGapIdx = prPkt->ausFirstGap[0];
+            usGapIdx < prPkt->ausFirstGap[0] + prPkt->ausNumGap[0];
+            usGapIdx++
+          )
+        {
+          (VOID)memset
+              (
+                &puSercosFrameP1->rTel.aucData[prSiceInstance->rTxPlan.arGap[usGapIdx].usFrameOffset],
+                (UCHAR)0x00,
+                prSiceInstance->rTxPlan.arGap[usGapIdx].usLen
+              );
+        }
+
+        // Sercos type field in packet header is set by SICE_CompileTxPlan()
 
         // Set communication phase field in packet header
         puSercosFrameP1->rTel.ucPhase = ucPhaseAll;
 
         // Sercos time (and therefore extended field) activated?
 #if (defined CSMD_SERCOS_TIME) || (CSMD_DRV_VERSION > 5)
-        // Generate extended field in MDT0
-        eSiceRet = SICE_GenExtField
-            (
-              prSiceInstance,       // SICE instance
-              (USHORT*)&(puSercosFrameP1->rTel.aucData[SICE_TEL_EXT_FIELD_OFFSET]),
-                                    // Offset of extended field in packet
-              ucPhaseAll,
-              usPacketIdx
-            );
-
-        if (eSiceRet != SICE_NO_ERROR)
+        // Extended field in MDT0 as generated for this cycle
+        if (
+            prSiceInstance->rSercosTime.boExtField    &&
+            (usPacketIdx == CSMD_DES_IDX_MDT0)
+          )
         {
-          return(SICE_SYSTEM_ERROR);
+          (VOID)memcpy
+              (
+                &puSercosFrameP1->rTel.aucData[SICE_TEL_EXT_FIELD_OFFSET],
+                prSiceInstance->rSercosTime.ausExtField,
+                sizeof(prSiceInstance->rSercosTime.ausExtField)
+              );
         }
 #endif
         // The same for the other port - in case redundancy is enabled
@@ -327,157 +394,174 @@ SICE_FUNC_RET SICE_PrepareTelegrams
         {
           prSiceInstance->aprSendFrame[usPacketIdx + 2*CSMD_MAX_TEL]->boEnable = TRUE;
 
-          (VOID)memset
-              (
-                prSiceInstance->aprSendFrame[usPacketIdx + 2*CSMD_MAX_TEL]->aucData +
-                    SICE_SERC3_TEL_HEADER,
-                (UCHAR)0x00,
-                SICE_ETH_FRAMEBUF_LEN - SICE_SERC3_TEL_HEADER
-              );
-
           // Pointer to already allocated frame
           puSercosFrameP2 = (SICE_SIII_FRAME *)
               prSiceInstance->aprSendFrame[usPacketIdx + 2*CSMD_MAX_TEL]->aucData;
 
-          // Set Sercos type field in packet header
-          puSercosFrameP2->rTel.ucSercosType = SICE_SercosTypeField
-              (
-                usPacketIdx,
-                SICE_TEL_S_CHANNEL
-              );
+#ifndef SICE_TX_SHARED_PAYLOAD
+          for (
+              usGapIdx = prPkt->ausFirstGap[SICE_REDUNDANCY_VAL - 1];
+              usGapIdx < prPkt->ausFirstGap[SICE_REDUNDANCY_VAL - 1] +
+                  prPkt->ausNumGap[SICE_REDUNDANCY_VAL - 1];
+              usGapIdx++
+            )
+          {
+            (VOID)memset
+                (
+                  &puSercosFrameP2->rTel.aucData[prSiceInstance->rTxPlan.arGap[usGapIdx].usFrameOffset],
+                  (UCHAR)0x00,
+                  prSiceInstance->rTxPlan.arGap[usGapIdx].usLen
+                );
+          }
+#endif
 
           // Set communication phase field in packet header
           puSercosFrameP2->rTel.ucPhase = ucPhaseAll;
 
-          // Sercos time (and therefore extended field) activated?
-#if (defined CSMD_SERCOS_TIME) || (CSMD_DRV_VERSION > 5)
-          // Generate extended field in MDT0
-          eSiceRet = SICE_GenExtField
-              (
-                prSiceInstance,       // SICE instance
-                (USHORT*)&(puSercosFrameP2->rTel.aucData[SICE_TEL_EXT_FIELD_OFFSET]),
-                              // Offset of extended field in packet
-                ucPhaseAll,
-                usPacketIdx
-              );
-
-          if (eSiceRet != SICE_NO_ERROR)
+          // Sercos time (and therefore extended field) activated? With
+          // shared payload, it is taken over from port P.
+#if ((defined CSMD_SERCOS_TIME) || (CSMD_DRV_VERSION > 5)) && \
+    (!defined SICE_TX_SHARED_PAYLOAD)
+          // Extended field in MDT0 as generated for this cycle
+          if (
+              prSiceInstance->rSercosTime.boExtField  &&
+              (usPacketIdx == CSMD_DES_IDX_MDT0)
+            )
           {
-            return(SICE_SYSTEM_ERROR);
+            (VOID)memcpy
+                (
+                  &puSercosFrameP2->rTel.aucData[SICE_TEL_EXT_FIELD_OFFSET],
+                  prSiceInstance->rSercosTime.ausExtField,
+                  sizeof(prSiceInstance->rSercosTime.ausExtField)
+                );
           }
 #endif
 
         }
 
-        // Browse through all TX descriptors for this packet
-        do
+        // Copy data to frame buffer(s) as compiled from the TX descriptors
+        for (
+            usSegIdx = prPkt->usFirstSeg;
+            usSegIdx < prPkt->usFirstSeg + prPkt->usNumSeg;
+            usSegIdx++
+          )
         {
-          // Retrieve TX descriptor
-          /*lint -save -e826 */
-          ulCurDesc =
-              *(  (ULONG*)  (
-                        (UCHAR *)prSiceInstance->prTX_Ram +
-                        ((ULONG) usCurDescOffset)
-                      )
-              );
-          /*lint -restore */
-
-          // Move descriptor pointer
-          usCurDescOffset += (USHORT) sizeof(ULONG);
-
-          // Decode descriptor
-          usFrameOffset = (USHORT) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_TEL_OFFS))
-                            >> ((ULONG) CSMD_HAL_DES_SHIFT_TEL_OFFS));
-          ucDescType    = (UCHAR) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_TYPE))
-                            >> ((ULONG) CSMD_HAL_DES_SHIFT_TYPE));
-          usBufOffset   = (USHORT) (ulCurDesc  & ((ULONG) CSMD_HAL_DES_MASK_BUFF_OFFS));
-          ucBufSel      = (UCHAR) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_BUFF_SYS_SEL))
-                            >> ((ULONG) CSMD_HAL_DES_SHIFT_BUFF_SYS_SEL));
-
-          // Is it first descriptor of descriptor pair?
-          if (SICE_TX_DESC_START_DESC(ucDescType))
+          prSeg = &prSiceInstance->rTxPlan.arSeg[usSegIdx];
+
+          if (prSeg->boBufSysA)
+          {
+            lSegOffset = lBufSysAOffset;
+          }
+          else
           {
-            // Store start offsets for frame and buffer
-            usLastFrameOffset = usFrameOffset;
-            usLastBufOffset   = usBufOffset;
+            lSegOffset = 0;
           }
-          // Second descriptor of descriptor pair
-          else if (!SICE_TX_DESC_FRAME_END(ucDescType))
+
+#ifdef SICE_TX_INCREMENTAL
+          SICE_CopyTxSegment
+              (
+                prSiceInstance,
+                &puSercosFrameP1->rTel.aucData[prSeg->usFrameOffset],
+                prSeg->apucBuf[0] + lSegOffset,
+                prSeg->usLen,
+                boCopyAll
+              );
+#else
+          (VOID)memcpy
+              (
+                &puSercosFrameP1->rTel.aucData[prSeg->usFrameOffset],
+                prSeg->apucBuf[0] + lSegOffset,
+                prSeg->usLen
+              );
+#endif
+
+#ifndef SICE_TX_SHARED_PAYLOAD
+          // Last entry is the secondary port in case of redundancy, no
+          // source for port-specific CC data
+          if (  SICE_REDUNDANCY_BOOL &&
+                (prSeg->apucBuf[SICE_REDUNDANCY_VAL - 1] != NULL))
           {
-            // Copy data to frame buffer(s)
-            eSiceRet = SICE_CopyTxData
+#ifdef SICE_TX_INCREMENTAL
+            SICE_CopyTxSegment
+                (
+                  prSiceInstance,
+                  &puSercosFrameP2->rTel.aucData[prSeg->usFrameOffset],
+                  prSeg->apucBuf[SICE_REDUNDANCY_VAL - 1] + lSegOffset,
+                  prSeg->usLen,
+                  boCopyAll
+                );
+#else
+            (VOID)memcpy
                 (
-                  prSiceInstance,     // Pointer to SICE instance
-                  puSercosFrameP1,    // Frame buffer primary port
-                  puSercosFrameP2,    // Frame buffer secondary port
-                  ucDescType,         // descriptor type
-                  ucBufSel,           // Buffer selector
-                  usLastBufOffset,    // Buffer offset of last descriptor
-                  usLastFrameOffset,  // Frame offset of last descriptor
-                  usFrameOffset       // Frame offset of current descriptor
+                  &puSercosFrameP2->rTel.aucData[prSeg->usFrameOffset],
+                  prSeg->apucBuf[SICE_REDUNDANCY_VAL - 1] + lSegOffset,
+                  prSeg->usLen
                 );
-            if (eSiceRet != SICE_NO_ERROR)
-            {
-              return(eSiceRet);
-            }
+#endif
           }
+#endif
+        }
 
-          if (SICE_TX_DESC_FRAME_END(ucDescType))
-          {
-            // Calculate total frame length
-            prSiceInstance->aprSendFrame[usPacketIdx]->usLen =
-                usFrameOffset + ((USHORT) SICE_SERC3_TEL_HEADER);
+        // Total frame length
+        prSiceInstance->aprSendFrame[usPacketIdx]->usLen = prPkt->usFrameLen;
 
-            if (SICE_REDUNDANCY_BOOL)
-            {
-              // Calculate total frame length
-              prSiceInstance->aprSendFrame[usPacketIdx + 2* CSMD_MAX_TEL]->usLen =
-                  usFrameOffset + ((USHORT) SICE_SERC3_TEL_HEADER);
-            }
+        if (SICE_REDUNDANCY_BOOL)
+        {
+          prSiceInstance->aprSendFrame[usPacketIdx + 2* CSMD_MAX_TEL]->usLen =
+              prPkt->usFrameLen;
+        }
 
 #ifdef CSMD_HW_WATCHDOG
-            // In case of watchdog alarm and set packets to zero
-            // mode, do it.
-            if (prSiceInstance->ucWDAlarm == (UCHAR) SICE_WD_ALARM_SEND_EMPTY_TEL)
-            {
-              // Replace telegram content by zeros
-              (VOID)memset
-                  (
-                    prSiceInstance->aprSendFrame[usPacketIdx]->aucData +
-                        SICE_SERC3_TEL_HEADER,
-                    (UCHAR) 0x00,
-                    prSiceInstance->aprSendFrame[usPacketIdx]->usLen -
-                        SICE_SERC3_TEL_HEADER
-                  );
-            }
+        // In case of watchdog alarm and set packets to zero
+        // mode, do it.
+        if (prSiceInstance->ucWDAlarm == (UCHAR) SICE_WD_ALARM_SEND_EMPTY_TEL)
+        {
+          // Replace telegram content by zeros
+          (VOID)memset
+              (
+                prSiceInstance->aprSendFrame[usPacketIdx]->aucData +
+                    SICE_SERC3_TEL_HEADER,
+                (UCHAR) 0x00,
+                prSiceInstance->aprSendFrame[usPacketIdx]->usLen -
+                    SICE_SERC3_TEL_HEADER
+              );
+        }
 #endif
 
-            // Calculate CRC of dynamic part of header and use
-            // pre-calculated base CRC
-            // \todo Check if it works with big endian. htonl for conversion?
-            puSercosFrameP1->rTel.ulCRC = SICE_CRC32Calc
-                (
-                  &puSercosFrameP1->aucRaw[ SICE_TEL_LENGTH_HDR_FOR_CRC - SICE_TEL_LENGTH_DYN_HDR_FOR_CRC],
-                  SICE_TEL_LENGTH_DYN_HDR_FOR_CRC,
-                  prSiceInstance->ulBaseCRC
-                );
+#ifdef SICE_TX_SHARED_PAYLOAD
+        // Payload of port S is derived from the completed packet of port P
+        if (SICE_REDUNDANCY_BOOL)
+        {
+          SICE_ShareTxPayload
+              (
+                prSiceInstance,
+                usPacketIdx
+              );
+        }
+#endif
 
-            if (SICE_REDUNDANCY_BOOL)
-            {
-              // Calculate CRC of dynamic part of header and use
-              // pre-calculated base CRC
-              // \todo Check if it works with big endian. htonl for conversion?
-              puSercosFrameP2->rTel.ulCRC = SICE_CRC32Calc
-                  (
-                    &puSercosFrameP2->aucRaw[SICE_TEL_LENGTH_HDR_FOR_CRC - SICE_TEL_LENGTH_DYN_HDR_FOR_CRC],
-                    SICE_TEL_LENGTH_DYN_HDR_FOR_CRC,
-                    prSiceInstance->ulBaseCRC
-                  );
-            }
+        // Calculate CRC of dynamic part of header and use
+        // pre-calculated base CRC
+        // \todo Check if it works with big endian. htonl for conversion?
+        puSercosFrameP1->rTel.ulCRC = SICE_CRC32Calc
+            (
+              &puSercosFrameP1->aucRaw[ SICE_TEL_LENGTH_HDR_FOR_CRC - SICE_TEL_LENGTH_DYN_HDR_FOR_CRC],
+              SICE_TEL_LENGTH_DYN_HDR_FOR_CRC,
+              prSiceInstance->ulBaseCRC
+            );
 
-          } // if boIsLastFrameDesc
-        } while (!SICE_TX_DESC_FRAME_END(ucDescType));
-        // while more descriptors for this packet
+        if (SICE_REDUNDANCY_BOOL)
+        {
+          // Calculate CRC of dynamic part of header and use
+          // pre-calculated base CRC
+          // \todo Check if it works with big endian. htonl for conversion?
+          puSercosFrameP2->rTel.ulCRC = SICE_CRC32Calc
+              (
+                &puSercosFrameP2->aucRaw[SICE_TEL_LENGTH_HDR_FOR_CRC - SICE_TEL_LENGTH_DYN_HDR_FOR_CRC],
+                SICE_TEL_LENGTH_DYN_HDR_FOR_CRC,
+                prSiceInstance->ulBaseCRC
+              );
+        }
       } // if packet enabled in descriptor
       else
       {
@@ -503,9 +587,218 @@ SICE_FUNC_RET SICE_PrepareTelegrams
     }
   } // for all packets MDT0 .. AT3
 
+#ifdef SICE_TX_INCREMENTAL
+  // All changes have been taken over into the frames
+  (VOID)memset
+      (
+        prIncr->prTrack->aulDirty,
+        (UCHAR)0x00,
+        sizeof(prIncr->prTrack->aulDirty)
+      );
+
+  // Frames with contents replaced by zeros have to be rebuilt completely
+  prIncr->boCopyAll = (prSiceInstance->ucWDAlarm == (UCHAR) SICE_WD_ALARM_SEND_EMPTY_TEL);
+#endif
+
   return(SICE_NO_ERROR);
 }
 
+#ifdef SICE_TX_SHARED_PAYLOAD
+/**
+ * \fn VOID SICE_ShareTxPayload(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              USHORT usPacketIdx
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[in]       usPacketIdx     Packet type CSMD_DES_IDX_*
+ *
+ * \brief   Derives the payload of the port S packet from the completed
+ *          port P packet.
+ *
+ * \details If all data of the packet is the same for both ports, the port S
+ *          packet refers to the payload of the port P packet and only its
+ *          header is kept in its own buffer. Otherwise, the payload is copied
+ *          and the port-specific parts and the CC data are patched.
+ *
+ * \ingroup SICE
+ */
+VOID SICE_ShareTxPayload
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      USHORT usPacketIdx
+    )
+{
+  SICE_DESC_PKT_STRUCT* prPkt     = &prSiceInstance->rTxPlan.arPkt[usPacketIdx];
+  SICE_DESC_SEG_STRUCT* prSeg;
+  SICE_SIII_PACKET_BUF* prFrameP  = prSiceInstance->aprSendFrame[usPacketIdx];
+  SICE_SIII_PACKET_BUF* prFrameS  =
+      prSiceInstance->aprSendFrame[usPacketIdx + 2*CSMD_MAX_TEL];
+  USHORT                usSegIdx;
+
+  if (prPkt->boSharedPayload)
+  {
+    prFrameS->pucPayload = &prFrameP->aucData[SICE_SERC3_TEL_HEADER];
+    return;
+  }
+
+  prFrameS->pucPayload = NULL;
+
+  (VOID)memcpy
+      (
+        &prFrameS->aucData[SICE_SERC3_TEL_HEADER],
+        &prFrameP->aucData[SICE_SERC3_TEL_HEADER],
+        prPkt->usFrameLen - SICE_SERC3_TEL_HEADER
+      );
+
+#ifdef CSMD_HW_WATCHDOG
+  // Telegram content replaced by zeros
+  if (prSiceInstance->ucWDAlarm == (UCHAR) SICE_WD_ALARM_SEND_EMPTY_TEL)
+  {
+    return;
+  }
+#endif
+
+  // Port-specific data, no source for CC data on port S
+  for (
+      usSegIdx = prPkt->usFirstSeg;
+      usSegIdx < prPkt->usFirstSeg + prPkt->usNumSeg;
+      usSegIdx++
+    )
+  {
+    prSeg = &prSiceInstance->rTxPlan.arSeg[usSegIdx];
+
+    if (prSeg->apucBuf[SICE_REDUNDANCY_VAL - 1] == prSeg->apucBuf[0])
+    {
+      continue;
+    }
+
+    if (prSeg->apucBuf[SICE_REDUNDANCY_VAL - 1] == NULL)
+    {
+      (VOID)memset
+          (
+            &prFrameS->aucData[SICE_SERC3_TEL_HEADER + prSeg->usFrameOffset],
+            (UCHAR)0x00,
+            prSeg->usLen
+          );
+    }
+    else
+    {
+      (VOID)memcpy
+          (
+            &prFrameS->aucData[SICE_SERC3_TEL_HEADER + prSeg->usFrameOffset],
+            prSeg->apucBuf[SICE_REDUNDANCY_VAL - 1],
+            prSeg->usLen
+          );
+    }
+  }
+}
+#endif
+
+#ifdef SICE_TX_INCREMENTAL
+/**
+ * \fn VOID SICE_CopyTxSegment(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              UCHAR *pucDest,
+ *              UCHAR *pucSrc,
+ *              USHORT usLen,
+ *              BOOL boCopyAll
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[out]      pucDest         Destination in send frame
+ * \param[in]       pucSrc          Source of segment
+ * \param[in]       usLen           Length of segment in bytes
+ * \param[in]       boCopyAll       Copy complete segment?
+ *
+ * \brief   Copies the parts of a segment into a send frame that may have
+ *          changed since the previous cycle.
+ *
+ * \details Blocks of the TX RAM that are tracked by CoSeMa are only copied
+ *          when they are marked as changed. Untracked blocks and sources
+ *          outside of the TX RAM are always copied. Adjacent blocks are
+ *          copied together.
+ *
+ * \ingroup SICE
+ */
+VOID SICE_CopyTxSegment
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      UCHAR *pucDest,
+      UCHAR *pucSrc,
+      USHORT usLen,
+      BOOL boCopyAll
+    )
+{
+  CSMD_HAL_TX_TRACK*  prTrack = prSiceInstance->rTxIncr.prTrack;
+  LONG                lRamOffset;
+  ULONG               ulBlock;
+  ULONG               ulMask;
+  USHORT              usPos;
+  USHORT              usNext;
+  USHORT              usCopyStart = 0;
+
+  lRamOffset = (LONG)(pucSrc - (UCHAR*)prSiceInstance->prTX_Ram);
+
+  if (  boCopyAll ||
+        (lRamOffset < 0) ||
+        ((lRamOffset + usLen) > (LONG)SICE_RAM_TX_SIZE))
+  {
+    (VOID)memcpy(pucDest, pucSrc, usLen);
+    return;
+  }
+
+  for (
+      usPos = 0;
+      usPos < usLen;
+      usPos = usNext
+    )
+  {
+    ulBlock = ((ULONG)lRamOffset + usPos) / CSMD_HAL_TX_TRACK_BLOCK_SIZE;
+    ulMask  = ((ULONG) 1) << (ulBlock % 32);
+
+    // Start of next block relative to segment
+    usNext = (USHORT)((ulBlock + 1) * CSMD_HAL_TX_TRACK_BLOCK_SIZE - (ULONG)lRamOffset);
+    if (usNext > usLen)
+    {
+      usNext = usLen;
+    }
+
+    // Unchanged tracked block: copy blocks collected so far
+    if (  ((prTrack->aulTracked[ulBlock / 32] & ulMask) != (ULONG) 0) &&
+          ((prTrack->aulDirty[ulBlock / 32] & ulMask) == (ULONG) 0))
+    {
+      if (usPos > usCopyStart)
+      {
+        (VOID)memcpy
+            (
+              pucDest + usCopyStart,
+              pucSrc + usCopyStart,
+              usPos - usCopyStart
+            );
+      }
+      usCopyStart = usNext;
+    }
+  }
+
+  if (usLen > usCopyStart)
+  {
+    (VOID)memcpy
+        (
+          pucDest + usCopyStart,
+          pucSrc + usCopyStart,
+          usLen - usCopyStart
+        );
+  }
+}
+#endif
+
  /**
  * \fn BOOL SICE_CheckPacketSfcrTxEnabled(
  *              SICE_INSTANCE_STRUCT *prSiceInstance,
@@ -638,186 +931,294 @@ UCHAR SICE_SercosTypeField
 }
 
 /**
- * \fn SICE_FUNC_RET SICE_CopyTxData(
+ * \fn SICE_FUNC_RET SICE_CompileTxPlan(
  *          SICE_INSTANCE_STRUCT*   prSiceInstance,
- *          SICE_SIII_FRAME*        puSercosFrameP1,
- *          SICE_SIII_FRAME*        puSercosFrameP2,
- *          UCHAR                   ucDescType,
- *          UCHAR                   ucBufSel,
- *          USHORT                  usLastBufOffset,
- *          USHORT                  usLastFrameOffset,
- *          USHORT                  usFrameOffset
+ *          ULONG                   ulPacketMask
  *  )
  *
  * \private
  *
  * \param[in,out]   prSiceInstance      Pointer to Sercos SoftMaster core
  *                                      instance
- * \param[in,out]   puSercosFrameP1     Pointer to frame buffer for primary
- *                                      port
- * \param[in,out]   puSercosFrameP2     Pointer to frame buffer for secondary
- *                                      port
- * \param[in]       ucDescType          Descriptor type
- * \param[in]       ucBufSel            Buffer type
- * \param[in]       usLastBufOffset     Offset in buffer buffer of last
- *                                      descriptor
- * \param[in]       usLastFrameOffset   Offset in frame buffer of last
- *                                      descriptor
- * \param[in]       usFrameOffset       Offset in buffer of current descriptor
- *
- * \brief   Copies the data to be transmitted from the TX/RX RAM to the
- *          packet buffer.
+ * \param[in]       ulPacketMask        Packets to be compiled, bit per
+ *                                      CSMD_DES_IDX_*
+ *
+ * \brief   Compiles the TX descriptors of the given packets to a list of
+ *          copy segments from the TX RAM to the packet buffers.
  *
  * \return  See definition of SICE_FUNC_RET
  *          - SICE_NO_ERROR:            No error
- *          - SICE_SOCKET_ERROR:        When a problem occurred at packet
- *                                      transmission
- *          - SICE_PARAMETER_ERROR:     For function parameter error
  *          - SICE_TX_DESCRIPTOR_ERROR: When problems with TX descriptors
  *                                      occur, such as the signaling of an
  *                                      unsupported buffering mechanism
  *
- * \author  GMy
+ * \details The descriptors are decoded once, the result is used by
+ *          SICE_PrepareTelegrams() until CoSeMa changes the descriptors, see
+ *          SICE_DescPlanIsValid(). Descriptor pairs describing contiguous
+ *          data are merged into a single segment.
  *
  * \ingroup SICE
- *
- * \date    2015-01-28
  */
-SICE_FUNC_RET SICE_CopyTxData
+SICE_FUNC_RET SICE_CompileTxPlan
     (
       SICE_INSTANCE_STRUCT*   prSiceInstance,
-      SICE_SIII_FRAME*        puSercosFrameP1,
-      SICE_SIII_FRAME*        puSercosFrameP2,
-      UCHAR                   ucDescType,
-      UCHAR                   ucBufSel,
-      USHORT                  usLastBufOffset,
-      USHORT                  usLastFrameOffset,
-      USHORT                  usFrameOffset
+      ULONG                   ulPacketMask
     )
 {
-  USHORT  usBufSysOffset = 0;
-  USHORT  usLen;
+  SICE_DESC_PLAN_STRUCT*  prPlan            = &prSiceInstance->rTxPlan;
+  SICE_DESC_PKT_STRUCT*   prPkt;
+  UCHAR*                  apucSrc[SICE_REDUNDANCY_VAL];
+  UCHAR*                  pucTxRam          = (UCHAR *)prSiceInstance->prTX_Ram;
+  USHORT                  usPacketIdx;
+  USHORT                  usDescIdx;
+  USHORT                  usSegIdx;
+  ULONG                   ulCurDesc;
+  USHORT                  usFrameOffset;
+  UCHAR                   ucDescType;
+  USHORT                  usBufOffset;
+  UCHAR                   ucBufSel;
+  USHORT                  usLastFrameOffset = 0;
+  USHORT                  usLastBufOffset   = 0;
+  USHORT                  usBufSysOffset;
+  USHORT                  usLen;
+  BOOL                    boBufSysA;
+
+  SICE_VERBOSE(2, "SICE_CompileTxPlan()\n");
+
+  SICE_DescPlanStart(prSiceInstance, prPlan);
+
+  for (
+      usPacketIdx = 0;
+      usPacketIdx < 2*CSMD_MAX_TEL;
+      usPacketIdx++
+    )
+  {
+    if ((ulPacketMask & (((ULONG) 1) << usPacketIdx)) == (ULONG) 0)
+    {
+      continue;
+    }
+
+    // Copy TX descriptors of packet, if enabled in index table
+    if  (
+        !SICE_DescPlanFetch
+        (
+          prPlan,
+          pucTxRam,
+          prSiceInstance->prReg->rDECR.rDesIdx.usOffsetTxRam,
+          usPacketIdx,
+          TRUE
+        )
+      )
+    {
+      return(SICE_TX_DESCRIPTOR_ERROR);
+    }
+
+    prPkt = &prPlan->arPkt[usPacketIdx];
+
+    for (
+        usDescIdx = prPkt->usFirstDesc;
+        usDescIdx < prPkt->usFirstDesc + prPkt->usNumDesc;
+        usDescIdx++
+      )
+    {
+      ulCurDesc = prPlan->aulDesc[usDescIdx];
+
+      // Decode descriptor
+      usFrameOffset = (USHORT) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_TEL_OFFS))
+                        >> ((ULONG) CSMD_HAL_DES_SHIFT_TEL_OFFS));
+      ucDescType    = (UCHAR) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_TYPE))
+                        >> ((ULONG) CSMD_HAL_DES_SHIFT_TYPE));
+      usBufOffset   = (USHORT) (ulCurDesc  & ((ULONG) CSMD_HAL_DES_MASK_BUFF_OFFS));
+      ucBufSel      = (UCHAR) ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_BUFF_SYS_SEL))
+                        >> ((ULONG) CSMD_HAL_DES_SHIFT_BUFF_SYS_SEL));
+
+      // Is it first descriptor of descriptor pair?
+      if (SICE_TX_DESC_START_DESC(ucDescType))
+      {
+        // Store start offsets for frame and buffer
+        usLastFrameOffset = usFrameOffset;
+        usLastBufOffset   = usBufOffset;
+      }
+      // Second descriptor of descriptor pair
+      else if (!SICE_TX_DESC_FRAME_END(ucDescType))
+      {
+        usLen = (usFrameOffset - usLastFrameOffset) + ((USHORT)sizeof(USHORT));
+                                                            //USHORT alignment
+        boBufSysA = FALSE;
+
+        // Real-time data?
+        if (SICE_TX_DESC_RT_DATA(ucDescType))
+        {
+          switch (ucBufSel)
+          {
+            case 0:
+              usBufSysOffset = ((USHORT) CSMD_HAL_IDX_TX_BUFF_0_SYS_A);
+              boBufSysA      = TRUE;
+              break;
 
-  usLen = (usFrameOffset - usLastFrameOffset) + ((USHORT)sizeof(USHORT));
-                                                      //USHORT alignment
+            case 1:
+              usBufSysOffset = ((USHORT) CSMD_HAL_IDX_TX_BUFF_0_SYS_B);
+              break;
 
-  // Real-time data?
-  if (SICE_TX_DESC_RT_DATA(ucDescType))
-  {
-    switch (ucBufSel)
-    {
-      case 0:
-        usBufSysOffset = ((USHORT) CSMD_HAL_IDX_TX_BUFF_0_SYS_A);
-        break;
+            default:
+              SICE_VERBOSE
+                  (
+                    0,
+                    "Error in TX descriptor: Selected buffer "
+                    "system %c is not supported.",
+                    ucBufSel
+                  );
+              return(SICE_TX_DESCRIPTOR_ERROR);
+              /*lint -save -e527 */
+              break;
+              /*lint -restore */
+          }
+          apucSrc[0] = pucTxRam + prPlan->aulTxBufBasePtr[usBufSysOffset] +
+              usLastBufOffset;
 
-      case 1:
-        usBufSysOffset = ((USHORT) CSMD_HAL_IDX_TX_BUFF_0_SYS_B);
-        break;
+          if (SICE_REDUNDANCY_BOOL)
+          {
+            apucSrc[SICE_REDUNDANCY_VAL - 1] = apucSrc[0];
+          }
+        }
+        // Service channel data?
+        else if (SICE_TX_DESC_SVC_DATA(ucDescType))
+        {
+          apucSrc[0] = pucTxRam + prPlan->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_SVC] +
+              usLastBufOffset;
 
-      default:
-        SICE_VERBOSE
+          if (SICE_REDUNDANCY_BOOL)
+          {
+            apucSrc[SICE_REDUNDANCY_VAL - 1] = apucSrc[0];
+          }
+        }
+        // Port-specific data?
+        else if (SICE_TX_DESC_PORT_DATA(ucDescType))
+        {
+          apucSrc[0] = pucTxRam + prPlan->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_1] +
+              usLastBufOffset;
+
+          if (SICE_REDUNDANCY_BOOL)
+          {
+            apucSrc[SICE_REDUNDANCY_VAL - 1] = pucTxRam +
+                prPlan->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_2] +
+                usLastBufOffset;
+          }
+        }
+        // CC data?
+        else if (SICE_TX_DESC_PORTCC_DATA(ucDescType))
+        {
+          // \todo fill with zeros after AT error
+          // \todo set datafield delay bit (only needed for double line)
+          //    Something like:
+          //    prSiceInstance->prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_1] +
+          //      usLastBufOffset |= 1<<2;
+          apucSrc[0] = pucTxRam + prPlan->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_1] +
+              usLastBufOffset;
+
+          if (SICE_REDUNDANCY_BOOL)
+          {
+            apucSrc[SICE_REDUNDANCY_VAL - 1] = NULL;
+          }
+        }
+        else
+        {
+          SICE_VERBOSE(0, "Error: Unknown TX descriptor\n");
+          return(SICE_TX_DESCRIPTOR_ERROR);
+        }
+
+        if  (
+            !SICE_DescPlanAddSeg
             (
-              0,
-              "Error in TX descriptor: Selected buffer "
-              "system %c is not supported.",
-              ucBufSel
+              prPlan,
+              usPacketIdx,
+              apucSrc,
+              NULL,
+              usLastFrameOffset,
+              usLen,
+              boBufSysA
+            )
+          )
+        {
+          return(SICE_TX_DESCRIPTOR_ERROR);
+        }
+      }
+      else
+      {
+        if (usFrameOffset > (USHORT) (SICE_ETH_FRAMEBUF_LEN - SICE_SERC3_TEL_HEADER))
+        {
+          SICE_VERBOSE
+              (
+                0,
+                "Error: TX packet #%hu exceeds frame buffer (length %hu).\n",
+                usPacketIdx,
+                usFrameOffset
+              );
+          return(SICE_TX_DESCRIPTOR_ERROR);
+        }
+
+        // Calculate total frame length
+        prPkt->usFrameLen = usFrameOffset + ((USHORT) SICE_SERC3_TEL_HEADER);
+
+        // Parts of the frame to be filled with zeros
+        SICE_DescPlanBuildGaps
+            (
+              prPlan,
+              usPacketIdx,
+              usFrameOffset
             );
-        return(SICE_TX_DESCRIPTOR_ERROR);
-        /*lint -save -e527 */
-        break;
-        /*lint -restore */
+      }
     }
-    (VOID)memcpy
-        (
-          &puSercosFrameP1->rTel.aucData[usLastFrameOffset],
-          (UCHAR *)prSiceInstance->prTX_Ram +
-            prSiceInstance->prReg->aulTxBufBasePtr[usBufSysOffset] +
-            usLastBufOffset,
-          usLen
-        );
 
-    if (SICE_REDUNDANCY_BOOL)
-    {
-      (VOID)memcpy
-          (
-            &puSercosFrameP2->rTel.aucData[usLastFrameOffset],
-            (UCHAR *)prSiceInstance->prTX_Ram +
-              prSiceInstance->prReg->aulTxBufBasePtr[usBufSysOffset] +
-              usLastBufOffset,
-            usLen
-          );
-    }
-  }
-  // Service channel data?
-  else if (SICE_TX_DESC_SVC_DATA(ucDescType))
-  {
-    (VOID)memcpy
-        (
-          &puSercosFrameP1->rTel.aucData[usLastFrameOffset],
-          (UCHAR *)prSiceInstance->prTX_Ram +
-            prSiceInstance->prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_SVC] +
-            usLastBufOffset,
-          usLen
-        );
+    // Packets without port-specific data may share the payload
+    prPkt->boSharedPayload = TRUE;
 
-    if (SICE_REDUNDANCY_BOOL)
+    for (
+        usSegIdx = prPkt->usFirstSeg;
+        usSegIdx < prPkt->usFirstSeg + prPkt->usNumSeg;
+        usSegIdx++
+      )
     {
-      (VOID)memcpy
-          (
-            &puSercosFrameP2->rTel.aucData[usLastFrameOffset],
-            (UCHAR *)prSiceInstance->prTX_Ram +
-              prSiceInstance->prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_SVC] +
-              usLastBufOffset,
-            usLen
-          );
+      if  (
+          prPlan->arSeg[usSegIdx].apucBuf[SICE_REDUNDANCY_VAL - 1] !=
+          prPlan->arSeg[usSegIdx].apucBuf[0]
+        )
+      {
+        prPkt->boSharedPayload = FALSE;
+      }
     }
-  }
-  // Port-specific data?
-  else if (SICE_TX_DESC_PORT_DATA(ucDescType))
-  {
-    (VOID)memcpy
-        (
-          &puSercosFrameP1->rTel.aucData[usLastFrameOffset],
-          (UCHAR *)prSiceInstance->prTX_Ram +
-            prSiceInstance->prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_1] +
-            usLastBufOffset,
-          usLen
-        );
+
+    // Persistent header template: the Sercos type field does not change
+    // as long as the plan is valid
+    ((SICE_SIII_FRAME *) prSiceInstance->aprSendFrame[usPacketIdx]->aucData)->
+        rTel.ucSercosType = SICE_SercosTypeField
+            (
+              usPacketIdx,
+              SICE_TEL_P_CHANNEL
+            );
 
     if (SICE_REDUNDANCY_BOOL)
     {
-      (VOID)memcpy
-          (
-            &puSercosFrameP2->rTel.aucData[usLastFrameOffset],
-            (UCHAR *)prSiceInstance->prTX_Ram +
-              prSiceInstance->prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_2] +
-              usLastBufOffset,
-            usLen
-          );
+      ((SICE_SIII_FRAME *) prSiceInstance->aprSendFrame[usPacketIdx + 2*CSMD_MAX_TEL]->aucData)->
+          rTel.ucSercosType = SICE_SercosTypeField
+              (
+                usPacketIdx,
+                SICE_TEL_S_CHANNEL
+              );
     }
-  }
-  // CC data?
-  else if (SICE_TX_DESC_PORTCC_DATA(ucDescType))
-  {
-    // \todo fill with zeros after AT error
-    // \todo set datafield delay bit (only needed for double line)
-    //    Something like:
-    //    prSiceInstance->prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_1] +
-    //      usLastBufOffset |= 1<<2;
-    (VOID)memcpy
+
+    SICE_VERBOSE
         (
-          &puSercosFrameP1->rTel.aucData[usLastFrameOffset],
-          (UCHAR *)prSiceInstance->prTX_Ram +
-            prSiceInstance->prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_1] +
-            usLastBufOffset,
-          usLen
+          2,
+          "TX packet #%hu: %hu descriptors compiled to %hu segments\n",
+          usPacketIdx,
+          prPkt->usNumDesc,
+          prPkt->usNumSeg
         );
   }
-  else
-  {
-    SICE_VERBOSE(0, "Error: Unknown TX descriptor\n");
-    return(SICE_TX_DESCRIPTOR_ERROR);
-  }
+
+  prPlan->ulPacketMask  = ulPacketMask;
+  prPlan->boValid       = TRUE;
 
   return(SICE_NO_ERROR);
 }
@@ -834,6 +1235,9 @@ SICE_FUNC_RET SICE_CopyTxData
  *
  * \brief   Transmits Sercos MDT telegrams
  *
+ * \note    With SICE_TX_BATCH, the telegrams are only queued in the instance
+ *          and transmitted by SICE_FlushTelegrams().
+ *
  * \return  See definition of SICE_FUNC_RET
  *          - SICE_NO_ERROR:            No error
  *          - SICE_SOCKET_ERROR:        When a problem occurred at packet
@@ -864,10 +1268,12 @@ SICE_FUNC_RET SICE_SendMDTTelegrams
       SICE_INSTANCE_STRUCT *prSiceInstance
     )
 {
+#ifndef SICE_TX_BATCH
   INT           iRet        = 0;
-  USHORT        usPacketIdx;
   USHORT        usIFG       = CSMD_HAL_TXIFG_BASE;
   USHORT        usReqIFG;
+#endif
+  USHORT        usPacketIdx;
   INT           iPort       = 0;
 
   SICE_VERBOSE(3, "SICE_SendMDTTelegrams()\n");
@@ -877,12 +1283,14 @@ SICE_FUNC_RET SICE_SendMDTTelegrams
     return(SICE_PARAMETER_ERROR);
   }
 
+#ifndef SICE_TX_BATCH
   // Take over inter frame gap from CoSeMa if larger than minimum value
   usReqIFG = (USHORT) prSiceInstance->prReg->ulIFG & ((ULONG) SICE_IFG_REG_MASK);
   if (usReqIFG > (USHORT) CSMD_HAL_TXIFG_BASE)
   {
     usIFG = usReqIFG;
   }
+#endif
 
   // For all Sercos MDT telegrams MDT0 .. MDT3
   for (
@@ -908,6 +1316,34 @@ SICE_FUNC_RET SICE_SendMDTTelegrams
               iPort
             );
 
+#ifdef SICE_TX_BATCH
+        // Queue packet, transmitted together with the other packets of the
+        // cycle by SICE_FlushTelegrams()
+        if (prSiceInstance->rTxBatch.usNum >=
+            (USHORT) (2 * CSMD_MAX_TEL * SICE_REDUNDANCY_VAL))
+        {
+          return(SICE_BUFFER_ERROR);
+        }
+        prSiceInstance->rTxBatch.apucPacket[prSiceInstance->rTxBatch.usNum] =
+            prSiceInstance->aprSendFrame[usPacketIdx + iPort*2*CSMD_MAX_TEL]->aucData;
+        prSiceInstance->rTxBatch.ausLen[prSiceInstance->rTxBatch.usNum] =
+            prSiceInstance->aprSendFrame[usPacketIdx + iPort*2*CSMD_MAX_TEL]->usLen;
+        prSiceInstance->rTxBatch.aucPort[prSiceInstance->rTxBatch.usNum] = (UCHAR) iPort;
+#ifdef SICE_TX_SHARED_PAYLOAD
+        // Own header, payload of the packet for port P
+        prSiceInstance->rTxBatch.apucPayload[prSiceInstance->rTxBatch.usNum] =
+            prSiceInstance->aprSendFrame[usPacketIdx + iPort*2*CSMD_MAX_TEL]->pucPayload;
+        if (prSiceInstance->rTxBatch.apucPayload[prSiceInstance->rTxBatch.usNum] != NULL)
+        {
+          prSiceInstance->rTxBatch.ausLen[prSiceInstance->rTxBatch.usNum] =
+              (USHORT) SICE_SERC3_TEL_HEADER;
+          prSiceInstance->rTxBatch.ausPayloadLen[prSiceInstance->rTxBatch.usNum] =
+              prSiceInstance->aprSendFrame[usPacketIdx + iPort*2*CSMD_MAX_TEL]->usLen -
+                  (USHORT) SICE_SERC3_TEL_HEADER;
+        }
+#endif
+        prSiceInstance->rTxBatch.usNum++;
+#else
         // Send packet
         iRet = RTOS_TxPacket
             (
@@ -946,6 +1382,7 @@ SICE_FUNC_RET SICE_SendMDTTelegrams
 
           SICE_VERBOSE(2, "Packet transmission OK\n");
         }
+#endif
       } // if packet enabled
     } // for all ports
   } // for all Sercos MDT telegrams MDT0 .. MDT3
@@ -965,6 +1402,9 @@ SICE_FUNC_RET SICE_SendMDTTelegrams
  *
  * \brief   Transmit Sercos AT telegrams
  *
+ * \note    With SICE_TX_BATCH, the telegrams are only queued in the instance
+ *          and transmitted by SICE_FlushTelegrams().
+ *
  * \return  See definition of SICE_FUNC_RET
  *          - SICE_NO_ERROR:        No error
  *          - SICE_SOCKET_ERROR:    When a problem occurred at packet
@@ -996,10 +1436,12 @@ SICE_FUNC_RET SICE_SendATTelegrams
       SICE_INSTANCE_STRUCT *prSiceInstance
     )
 {
+#ifndef SICE_TX_BATCH
   INT    iRet        = 0;
-  USHORT usPacketIdx;
   USHORT usIFG       = CSMD_HAL_TXIFG_BASE;
   USHORT usReqIFG;
+#endif
+  USHORT usPacketIdx;
   INT    iPort       = 0;
 
   SICE_VERBOSE(3, "SICE_SendATTelegrams()\n");
@@ -1011,12 +1453,14 @@ SICE_FUNC_RET SICE_SendATTelegrams
 
 #ifndef SICE_MEASURE_TIMING
 
+#ifndef SICE_TX_BATCH
   // Take over inter frame gap from CoSeMa if larger than minimum value
   usReqIFG = (USHORT) prSiceInstance->prReg->ulIFG & ((ULONG) SICE_IFG_REG_MASK);
   if (usReqIFG > (USHORT) CSMD_HAL_TXIFG_BASE)
   {
     usIFG = usReqIFG;
   }
+#endif
 
   // For all Sercos AT telegrams AT0 .. AT3
   for (
@@ -1042,6 +1486,34 @@ SICE_FUNC_RET SICE_SendATTelegrams
               iPort
             );
 
+#ifdef SICE_TX_BATCH
+        // Queue packet, transmitted together with the other packets of the
+        // cycle by SICE_FlushTelegrams()
+        if (prSiceInstance->rTxBatch.usNum >=
+            (USHORT) (2 * CSMD_MAX_TEL * SICE_REDUNDANCY_VAL))
+        {
+          return(SICE_BUFFER_ERROR);
+        }
+        prSiceInstance->rTxBatch.apucPacket[prSiceInstance->rTxBatch.usNum] =
+            prSiceInstance->aprSendFrame[usPacketIdx + iPort*2*CSMD_MAX_TEL]->aucData;
+        prSiceInstance->rTxBatch.ausLen[prSiceInstance->rTxBatch.usNum] =
+            prSiceInstance->aprSendFrame[usPacketIdx + iPort*2*CSMD_MAX_TEL]->usLen;
+        prSiceInstance->rTxBatch.aucPort[prSiceInstance->rTxBatch.usNum] = (UCHAR) iPort;
+#ifdef SICE_TX_SHARED_PAYLOAD
+        // Own header, payload of the packet for port P
+        prSiceInstance->rTxBatch.apucPayload[prSiceInstance->rTxBatch.usNum] =
+            prSiceInstance->aprSendFrame[usPacketIdx + iPort*2*CSMD_MAX_TEL]->pucPayload;
+        if (prSiceInstance->rTxBatch.apucPayload[prSiceInstance->rTxBatch.usNum] != NULL)
+        {
+          prSiceInstance->rTxBatch.ausLen[prSiceInstance->rTxBatch.usNum] =
+              (USHORT) SICE_SERC3_TEL_HEADER;
+          prSiceInstance->rTxBatch.ausPayloadLen[prSiceInstance->rTxBatch.usNum] =
+              prSiceInstance->aprSendFrame[usPacketIdx + iPort*2*CSMD_MAX_TEL]->usLen -
+                  (USHORT) SICE_SERC3_TEL_HEADER;
+        }
+#endif
+        prSiceInstance->rTxBatch.usNum++;
+#else
         // Send packet.
         iRet = RTOS_TxPacket
             (
@@ -1080,6 +1552,7 @@ SICE_FUNC_RET SICE_SendATTelegrams
 
           SICE_VERBOSE(2, "Packet transmission OK\n");
         }
+#endif
       } // if packet enabled
     } // For all ports
   } // For all Sercos telegrams AT0 .. AT3
@@ -1089,6 +1562,123 @@ SICE_FUNC_RET SICE_SendATTelegrams
   return(SICE_NO_ERROR);
 }
 
+#ifdef SICE_TX_BATCH
+/**
+ * \fn SICE_FUNC_RET SICE_FlushTelegrams(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ *
+ * \brief   Transmits all Sercos telegrams queued by SICE_SendMDTTelegrams()
+ *          and SICE_SendATTelegrams() in queuing order with a single call
+ *          of the RTOS abstraction layer and empties the queue. With
+ *          SICE_WIRE_THREAD, the telegrams are handed over to the wire thread
+ *          instead.
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:            No error
+ *          - SICE_SOCKET_ERROR:        When a problem occurred at packet
+ *                                      transmission
+ *          - SICE_PARAMETER_ERROR:     For function parameter error
+ *
+ * \ingroup SICE
+ */
+SICE_FUNC_RET SICE_FlushTelegrams
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    )
+{
+  INT    iRet        = 0;
+  USHORT usIFG       = CSMD_HAL_TXIFG_BASE;
+  USHORT usReqIFG;
+  USHORT usCnt;
+
+  SICE_VERBOSE(3, "SICE_FlushTelegrams()\n");
+
+  if  (prSiceInstance ==  NULL)
+  {
+    return(SICE_PARAMETER_ERROR);
+  }
+
+  if (prSiceInstance->rTxBatch.usNum == 0)
+  {
+    return(SICE_NO_ERROR);
+  }
+
+  // Take over inter frame gap from CoSeMa if larger than minimum value
+  usReqIFG = (USHORT) prSiceInstance->prReg->ulIFG & ((ULONG) SICE_IFG_REG_MASK);
+  if (usReqIFG > (USHORT) CSMD_HAL_TXIFG_BASE)
+  {
+    usIFG = usReqIFG;
+  }
+
+#ifdef SICE_WIRE_THREAD
+  // Transmitted by the wire thread at its next transmission instant
+  iRet = SICE_WireHandOverTx
+      (
+        prSiceInstance,                         // SICE instance
+        usIFG                                   // inter-frame gap
+      );
+#else
+  iRet = RTOS_TxPacketBatch
+      (
+        prSiceInstance->iInstanceNo,            // SICE instance
+        prSiceInstance->rTxBatch.apucPacket,    // data pointers
+        prSiceInstance->rTxBatch.ausLen,        // packet lengths
+#ifdef SICE_TX_SHARED_PAYLOAD
+        prSiceInstance->rTxBatch.apucPayload,   // shared payload pointers
+        prSiceInstance->rTxBatch.ausPayloadLen, // shared payload lengths
+#else
+        NULL,                                   // no shared payload
+        NULL,
+#endif
+        prSiceInstance->rTxBatch.aucPort,       // port indices
+        prSiceInstance->rTxBatch.usNum,         // number of packets
+        usIFG                                   // inter-frame gap
+      );
+#endif
+
+  if (iRet < 0)
+  {
+    SICE_VERBOSE
+        (
+          0,
+          "Error: Sending %u queued telegrams failed.\n",
+          prSiceInstance->rTxBatch.usNum
+        );
+    prSiceInstance->rTxBatch.usNum = 0;
+    return(SICE_SOCKET_ERROR);
+  }
+
+  // Increase counter register for successfully transmitted packets
+  for (
+      usCnt = 0;
+      usCnt < (USHORT) iRet;
+      usCnt++
+    )
+  {
+    (VOID)SICE_IncPacketCounter
+        (
+          prSiceInstance,                             // SICE instance
+          SICE_TX_PACKET_CNT,                         // TX
+          TRUE,                                       // Packet is OK
+          prSiceInstance->rTxBatch.aucPort[usCnt],    // Port number
+          1                                           // Single packet
+        );
+  }
+
+  prSiceInstance->rTxBatch.usNum = 0;
+
+  SICE_VERBOSE(2, "Packet transmission OK\n");
+
+  return(SICE_NO_ERROR);
+}
+#endif
+
 /**
  * \fn SICE_FUNC_RET SICE_CheckPreCondsSend(
  *              SICE_INSTANCE_STRUCT *prSiceInstance
@@ -1161,26 +1751,28 @@ SICE_FUNC_RET SICE_CheckPreCondsSend
 }
 
 /**
- * \fn SICE_FUNC_RET SICE_GenExtField(
+ * \fn VOID SICE_GenExtField(
  *              SICE_INSTANCE_STRUCT *prSiceInstance,
- *              USHORT *pusExtField,
-                UCHAR ucPhaseAll,
-                USHORT usPacketIdx
+ *              UCHAR ucPhaseAll
  *          )
  *
  * \private
  *
  * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
  *                                  instance
- * \param[out]      pusExtField     Pointer to extended field to be written
  * \param[in]       ucPhaseAll      Sercos packet phase field
- * \param[in]       usPacketIdx     Packet index
  *
- * \brief   This function generates the extended function field
+ * \brief   This function generates the extended function field of MDT0 for
+ *          the current cycle.
  *
- * \return  See definition of SICE_FUNC_RET
- *          - SICE_NO_ERROR:            Success
- *          - SICE_SYSTEM_ERROR:        Internal inconsistency
+ * \details The extended field is generated once per cycle in ausExtField of
+ *          the Sercos time structure and copied into MDT0 of all ports.
+ *          boExtField signals whether MDT0 carries the extended field in
+ *          this cycle. The pre-calculated Sercos time is latched at cycle
+ *          count 0 and split into the words that are multiplexed into the
+ *          time field, so no conversion is needed in the other cycles.
+ *
+ * \return  None
  *
  * \author  GMy
  *
@@ -1191,183 +1783,108 @@ SICE_FUNC_RET SICE_CheckPreCondsSend
  * \version 2014-05-21 (GMy): Moved check for telegram and phase action to
  *                            function
  */
-SICE_FUNC_RET SICE_GenExtField
+VOID SICE_GenExtField
     (
       SICE_INSTANCE_STRUCT *prSiceInstance,
-      USHORT *pusExtField,
-      UCHAR ucPhaseAll,
-      USHORT usPacketIdx
+      UCHAR ucPhaseAll
     )
 {
-  INT iSercosTimePhase = 0;
+  SICE_SERCOS_TIME_STRUCT*  prTime = &prSiceInstance->rSercosTime;
+  USHORT                    usCTime;
 
   SICE_VERBOSE(2, "SICE_GenExtField()\n");
 
-  // Only in MDT0 during phases CP3 and CP4
-  if  (
+  // Only during phases CP3 and CP4
+  prTime->boExtField =
       (
         (
-          (
-            (ucPhaseAll & ((UCHAR) CSMD_HAL_PHASECR_PHASE_MASK))
-            == ((UCHAR) CSMD_SERC_PHASE_3)
-          )                                                           &&
+          (ucPhaseAll & ((UCHAR) CSMD_HAL_PHASECR_PHASE_MASK))
+          == ((UCHAR) CSMD_SERC_PHASE_3)
+        )                                                             &&
                                                         // in CP3
-          !(ucPhaseAll & SICE_TEL_CP_SWITCH_MASK)
-        )                                                               ||
+        !(ucPhaseAll & SICE_TEL_CP_SWITCH_MASK)
+      )                                                                 ||
                                                         // but not in transition from CP2
-        (
-          (ucPhaseAll & ((UCHAR) CSMD_HAL_PHASECR_PHASE_MASK))
-          == ((UCHAR) CSMD_SERC_PHASE_4)
-        )
-      )                                                                   &&
-                                                        // or in CP4
-      (usPacketIdx == CSMD_DES_IDX_MDT0)          // and only for MDT0
-    )
-  {
-
-    // SICE has to write pre-calculated time in extended field after
-    // hot-plug field
-
-    // Is Sercos time activated in TCSR register?
-    if  (
-        (prSiceInstance->prReg->ulTCSR & (((ULONG)1) << CSMD_HAL_TCSR_EST))
-        == ((ULONG) 0)
-      )
-    {
-      // Sercos time is not activated
-      prSiceInstance->boSercosTimeEn  = FALSE;
+      (
+        (ucPhaseAll & ((UCHAR) CSMD_HAL_PHASECR_PHASE_MASK))
+        == ((UCHAR) CSMD_SERC_PHASE_4)
+      );                                                // or in CP4
 
-  #if (CSMD_DRV_VERSION <= 5)
-      // First word of extended function field (C-Time)
-      pusExtField[0] = (USHORT)
-        (
-          (prSiceInstance->prReg->rSCCCMDT.rSCCNT.usSccCount & ((USHORT)0x3FFF))    |   // TSRef counter
-          (USHORT) (
-            prSiceInstance->prReg->ulTCSR                       &
-            ((ULONG)1 << CSMD_HAL_TCSR_NEW_ST)
-          )                                                           |   // Toggle bit
-          (((USHORT) 0) << 14)                                            // Time fragment invalid
-        );
-  #else
-      // First word of extended function field (C-Time)
-      pusExtField[0] = (USHORT)
-        (
-          (
-            prSiceInstance->prReg->rSCCMDT.rSCCNT.usScCount &
-            ((USHORT)0x3FFF)
-          )                                                           |   // TSRef counter
-          (USHORT) (
-            prSiceInstance->prReg->ulTCSR                       &
-            ((ULONG)1 << CSMD_HAL_TCSR_SYS_TIME_TOGGLE)
-          )                                                           |   // Toggle bit
-          (((USHORT) 0) << 14)                                            // Time fragment invalid
-        );
-  #endif
-      // Second word of extended function field (Time)
-      pusExtField[1] = (USHORT) 0;
-    }
-    else
-    {
-      // Sercos time is activated
+  if (!prTime->boExtField)
+  {
+    return;
+  }
 
-      // Latch Sercos time for transmission at cycle count 0
-      if  (prSiceInstance->ucCycleCnt == (UCHAR)0)
-      {
-        prSiceInstance->ulLatchedTime.ulSeconds = prSiceInstance->prReg->ulSTSECP;
-        prSiceInstance->ulLatchedTime.ulNanos   = prSiceInstance->prReg->ulSTNSP;
-        prSiceInstance->boSercosTimeEn          = TRUE;
-      }
+  // SICE has to write pre-calculated time in extended field after
+  // hot-plug field
 
-      if  (prSiceInstance->boSercosTimeEn)
-      {
-        // Only change Sercos time transmission phase every second cycle,
-        // so each value is transmitted twice in a row
-        iSercosTimePhase = prSiceInstance->ucCycleCnt / 2;
+#if (CSMD_DRV_VERSION <= 5)
+  // First word of extended function field (C-Time) without time valid bit
+  usCTime = (USHORT)
+    (
+      (prSiceInstance->prReg->rSCCCMDT.rSCCNT.usSccCount & ((USHORT)0x3FFF))    |   // TSRef counter
+      (USHORT) (
+        prSiceInstance->prReg->ulTCSR                       &
+        ((ULONG)1 << CSMD_HAL_TCSR_NEW_ST)
+      )                                                                             // Toggle bit
+    );
+#else
+  // First word of extended function field (C-Time) without time valid bit
+  usCTime = (USHORT)
+    (
+      (
+        prSiceInstance->prReg->rSCCMDT.rSCCNT.usScCount &
+        ((USHORT)0x3FFF)
+      )                                                           |   // TSRef counter
+      (USHORT) (
+        prSiceInstance->prReg->ulTCSR                       &
+        ((ULONG)1 << CSMD_HAL_TCSR_SYS_TIME_TOGGLE)
+      )                                                               // Toggle bit
+    );
+#endif
 
-  #if (CSMD_DRV_VERSION <=5)
-        // First word of extended function field (C-Time)
-        pusExtField[0] = (USHORT)
-          (
-            (prSiceInstance->prReg->rSCCCMDT.rSCCNT.usSccCount &((USHORT) 0x3FFF))      |   // TSRef counter
-            (USHORT)(
-              prSiceInstance->prReg->ulTCSR                       &
-              ((ULONG)1 << CSMD_HAL_TCSR_NEW_ST)
-            )                                                           |   // Toggle bit
-            ((USHORT)1 << 14)                                               // Time fragment valid
-          );
-  #else
-        // First word of extended function field (C-Time)
-        pusExtField[0] = (USHORT)
-          (
-            (prSiceInstance->prReg->rSCCMDT.rSCCNT.usScCount &((USHORT) 0x3FFF))      |   // TSRef counter
-            (USHORT)(
-              prSiceInstance->prReg->ulTCSR                       &
-              ((ULONG)1 << CSMD_HAL_TCSR_SYS_TIME_TOGGLE)
-            )                                                           |   // Toggle bit
-            ((USHORT)1 << 14)                                               // Time fragment valid
-          );
-  #endif
-        // Set second word of extended field (time) multiplexed time value.
-        // First high byte of seconds, then low byte, then high byte of
-        // nanos, then low byte.
-        // \todo OK for big endian?
-        /*lint -save -e527 const! */
-        switch(iSercosTimePhase)
-        {
-          case 0:
-            pusExtField[1] =
-                (USHORT)((prSiceInstance->ulLatchedTime.ulSeconds & (ULONG)0xFFFF0000) >> 16);
-            break;
-          case 1:
-            pusExtField[1] =
-                (USHORT)(prSiceInstance->ulLatchedTime.ulSeconds & (ULONG)0x0000FFFF);
-            break;
-          case 2:
-            pusExtField[1] =
-                (USHORT)((prSiceInstance->ulLatchedTime.ulNanos & (ULONG)0xFFFF0000) >> 16);
-            break;
-          case 3:
-            pusExtField[1] =
-                (USHORT)(prSiceInstance->ulLatchedTime.ulNanos & (ULONG)0x0000FFFF);
-            break;
-          default:
-            return(SICE_SYSTEM_ERROR);
-            break;
-        }
-        /*lint -restore const! */
-      }
-      else
-      {
-        // Wait until next time the cycle counter is 0 to latch Sercos time value.
+  // Is Sercos time activated in TCSR register?
+  if  (
+      (prSiceInstance->prReg->ulTCSR & (((ULONG)1) << CSMD_HAL_TCSR_EST))
+      == ((ULONG) 0)
+    )
+  {
+    // Sercos time is not activated
+    prTime->boLatched = FALSE;
+  }
+  else if (prSiceInstance->ucCycleCnt == (UCHAR)0)
+  {
+    // Latch Sercos time for transmission at cycle count 0. First high word
+    // of seconds, then low word, then high word of nanos, then low word.
+    prTime->ausLatched[0] =
+        (USHORT)((prSiceInstance->prReg->ulSTSECP & (ULONG)0xFFFF0000) >> 16);
+    prTime->ausLatched[1] =
+        (USHORT)(prSiceInstance->prReg->ulSTSECP & (ULONG)0x0000FFFF);
+    prTime->ausLatched[2] =
+        (USHORT)((prSiceInstance->prReg->ulSTNSP & (ULONG)0xFFFF0000) >> 16);
+    prTime->ausLatched[3] =
+        (USHORT)(prSiceInstance->prReg->ulSTNSP & (ULONG)0x0000FFFF);
+    prTime->boLatched = TRUE;
+  }
 
-  #if (CSMD_DRV_VERSION <=5)
-        // First word of extended function field (C-Time)
-        pusExtField[0] = (USHORT)
-          (
-            (prSiceInstance->prReg->rSCCCMDT.rSCCNT.usSccCount & ((USHORT)0x3FFF))     |   // TSRef counter
-            (USHORT)(
-              prSiceInstance->prReg->ulTCSR                       &
-              ((ULONG)1 << CSMD_HAL_TCSR_NEW_ST)
-            )                                                           |   // Toggle bit
-            ((USHORT)0 << 14)                                               // Time fragment invalid
-          );
-  #else
-        // First word of extended function field (C-Time)
-        pusExtField[0] = (USHORT)
-          (
-            (prSiceInstance->prReg->rSCCMDT.rSCCNT.usScCount &((USHORT)0x3FFF))       |   // TSRef counter
-            (USHORT)(
-              prSiceInstance->prReg->ulTCSR                       &
-              ((ULONG)1 << CSMD_HAL_TCSR_SYS_TIME_TOGGLE)
-            )                                                           |   // Toggle bit
-            ((USHORT)0 << 14)                                               // Time fragment invalid
-          );
-  #endif
+  if (prTime->boLatched)
+  {
+    // Time fragment valid
+    prTime->ausExtField[0] = (USHORT)(usCTime | ((USHORT)1 << 14));
+
+    // Set second word of extended field (time) multiplexed time value. Only
+    // change Sercos time transmission phase every second cycle, so each
+    // value is transmitted twice in a row.
+    // \todo OK for big endian?
+    prTime->ausExtField[1] = prTime->ausLatched[(prSiceInstance->ucCycleCnt >> 1) & 0x03];
+  }
+  else
+  {
+    // Sercos time is not activated or waiting until next time the cycle
+    // counter is 0 to latch Sercos time value: Time fragment invalid
+    prTime->ausExtField[0] = usCTime;
 
-        // Second word of extended function field (Time)
-        pusExtField[1] = (USHORT) 0;
-      }
-    }
+    // Second word of extended function field (Time)
+    prTime->ausExtField[1] = (USHORT) 0;
   }
-  return(SICE_NO_ERROR);
 }
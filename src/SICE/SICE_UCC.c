@@ -122,10 +122,8 @@ SICE_FUNC_RET SICE_UCC_Init
   }
 
   // Initialize UCC packet buffers
-  prSiceInstance->rUCCRxBuf.ucBufPtrStart = 0;
-  prSiceInstance->rUCCRxBuf.ucBufPtrEnd   = 0;
-  prSiceInstance->rUCCTxBuf.ucBufPtrStart = 0;
-  prSiceInstance->rUCCTxBuf.ucBufPtrEnd   = 0;
+  SICE_UCC_RingReset(&prSiceInstance->rUCCRxBuf);
+  SICE_UCC_RingReset(&prSiceInstance->rUCCTxBuf);
 
   // IP transmit stack (IPTXS)
   prSiceInstance->prReg->ulIPTXS1 = (ULONG) 0;
@@ -443,6 +441,7 @@ SICE_FUNC_RET SICE_UCC_SendTelegrams
   ULONG  ulRemUCCDuration = ulUCCDuration;
   INT    iRet             = 0;
   INT    iCnt             = 0;
+  SICE_UCC_PACKET_SLOT* prSlot = NULL;
 
   SICE_VERBOSE(3, "SICE_UCC_SendTelegrams()\n");
 
@@ -477,14 +476,16 @@ SICE_FUNC_RET SICE_UCC_SendTelegrams
             SICE_UCC_GetTxNextPacketSize(prSiceInstance)
           );
 
-      // Send packet via RTOS function
+      // Send packet via RTOS function directly from the ring slot
+
+      prSlot = SICE_UCC_RingPeek(&prSiceInstance->rUCCTxBuf, 0);
 
       iRet = RTOS_TxUCCPacket
           (
             prSiceInstance->iInstanceNo,
-            prSiceInstance->rUCCTxBuf.ucBufPort[prSiceInstance->rUCCTxBuf.ucBufPtrStart],
-            prSiceInstance->rUCCTxBuf.aucBuf[prSiceInstance->rUCCTxBuf.ucBufPtrStart],
-            prSiceInstance->rUCCTxBuf.usBufSize[prSiceInstance->rUCCTxBuf.ucBufPtrStart]
+            prSlot->ucPort,
+            prSlot->aucData,
+            prSlot->usLen
           );
       if (iRet < 0)
       {
@@ -492,14 +493,14 @@ SICE_FUNC_RET SICE_UCC_SendTelegrams
             (
               0,
               "Error: Transmitting UCC data on port %d failed.\n",
-              prSiceInstance->rUCCTxBuf.ucBufPort[prSiceInstance->rUCCTxBuf.ucBufPtrStart]
+              prSlot->ucPort
             );
         return(SICE_SOCKET_ERROR);
       }
       else
       {
-        // Successfully transmitted the packet
-        prSiceInstance->rUCCTxBuf.ucBufPtrStart = (prSiceInstance->rUCCTxBuf.ucBufPtrStart +1) % SICE_UCC_BUF_SIZE;
+        // Successfully transmitted the packet, hand slot back to producer
+        SICE_UCC_RingRelease(&prSiceInstance->rUCCTxBuf, 1);
         SICE_VERBOSE(1, "Successfully transmitted UCC packet\n");
       }
     }
@@ -533,13 +534,14 @@ SICE_FUNC_RET SICE_UCC_SendTelegrams
  *
  * \attention   Not tested yet!
  *
- * \details In case more packets are received than the ring buffer can hold,
- *          the oldest packets are overwritten (= dropped).
+ * \details Packets are received directly into free slots of the receive
+ *          ring buffer. In case more packets are received than the ring
+ *          buffer can hold, the new packets are dropped and counted, so that
+ *          the RT cycle is never blocked by a slow consumer.
  *
  * \return  See definition of SICE_FUNC_RET
  *          - SICE_NO_ERROR:        No error
  *          - SICE_CONFIG_ERROR:    UCC not enabled
- *          - SICE_BUFFER_ERROR:    Ring buffer overflow
  *          - SICE_SOCKET_ERROR:    Problems with UCC socket
  *          - SICE_PARAMETER_ERROR: For function parameter error
  *
@@ -557,8 +559,10 @@ SICE_FUNC_RET SICE_UCC_ReceiveTelegrams
 {
 #ifdef SICE_UC_CHANNEL
 
-  INT iPort = 0;
-  INT iRet  = 1;
+  INT                   iPort   = 0;
+  INT                   iRet    = 1;
+  SICE_UCC_PACKET_SLOT* prSlot  = NULL;
+  UCHAR                 aucDiscardBuf[SICE_ETH_FRAMEBUF_LEN];
 
   SICE_VERBOSE(3, "SICE_UCC_ReceiveTelegrams()\n");
 
@@ -575,12 +579,16 @@ SICE_FUNC_RET SICE_UCC_ReceiveTelegrams
   {
     do
     {
+      // Receive into next free slot, or into discard buffer in case the ring
+      // is full, so that the socket is drained in any case
+      prSlot = SICE_UCC_RingReserve(&prSiceInstance->rUCCRxBuf);
+
       iRet = RTOS_RxUCCPacket
           (
             prSiceInstance->iInstanceNo,
             iPort,
             boNrtState,
-            prSiceInstance->rUCCRxBuf.aucBuf[prSiceInstance->rUCCRxBuf.ucBufPtrEnd]
+            (prSlot != NULL) ? prSlot->aucData : aucDiscardBuf
           );
       if (iRet < 0)
       {
@@ -594,22 +602,20 @@ SICE_FUNC_RET SICE_UCC_ReceiveTelegrams
       }
       else if (iRet > 0)
       {
-        // Received UCC packet
-        prSiceInstance->rUCCRxBuf.ucBufPort[prSiceInstance->rUCCRxBuf.ucBufPtrEnd] = iPort;
-        prSiceInstance->rUCCRxBuf.usBufSize[prSiceInstance->rUCCRxBuf.ucBufPtrEnd] = iRet;
-
-        // Increase ring buffer pointer
-        prSiceInstance->rUCCRxBuf.ucBufPtrEnd =
-            (prSiceInstance->rUCCRxBuf.ucBufPtrEnd + 1) % SICE_UCC_BUF_SIZE;
+        if (prSlot != NULL)
+        {
+          // Received UCC packet, publish slot to consumer
+          prSlot->ucPort = (UCHAR) iPort;
+          prSlot->usLen  = (USHORT) iRet;
 
-        // Ring buffer overflow?
-        if (prSiceInstance->rUCCRxBuf.ucBufPtrEnd == prSiceInstance->rUCCRxBuf.ucBufPtrStart)
+          SICE_UCC_RingCommit(&prSiceInstance->rUCCRxBuf);
+        }
+        else
         {
-          SICE_VERBOSE(0, "Error: UCC RX Buffer overflow!");
+          // Ring buffer overflow, drop packet
+          SICE_VERBOSE(1, "Warning: UCC RX Buffer overflow!\n");
 
-          // Overwrite (= drop) oldest packet
-          prSiceInstance->rUCCRxBuf.ucBufPtrStart =
-              (prSiceInstance->rUCCRxBuf.ucBufPtrStart + 1) % SICE_UCC_BUF_SIZE;
+          prSiceInstance->rUCCRxBuf.ulDropCnt++;
 
           (VOID)SICE_IncPacketCounter
               (
@@ -619,8 +625,6 @@ SICE_FUNC_RET SICE_UCC_ReceiveTelegrams
                 iPort,                    // Port
                 1                         // One packet
               );
-
-          return(SICE_BUFFER_ERROR);
         }
       }                  // if packet received
     } while (iRet > 0);  // while more packets received
@@ -660,14 +664,13 @@ SICE_FUNC_RET SICE_UCC_ReceiveTelegrams
  *
  * \return  See definition of SICE_FUNC_RET
  *          - SICE_NO_ERROR:        No error
- *          - SICE_SYSTEM_ERROR:    Writing packet not possible, e.g. due to
- *                                  buffer overrun
+ *          - SICE_BUFFER_ERROR:    Ring buffer full, packet dropped
  *          - SICE_CONFIG_ERROR:    UCC not enabled
  *          - SICE_PARAMETER_ERROR: For function parameter error
  *
- * \details This function is non-blocking. In case more packets are received
- *          than the ring buffer can hold, the oldest packets are overwritten
- *          (= dropped).
+ * \details This function is non-blocking and may be called from a single
+ *          NRT thread concurrently to the RT cycle. In case more packets are
+ *          put than the ring buffer can hold, the new packet is dropped.
  *
  * \author  GMy
  *
@@ -685,45 +688,45 @@ SICE_FUNC_RET SICE_UCC_PutPacket
 {
 #ifdef SICE_UC_CHANNEL
 
+  SICE_UCC_PACKET_SLOT* prSlot = NULL;
+
   SICE_VERBOSE(3, "SICE_PutUCCPacket()\n");
 
   if (
       (prSiceInstance == NULL)  ||
       (pucFrame == NULL)        ||
-      (usLen == 0)
+      (usLen == 0)              ||
+      (usLen > SICE_ETH_FRAMEBUF_LEN)
     )
   {
     return(SICE_PARAMETER_ERROR);
   }
 
-  // Copy packet data to buffer
-  memcpy
-      (
-        prSiceInstance->rUCCTxBuf.aucBuf[prSiceInstance->rUCCTxBuf.ucBufPtrEnd],
-        pucFrame,
-        usLen
-      );
-
-  prSiceInstance->rUCCTxBuf.ucBufPort[prSiceInstance->rUCCTxBuf.ucBufPtrEnd] = ucPort;
-
-  prSiceInstance->rUCCTxBuf.usBufSize[prSiceInstance->rUCCTxBuf.ucBufPtrEnd] = usLen;
-
-  // Increase ring buffer pointer
-  prSiceInstance->rUCCTxBuf.ucBufPtrEnd =
-      (prSiceInstance->rUCCTxBuf.ucBufPtrEnd + 1) % SICE_UCC_BUF_SIZE;
+  prSlot = SICE_UCC_RingReserve(&prSiceInstance->rUCCTxBuf);
 
   // Ring buffer overflow?
-  if (prSiceInstance->rUCCTxBuf.ucBufPtrEnd == prSiceInstance->rUCCTxBuf.ucBufPtrStart)
+  if (prSlot == NULL)
   {
-    SICE_VERBOSE(0, "Error: UCC TX Buffer overflow!");
+    SICE_VERBOSE(0, "Error: UCC TX Buffer overflow!\n");
 
-    // Overwrite (= drop) oldest packet
-    prSiceInstance->rUCCTxBuf.ucBufPtrStart =
-        (prSiceInstance->rUCCTxBuf.ucBufPtrStart + 1) % SICE_UCC_BUF_SIZE;
+    prSiceInstance->rUCCTxBuf.ulDropCnt++;
 
     return(SICE_BUFFER_ERROR);
   }
 
+  // Copy packet data to slot and publish it to the RT cycle
+  (VOID)memcpy
+      (
+        prSlot->aucData,
+        pucFrame,
+        usLen
+      );
+
+  prSlot->ucPort = ucPort;
+  prSlot->usLen  = usLen;
+
+  SICE_UCC_RingCommit(&prSiceInstance->rUCCTxBuf);
+
   return(SICE_NO_ERROR);
 
 #else
@@ -764,7 +767,8 @@ SICE_FUNC_RET SICE_UCC_PutPacket
  *          - SICE_CONFIG_ERROR:    UCC not enabled
  *          - SICE_PARAMETER_ERROR: For function parameter error
  *
- * \details This function is non-blocking.
+ * \details This function is non-blocking and may be called from a single
+ *          NRT thread concurrently to the RT cycle.
  *
  * \author  GMy
  *
@@ -782,6 +786,8 @@ SICE_FUNC_RET SICE_UCC_GetPacket
 {
 #ifdef SICE_UC_CHANNEL
 
+  SICE_UCC_PACKET_SLOT* prSlot = NULL;
+
   SICE_VERBOSE(3, "SICE_GetUCCPacket()\n");
 
   if (
@@ -794,20 +800,22 @@ SICE_FUNC_RET SICE_UCC_GetPacket
     return(SICE_PARAMETER_ERROR);
   }
 
-  if (prSiceInstance->rUCCRxBuf.ucBufPtrStart != prSiceInstance->rUCCRxBuf.ucBufPtrEnd)
+  prSlot = SICE_UCC_RingPeek(&prSiceInstance->rUCCRxBuf, 0);
+
+  if (prSlot != NULL)
   {
     // Found packet(s) in ring buffer, so copy first one
-    memcpy
+    (VOID)memcpy
         (
           pucFrame,
-          prSiceInstance->rUCCRxBuf.aucBuf[prSiceInstance->rUCCRxBuf.ucBufPtrStart],
-          prSiceInstance->rUCCRxBuf.usBufSize[prSiceInstance->rUCCRxBuf.ucBufPtrStart]
+          prSlot->aucData,
+          prSlot->usLen
         );
-    *pusLen = prSiceInstance->rUCCRxBuf.usBufSize[prSiceInstance->rUCCRxBuf.ucBufPtrStart];
-    *pucPort = prSiceInstance->rUCCRxBuf.ucBufPort[prSiceInstance->rUCCRxBuf.ucBufPtrStart];
+    *pusLen = prSlot->usLen;
+    *pucPort = prSlot->ucPort;
 
-    // Increase ring buffer pointer
-    prSiceInstance->rUCCRxBuf.ucBufPtrStart = (prSiceInstance->rUCCRxBuf.ucBufPtrStart + 1) % SICE_UCC_BUF_SIZE;
+    // Hand slot back to producer
+    SICE_UCC_RingRelease(&prSiceInstance->rUCCRxBuf, 1);
 
     return(SICE_NO_ERROR);
   }
@@ -856,14 +864,7 @@ ULONG SICE_UCC_GetTxQueueSize
     return(0);
   }
 
-  if (prSiceInstance->rUCCTxBuf.ucBufPtrEnd >= prSiceInstance->rUCCTxBuf.ucBufPtrStart)
-  {
-    return(prSiceInstance->rUCCTxBuf.ucBufPtrEnd - prSiceInstance->rUCCTxBuf.ucBufPtrStart);
-  }
-  else
-  {
-    return(prSiceInstance->rUCCTxBuf.ucBufPtrEnd + SICE_UCC_BUF_SIZE - prSiceInstance->rUCCTxBuf.ucBufPtrStart);
-  }
+  return(SICE_UCC_RingLevel(&prSiceInstance->rUCCTxBuf));
 #else
 
   SICE_VERBOSE(3, "Warning: SICE_GetUCCTxQueueSize() called, but UCC disabled\n");
@@ -899,21 +900,22 @@ ULONG SICE_UCC_GetTxNextPacketSize
     )
 {
 #ifdef SICE_UC_CHANNEL
-  ULONG ulPacketSize = 0;
+  SICE_UCC_PACKET_SLOT* prSlot = NULL;
 
   if (prSiceInstance == NULL)
   {
     return(0);
   }
 
-  if (SICE_UCC_GetTxQueueSize(prSiceInstance) == 0)
+  prSlot = SICE_UCC_RingPeek(&prSiceInstance->rUCCTxBuf, 0);
+
+  if (prSlot == NULL)
   {
     return(0);
   }
   else
   {
-    ulPacketSize = prSiceInstance->rUCCTxBuf.usBufSize[prSiceInstance->rUCCTxBuf.ucBufPtrStart];
-    return(ulPacketSize);
+    return((ULONG) prSlot->usLen);
   }
 
 #else
@@ -923,3 +925,507 @@ ULONG SICE_UCC_GetTxNextPacketSize
 
 #endif
 }
+
+/**
+ * \fn SICE_FUNC_RET SICE_UCC_ReservePacket(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              UCHAR** ppucFrame
+ *          )
+ *
+ * \public
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[out]      ppucFrame       Pointer to packet buffer of reserved slot,
+ *                                  able to hold SICE_ETH_FRAMEBUF_LEN bytes
+ *
+ * \brief   Reserves the next free slot of the UCC transmit ring buffer, so
+ *          that the packet can be built in place without an additional copy.
+ *          The packet is handed over for transmission by
+ *          SICE_UCC_CommitPacket().
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:        No error
+ *          - SICE_BUFFER_ERROR:    Ring buffer full
+ *          - SICE_CONFIG_ERROR:    UCC not enabled
+ *          - SICE_PARAMETER_ERROR: For function parameter error
+ *
+ * \details This function is non-blocking and may be called from a single
+ *          NRT thread concurrently to the RT cycle. Calling it repeatedly
+ *          without commit returns the same slot.
+ *
+ * \ingroup SICE_UCC
+ */
+SICE_FUNC_RET SICE_UCC_ReservePacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      UCHAR** ppucFrame
+    )
+{
+#ifdef SICE_UC_CHANNEL
+
+  SICE_UCC_PACKET_SLOT* prSlot = NULL;
+
+  if (
+      (prSiceInstance == NULL)  ||
+      (ppucFrame == NULL)
+    )
+  {
+    return(SICE_PARAMETER_ERROR);
+  }
+
+  prSlot = SICE_UCC_RingReserve(&prSiceInstance->rUCCTxBuf);
+
+  if (prSlot == NULL)
+  {
+    prSiceInstance->rUCCTxBuf.ulDropCnt++;
+    *ppucFrame = NULL;
+    return(SICE_BUFFER_ERROR);
+  }
+
+  *ppucFrame = prSlot->aucData;
+
+  return(SICE_NO_ERROR);
+
+#else
+
+  SICE_VERBOSE(3, "Warning: SICE_UCC_ReservePacket() called, but UCC disabled\n");
+  return (SICE_CONFIG_ERROR);
+
+#endif
+}
+
+/**
+ * \fn SICE_FUNC_RET SICE_UCC_CommitPacket(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              UCHAR ucPort,
+ *              USHORT usLen
+ *          )
+ *
+ * \public
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[in]       ucPort          Port index (SICE_ETH_PORT_P,
+ *                                  SICE_ETH_PORT_S, or SICE_ETH_PORT_BOTH)
+ * \param[in]       usLen           Length of packet
+ *
+ * \brief   Hands the packet in the slot reserved by SICE_UCC_ReservePacket()
+ *          over for transmission by the RT cycle.
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:        No error
+ *          - SICE_BUFFER_ERROR:    No slot reserved
+ *          - SICE_CONFIG_ERROR:    UCC not enabled
+ *          - SICE_PARAMETER_ERROR: For function parameter error
+ *
+ * \ingroup SICE_UCC
+ */
+SICE_FUNC_RET SICE_UCC_CommitPacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      UCHAR ucPort,
+      USHORT usLen
+    )
+{
+#ifdef SICE_UC_CHANNEL
+
+  SICE_UCC_PACKET_SLOT* prSlot = NULL;
+
+  if (
+      (prSiceInstance == NULL)  ||
+      (usLen == 0)              ||
+      (usLen > SICE_ETH_FRAMEBUF_LEN)
+    )
+  {
+    return(SICE_PARAMETER_ERROR);
+  }
+
+  // The consumer only frees slots, so a previously reserved slot is still
+  // available here
+  prSlot = SICE_UCC_RingReserve(&prSiceInstance->rUCCTxBuf);
+
+  if (prSlot == NULL)
+  {
+    return(SICE_BUFFER_ERROR);
+  }
+
+  prSlot->ucPort = ucPort;
+  prSlot->usLen  = usLen;
+
+  SICE_UCC_RingCommit(&prSiceInstance->rUCCTxBuf);
+
+  return(SICE_NO_ERROR);
+
+#else
+
+  SICE_VERBOSE(3, "Warning: SICE_UCC_CommitPacket() called, but UCC disabled\n");
+  return (SICE_CONFIG_ERROR);
+
+#endif
+}
+
+/**
+ * \fn SICE_FUNC_RET SICE_UCC_PeekPacket(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              UCHAR* pucPort,
+ *              UCHAR** ppucFrame,
+ *              USHORT* pusLen
+ *          )
+ *
+ * \public
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[out]      pucPort         Port index (SICE_ETH_PORT_P or
+ *                                  SICE_ETH_PORT_S)
+ * \param[out]      ppucFrame       Pointer to packet data in ring slot
+ * \param[out]      pusLen          Length of packet
+ *
+ * \brief   Returns the oldest received UCC packet in place, without copying
+ *          it. The slot stays valid until SICE_UCC_ReleasePacket() is called.
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:        No error
+ *          - SICE_NO_PACKET:       No packet in buffer
+ *          - SICE_CONFIG_ERROR:    UCC not enabled
+ *          - SICE_PARAMETER_ERROR: For function parameter error
+ *
+ * \details This function is non-blocking and may be called from a single
+ *          NRT thread concurrently to the RT cycle.
+ *
+ * \ingroup SICE_UCC
+ */
+SICE_FUNC_RET SICE_UCC_PeekPacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      UCHAR* pucPort,
+      UCHAR** ppucFrame,
+      USHORT* pusLen
+    )
+{
+#ifdef SICE_UC_CHANNEL
+
+  SICE_UCC_PACKET_SLOT* prSlot = NULL;
+
+  if (
+      (prSiceInstance == NULL)  ||
+      (pucPort == NULL)         ||
+      (ppucFrame == NULL)       ||
+      (pusLen == NULL)
+    )
+  {
+    return(SICE_PARAMETER_ERROR);
+  }
+
+  prSlot = SICE_UCC_RingPeek(&prSiceInstance->rUCCRxBuf, 0);
+
+  if (prSlot == NULL)
+  {
+    return(SICE_NO_PACKET);
+  }
+
+  *pucPort   = prSlot->ucPort;
+  *ppucFrame = prSlot->aucData;
+  *pusLen    = prSlot->usLen;
+
+  return(SICE_NO_ERROR);
+
+#else
+
+  SICE_VERBOSE(3, "Warning: SICE_UCC_PeekPacket() called, but UCC disabled\n");
+  return (SICE_CONFIG_ERROR);
+
+#endif
+}
+
+/**
+ * \fn SICE_FUNC_RET SICE_UCC_ReleasePacket(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance
+ *          )
+ *
+ * \public
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ *
+ * \brief   Releases the receive slot returned by SICE_UCC_PeekPacket(), so
+ *          that it can be reused by the RT cycle.
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:        No error
+ *          - SICE_NO_PACKET:       No packet in buffer
+ *          - SICE_CONFIG_ERROR:    UCC not enabled
+ *          - SICE_PARAMETER_ERROR: For function parameter error
+ *
+ * \ingroup SICE_UCC
+ */
+SICE_FUNC_RET SICE_UCC_ReleasePacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    )
+{
+#ifdef SICE_UC_CHANNEL
+
+  if (prSiceInstance == NULL)
+  {
+    return(SICE_PARAMETER_ERROR);
+  }
+
+  if (SICE_UCC_RingPeek(&prSiceInstance->rUCCRxBuf, 0) == NULL)
+  {
+    return(SICE_NO_PACKET);
+  }
+
+  SICE_UCC_RingRelease(&prSiceInstance->rUCCRxBuf, 1);
+
+  return(SICE_NO_ERROR);
+
+#else
+
+  SICE_VERBOSE(3, "Warning: SICE_UCC_ReleasePacket() called, but UCC disabled\n");
+  return (SICE_CONFIG_ERROR);
+
+#endif
+}
+
+/**
+ * \fn SICE_FUNC_RET SICE_UCC_GetQueueStats(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              BOOL boTxQueue,
+ *              ULONG* pulDropCnt,
+ *              ULONG* pulHighWater
+ *          )
+ *
+ * \public
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[in]       boTxQueue       TRUE for transmit ring buffer, FALSE for
+ *                                  receive ring buffer
+ * \param[out]      pulDropCnt      Number of packets dropped due to full ring
+ * \param[out]      pulHighWater    Maximum fill level of ring (packets)
+ *
+ * \brief   Returns the statistics of a UCC ring buffer.
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:        No error
+ *          - SICE_CONFIG_ERROR:    UCC not enabled
+ *          - SICE_PARAMETER_ERROR: For function parameter error
+ *
+ * \ingroup SICE_UCC
+ */
+SICE_FUNC_RET SICE_UCC_GetQueueStats
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      BOOL boTxQueue,
+      ULONG* pulDropCnt,
+      ULONG* pulHighWater
+    )
+{
+#ifdef SICE_UC_CHANNEL
+
+  SICE_UCC_PACKET_BUF* prRing = NULL;
+
+  if (
+      (prSiceInstance == NULL)  ||
+      (pulDropCnt == NULL)      ||
+      (pulHighWater == NULL)
+    )
+  {
+    return(SICE_PARAMETER_ERROR);
+  }
+
+  prRing = (boTxQueue) ? &prSiceInstance->rUCCTxBuf : &prSiceInstance->rUCCRxBuf;
+
+  *pulDropCnt   = SICE_LOAD_ACQUIRE(&prRing->ulDropCnt);
+  *pulHighWater = SICE_LOAD_ACQUIRE(&prRing->ulHighWater);
+
+  return(SICE_NO_ERROR);
+
+#else
+
+  SICE_VERBOSE(3, "Warning: SICE_UCC_GetQueueStats() called, but UCC disabled\n");
+  return (SICE_CONFIG_ERROR);
+
+#endif
+}
+
+/**
+ * \fn VOID SICE_UCC_RingReset(
+ *              SICE_UCC_PACKET_BUF *prRing
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prRing  Pointer to UCC ring buffer
+ *
+ * \brief   Empties the ring buffer and clears its statistics. Must not be
+ *          called while producer or consumer are active.
+ *
+ * \return  None
+ *
+ * \ingroup SICE_UCC
+ */
+VOID SICE_UCC_RingReset
+    (
+      SICE_UCC_PACKET_BUF *prRing
+    )
+{
+  prRing->ulDropCnt   = 0;
+  prRing->ulHighWater = 0;
+  prRing->ulTail      = 0;
+  SICE_STORE_RELEASE(&prRing->ulHead, (ULONG) 0);
+}
+
+/**
+ * \fn SICE_UCC_PACKET_SLOT* SICE_UCC_RingReserve(
+ *              SICE_UCC_PACKET_BUF *prRing
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prRing  Pointer to UCC ring buffer
+ *
+ * \brief   Producer side: returns the next free slot without publishing it.
+ *          The slot is published by SICE_UCC_RingCommit().
+ *
+ * \return  Pointer to free slot, NULL in case the ring is full
+ *
+ * \ingroup SICE_UCC
+ */
+SICE_UCC_PACKET_SLOT* SICE_UCC_RingReserve
+    (
+      SICE_UCC_PACKET_BUF *prRing
+    )
+{
+  ULONG ulHead = prRing->ulHead;
+
+  // Acquire pairs with the release in SICE_UCC_RingRelease(), so that the
+  // consumer has finished reading the slot before it is overwritten
+  if ((ulHead - SICE_LOAD_ACQUIRE(&prRing->ulTail)) >= (ULONG) SICE_UCC_BUF_SIZE)
+  {
+    return(NULL);
+  }
+
+  return(&prRing->arSlot[ulHead & ((ULONG) SICE_UCC_BUF_SIZE - 1)]);
+}
+
+/**
+ * \fn VOID SICE_UCC_RingCommit(
+ *              SICE_UCC_PACKET_BUF *prRing
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prRing  Pointer to UCC ring buffer
+ *
+ * \brief   Producer side: publishes the slot returned by
+ *          SICE_UCC_RingReserve() to the consumer and updates the high
+ *          watermark.
+ *
+ * \return  None
+ *
+ * \ingroup SICE_UCC
+ */
+VOID SICE_UCC_RingCommit
+    (
+      SICE_UCC_PACKET_BUF *prRing
+    )
+{
+  ULONG ulHead  = prRing->ulHead + 1;
+  ULONG ulLevel = ulHead - SICE_LOAD_ACQUIRE(&prRing->ulTail);
+
+  if (ulLevel > prRing->ulHighWater)
+  {
+    prRing->ulHighWater = ulLevel;
+  }
+
+  // Release makes the slot content visible before the new head
+  SICE_STORE_RELEASE(&prRing->ulHead, ulHead);
+}
+
+/**
+ * \fn SICE_UCC_PACKET_SLOT* SICE_UCC_RingPeek(
+ *              SICE_UCC_PACKET_BUF *prRing,
+ *              ULONG ulOffset
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prRing      Pointer to UCC ring buffer
+ * \param[in]       ulOffset    Offset of slot relative to oldest packet
+ *
+ * \brief   Consumer side: returns a published slot without releasing it.
+ *          Several slots may be peeked before they are released together by
+ *          SICE_UCC_RingRelease().
+ *
+ * \return  Pointer to slot, NULL in case there is no such packet
+ *
+ * \ingroup SICE_UCC
+ */
+SICE_UCC_PACKET_SLOT* SICE_UCC_RingPeek
+    (
+      SICE_UCC_PACKET_BUF *prRing,
+      ULONG ulOffset
+    )
+{
+  ULONG ulTail = prRing->ulTail;
+
+  // Acquire pairs with the release in SICE_UCC_RingCommit()
+  if ((SICE_LOAD_ACQUIRE(&prRing->ulHead) - ulTail) <= ulOffset)
+  {
+    return(NULL);
+  }
+
+  return(&prRing->arSlot[(ulTail + ulOffset) & ((ULONG) SICE_UCC_BUF_SIZE - 1)]);
+}
+
+/**
+ * \fn VOID SICE_UCC_RingRelease(
+ *              SICE_UCC_PACKET_BUF *prRing,
+ *              ULONG ulNum
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prRing  Pointer to UCC ring buffer
+ * \param[in]       ulNum   Number of slots to release
+ *
+ * \brief   Consumer side: hands the oldest ulNum slots back to the producer.
+ *
+ * \return  None
+ *
+ * \ingroup SICE_UCC
+ */
+VOID SICE_UCC_RingRelease
+    (
+      SICE_UCC_PACKET_BUF *prRing,
+      ULONG ulNum
+    )
+{
+  SICE_STORE_RELEASE(&prRing->ulTail, prRing->ulTail + ulNum);
+}
+
+/**
+ * \fn ULONG SICE_UCC_RingLevel(
+ *              SICE_UCC_PACKET_BUF *prRing
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prRing  Pointer to UCC ring buffer
+ *
+ * \brief   Returns the number of published packets in the ring buffer.
+ *
+ * \return  Number of packets
+ *
+ * \ingroup SICE_UCC
+ */
+ULONG SICE_UCC_RingLevel
+    (
+      SICE_UCC_PACKET_BUF *prRing
+    )
+{
+  return(SICE_LOAD_ACQUIRE(&prRing->ulHead) - SICE_LOAD_ACQUIRE(&prRing->ulTail));
+}
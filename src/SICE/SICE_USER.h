@@ -84,6 +84,28 @@
  */
 #define SICE_WAIT_RX_AFTER_TX       (0)
 
+/**
+ * \def     SICE_RX_BUSY_POLL
+ *
+ * \brief   If defined in the mode SICE_CALL_RX_RIGHT_AFTER_TX, reception is
+ *          repeated after transmission until all enabled ATs of the cycle
+ *          have been received or the deadline (maximum ring delay plus
+ *          SICE_RX_BUSY_POLL_MARGIN) has passed. Thereby, the AT data is
+ *          available in the same cycle. The arrival time of each telegram is
+ *          recorded in aulRxArrivalNs of the SICE instance.
+ *
+ * \attention The CPU is busy during the ring delay of each cycle.
+ */
+#undef SICE_RX_BUSY_POLL
+
+/**
+ * \def     SICE_RX_BUSY_POLL_MARGIN
+ *
+ * \brief   Time in ns added to the ring delay for the busy-poll deadline to
+ *          cover the transmission duration and the software latency.
+ */
+#define SICE_RX_BUSY_POLL_MARGIN    (20 * 1000)
+
 /**
  * \def     SICE_LINE_BREAK_SENS
  *
@@ -131,6 +153,159 @@
  */
 #undef SICE_USE_NIC_TIMED_TX
 
+/**
+ * \def     SICE_TX_BATCH
+ *
+ * \brief   If defined, the MDT and AT telegrams of a Sercos cycle are queued
+ *          and handed over to the RTOS abstraction layer as one batch
+ *          (RTOS_TxPacketBatch()) instead of one call per telegram and port.
+ *          The transmission order is kept. Ignored in case the NIC-timed
+ *          transmission mode is being used.
+ */
+#undef SICE_TX_BATCH
+
+/**
+ * \def     SICE_TX_INCREMENTAL
+ *
+ * \brief   If defined, the send frames are kept from cycle to cycle and only
+ *          the TX RAM data that has changed since the previous cycle is
+ *          copied into them. CoSeMa marks changed connection data in the TX
+ *          RAM change tracking (CSMD_HAL_WriteTxRam()), all other data is
+ *          copied in every cycle. All data is copied after changes of the
+ *          communication phase, of the descriptors, of the enabled packets
+ *          and of the TX buffer of system A. If not defined, CoSeMa writes
+ *          the TX RAM without change tracking.
+ *
+ * \note    Not yet validated with real Sercos slaves.
+ */
+#undef SICE_TX_INCREMENTAL
+
+/**
+ * \def     SICE_TX_SHARED_PAYLOAD
+ *
+ * \brief   If defined in redundancy mode (SICE_REDUNDANCY), the payload of a
+ *          telegram is only built for port P. Port S gets its own header and
+ *          reuses the payload of port P, the packet is gathered from both
+ *          parts at transmission. Telegrams with port-specific data or CC
+ *          data are copied from port P and only the port-specific parts are
+ *          patched. Requires SICE_TX_BATCH, not available in NIC-timed
+ *          transmission mode.
+ */
+#undef SICE_TX_SHARED_PAYLOAD
+
+/**
+ * \def     SICE_WIRE_THREAD
+ *
+ * \brief   If defined, the Sercos telegrams are transmitted and received by a
+ *          dedicated wire thread of SICE instead of the thread calling
+ *          SICE_Cycle_Start() and SICE_Cycle_Prepare(). The calling thread
+ *          hands over the telegrams of a cycle and takes over the telegrams
+ *          received in the latest cycle through lock-free triple buffers,
+ *          see SICE_WIRE.c. The wire thread transmits at absolute deadlines
+ *          with the Sercos cycle time and receives until all ATs have
+ *          returned or the maximum ring delay plus SICE_RX_BUSY_POLL_MARGIN
+ *          has passed. Requires SICE_TX_BATCH, not available in NIC-timed
+ *          transmission mode, with SICE_CALL_RX_RIGHT_AFTER_TX or with
+ *          SICE_MEASURE_RDLY.
+ *
+ * \attention The wire thread is busy during the ring delay of each cycle, so
+ *            it should have a CPU core of its own (SICE_WIRE_THREAD_CORE).
+ */
+#undef SICE_WIRE_THREAD
+
+/**
+ * \def     SICE_WIRE_THREAD_CORE
+ *
+ * \brief   CPU core the wire thread is pinned to, -1 for no pinning.
+ */
+#define SICE_WIRE_THREAD_CORE           (-1)
+
+/**
+ * \def     SICE_WIRE_TX_DELAY
+ *
+ * \brief   Time in ns between the first handover of telegrams and the first
+ *          transmission by the wire thread. It defines the phase of the wire
+ *          thread relative to the calling thread and has to cover the jitter
+ *          of the calling thread.
+ */
+#define SICE_WIRE_TX_DELAY              (50 * 1000)
+
+/**
+ * \def     SICE_WIRE_RX_FRAMES
+ *
+ * \brief   Maximum number of frames received by the wire thread in one cycle.
+ *          Further frames of the cycle are dropped.
+ */
+#define SICE_WIRE_RX_FRAMES             (32)
+
+/**
+ * \def     SICE_MEASURE_RDLY
+ *
+ * \brief   If defined, the ring delay is measured from the transmit timestamp
+ *          of MDT0 to the receive timestamp of the returning MDT0 instead of
+ *          being calculated from the delays given in CSMD_USER.h. Requires
+ *          RTOS_TIMESTAMPING. Not available in NIC-timed transmission mode.
+ */
+#undef SICE_MEASURE_RDLY
+
+/**
+ * \def     SICE_RDLY_FILTER_LEN
+ *
+ * \brief   Number of ring delay samples a median is taken over. The
+ *          calculated ring delay is used until the first SICE_RDLY_FILTER_LEN
+ *          samples have been collected.
+ */
+#define SICE_RDLY_FILTER_LEN            (16)
+
+/**
+ * \def     SICE_RDLY_MAX_NS
+ *
+ * \brief   Upper limit of a plausible ring delay sample in ns. Larger
+ *          samples (e.g. telegrams lost and a stale timestamp) are discarded.
+ */
+#define SICE_RDLY_MAX_NS                (100 * 1000)
+
+/**
+ * \def     SICE_SERCOS_TIME_TAI
+ *
+ * \brief   If defined, the Sercos time is disciplined to CLOCK_TAI of the
+ *          master. When CoSeMa sets the Sercos time, it is stepped to
+ *          CLOCK_TAI instead, afterwards deviations are corrected by adjusting
+ *          the increment per cycle. For drives and PTP timestamps of other
+ *          devices to agree, CLOCK_TAI has to be synchronized to the PTP
+ *          hardware clock (PHC), e.g. with phc2sys.
+ *
+ * \note    CLOCK_TAI is sampled in SICE_Cycle_Prepare(). The minimum latency
+ *          of the calling thread relative to the cycle start remains as a
+ *          constant offset.
+ */
+#undef SICE_SERCOS_TIME_TAI
+
+/**
+ * \def     SICE_SERCOS_TIME_TAI_WINDOW
+ *
+ * \brief   Number of cycles the minimum offset between CLOCK_TAI and the
+ *          Sercos time is taken over. The offset is corrected during the
+ *          following window.
+ */
+#define SICE_SERCOS_TIME_TAI_WINDOW     (64)
+
+/**
+ * \def     SICE_SERCOS_TIME_TAI_STEP_NS
+ *
+ * \brief   Offset between CLOCK_TAI and the Sercos time in ns above which the
+ *          Sercos time is stepped instead of being corrected gradually.
+ */
+#define SICE_SERCOS_TIME_TAI_STEP_NS    (1000 * 1000)
+
+/**
+ * \def     SICE_SERCOS_TIME_TAI_MAX_PPM
+ *
+ * \brief   Maximum correction of the Sercos time increment per cycle in ppm
+ *          of the cycle time when disciplined to CLOCK_TAI.
+ */
+#define SICE_SERCOS_TIME_TAI_MAX_PPM    (500)
+
 /**
  * \def     SICE_REDUNDANCY
  *
@@ -192,10 +367,40 @@
  *
  * \brief   Buffer size (number of packets) of UCC buffer, each for transmit
  *          and receive buffer. For each packet, SICE_ETH_FRAMEBUF_LEN bytes
- *          are allocated.
+ *          are allocated. Has to be a power of two.
  */
 #define SICE_UCC_BUF_SIZE               (64)
 
+/**
+ * \def     SICE_DESC_PLAN_MAX_SEG
+ *
+ * \brief   Maximum number of copy segments of a compiled descriptor plan,
+ *          each for transmit (all MDTs and ATs) and receive (all ATs).
+ *          Adjacent descriptor pairs are merged into a single segment, so
+ *          usually far less segments than descriptor pairs are needed.
+ */
+#define SICE_DESC_PLAN_MAX_SEG          (512)
+
+/**
+ * \def     SICE_DESC_PLAN_MAX_DESC
+ *
+ * \brief   Maximum number of descriptors covered by a compiled descriptor
+ *          plan, each for transmit and receive. The descriptors are kept as
+ *          a shadow copy in order to detect changes of the descriptor RAM.
+ */
+#define SICE_DESC_PLAN_MAX_DESC         (1024)
+
+/**
+ * \def     SICE_CRC32_HW_ACCEL
+ *
+ * \brief   If defined, the CRC32 checksum of Sercos headers is calculated
+ *          using CPU instructions if they are available at runtime: carry-less
+ *          multiplication (PCLMULQDQ) on x86-64 and the CRC32 instructions on
+ *          ARMv8 (AArch64). Otherwise, a table-based slice-by-8 calculation is
+ *          used.
+ */
+#define SICE_CRC32_HW_ACCEL
+
 /**
  * \def     SICE_MEASURE_TIMING
  *
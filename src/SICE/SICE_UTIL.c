@@ -54,6 +54,7 @@
 #include "../SICE/SICE_GLOB.h"
 #include "../SICE/SICE_PRIV.h"
 
+#include "../CSMD/CSMD_HAL_PRIV.h"
 #include "../CSMD/CSMD_BM_CFG.h"
 #include "../CSMD/CSMD_CALC.h"
 
@@ -207,6 +208,190 @@ SICE_FUNC_RET SICE_CheckTimingMethod
   }
 }
 
+/**
+ * \fn VOID SICE_UpdateSercosTime(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ *
+ * \brief   This function counts up the Sercos time by one cycle and updates
+ *          the system time registers.
+ *
+ * \details The Sercos time is counted as 64-bit nanoseconds in the SICE
+ *          instance. It is loaded from the system time registers when the
+ *          Sercos time is enabled in TCSR or when CoSeMa signals a new time
+ *          by the toggle bit. The increment is taken over from TCNTCYCR only
+ *          when the cycle time changes. With SICE_SERCOS_TIME_TAI, the time
+ *          is stepped to CLOCK_TAI when loaded. The minimum offset to
+ *          CLOCK_TAI over SICE_SERCOS_TIME_TAI_WINDOW cycles is corrected
+ *          gradually by adjusting the increment.
+ *
+ * \return  None
+ *
+ * \ingroup SICE
+ */
+VOID SICE_UpdateSercosTime
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    )
+{
+  SICE_SERCOS_TIME_STRUCT*  prTime = &prSiceInstance->rSercosTime;
+  ULONG                     ulToggle;
+  ULONGLONG                 ullSeconds;
+#ifdef SICE_SERCOS_TIME_TAI
+  LONGLONG                  llOffsetNs;
+  LONGLONG                  llMaxCorrNs;
+  LONG                      lCorrNs;
+  BOOL                      boStep      = FALSE;
+#endif
+
+  // Is ET3 / EST for Sercos system time enabled?
+  if (
+      (prSiceInstance->prReg->ulTCSR & (((ULONG)1) << CSMD_HAL_TCSR_EST))
+      == ((ULONG) 0)
+    )
+  {
+    prTime->boRunning = FALSE;
+    return;
+  }
+
+  ulToggle = prSiceInstance->prReg->ulTCSR & (((ULONG)1) << CSMD_HAL_TCSR_SYS_TIME_TOGGLE);
+
+  // Load Sercos time set by CoSeMa
+  if (!prTime->boRunning || (ulToggle != prTime->ulToggle))
+  {
+    prTime->ullTimeNs =
+        (ULONGLONG)prSiceInstance->prReg->ulSTSEC * SICE_NSEC_PER_SEC +
+        prSiceInstance->prReg->ulSTNS;
+    prTime->ullTimePNs =
+        (ULONGLONG)prSiceInstance->prReg->ulSTSECP * SICE_NSEC_PER_SEC +
+        prSiceInstance->prReg->ulSTNSP;
+    prTime->ulToggle  = ulToggle;
+    prTime->boRunning = TRUE;
+
+#ifdef SICE_SERCOS_TIME_TAI
+    // Step to CLOCK_TAI below
+    prTime->ulWindowCnt = 0;
+    prTime->llPendingNs = 0;
+    prTime->lCorrNs     = 0;
+    boStep              = TRUE;
+#endif
+  }
+
+  // Increment per cycle
+  if (prTime->ulCycleTimeNs != prSiceInstance->prReg->ulTCNTCYCR)
+  {
+    prTime->ulCycleTimeNs = prSiceInstance->prReg->ulTCNTCYCR;
+    prTime->ulIncNs       = prTime->ulCycleTimeNs;
+  }
+
+  prTime->ullTimeNs  += prTime->ulIncNs;
+  prTime->ullTimePNs += prTime->ulIncNs;
+
+#ifdef SICE_SERCOS_TIME_TAI
+  // Apply pending correction
+  lCorrNs = prTime->lCorrNs;
+  if (
+      ((lCorrNs > 0) && ((LONGLONG)lCorrNs > prTime->llPendingNs)) ||
+      ((lCorrNs < 0) && ((LONGLONG)lCorrNs < prTime->llPendingNs))
+    )
+  {
+    lCorrNs = (LONG)prTime->llPendingNs;
+  }
+  prTime->ullTimeNs   += (ULONGLONG)(LONGLONG)lCorrNs;
+  prTime->ullTimePNs  += (ULONGLONG)(LONGLONG)lCorrNs;
+  prTime->llPendingNs -= lCorrNs;
+
+  // Offset to CLOCK_TAI once the pending correction has been applied. The
+  // minimum over the window excludes the latency of the calling thread.
+  llOffsetNs =
+      (LONGLONG)(RTOS_GetTaiTime() - prTime->ullTimeNs) - prTime->llPendingNs;
+
+  if (boStep)
+  {
+    // Step to CLOCK_TAI, keep offset of pre-calculated time
+    prTime->ullTimeNs  += (ULONGLONG)llOffsetNs;
+    prTime->ullTimePNs += (ULONGLONG)llOffsetNs;
+    llOffsetNs          = 0;
+  }
+
+  if ((prTime->ulWindowCnt == 0) || (llOffsetNs < prTime->llMinOffsetNs))
+  {
+    prTime->llMinOffsetNs = llOffsetNs;
+  }
+
+  if (++prTime->ulWindowCnt >= (ULONG)SICE_SERCOS_TIME_TAI_WINDOW)
+  {
+    prTime->ulWindowCnt  = 0;
+    prTime->llPendingNs += prTime->llMinOffsetNs;
+
+    if (
+        (prTime->llPendingNs > (LONGLONG)SICE_SERCOS_TIME_TAI_STEP_NS) ||
+        (prTime->llPendingNs < -(LONGLONG)SICE_SERCOS_TIME_TAI_STEP_NS)
+      )
+    {
+      SICE_VERBOSE
+          (
+            0,
+            "Sercos time stepped by %lld ns to CLOCK_TAI\n",
+            prTime->llPendingNs
+          );
+
+      prTime->ullTimeNs  += (ULONGLONG)prTime->llPendingNs;
+      prTime->ullTimePNs += (ULONGLONG)prTime->llPendingNs;
+      prTime->llPendingNs = 0;
+
+      // Declare new Sercos time by toggling TCSR bit
+      prSiceInstance->prReg->ulTCSR ^= (((ULONG)1) << CSMD_HAL_TCSR_SYS_TIME_TOGGLE);
+      prTime->ulToggle =
+          prSiceInstance->prReg->ulTCSR & (((ULONG)1) << CSMD_HAL_TCSR_SYS_TIME_TOGGLE);
+    }
+
+    // Spread correction over the next window, limited in rate
+    llMaxCorrNs =
+        ((LONGLONG)prTime->ulCycleTimeNs * SICE_SERCOS_TIME_TAI_MAX_PPM) / 1000000 + 1;
+
+    prTime->lCorrNs = (LONG)(prTime->llPendingNs / SICE_SERCOS_TIME_TAI_WINDOW);
+    if (prTime->lCorrNs > llMaxCorrNs)
+    {
+      prTime->lCorrNs = (LONG)llMaxCorrNs;
+    }
+    else if (prTime->lCorrNs < -llMaxCorrNs)
+    {
+      prTime->lCorrNs = (LONG)-llMaxCorrNs;
+    }
+    else if ((prTime->lCorrNs == 0) && (prTime->llPendingNs != 0))
+    {
+      prTime->lCorrNs = (prTime->llPendingNs > 0) ? 1 : -1;
+    }
+  }
+#endif
+
+  // System timer registers
+  ullSeconds = prTime->ullTimeNs / SICE_NSEC_PER_SEC;
+  prSiceInstance->prReg->ulSTSEC = (ULONG)ullSeconds;
+  prSiceInstance->prReg->ulSTNS  =
+      (ULONG)(prTime->ullTimeNs - ullSeconds * SICE_NSEC_PER_SEC);
+
+  SICE_VERBOSE
+      (
+        2,
+        "SICE time: %u:%u\n",
+        prSiceInstance->prReg->ulSTSEC,
+        prSiceInstance->prReg->ulSTNS
+      );
+
+  // Pre-calculated system timer registers
+  ullSeconds = prTime->ullTimePNs / SICE_NSEC_PER_SEC;
+  prSiceInstance->prReg->ulSTSECP = (ULONG)ullSeconds;
+  prSiceInstance->prReg->ulSTNSP  =
+      (ULONG)(prTime->ullTimePNs - ullSeconds * SICE_NSEC_PER_SEC);
+}
+
 #ifdef CSMD_HW_WATCHDOG
 /**
  * \fn SICE_FUNC_RET SICE_UpdateWatchdogStatus(
@@ -472,6 +657,10 @@ SICE_FUNC_RET SICE_UpdateWatchdogStatus
  * \note    As a fixed single line topology is assumed, the ring delay for the
  *          second port is always set to 0.
  *
+ * \note    With SICE_MEASURE_RDLY, the median of the measured samples (see
+ *          SICE_UpdateRdlySamples()) plus the MST delay is used for a port
+ *          as soon as SICE_RDLY_FILTER_LEN samples are available.
+ *
  * \author  GMy
  *
  * \ingroup SICE
@@ -524,6 +713,24 @@ SICE_FUNC_RET SICE_CalcRingDelay(SICE_INSTANCE_STRUCT *prSiceInstance)
 
 #endif
 
+#ifdef SICE_MEASURE_RDLY
+  // Replace calculated value by measured one once the filter is filled
+  if (prSiceInstance->arRdlyMeas[SICE_ETH_PORT_P].usNum == (USHORT) SICE_RDLY_FILTER_LEN)
+  {
+    prSiceInstance->prReg->ulRDLY1 =
+        ((ULONG) CSMD_MST_DELAY) +
+        SICE_GetRdlyMedian(&prSiceInstance->arRdlyMeas[SICE_ETH_PORT_P]);
+  }
+  #ifdef SICE_REDUNDANCY
+  if (prSiceInstance->arRdlyMeas[SICE_ETH_PORT_S].usNum == (USHORT) SICE_RDLY_FILTER_LEN)
+  {
+    prSiceInstance->prReg->ulRDLY2 =
+        ((ULONG) CSMD_MST_DELAY) +
+        SICE_GetRdlyMedian(&prSiceInstance->arRdlyMeas[SICE_ETH_PORT_S]);
+  }
+  #endif
+#endif
+
   SICE_VERBOSE
       (
         2,
@@ -535,6 +742,312 @@ SICE_FUNC_RET SICE_CalcRingDelay(SICE_INSTANCE_STRUCT *prSiceInstance)
   return(SICE_NO_ERROR);
 }
 
+/**
+ * \fn SICE_FUNC_RET SICE_SwitchBufferSysA(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ *
+ * \brief   This function emulates the buffer switching of RX and TX buffer
+ *          system A of the Sercos master IP core for single, double and triple
+ *          buffering. It has to be called once per cycle before reception and
+ *          transmission.
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:            Success
+ *          - SICE_BUFFER_ERROR:        Unsupported buffer count
+ *
+ * \details TX: When CoSeMa has requested a new buffer, the buffer written by
+ *          CoSeMa in the last cycle is transmitted from now on and CoSeMa
+ *          gets the next buffer.
+ *          RX: When new data has been received in the last cycle, the
+ *          received buffer stays usable for CoSeMa (see SICE_CopyRxData())
+ *          and the next buffer is written. As the emulation receives and
+ *          transmits synchronously to the CoSeMa cycle, a triple buffer system
+ *          behaves like a double buffer system.
+ *
+ * \ingroup SICE
+ */
+SICE_FUNC_RET SICE_SwitchBufferSysA
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    )
+{
+  ULONG   ulRxBufCnt;
+  ULONG   ulTxBufCnt;
+  ULONG   ulTxBufUsable;
+  ULONG   ulNewData;
+  INT     iPort;
+
+  SICE_VERBOSE(3, "SICE_SwitchBufferSysA()\n");
+
+  ulRxBufCnt = prSiceInstance->prReg->ulRXBUFCSR_A & ((ULONG) CSMD_HAL_RXBUFCSR_COUNT_MASK);
+  ulTxBufCnt = prSiceInstance->prReg->ulTXBUFCSR_A & ((ULONG) CSMD_HAL_TXBUFCSR_COUNT_MASK);
+
+  if  (
+      (ulRxBufCnt > (ULONG) CSMD_HAL_TRIPLE_BUFFER_SYSTEM) ||
+      (ulTxBufCnt > (ULONG) CSMD_HAL_TRIPLE_BUFFER_SYSTEM)
+    )
+  {
+    SICE_VERBOSE
+        (
+          0,
+          "Error: Only single, double or triple buffering is supported "
+          "by SICE.\n"
+        );
+
+    return(SICE_BUFFER_ERROR);
+  }
+
+  // RX buffer system A
+  for (
+      iPort = 0;
+      iPort < SICE_REDUNDANCY_VAL;
+      iPort++
+    )
+  {
+    if (iPort == 0)
+    {
+      ulNewData = (ULONG) CSMD_HAL_RXBUFCSR_NEW_DATA_P1;
+    }
+    else
+    {
+      ulNewData = (ULONG) CSMD_HAL_RXBUFCSR_NEW_DATA_P2;
+    }
+
+    if ((prSiceInstance->prReg->ulRXBUFCSR_A & ulNewData) != (ULONG) 0)
+    {
+      prSiceInstance->ausRxBufSysA[iPort]++;
+    }
+
+    if ((ULONG) prSiceInstance->ausRxBufSysA[iPort] > ulRxBufCnt)
+    {
+      prSiceInstance->ausRxBufSysA[iPort] = 0;
+    }
+  }
+
+  // New data is signaled again by SICE_CopyRxData(), the request of CoSeMa
+  // is always served with the latest received buffer
+  prSiceInstance->prReg->ulRXBUFCSR_A &= ~((ULONG) (CSMD_HAL_RXBUFCSR_NEW_DATA_P1 |
+                                                    CSMD_HAL_RXBUFCSR_NEW_DATA_P2 |
+                                                    CSMD_HAL_RXBUFCSR_REQ_BUFFER));
+
+  // TX buffer system A
+  if ((prSiceInstance->prReg->ulTXBUFCSR_A & ((ULONG) CSMD_HAL_TXBUFCSR_REQ_BUFFER)) != (ULONG) 0)
+  {
+    ulTxBufUsable = (prSiceInstance->prReg->ulTXBUFCSR_A & ((ULONG) CSMD_HAL_TXBUFCSR_ACT_BUF_MASK))
+                      >> CSMD_HAL_TXBUFCSR_ACT_BUF_SHIFT;
+
+    prSiceInstance->usTxBufSysA = (USHORT) ulTxBufUsable;
+
+    ulTxBufUsable++;
+
+    if (ulTxBufUsable > ulTxBufCnt)
+    {
+      ulTxBufUsable = 0;
+    }
+
+    prSiceInstance->prReg->ulTXBUFCSR_A =
+        (prSiceInstance->prReg->ulTXBUFCSR_A &
+            ~((ULONG) (CSMD_HAL_TXBUFCSR_ACT_BUF_MASK | CSMD_HAL_TXBUFCSR_REQ_BUFFER))) |
+        (ulTxBufUsable << CSMD_HAL_TXBUFCSR_ACT_BUF_SHIFT);
+  }
+
+  if ((ULONG) prSiceInstance->usTxBufSysA > ulTxBufCnt)
+  {
+    prSiceInstance->usTxBufSysA = 0;
+  }
+
+  return(SICE_NO_ERROR);
+}
+
+#ifdef SICE_MEASURE_RDLY
+/**
+ * \fn VOID SICE_StoreRdlyRxStamp(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              INT iRxPort,
+ *              INT iTxPort
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[in]       iRxPort         Port MDT0 has been received on
+ * \param[in]       iTxPort         Port MDT0 has been transmitted on
+ *
+ * \brief   This function stores the receive timestamp of the MDT0 just
+ *          received for the ring delay measurement.
+ *
+ * \note    The latest MDT0 of a cycle is kept, so that an own transmitted
+ *          MDT0 seen by the receive socket is superseded by the returning
+ *          one.
+ *
+ * \ingroup SICE
+ */
+VOID SICE_StoreRdlyRxStamp
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      INT iRxPort,
+      INT iTxPort
+    )
+{
+  ULONGLONG ullStampNs = 0;
+
+  if ((iTxPort < 0) || (iTxPort >= SICE_REDUNDANCY_VAL))
+  {
+    return;
+  }
+
+  if (RTOS_GetRxTimestamp(prSiceInstance->iInstanceNo, iRxPort, &ullStampNs) > 0)
+  {
+    prSiceInstance->arRdlyMeas[iTxPort].ullRxStampNs = ullStampNs;
+  }
+}
+
+/**
+ * \fn VOID SICE_UpdateRdlySamples(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ *
+ * \brief   This function takes one ring delay sample per port from the
+ *          transmit timestamp of the MDT0 of the previous cycle and the
+ *          receive timestamp of the returned MDT0. Has to be called before
+ *          the telegrams of the current cycle are transmitted.
+ *
+ * \ingroup SICE
+ */
+VOID SICE_UpdateRdlySamples
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    )
+{
+  SICE_RDLY_MEAS_STRUCT*  prRdlyMeas;
+  ULONGLONG               ullTxStampNs = 0;
+  INT                     iPort;
+
+  for (
+      iPort = 0;
+      iPort < SICE_REDUNDANCY_VAL;
+      iPort++
+    )
+  {
+    prRdlyMeas = &prSiceInstance->arRdlyMeas[iPort];
+
+    // First packet transmitted in previous cycle is MDT0
+    if (
+        (RTOS_GetTxTimestamp(prSiceInstance->iInstanceNo, iPort, &ullTxStampNs) > 0) &&
+        (prRdlyMeas->ullRxStampNs > ullTxStampNs) &&
+        ((prRdlyMeas->ullRxStampNs - ullTxStampNs) < (ULONGLONG) SICE_RDLY_MAX_NS)
+      )
+    {
+      prRdlyMeas->aulSample[prRdlyMeas->usIdx] =
+          (ULONG) (prRdlyMeas->ullRxStampNs - ullTxStampNs);
+
+      prRdlyMeas->usIdx = (USHORT) ((prRdlyMeas->usIdx + 1) % SICE_RDLY_FILTER_LEN);
+
+      if (prRdlyMeas->usNum < (USHORT) SICE_RDLY_FILTER_LEN)
+      {
+        prRdlyMeas->usNum++;
+      }
+    }
+
+    prRdlyMeas->ullRxStampNs = 0;
+  }
+}
+
+/**
+ * \fn ULONG SICE_GetRdlyMedian(
+ *              SICE_RDLY_MEAS_STRUCT *prRdlyMeas
+ *          )
+ *
+ * \private
+ *
+ * \param[in]   prRdlyMeas  Pointer to ring delay measurement of port
+ *
+ * \brief   This function returns the median of the ring delay samples. The
+ *          median is used instead of the mean to suppress the outliers caused
+ *          by the scheduling jitter of the soft master.
+ *
+ * \return  Median ring delay in ns, 0 if there are no samples
+ *
+ * \ingroup SICE
+ */
+ULONG SICE_GetRdlyMedian
+    (
+      SICE_RDLY_MEAS_STRUCT *prRdlyMeas
+    )
+{
+  ULONG   aulSorted[SICE_RDLY_FILTER_LEN];
+  ULONG   ulVal;
+  INT     iCnt;
+  INT     iPos;
+
+  if (prRdlyMeas->usNum == (USHORT) 0)
+  {
+    return((ULONG) 0);
+  }
+
+  // Insertion sort of copy, the window is small
+  for (
+      iCnt = 0;
+      iCnt < (INT) prRdlyMeas->usNum;
+      iCnt++
+    )
+  {
+    ulVal = prRdlyMeas->aulSample[iCnt];
+
+    for (
+        iPos = iCnt;
+        (iPos > 0) && (aulSorted[iPos - 1] > ulVal);
+        iPos--
+      )
+    {
+      aulSorted[iPos] = aulSorted[iPos - 1];
+    }
+    aulSorted[iPos] = ulVal;
+  }
+
+  return(aulSorted[prRdlyMeas->usNum / 2]);
+}
+#endif
+
+#if (defined SICE_RX_BUSY_POLL) || (defined SICE_WIRE_THREAD)
+/**
+ * \fn ULONGLONG SICE_GetTimeNs(
+ *              VOID
+ *          )
+ *
+ * \private
+ *
+ * \brief   This function returns the current system time in ns.
+ *
+ * \return  System time in ns
+ *
+ * \ingroup SICE
+ */
+ULONGLONG SICE_GetTimeNs
+    (
+      VOID
+    )
+{
+  RTOS_TIMESPEC rTime;
+
+  RTOS_GetSystemTime(&rTime);
+
+  return(((ULONGLONG) rTime.tv_sec * 1000000000ULL) + (ULONGLONG) rTime.tv_nsec);
+}
+#endif
+
 /**
  * \fn SICE_FUNC_RET SICE_IncPacketCounter(
  *              SICE_INSTANCE_STRUCT *prSiceInstance,
@@ -818,3 +1331,525 @@ ULONG SICE_CalcPacketDuration
 
   return (ulPacketDuration);
 }
+
+/**
+ * \fn VOID SICE_DescPlanStart(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              SICE_DESC_PLAN_STRUCT *prPlan
+ *          )
+ *
+ * \private
+ *
+ * \param[in]       prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[out]      prPlan          Pointer to descriptor plan
+ *
+ * \brief   This function empties a descriptor plan before compilation and
+ *          takes a snapshot of the registers the plan depends on.
+ *
+ * \return  None
+ *
+ * \ingroup SICE
+ */
+VOID SICE_DescPlanStart
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      SICE_DESC_PLAN_STRUCT *prPlan
+    )
+{
+  SICE_VERBOSE(3, "SICE_DescPlanStart()\n");
+
+  prPlan->boValid       = FALSE;
+  prPlan->ulPacketMask  = (ULONG) 0;
+  prPlan->usNumSeg      = (USHORT) 0;
+  prPlan->usNumDesc     = (USHORT) 0;
+  prPlan->usNumGap      = (USHORT) 0;
+  prPlan->ulDECR        = prSiceInstance->prReg->rDECR.ulDesIdxTableOffsets;
+
+  (VOID)memcpy
+      (
+        prPlan->aulTxBufBasePtr,
+        (VOID*) prSiceInstance->prReg->aulTxBufBasePtr,
+        sizeof(prPlan->aulTxBufBasePtr)
+      );
+
+  (VOID)memcpy
+      (
+        prPlan->aulRxBufBasePtr,
+        (VOID*) prSiceInstance->prReg->aulRxBufBasePtr,
+        sizeof(prPlan->aulRxBufBasePtr)
+      );
+
+  (VOID)memset
+      (
+        prPlan->arPkt,
+        (UCHAR)0x00,
+        sizeof(prPlan->arPkt)
+      );
+}
+
+/**
+ * \fn BOOL SICE_DescPlanFetch(
+ *              SICE_DESC_PLAN_STRUCT *prPlan,
+ *              UCHAR *pucRam,
+ *              USHORT usIndexTableOffset,
+ *              USHORT usPacketIdx,
+ *              BOOL boCheckEnable
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prPlan              Pointer to descriptor plan
+ * \param[in]       pucRam              Pointer to TX or RX RAM
+ * \param[in]       usIndexTableOffset  Offset of index table in RAM
+ * \param[in]       usPacketIdx         Packet type CSMD_DES_IDX_*
+ * \param[in]       boCheckEnable       Only fetch descriptors if enabled in
+ *                                      index table entry
+ *
+ * \brief   This function copies the index table entry and the descriptor list
+ *          of a packet to the shadow of the descriptor plan.
+ *
+ * \return
+ * - TRUE, in case the descriptor list fits into the plan
+ * - FALSE, otherwise
+ *
+ * \ingroup SICE
+ */
+BOOL SICE_DescPlanFetch
+    (
+      SICE_DESC_PLAN_STRUCT *prPlan,
+      UCHAR *pucRam,
+      USHORT usIndexTableOffset,
+      USHORT usPacketIdx,
+      BOOL boCheckEnable
+    )
+{
+  SICE_DESC_PKT_STRUCT* prPkt = &prPlan->arPkt[usPacketIdx];
+  USHORT                usCurDescOffset;
+  ULONG                 ulCurDesc;
+
+  SICE_VERBOSE(3, "SICE_DescPlanFetch()\n");
+
+  /*lint -save -e826 */
+  prPkt->ulIndexEntry =
+      *((ULONG*)  (
+              pucRam +
+              ((ULONG) usIndexTableOffset) +
+              ((ULONG) usPacketIdx) * ((ULONG) sizeof(ULONG)))
+            );
+  /*lint -restore */
+
+  prPkt->usFirstDesc  = prPlan->usNumDesc;
+  prPkt->usNumDesc    = 0;
+  prPlan->ulPacketMask |= ((ULONG) 1) << usPacketIdx;
+
+  if (  boCheckEnable &&
+        ((prPkt->ulIndexEntry & ((ULONG) SICE_TEL_DESC_ENABLE_MASK)) == (ULONG) 0))
+  {
+    return(TRUE);
+  }
+
+  usCurDescOffset = (USHORT) (prPkt->ulIndexEntry & ((ULONG) SICE_TEL_DESC_OFFSET_MASK));
+
+  do
+  {
+    if (prPlan->usNumDesc >= (USHORT) SICE_DESC_PLAN_MAX_DESC)
+    {
+      SICE_VERBOSE
+          (
+            0,
+            "Error: Descriptor list of packet #%hu exceeds "
+            "SICE_DESC_PLAN_MAX_DESC.\n",
+            usPacketIdx
+          );
+      return(FALSE);
+    }
+
+    /*lint -save -e826 */
+    ulCurDesc = *((ULONG*) (pucRam + (ULONG) usCurDescOffset));
+    /*lint -restore */
+
+    usCurDescOffset += (USHORT) sizeof(ULONG);
+
+    prPlan->aulDesc[prPlan->usNumDesc++] = ulCurDesc;
+    prPkt->usNumDesc++;
+  } while (
+      ((ulCurDesc & ((ULONG) CSMD_HAL_DES_MASK_TYPE)) >> CSMD_HAL_DES_SHIFT_TYPE)
+      != (ULONG) SICE_TEL_DESC_TYPE_END
+    );
+
+  return(TRUE);
+}
+
+/**
+ * \fn BOOL SICE_DescPlanAddSeg(
+ *              SICE_DESC_PLAN_STRUCT *prPlan,
+ *              USHORT usPacketIdx,
+ *              UCHAR* apucBuf[],
+ *              UCHAR* pucBuf2,
+ *              USHORT usFrameOffset,
+ *              USHORT usLen,
+ *              BOOL boBufSysA
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prPlan          Pointer to descriptor plan
+ * \param[in]       usPacketIdx     Packet type CSMD_DES_IDX_*
+ * \param[in]       apucBuf         Buffer per port (SICE_REDUNDANCY_VAL
+ *                                  entries), NULL if not copied
+ * \param[in]       pucBuf2         Second buffer, NULL if none
+ * \param[in]       usFrameOffset   Offset in telegram data field
+ * \param[in]       usLen           Number of bytes to be copied
+ * \param[in]       boBufSysA       apucBuf refers to buffer 0 of buffer
+ *                                  system A
+ *
+ * \brief   This function appends a copy segment to the current packet of the
+ *          descriptor plan. If the segment directly follows the previous
+ *          segment of the packet in the frame as well as in all buffers, the
+ *          previous segment is extended instead.
+ *
+ * \return
+ * - TRUE, in case the segment was added
+ * - FALSE, in case the plan is full or the segment exceeds the frame
+ *
+ * \ingroup SICE
+ */
+BOOL SICE_DescPlanAddSeg
+    (
+      SICE_DESC_PLAN_STRUCT *prPlan,
+      USHORT usPacketIdx,
+      UCHAR* apucBuf[],
+      UCHAR* pucBuf2,
+      USHORT usFrameOffset,
+      USHORT usLen,
+      BOOL boBufSysA
+    )
+{
+  SICE_DESC_PKT_STRUCT* prPkt = &prPlan->arPkt[usPacketIdx];
+  SICE_DESC_SEG_STRUCT* prSeg;
+  BOOL                  boMerge;
+  INT                   iPort;
+
+  SICE_VERBOSE(3, "SICE_DescPlanAddSeg()\n");
+
+  if (  ((ULONG) usFrameOffset + (ULONG) usLen) >
+        (ULONG) (SICE_ETH_FRAMEBUF_LEN - SICE_SERC3_TEL_HEADER))
+  {
+    SICE_VERBOSE
+        (
+          0,
+          "Error: Descriptor of packet #%hu exceeds frame (offset %hu, "
+          "length %hu).\n",
+          usPacketIdx,
+          usFrameOffset,
+          usLen
+        );
+    return(FALSE);
+  }
+
+  if (prPkt->usNumSeg == (USHORT) 0)
+  {
+    prPkt->usFirstSeg = prPlan->usNumSeg;
+  }
+  else
+  {
+    // Contiguous with previous segment?
+    prSeg   = &prPlan->arSeg[prPlan->usNumSeg - 1];
+    boMerge = ((prSeg->usFrameOffset + prSeg->usLen) == usFrameOffset) &&
+              (prSeg->boBufSysA == boBufSysA);
+
+    for (
+        iPort = 0;
+        iPort < SICE_REDUNDANCY_VAL;
+        iPort++
+      )
+    {
+      if (prSeg->apucBuf[iPort] == NULL)
+      {
+        boMerge = boMerge && (apucBuf[iPort] == NULL);
+      }
+      else
+      {
+        boMerge = boMerge && ((prSeg->apucBuf[iPort] + prSeg->usLen) == apucBuf[iPort]);
+      }
+    }
+
+    if (prSeg->pucBuf2 == NULL)
+    {
+      boMerge = boMerge && (pucBuf2 == NULL);
+    }
+    else
+    {
+      boMerge = boMerge && ((prSeg->pucBuf2 + prSeg->usLen) == pucBuf2);
+    }
+
+    if (boMerge)
+    {
+      prSeg->usLen += usLen;
+      return(TRUE);
+    }
+  }
+
+  if (prPlan->usNumSeg >= (USHORT) SICE_DESC_PLAN_MAX_SEG)
+  {
+    SICE_VERBOSE
+        (
+          0,
+          "Error: Descriptors of packet #%hu exceed "
+          "SICE_DESC_PLAN_MAX_SEG.\n",
+          usPacketIdx
+        );
+    return(FALSE);
+  }
+
+  prSeg = &prPlan->arSeg[prPlan->usNumSeg++];
+
+  for (
+      iPort = 0;
+      iPort < SICE_REDUNDANCY_VAL;
+      iPort++
+    )
+  {
+    prSeg->apucBuf[iPort] = apucBuf[iPort];
+  }
+  prSeg->pucBuf2        = pucBuf2;
+  prSeg->usFrameOffset  = usFrameOffset;
+  prSeg->usLen          = usLen;
+  prSeg->boBufSysA      = boBufSysA;
+  prPkt->usNumSeg++;
+
+  return(TRUE);
+}
+
+/**
+ * \fn VOID SICE_DescPlanBuildGaps(
+ *              SICE_DESC_PLAN_STRUCT *prPlan,
+ *              USHORT usPacketIdx,
+ *              USHORT usDataLen
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prPlan          Pointer to descriptor plan
+ * \param[in]       usPacketIdx     Packet type CSMD_DES_IDX_*
+ * \param[in]       usDataLen       Length of telegram data field to be sent
+ *
+ * \brief   This function determines for each port the parts of the telegram
+ *          data field which are not written by any copy segment of the packet.
+ *
+ * \return  None
+ *
+ * \details Only these gaps have to be filled with zeros each cycle instead of
+ *          the whole packet buffer. Gaps closer than SICE_DESC_GAP_MERGE_LEN
+ *          are joined. The number of gaps of a packet and port is at most the
+ *          number of its segments plus one, so the gap array of the plan can
+ *          not overflow.
+ *
+ * \ingroup SICE
+ */
+VOID SICE_DescPlanBuildGaps
+    (
+      SICE_DESC_PLAN_STRUCT *prPlan,
+      USHORT usPacketIdx,
+      USHORT usDataLen
+    )
+{
+  SICE_DESC_PKT_STRUCT* prPkt = &prPlan->arPkt[usPacketIdx];
+  SICE_DESC_SEG_STRUCT* prSeg;
+  SICE_DESC_GAP_STRUCT* prGap;
+  UCHAR                 aucCovered[SICE_ETH_FRAMEBUF_LEN];
+  USHORT                usSegIdx;
+  USHORT                usOffset;
+  USHORT                usStart;
+  INT                   iPort;
+
+  SICE_VERBOSE(3, "SICE_DescPlanBuildGaps()\n");
+
+  for (
+      iPort = 0;
+      iPort < SICE_REDUNDANCY_VAL;
+      iPort++
+    )
+  {
+    (VOID)memset
+        (
+          aucCovered,
+          (UCHAR)0x00,
+          usDataLen
+        );
+
+    // Mark bytes written by segments for this port
+    for (
+        usSegIdx = prPkt->usFirstSeg;
+        usSegIdx < prPkt->usFirstSeg + prPkt->usNumSeg;
+        usSegIdx++
+      )
+    {
+      prSeg = &prPlan->arSeg[usSegIdx];
+
+      if (prSeg->apucBuf[iPort] != NULL)
+      {
+        for (
+            usOffset = prSeg->usFrameOffset;
+            (usOffset < prSeg->usFrameOffset + prSeg->usLen) && (usOffset < usDataLen);
+            usOffset++
+          )
+        {
+          aucCovered[usOffset] = (UCHAR) 1;
+        }
+      }
+    }
+
+    prPkt->ausFirstGap[iPort] = prPlan->usNumGap;
+    prPkt->ausNumGap[iPort]   = (USHORT) 0;
+
+    // Collect runs of uncovered bytes
+    usOffset = 0;
+    while (usOffset < usDataLen)
+    {
+      if (aucCovered[usOffset])
+      {
+        usOffset++;
+        continue;
+      }
+
+      usStart = usOffset;
+      while ((usOffset < usDataLen) && !aucCovered[usOffset])
+      {
+        usOffset++;
+      }
+
+      prGap = &prPlan->arGap[prPlan->usNumGap - 1];
+
+      if  (
+          (prPkt->ausNumGap[iPort] > (USHORT) 0) &&
+          ((usStart - (prGap->usFrameOffset + prGap->usLen)) <= (USHORT) SICE_DESC_GAP_MERGE_LEN)
+        )
+      {
+        // Close to previous gap: one memset() including the bytes in between
+        // is cheaper, these are overwritten by the segments afterwards
+        prGap->usLen = usOffset - prGap->usFrameOffset;
+      }
+      else
+      {
+        prGap = &prPlan->arGap[prPlan->usNumGap++];
+        prGap->usFrameOffset  = usStart;
+        prGap->usLen          = usOffset - usStart;
+        prPkt->ausNumGap[iPort]++;
+      }
+    }
+  }
+}
+
+/**
+ * \fn BOOL SICE_DescPlanIsValid(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              SICE_DESC_PLAN_STRUCT *prPlan,
+ *              UCHAR *pucRam,
+ *              USHORT usIndexTableOffset,
+ *              ULONG ulPacketMask
+ *          )
+ *
+ * \private
+ *
+ * \param[in]       prSiceInstance      Pointer to Sercos SoftMaster core
+ *                                      instance
+ * \param[in]       prPlan              Pointer to descriptor plan
+ * \param[in]       pucRam              Pointer to TX or RX RAM
+ * \param[in]       usIndexTableOffset  Offset of index table in RAM
+ * \param[in]       ulPacketMask        Packets to be checked, bit per
+ *                                      CSMD_DES_IDX_*
+ *
+ * \brief   This function checks whether a compiled descriptor plan is still
+ *          up to date for the given packets.
+ *
+ * \return
+ * - TRUE, in case the plan may be used
+ * - FALSE, in case the plan has to be compiled again
+ *
+ * \details CoSeMa writes the descriptors, the index tables and the DECR
+ *          register directly to the emulated memory. As writes can not be
+ *          trapped, the plan keeps a shadow of all of them, which is compared
+ *          here. This is considerably cheaper than decoding the descriptors
+ *          again.
+ *
+ * \ingroup SICE
+ */
+BOOL SICE_DescPlanIsValid
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      SICE_DESC_PLAN_STRUCT *prPlan,
+      UCHAR *pucRam,
+      USHORT usIndexTableOffset,
+      ULONG ulPacketMask
+    )
+{
+  SICE_DESC_PKT_STRUCT* prPkt;
+  USHORT                usPacketIdx;
+  ULONG                 ulIndexEntry;
+
+  SICE_VERBOSE(3, "SICE_DescPlanIsValid()\n");
+
+  if (  (!prPlan->boValid)                                        ||
+        ((ulPacketMask & ~prPlan->ulPacketMask) != (ULONG) 0)     ||
+        (prPlan->ulDECR != prSiceInstance->prReg->rDECR.ulDesIdxTableOffsets))
+  {
+    return(FALSE);
+  }
+
+  if (  (memcmp
+          (
+            prPlan->aulTxBufBasePtr,
+            (VOID*) prSiceInstance->prReg->aulTxBufBasePtr,
+            sizeof(prPlan->aulTxBufBasePtr)
+          ) != 0)                                                 ||
+        (memcmp
+          (
+            prPlan->aulRxBufBasePtr,
+            (VOID*) prSiceInstance->prReg->aulRxBufBasePtr,
+            sizeof(prPlan->aulRxBufBasePtr)
+          ) != 0))
+  {
+    return(FALSE);
+  }
+
+  for (
+      usPacketIdx = 0;
+      usPacketIdx < 2*CSMD_MAX_TEL;
+      usPacketIdx++
+    )
+  {
+    if ((ulPacketMask & (((ULONG) 1) << usPacketIdx)) != (ULONG) 0)
+    {
+      prPkt = &prPlan->arPkt[usPacketIdx];
+
+      /*lint -save -e826 */
+      ulIndexEntry =
+          *((ULONG*)  (
+                  pucRam +
+                  ((ULONG) usIndexTableOffset) +
+                  ((ULONG) usPacketIdx) * ((ULONG) sizeof(ULONG)))
+                );
+      /*lint -restore */
+
+      if (ulIndexEntry != prPkt->ulIndexEntry)
+      {
+        return(FALSE);
+      }
+
+      if (  (prPkt->usNumDesc != (USHORT) 0) &&
+            (memcmp
+              (
+                &prPlan->aulDesc[prPkt->usFirstDesc],
+                pucRam + (ulIndexEntry & ((ULONG) SICE_TEL_DESC_OFFSET_MASK)),
+                prPkt->usNumDesc * sizeof(ULONG)
+              ) != 0))
+      {
+        return(FALSE);
+      }
+    }
+  }
+
+  return(TRUE);
+}
@@ -0,0 +1,767 @@
+/*
+ * Sercos Soft Master Core Library
+ * Version: see SICE_GLOB.h
+ * Copyright (C) 2012 - 2016 Bosch Rexroth AG
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS"; WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY;
+ * FITNESS FOR A PERTICULAR PURPOSE AND NONINFRINGEMENT. THE AUTHORS OR COPYRIGHT
+ * HOLDERS SHALL NOT BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE;
+ * UNLESS STIPULATED BY MANDATORY LAW.
+ *
+ * You may contact us at open.source@boschrexroth.de if you are interested in
+ * contributing a modification to the Software.
+ */
+
+/**
+ * \file      SICE_WIRE.c
+ *
+ * \brief     Sercos SoftMaster core: Wire thread for packet transmission and
+ *            reception
+ *
+ * \details   With SICE_WIRE_THREAD, the thread calling SICE_Cycle_Prepare()
+ *            and SICE_Cycle_Start() still emulates the IP core and builds
+ *            and evaluates the telegrams, but does not access the network.
+ *            SICE_FlushTelegrams() copies the telegrams of the cycle to a
+ *            transmit image, SICE_ReceiveTelegrams() evaluates the frames of
+ *            the latest receive image. The wire thread transmits the latest
+ *            transmit image at absolute deadlines with the Sercos cycle time
+ *            and collects the frames received afterwards in a receive image.
+ *            Both images are handed over with lock-free triple buffers, so
+ *            that neither thread ever waits for the other one.
+ *
+ *            If no new transmit image has been handed over in time, no
+ *            telegrams are transmitted at that instant rather than repeating
+ *            the previous ones. If the calling thread misses a receive image,
+ *            it is replaced by the next one.
+ *
+ * \ingroup   SICE
+ */
+
+//---- includes ---------------------------------------------------------------
+
+#include "../SICE/SICE_GLOB.h"
+#include "../SICE/SICE_PRIV.h"
+
+#ifdef __qnx__
+/*lint -save -w0 */
+#include <arpa/inet.h>
+/*lint -restore */
+#elif defined __unix__
+/*lint -save -w0 */
+#include <arpa/inet.h>
+/*lint -restore */
+#elif defined WINCE7
+/*lint -save -w0 */
+#include <Winsock.h>
+/*lint -restore */
+#elif defined WINCE
+/*lint -save -w0 */
+#include <Winsock.h>
+/*lint -restore */
+#elif defined __INTIME__
+/*lint -save -w0 */
+#include <sys/endian.h>
+/*lint -restore */
+#elif defined __RTX__
+#elif defined __VXWORKS__
+#elif defined __KITHARA__
+#elif defined WIN32
+#elif defined WIN64
+#else
+#error Operating system not supported by SICE!
+#endif
+
+#ifdef SICE_WIRE_THREAD
+
+//---- defines ----------------------------------------------------------------
+
+//---- type definitions -------------------------------------------------------
+
+//---- variable declarations --------------------------------------------------
+
+//---- function declarations --------------------------------------------------
+
+static VOID SICE_WireTriplePublish
+    (
+      SICE_WIRE_TRIPLE_STRUCT *prTriple
+    );
+
+static BOOL SICE_WireTripleFetch
+    (
+      SICE_WIRE_TRIPLE_STRUCT *prTriple
+    );
+
+static VOID SICE_WireReceive
+    (
+      SICE_WIRE_STRUCT *prWire,
+      ULONGLONG ullDeadlineNs,
+      ULONG ulExpectedAT
+    );
+
+static VOID* SICE_WireThread
+    (
+      VOID *pvArg
+    );
+
+//---- function implementations -----------------------------------------------
+
+/**
+ * \fn SICE_FUNC_RET SICE_WireStart(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ *
+ * \brief   Allocates the handover buffers and starts the wire thread. The
+ *          thread transmits as soon as the first telegrams are handed over.
+ *
+ * \return  See definition of SICE_FUNC_RET
+ *          - SICE_NO_ERROR:            No error
+ *          - SICE_MEM_ERROR:           Buffers could not be allocated
+ *          - SICE_SYSTEM_ERROR:        Thread could not be created
+ *
+ * \ingroup SICE
+ */
+SICE_FUNC_RET SICE_WireStart
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    )
+{
+  SICE_WIRE_STRUCT* prWire;
+  USHORT            usImage;
+  USHORT            usCnt;
+
+  // Zeroed and locked in RAM like the other memory used in the cycle
+  prWire = (SICE_WIRE_STRUCT*) RTOS_AllocLockedMem(sizeof(SICE_WIRE_STRUCT));
+
+  if (prWire == NULL)
+  {
+    return(SICE_MEM_ERROR);
+  }
+
+  prWire->prSiceInstance = prSiceInstance;
+
+  // Producer writes image 0, image 1 is exchanged, consumer reads image 2
+  prWire->rTxBuf.ulWrite  = 0;
+  prWire->rTxBuf.ulMiddle = 1;
+  prWire->rTxBuf.ulRead   = 2;
+  prWire->rRxBuf.ulWrite  = 0;
+  prWire->rRxBuf.ulMiddle = 1;
+  prWire->rRxBuf.ulRead   = 2;
+
+  for (
+      usImage = 0;
+      usImage < (USHORT) SICE_WIRE_NUM_BUF;
+      usImage++
+    )
+  {
+    for (
+        usCnt = 0;
+        usCnt < (USHORT) SICE_WIRE_TX_FRAMES;
+        usCnt++
+      )
+    {
+      prWire->arTxImage[usImage].apucData[usCnt] =
+          prWire->arTxImage[usImage].aaucData[usCnt];
+    }
+  }
+
+  prWire->boRunning      = TRUE;
+  prSiceInstance->prWire = prWire;
+
+  if (
+      RTOS_CreateThread
+          (
+            (VOID*)SICE_WireThread,
+            &prWire->rThread,
+            "SICE_Wire",
+            prWire
+          ) != RTOS_RET_OK
+    )
+  {
+    SICE_VERBOSE(0, "Error: Could not create wire thread!\n");
+    prSiceInstance->prWire = NULL;
+    RTOS_FreeLockedMem(prWire);
+    return(SICE_SYSTEM_ERROR);
+  }
+
+  SICE_VERBOSE
+      (
+        1,
+        "Wire thread started, size of handover buffers: %u Bytes\n",
+        (ULONG) sizeof(SICE_WIRE_STRUCT)
+      );
+
+  return(SICE_NO_ERROR);
+}
+
+/**
+ * \fn VOID SICE_WireStop(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ *
+ * \brief   Stops the wire thread and releases the handover buffers. Has to
+ *          be called before the sockets are closed.
+ *
+ * \ingroup SICE
+ */
+VOID SICE_WireStop
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    )
+{
+  SICE_WIRE_STRUCT* prWire = prSiceInstance->prWire;
+
+  if (prWire == NULL)
+  {
+    return;
+  }
+
+  prWire->boRunning = FALSE;
+  (VOID)RTOS_JoinThread(&prWire->rThread);
+
+  SICE_VERBOSE
+      (
+        1,
+        "Wire thread stopped. Skipped: %u, overruns: %u, TX errors: %u, "
+        "RX errors: %u, RX dropped: %u\n",
+        prWire->ulTxSkipped,
+        prWire->ulOverruns,
+        prWire->ulTxErrors,
+        prWire->ulRxErrors,
+        prWire->ulRxDropped
+      );
+
+  prSiceInstance->prWire = NULL;
+  RTOS_FreeLockedMem(prWire);
+}
+
+/**
+ * \fn INT SICE_WireHandOverTx(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              USHORT usIFG
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[in]       usIFG           Inter-frame gap for transmission
+ *
+ * \brief   Copies the telegrams queued in rTxBatch to a transmit image and
+ *          hands it over to the wire thread, which transmits it at its next
+ *          transmission instant. A shared payload is joined with the header.
+ *
+ * \return  Number of telegrams handed over
+ *
+ * \ingroup SICE
+ */
+INT SICE_WireHandOverTx
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      USHORT usIFG
+    )
+{
+  SICE_WIRE_STRUCT*   prWire  = prSiceInstance->prWire;
+  SICE_WIRE_TX_IMAGE* prTx    = &prWire->arTxImage[prWire->rTxBuf.ulWrite];
+  ULONG               ulRingDelay;
+  USHORT              usLen;
+  USHORT              usCnt;
+
+  for (
+      usCnt = 0;
+      usCnt < prSiceInstance->rTxBatch.usNum;
+      usCnt++
+    )
+  {
+    usLen = prSiceInstance->rTxBatch.ausLen[usCnt];
+
+    (VOID)memcpy
+        (
+          prTx->aaucData[usCnt],
+          prSiceInstance->rTxBatch.apucPacket[usCnt],
+          usLen
+        );
+
+#ifdef SICE_TX_SHARED_PAYLOAD
+    if (prSiceInstance->rTxBatch.apucPayload[usCnt] != NULL)
+    {
+      (VOID)memcpy
+          (
+            &prTx->aaucData[usCnt][usLen],
+            prSiceInstance->rTxBatch.apucPayload[usCnt],
+            prSiceInstance->rTxBatch.ausPayloadLen[usCnt]
+          );
+      usLen += prSiceInstance->rTxBatch.ausPayloadLen[usCnt];
+    }
+#endif
+
+    prTx->ausLen[usCnt]  = usLen;
+    prTx->aucPort[usCnt] = prSiceInstance->rTxBatch.aucPort[usCnt];
+  }
+
+  prTx->usNum         = prSiceInstance->rTxBatch.usNum;
+  prTx->usIFG         = usIFG;
+  prTx->ulCycleTimeNs = prSiceInstance->prReg->ulTCNTCYCR;
+
+  // Enabled ATs of port P, returning on any port
+  prTx->ulExpectedAT = 0;
+  for (
+      usCnt = 0;
+      usCnt < (USHORT) CSMD_MAX_TEL;
+      usCnt++
+    )
+  {
+    if (prSiceInstance->aprSendFrame[CSMD_MAX_TEL + usCnt]->boEnable)
+    {
+      prTx->ulExpectedAT |= ((ULONG) 1) << usCnt;
+    }
+  }
+
+  // Same reception deadline as for SICE_RX_BUSY_POLL, but keep the wire
+  // thread clear of its next transmission instant
+  ulRingDelay = (prSiceInstance->prReg->ulRDLY1 > prSiceInstance->prReg->ulRDLY2) ?
+      prSiceInstance->prReg->ulRDLY1 : prSiceInstance->prReg->ulRDLY2;
+
+  prTx->ulRxWindowNs = ulRingDelay + (ULONG) SICE_RX_BUSY_POLL_MARGIN;
+
+  if (prTx->ulRxWindowNs > (prTx->ulCycleTimeNs / 2))
+  {
+    prTx->ulRxWindowNs = prTx->ulCycleTimeNs / 2;
+  }
+
+  SICE_WireTriplePublish(&prWire->rTxBuf);
+
+  return((INT) prTx->usNum);
+}
+
+/**
+ * \fn VOID SICE_WireFetchRx(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ *
+ * \brief   Takes over the latest receive image of the wire thread, if any.
+ *          Its frames are then returned by SICE_WireRxPacket(). Without a new
+ *          image, SICE_WireRxPacket() does not return any frames.
+ *
+ * \ingroup SICE
+ */
+VOID SICE_WireFetchRx
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance
+    )
+{
+  SICE_WIRE_STRUCT* prWire = prSiceInstance->prWire;
+  INT               iPort;
+
+  if (SICE_WireTripleFetch(&prWire->rRxBuf))
+  {
+    for (
+        iPort = 0;
+        iPort < SICE_REDUNDANCY_VAL;
+        iPort++
+      )
+    {
+      prWire->ausRxNext[iPort] = 0;
+    }
+  }
+}
+
+/**
+ * \fn INT SICE_WireRxPacket(
+ *              SICE_INSTANCE_STRUCT *prSiceInstance,
+ *              INT iPort,
+ *              UCHAR **ppucPacket
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prSiceInstance  Pointer to Sercos SoftMaster core
+ *                                  instance
+ * \param[in]       iPort           Port index
+ * \param[out]      ppucPacket      Pointer to frame in receive image
+ *
+ * \brief   Returns the next frame of the port from the receive image taken
+ *          over by SICE_WireFetchRx(), with the same signature as
+ *          RTOS_RxPacket() for a frame in a foreign buffer. The frame stays
+ *          valid until the next call of SICE_WireFetchRx().
+ *
+ * \return  Length of frame, 0 if there is no further frame
+ *
+ * \ingroup SICE
+ */
+INT SICE_WireRxPacket
+    (
+      SICE_INSTANCE_STRUCT *prSiceInstance,
+      INT iPort,
+      UCHAR **ppucPacket
+    )
+{
+  SICE_WIRE_STRUCT*   prWire  = prSiceInstance->prWire;
+  SICE_WIRE_RX_IMAGE* prRx    = &prWire->arRxImage[prWire->rRxBuf.ulRead];
+  USHORT              usIdx;
+
+  while (prWire->ausRxNext[iPort] < prRx->usNum)
+  {
+    usIdx = prWire->ausRxNext[iPort]++;
+
+    if (prRx->aucPort[usIdx] == (UCHAR) iPort)
+    {
+      *ppucPacket = prRx->aaucData[usIdx];
+      return((INT) prRx->ausLen[usIdx]);
+    }
+  }
+
+  return(0);
+}
+
+/**
+ * \fn static VOID SICE_WireTriplePublish(
+ *              SICE_WIRE_TRIPLE_STRUCT *prTriple
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prTriple    Triple buffer
+ *
+ * \brief   Producer side: publishes the image just written and takes over
+ *          the exchanged one for writing.
+ *
+ * \ingroup SICE
+ */
+static VOID SICE_WireTriplePublish
+    (
+      SICE_WIRE_TRIPLE_STRUCT *prTriple
+    )
+{
+  prTriple->ulWrite =
+      SICE_EXCHANGE_ACQ_REL
+          (
+            &prTriple->ulMiddle,
+            prTriple->ulWrite | (ULONG) SICE_WIRE_BUF_NEW
+          ) & (ULONG) SICE_WIRE_BUF_IDX_MASK;
+}
+
+/**
+ * \fn static BOOL SICE_WireTripleFetch(
+ *              SICE_WIRE_TRIPLE_STRUCT *prTriple
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prTriple    Triple buffer
+ *
+ * \brief   Consumer side: takes over the latest published image for reading
+ *          and releases the image read before.
+ *
+ * \return  TRUE if a new image has been taken over, FALSE if the image read
+ *          before is still the latest one
+ *
+ * \ingroup SICE
+ */
+static BOOL SICE_WireTripleFetch
+    (
+      SICE_WIRE_TRIPLE_STRUCT *prTriple
+    )
+{
+  if ((SICE_LOAD_ACQUIRE(&prTriple->ulMiddle) & (ULONG) SICE_WIRE_BUF_NEW) == 0)
+  {
+    return(FALSE);
+  }
+
+  // Only the consumer clears the flag, so the exchanged image is new
+  prTriple->ulRead =
+      SICE_EXCHANGE_ACQ_REL
+          (
+            &prTriple->ulMiddle,
+            prTriple->ulRead
+          ) & (ULONG) SICE_WIRE_BUF_IDX_MASK;
+
+  return(TRUE);
+}
+
+/**
+ * \fn static VOID SICE_WireReceive(
+ *              SICE_WIRE_STRUCT *prWire,
+ *              ULONGLONG ullDeadlineNs,
+ *              ULONG ulExpectedAT
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   prWire          Wire thread
+ * \param[in]       ullDeadlineNs   End of reception in ns, 0 for a single
+ *                                  pass
+ * \param[in]       ulExpectedAT    ATs ending the reception early, bit per
+ *                                  telegram number
+ *
+ * \brief   Receives frames of all ports into the receive image being written
+ *          until all expected ATs have been received on any port or the
+ *          deadline has passed. At least one pass over all ports is made.
+ *          The image is only handed over if frames have been received, so
+ *          that an unread image is not replaced by an empty one.
+ *
+ * \ingroup SICE
+ */
+static VOID SICE_WireReceive
+    (
+      SICE_WIRE_STRUCT *prWire,
+      ULONGLONG ullDeadlineNs,
+      ULONG ulExpectedAT
+    )
+{
+  SICE_WIRE_RX_IMAGE* prRx          = &prWire->arRxImage[prWire->rRxBuf.ulWrite];
+  SICE_SIII_FRAME*    puSercosFrame;
+  UCHAR*              pucBuf;
+  UCHAR*              pucPacketBuf;
+  ULONG               ulReceivedAT  = 0;
+  INT                 iPort;
+  INT                 iRet;
+
+  prRx->usNum = 0;
+
+  do
+  {
+    for (
+        iPort = 0;
+        iPort < SICE_REDUNDANCY_VAL;
+        iPort++
+      )
+    {
+      do
+      {
+        pucBuf = (prRx->usNum < (USHORT) SICE_WIRE_RX_FRAMES) ?
+            prRx->aaucData[prRx->usNum] : prWire->aucRxDiscard;
+        pucPacketBuf = NULL;
+
+        iRet = RTOS_RxPacket
+            (
+              prWire->prSiceInstance->iInstanceNo,  // SICE instance
+              iPort,                                // Port index
+              pucBuf,                               // provided data buffer
+              &pucPacketBuf                         // pointer to foreign data buffer
+            );
+
+        if (iRet < 0)
+        {
+          prWire->ulRxErrors++;
+        }
+        else if (iRet > 0)
+        {
+          if (
+              (prRx->usNum >= (USHORT) SICE_WIRE_RX_FRAMES)  ||
+              (iRet > SICE_ETH_FRAMEBUF_LEN)
+            )
+          {
+            prWire->ulRxDropped++;
+          }
+          else
+          {
+            if (pucPacketBuf != NULL)
+            {
+              (VOID)memcpy(pucBuf, pucPacketBuf, (size_t) iRet);
+            }
+
+            /*lint -save -e826 */
+            puSercosFrame = (SICE_SIII_FRAME*)pucBuf;
+            /*lint -restore */
+
+            if (
+                (puSercosFrame->rTel.usPortID ==
+                    (USHORT) htons((USHORT) SICE_SIII_ETHER_TYPE))      &&
+                ((puSercosFrame->rTel.ucSercosType & ((UCHAR) SICE_TEL_TYPE_MASK))
+                    == ((UCHAR) SICE_TEL_TYPE_AT))
+              )
+            {
+              ulReceivedAT |= ((ULONG) 1) <<
+                  (puSercosFrame->rTel.ucSercosType & ((UCHAR) SICE_TEL_NO_MASK));
+            }
+
+            prRx->ausLen[prRx->usNum]  = (USHORT) iRet;
+            prRx->aucPort[prRx->usNum] = (UCHAR) iPort;
+            prRx->usNum++;
+          }
+        }
+      } while (iRet > 0);
+    }
+  } while (
+      ((ulReceivedAT & ulExpectedAT) != ulExpectedAT)  &&
+      (SICE_GetTimeNs() < ullDeadlineNs)
+    );
+
+  if (prRx->usNum > 0)
+  {
+    SICE_WireTriplePublish(&prWire->rRxBuf);
+  }
+}
+
+/**
+ * \fn static VOID* SICE_WireThread(
+ *              VOID *pvArg
+ *          )
+ *
+ * \private
+ *
+ * \param[in,out]   pvArg   Wire thread (SICE_WIRE_STRUCT)
+ *
+ * \brief   Wire thread: transmits the latest transmit image at absolute
+ *          deadlines and receives the returning frames afterwards.
+ *
+ * \details The first transmit image defines the cycle time and, delayed by
+ *          SICE_WIRE_TX_DELAY, the phase of the transmission instants.
+ *          Missed instants are skipped without changing the phase. A cycle
+ *          time of 0 or a changed cycle time restarts the synchronization
+ *          with the next transmit image.
+ *
+ * \return  NULL
+ *
+ * \ingroup SICE
+ */
+static VOID* SICE_WireThread
+    (
+      VOID *pvArg
+    )
+{
+  SICE_WIRE_STRUCT*   prWire          = (SICE_WIRE_STRUCT*) pvArg;
+  SICE_WIRE_TX_IMAGE* prTx;
+  RTOS_TIMESPEC       rDeadline;
+  ULONGLONG           ullDeadlineNs   = 0;
+  ULONGLONG           ullNowNs;
+  ULONGLONG           ullMissed;
+  ULONG               ulCycleTimeNs   = 0;
+  BOOL                boNew           = FALSE;
+
+  (VOID)RTOS_SetThreadPriority(RTOS_THREAD_PRIORITY_TIMER);
+
+  if (SICE_WIRE_THREAD_CORE >= 0)
+  {
+    if (RTOS_SetThreadCoreAffinity(SICE_WIRE_THREAD_CORE) != RTOS_RET_OK)
+    {
+      SICE_VERBOSE
+          (
+            0,
+            "Warning: Could not pin wire thread to core %d\n",
+            SICE_WIRE_THREAD_CORE
+          );
+    }
+  }
+
+  while (prWire->boRunning)
+  {
+    if (ulCycleTimeNs == 0)
+    {
+      // Wait for the first telegrams and keep receiving meanwhile
+      if (SICE_WireTripleFetch(&prWire->rTxBuf) == FALSE)
+      {
+        SICE_WireReceive(prWire, 0, 0);
+        RTOS_NanoSleepRel(SICE_WIRE_IDLE_NS);
+        continue;
+      }
+
+      prTx = &prWire->arTxImage[prWire->rTxBuf.ulRead];
+
+      if (prTx->ulCycleTimeNs == 0)
+      {
+        continue;
+      }
+
+      boNew         = TRUE;
+      ulCycleTimeNs = prTx->ulCycleTimeNs;
+      ullDeadlineNs = SICE_GetTimeNs() + (ULONGLONG) SICE_WIRE_TX_DELAY;
+    }
+
+    rDeadline.tv_sec  = (time_t)(ullDeadlineNs / 1000000000ULL);
+    rDeadline.tv_nsec = (long)(ullDeadlineNs % 1000000000ULL);
+    RTOS_WaitForSystemTime(&rDeadline);
+
+    if (SICE_WireTripleFetch(&prWire->rTxBuf))
+    {
+      boNew = TRUE;
+    }
+
+    prTx = &prWire->arTxImage[prWire->rTxBuf.ulRead];
+
+    if (boNew)
+    {
+      if (
+          RTOS_TxPacketBatch
+              (
+                prWire->prSiceInstance->iInstanceNo,  // SICE instance
+                prTx->apucData,                       // data pointers
+                prTx->ausLen,                         // packet lengths
+                NULL,                                 // payload joined with header
+                NULL,
+                prTx->aucPort,                        // port indices
+                prTx->usNum,                          // number of packets
+                prTx->usIFG                           // inter-frame gap
+              ) < 0
+        )
+      {
+        prWire->ulTxErrors++;
+      }
+      boNew = FALSE;
+
+      SICE_WireReceive
+          (
+            prWire,
+            SICE_GetTimeNs() + (ULONGLONG) prTx->ulRxWindowNs,
+            prTx->ulExpectedAT
+          );
+    }
+    else
+    {
+      prWire->ulTxSkipped++;
+
+      // Pick up late frames and UCC frames
+      SICE_WireReceive(prWire, 0, 0);
+    }
+
+    if (prTx->ulCycleTimeNs != ulCycleTimeNs)
+    {
+      // Cycle time changed by CoSeMa, synchronize again
+      ulCycleTimeNs = 0;
+      continue;
+    }
+
+    ullDeadlineNs += (ULONGLONG) ulCycleTimeNs;
+    ullNowNs       = SICE_GetTimeNs();
+
+    if (ullNowNs >= ullDeadlineNs)
+    {
+      // Skip missed instants, keep the phase
+      ullMissed           = (ullNowNs - ullDeadlineNs) / (ULONGLONG) ulCycleTimeNs + 1;
+      prWire->ulOverruns += (ULONG) ullMissed;
+      ullDeadlineNs      += ullMissed * (ULONGLONG) ulCycleTimeNs;
+    }
+  }
+
+  return(NULL);
+}
+
+#endif  // SICE_WIRE_THREAD
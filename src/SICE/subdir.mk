@@ -11,7 +11,8 @@ C_SRCS += \
 ./SICE/SICE_SIII.c \
 ./SICE/SICE_TX.c \
 ./SICE/SICE_UCC.c \
-./SICE/SICE_UTIL.c 
+./SICE/SICE_UTIL.c \
+./SICE/SICE_WIRE.c 
 
 OBJS += \
 ./SICE/SICE_CYCLIC.o \
@@ -21,7 +22,8 @@ OBJS += \
 ./SICE/SICE_SIII.o \
 ./SICE/SICE_TX.o \
 ./SICE/SICE_UCC.o \
-./SICE/SICE_UTIL.o 
+./SICE/SICE_UTIL.o \
+./SICE/SICE_WIRE.o 
 
 C_DEPS += \
 ./SICE/SICE_CYCLIC.d \
@@ -31,7 +33,8 @@ C_DEPS += \
 ./SICE/SICE_SIII.d \
 ./SICE/SICE_TX.d \
 ./SICE/SICE_UCC.d \
-./SICE/SICE_UTIL.d 
+./SICE/SICE_UTIL.d \
+./SICE/SICE_WIRE.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -59,4 +62,6 @@ SICE/SICE_UCC.o: ./SICE/SICE_UCC.c
 SICE/SICE_UTIL.o: ./SICE/SICE_UTIL.c
 	$(CC) -O3 -Wall -fPIC -c -fmessage-length=0 -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@:%.o=%.d)" -o "$@" "$<"
 
+SICE/SICE_WIRE.o: ./SICE/SICE_WIRE.c
+	$(CC) -O3 -Wall -fPIC -c -fmessage-length=0 -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@:%.o=%.d)" -o "$@" "$<"
 
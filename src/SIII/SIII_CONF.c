@@ -638,6 +638,8 @@ SIII_FUNC_RET SIII_ClearDeviceCallbacks
     prS3Instance->afpAppCyclic[iCnt]     = NULL;
   }
 
+  prS3Instance->rCyclicCommCtrl.boCycSlaveListDirty = TRUE;
+
   return(SIII_NO_ERROR);
 }
 /*lint -restore const! */
@@ -716,6 +718,8 @@ SIII_FUNC_RET SIII_SetDeviceCallback
     prS3Instance->afpAppCyclic[usDevIdx] =
         (FP_APP_CYCLIC) fpAppCyclic;
 
+    prS3Instance->rCyclicCommCtrl.boCycSlaveListDirty = TRUE;
+
     return(SIII_NO_ERROR);
   }
 }
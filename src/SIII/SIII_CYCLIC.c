@@ -208,6 +208,17 @@ SIII_FUNC_RET SIII_Cycle_Prepare
       (
         &prS3Instance->rSiceInstance
       );
+  // Rebuild list of slaves handled in the cycle after phase switch, topology
+  // change, hot-plug or change of the device callbacks
+  if (
+      (prS3Instance->rCyclicCommCtrl.boCycSlaveListDirty) ||
+      (prS3Instance->rCyclicCommCtrl.sCycSlaveListPhase !=
+          prS3Instance->rCosemaInstance.sCSMD_Phase)
+    )
+  {
+    SIII_UpdateCyclicSlaveList(prS3Instance);
+  }
+
   //Re-set cyclic data validity flags
 
   eS3FuncRet = SIII_ClearCyclicDataValid(prS3Instance);
@@ -275,11 +286,13 @@ SIII_FUNC_RET SIII_Cycle_Start
 {
   INT             iCnt;
   USHORT          usI;
+  USHORT          usK;
   SIII_FUNC_RET   eErrorCode    = SIII_NO_ERROR;  // Error code to be returned
   CSMD_FUNC_RET   eCsmdFuncRet  = CSMD_NO_ERROR;  // Temporary error code
   SICE_FUNC_RET   eSiceFuncRet  = SICE_NO_ERROR;  // Temporary error code
   SIII_FUNC_RET   eS3FuncRet    = SIII_NO_ERROR;  // Temporary error code
   USHORT*         pusC_Con;
+  FP_APP_CYCLIC   fpAppCyclic;
 
   SIII_VERBOSE(3, "SIII_Cycle_Start()\n");
 
@@ -347,6 +360,7 @@ SIII_FUNC_RET SIII_Cycle_Start
   else if (eCsmdFuncRet == CSMD_TOPOLOGY_CHANGE)
   {
     (VOID)SIII_UpdateTopology(prS3Instance);
+    prS3Instance->rCyclicCommCtrl.boCycSlaveListDirty = TRUE;
   }
   else if (eCsmdFuncRet == CSMD_NO_ERROR)
   {
@@ -381,14 +395,17 @@ SIII_FUNC_RET SIII_Cycle_Start
 
       // Call application-specific cyclic function via pointer
       for (
-          iCnt = 0;
-          iCnt < SIII_MAX_SLAVES;
-          iCnt++
+          usK = 0;
+          usK < prS3Instance->rCyclicCommCtrl.usNumCycSlaves;
+          usK++
           )
       {
-        if (prS3Instance->afpAppCyclic[iCnt] != NULL)
+        iCnt = (INT)prS3Instance->rCyclicCommCtrl.ausCycSlaveIdx[usK];
+        fpAppCyclic = prS3Instance->afpAppCyclic[iCnt];
+
+        if (fpAppCyclic != NULL)
         {
-          prS3Instance->afpAppCyclic[iCnt]
+          fpAppCyclic
               (
                 prS3Instance,
                 (USHORT)iCnt
@@ -398,8 +415,10 @@ SIII_FUNC_RET SIII_Cycle_Start
 
     //}
     // Activate master producer connections
-    for (iCnt = 0; iCnt < SIII_MAX_SLAVES; iCnt++)
+    for (usK = 0; usK < prS3Instance->rCyclicCommCtrl.usNumCycSlaves; usK++)
     {
+      iCnt = (INT)prS3Instance->rCyclicCommCtrl.ausCycSlaveIdx[usK];
+
       if (prS3Instance->rCosemaInstance.rSlaveList.aeSlaveActive[iCnt] ==
           CSMD_SLAVE_ACTIVE)
       {
@@ -434,7 +453,7 @@ SIII_FUNC_RET SIII_Cycle_Start
           }
         } /* if (prS3Instance->rCyclicCommCtrl.aboCycDataValid[iCnt]) */
       } /* if (prS3Instance->rCosemaInstance.rSlaveList.aeSlaveActive[iCnt] == CSMD_SLAVE_ACTIVE) */
-    } /* for (iCnt = 0; iCnt < SIII_MAX_SLAVES; iCnt++) */
+    } /* for (usK = 0; usK < usNumCycSlaves; usK++) */
 
     if (SIII_GetSercosPhase(prS3Instance) == SIII_PHASE_CP4)
     {
@@ -480,6 +499,15 @@ SIII_FUNC_RET SIII_Cycle_Start
     }
   }
 
+  // Advance SVC requests, if any
+  if (
+      (prS3Instance->usSvcActive    != 0)                           ||
+      (prS3Instance->ulSvcSubmitCnt != prS3Instance->ulSvcSeenCnt)
+    )
+  {
+    SIII_SVCSchedule(prS3Instance);
+  }
+
   return(eErrorCode);
  }
 
@@ -515,7 +543,9 @@ SIII_FUNC_RET SIII_GetConnections(SIII_INSTANCE_STRUCT *prS3Instance)
   USHORT          usI, usK;
   USHORT          usConnIdx;
   USHORT          usState             = 0;
+#ifndef SIII_CYCLIC_DIRECT
   USHORT*         pusConnDestination  = NULL; /* destination pointer for connection data */
+#endif
   CSMD_FUNC_RET   eCsmdFuncRet    = CSMD_NO_ERROR;
 
   /* parse through all projected slaves */
@@ -544,6 +574,7 @@ SIII_FUNC_RET SIII_GetConnections(SIII_INSTANCE_STRUCT *prS3Instance)
         /* copy data if connection state is 'consuming' */
         if ((CSMD_CONS_STATE)usState == CSMD_CONS_STATE_CONSUMING)
         {
+#ifndef SIII_CYCLIC_DIRECT
           /* read data offset from SIII connection info structure for AT */
           pusConnDestination = (USHORT*)&prS3Instance->aucCyclicATBuffer[prS3Instance->arConnInfoAT[usI][usK].usOffset];
 
@@ -566,6 +597,9 @@ SIII_FUNC_RET SIII_GetConnections(SIII_INSTANCE_STRUCT *prS3Instance)
             // Forward error
             return((SIII_FUNC_RET)eCsmdFuncRet);
           }
+#else
+          /* data is read in place via SIII_GetDeviceCyclicDataPtr() */
+#endif
         }
         /* always clear occurring connection errors */
         else if ((CSMD_CONS_STATE)usState == CSMD_CONS_STATE_ERROR)
@@ -622,6 +656,9 @@ SIII_FUNC_RET SIII_SetConnections(SIII_INSTANCE_STRUCT *prS3Instance)
   USHORT          usC_Con;
   USHORT          usConnIdx;
   USHORT*         pusConnSource   = NULL; /* pointer to connection data to be copied */
+#ifdef SIII_CYCLIC_DIRECT
+  USHORT*         pusConnTxRam    = NULL; /* pointer to connection in Tx ram */
+#endif
   CSMD_FUNC_RET   eCsmdFuncRet    = CSMD_NO_ERROR;
 
   /* parse through all projected slaves */
@@ -646,6 +683,21 @@ SIII_FUNC_RET SIII_SetConnections(SIII_INSTANCE_STRUCT *prS3Instance)
 
         usC_Con = *pusConnSource;
 
+#ifdef SIII_CYCLIC_DIRECT
+        /* flow control and real-time bits are written by the application
+           into the C-CON in Tx ram, producer ready is kept in the SIII buffer */
+        if (CSMD_GetConnectionTxRamPtr
+              (
+                &prS3Instance->rCosemaInstance,
+                usConnIdx,
+                &pusConnTxRam
+              ) == CSMD_NO_ERROR)
+        {
+          usC_Con = (USHORT)((usC_Con & CSMD_C_CON_PRODUCER_READY) |
+              (*pusConnTxRam & (CSMD_C_CON_FLOW_CONTROL | CSMD_C_CON_RTB_MASK)));
+        }
+#endif
+
         /* check C-CON of connection (written by application) */
         if ((usC_Con & CSMD_C_CON_PRODUCER_READY) != 0)
         {
@@ -687,6 +739,15 @@ SIII_FUNC_RET SIII_SetConnections(SIII_INSTANCE_STRUCT *prS3Instance)
             /* check if cyclic data is valid for this slave in current cycle */
             if (prS3Instance->rCyclicCommCtrl.aboCycDataValid[usI])
             {
+#ifdef SIII_CYCLIC_DIRECT
+              /* connection data is already in Tx ram, only write C-CON */
+              eCsmdFuncRet = CSMD_SetConnectionC_Con
+                  (
+                    &prS3Instance->rCosemaInstance,   // CoSeMa instance structure
+                    usConnIdx,                        // Connection index
+                    usC_Con                           // C-CON
+                  ); /* Real-time bits */
+#else
               eCsmdFuncRet = CSMD_SetConnectionData
                   (
                     &prS3Instance->rCosemaInstance,   // CoSeMa instance structure
@@ -694,6 +755,7 @@ SIII_FUNC_RET SIII_SetConnections(SIII_INSTANCE_STRUCT *prS3Instance)
                     pusConnSource,                    // Data buffer
                     usC_Con                           // C-CON
                   ); /* Real-time bits */
+#endif
 
               if (eCsmdFuncRet > CSMD_END_ERR_CLASS_00000)
               {
@@ -777,6 +839,12 @@ SIII_FUNC_RET SIII_CyclicHotplugFunc
       prS3Instance->rCyclicCommCtrl.eCyclicCsmdError = CSMD_FUNCTION_IN_PROCESS;
       prS3Instance->rCyclicCommCtrl.boHotplugCyclicPhase = FALSE;
     }
+
+    // Slaves may have been added or removed
+    if (eCsmdFuncRet != CSMD_FUNCTION_IN_PROCESS)
+    {
+      prS3Instance->rCyclicCommCtrl.boCycSlaveListDirty = TRUE;
+    }
   }
   return((SIII_FUNC_RET) eCsmdFuncRet);
 }
@@ -832,6 +900,7 @@ SIII_FUNC_RET SIII_DevicePower
   INT           iCnt;
   USHORT*       pusControlWord;
   USHORT        usConnIdx;
+  USHORT        usLength;
 
   SIII_VERBOSE(3, "SIII_DevicePower()\n");
 
@@ -863,7 +932,20 @@ SIII_FUNC_RET SIII_DevicePower
           if (eRet == SIII_NO_ERROR)
           {
             /* a connection containing S-0-0134 has been found */
-            pusControlWord = (USHORT*)&prS3Instance->aucCyclicMDTBuffer[prS3Instance->arConnInfoMDT[iCnt][usConnIdx].usOffset + 2];
+            eRet = SIII_GetDeviceCyclicDataPtr
+                (
+                  prS3Instance,
+                  (USHORT)iCnt,
+                  SIII_DEV_MDT_DATA,
+                  usConnIdx,
+                  &pusControlWord,
+                  &usLength
+                );
+          }
+
+          if (eRet == SIII_NO_ERROR)
+          {
+            pusControlWord++;
 
             if (boPower)
             {
@@ -886,17 +968,33 @@ SIII_FUNC_RET SIII_DevicePower
                   &usConnIdx
                 );
 
-        pusControlWord = (USHORT*)&prS3Instance->aucCyclicMDTBuffer[prS3Instance->arConnInfoMDT[usDevIdx][usConnIdx].usOffset + 2];
-
-        if (boPower)
+        if (eRet == SIII_NO_ERROR)
         {
-          *pusControlWord = SIII_SLAVE_ENABLE;
-          prS3Instance->rCyclicCommCtrl.boPowerOn = TRUE;
+          eRet = SIII_GetDeviceCyclicDataPtr
+              (
+                prS3Instance,
+                usDevIdx,
+                SIII_DEV_MDT_DATA,
+                usConnIdx,
+                &pusControlWord,
+                &usLength
+              );
         }
-        else
+
+        if (eRet == SIII_NO_ERROR)
         {
-          *pusControlWord = SIII_SLAVE_DISABLE;
-          prS3Instance->rCyclicCommCtrl.boPowerOn = FALSE;
+          pusControlWord++;
+
+          if (boPower)
+          {
+            *pusControlWord = SIII_SLAVE_ENABLE;
+            prS3Instance->rCyclicCommCtrl.boPowerOn = TRUE;
+          }
+          else
+          {
+            *pusControlWord = SIII_SLAVE_DISABLE;
+            prS3Instance->rCyclicCommCtrl.boPowerOn = FALSE;
+          }
         }
       }
     }
@@ -923,6 +1021,13 @@ SIII_FUNC_RET SIII_DevicePower
  *          device, either command or actual data. The returned pointer is NULL
  *          in case of an error.
  *
+ * \details With SIII_CYCLIC_DIRECT, the pointer refers to the connection in
+ *          the CoSeMa Tx or Rx ram in CP4 and is only valid in the current
+ *          Sercos cycle. The C-CON in Tx ram is overwritten by SIII, only its
+ *          flow control and real-time bits are taken from the application.
+ *          Outside of CP4 and for connections not configured, the pointer
+ *          refers to the SIII cyclic data buffer.
+ *
  * \param[in,out]   prS3Instance    Pointer to SIII instance structure
  * \param[in]       usDevIdx        Sercos slave device index
  * \param[in]       eMDTorAT
@@ -959,6 +1064,11 @@ SIII_FUNC_RET SIII_GetDeviceCyclicDataPtr
       USHORT*       pusLength
     )
 {
+#ifdef SIII_CYCLIC_DIRECT
+  USHORT          usCsmdConnIdx;
+  CSMD_FUNC_RET   eCsmdFuncRet;
+#endif
+
   SIII_VERBOSE(3, "SIII_GetDeviceCyclicDataPtr()\n");
 
   if  (
@@ -971,6 +1081,50 @@ SIII_FUNC_RET SIII_GetDeviceCyclicDataPtr
 
   if  (usDevIdx < (USHORT) SIII_MAX_SLAVES)
   {
+#ifdef SIII_CYCLIC_DIRECT
+    usCsmdConnIdx = (eMDTorAT == SIII_DEV_MDT_DATA) ?
+        prS3Instance->arConnInfoMDT[usDevIdx][usConnIdx].usConnIdx :
+        prS3Instance->arConnInfoAT[usDevIdx][usConnIdx].usConnIdx;
+
+    if (
+        (usCsmdConnIdx <
+            prS3Instance->rCosemaInstance.rPriv.rSystemLimits.usMaxGlobConn) &&
+        (SIII_GetSercosPhase(prS3Instance) == SIII_PHASE_CP4)
+      )
+    {
+      if (eMDTorAT == SIII_DEV_MDT_DATA)
+      {
+        eCsmdFuncRet = CSMD_GetConnectionTxRamPtr
+            (
+              &prS3Instance->rCosemaInstance,
+              usCsmdConnIdx,
+              ppusBuffer
+            );
+        *pusLength = prS3Instance->arConnInfoMDT[usDevIdx][usConnIdx].usLength;
+      }
+      else
+      {
+        eCsmdFuncRet = CSMD_GetConnectionRxRamPtr
+            (
+              &prS3Instance->rCosemaInstance,
+              usCsmdConnIdx,
+              ppusBuffer
+            );
+        *pusLength = prS3Instance->arConnInfoAT[usDevIdx][usConnIdx].usLength;
+      }
+
+      // Last received data is returned for invalid AT data, as without
+      // SIII_CYCLIC_DIRECT
+      if (
+          (eCsmdFuncRet == CSMD_NO_ERROR)                 ||
+          (eCsmdFuncRet == CSMD_CONNECTION_DATA_INVALID)
+        )
+      {
+        return(SIII_NO_ERROR);
+      }
+    }
+#endif
+
     switch (eMDTorAT)
     {
       case SIII_DEV_MDT_DATA:
@@ -1119,7 +1273,9 @@ SIII_FUNC_RET SIII_SetCyclicDataValid
  *              SIII_INSTANCE_STRUCT *prS3Instance,
  *          )
  *
- * \brief   Clears data validity flags for all slaves.
+ * \brief   Clears data validity flags for all slaves in the list of slaves
+ *          handled in the cycle. The flags of the other slaves are cleared
+ *          when the list is rebuilt.
  *
  * \param[in,out]   prS3Instance    Pointer to SIII instance structure
  *
@@ -1138,7 +1294,7 @@ SIII_FUNC_RET SIII_ClearCyclicDataValid
       SIII_INSTANCE_STRUCT *prS3Instance
     )
 {
-  INT iCnt;
+  USHORT usK;
 
   SIII_VERBOSE(3, "SIII_ClearCyclicDataValid()\n");
 
@@ -1147,10 +1303,65 @@ SIII_FUNC_RET SIII_ClearCyclicDataValid
     return(SIII_PARAMETER_ERROR);
   }
 
-  for (iCnt = 0; iCnt < SIII_MAX_SLAVES; iCnt++)
+  for (usK = 0; usK < prS3Instance->rCyclicCommCtrl.usNumCycSlaves; usK++)
   {
-    prS3Instance->rCyclicCommCtrl.aboCycDataValid[iCnt] = FALSE;
+    prS3Instance->rCyclicCommCtrl.aboCycDataValid[
+        prS3Instance->rCyclicCommCtrl.ausCycSlaveIdx[usK]] = FALSE;
   }
 
   return(SIII_NO_ERROR);
 }
+
+/**
+ * \fn VOID SIII_UpdateCyclicSlaveList(
+ *              SIII_INSTANCE_STRUCT *prS3Instance
+ *          )
+ *
+ * \private
+ *
+ * \brief   Rebuilds the list of slaves handled in the cycle, i.e. the slaves
+ *          that are active or have a cyclic callback.
+ *
+ * \details The list keeps the loops in SIII_Cycle_Start() and
+ *          SIII_ClearCyclicDataValid() at the number of slaves in use instead
+ *          of SIII_MAX_SLAVES. It is rebuilt in SIII_Cycle_Prepare() after a
+ *          Sercos phase switch, a topology change, a hot-plug and after
+ *          changes of the device callbacks. All data validity flags are
+ *          cleared here, so slaves leaving or entering the list start with a
+ *          defined state.
+ *
+ * \param[in,out]   prS3Instance    Pointer to SIII instance structure
+ *
+ * \ingroup SIII
+ */
+VOID SIII_UpdateCyclicSlaveList
+    (
+      SIII_INSTANCE_STRUCT *prS3Instance
+    )
+{
+  SIII_CYCLIC_COMM_CTRL_STRUCT* prCyclicCommCtrl = &prS3Instance->rCyclicCommCtrl;
+  USHORT usNumSlaves = 0;
+  INT    iCnt;
+
+  // Clear flag first, so a change during the rebuild is not lost
+  prCyclicCommCtrl->boCycSlaveListDirty = FALSE;
+  prCyclicCommCtrl->sCycSlaveListPhase  = prS3Instance->rCosemaInstance.sCSMD_Phase;
+
+  for (iCnt = 0; iCnt < SIII_MAX_SLAVES; iCnt++)
+  {
+    prCyclicCommCtrl->aboCycDataValid[iCnt] = FALSE;
+
+    if (
+        (prS3Instance->rCosemaInstance.rSlaveList.aeSlaveActive[iCnt] ==
+            CSMD_SLAVE_ACTIVE)                          ||
+        (prS3Instance->afpAppCyclic[iCnt] != NULL)
+      )
+    {
+      prCyclicCommCtrl->ausCycSlaveIdx[usNumSlaves++] = (USHORT)iCnt;
+    }
+  }
+
+  prCyclicCommCtrl->usNumCycSlaves = usNumSlaves;
+
+  SIII_VERBOSE(1, "Slaves handled in the cycle: %u\n", (ULONG)usNumSlaves);
+}
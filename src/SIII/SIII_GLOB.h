@@ -274,6 +274,11 @@ typedef struct SIII_CYCLIC_COMM_CTRL_STR
   CSMD_FUNC_RET       eCyclicCsmdError;           /**< CoSeMa error code from cyclic function*/
   BOOL                aboCycDataValid[SIII_MAX_SLAVES];
                                                   /**< Is cyclic command data from app valid?*/
+  USHORT              ausCycSlaveIdx[SIII_MAX_SLAVES];
+                                                  /**< Indices of slaves handled in the cycle*/
+  USHORT              usNumCycSlaves;             /**< Number of entries in ausCycSlaveIdx*/
+  volatile BOOL       boCycSlaveListDirty;        /**< Does ausCycSlaveIdx need a rebuild?*/
+  SHORT               sCycSlaveListPhase;         /**< Sercos phase ausCycSlaveIdx was built in*/
 } SIII_CYCLIC_COMM_CTRL_STRUCT;
 
 /**
@@ -299,6 +304,71 @@ typedef struct SIII_SVC_RESULT_STR
   USHORT              ausSVCData[SIII_SVC_BUF_SIZE/2];    /**< SVC data buffer */
 } SIII_SVC_RESULT_STRUCT;
 
+struct SIII_SVC_REQUEST_STR;
+
+/**
+ * \brief   Function pointer for completion of an SVC request
+ */
+typedef VOID (*FP_SVC_DONE)
+    (
+      VOID*,                        /**< SIII_INSTANCE_STRUCT*, casted to VOID to
+                                         avoid circular dependency */
+      struct SIII_SVC_REQUEST_STR*  /**< Completed SVC request */
+    );
+
+/**
+ * \struct SIII_SVC_REQUEST_STRUCT
+ *
+ * \brief   SVC request queued by SIII_SVCSubmit(). The memory is provided by
+ *          the caller and has to remain valid until the request is completed.
+ */
+typedef struct SIII_SVC_REQUEST_STR
+{
+  SIII_SVC_ACCESS_MODE          eAccessMode;  /**< SVC access mode (see SIII_SVC_ACCESS_MODE) */
+  USHORT                        usDevIdx;     /**< Slave device index */
+  ULONG                         ulIdent_Nbr;  /**< EIDN of parameter */
+  USHORT                        usElem;       /**< Element of parameter */
+  USHORT*                       pusData;      /**< Data buffer, not used for commands */
+  USHORT                        usLen;        /**< Length of data buffer in bytes */
+  FP_SVC_DONE                   fpDone;       /**< Function called by SIII_Cycle_Start() on
+                                                   completion, may be NULL */
+  VOID*                         pvUser;       /**< User data for fpDone */
+  volatile SIII_FUNC_RET        eFuncRet;     /**< Result, SIII_FUNCTION_IN_PROCESS until
+                                                   the request is completed */
+  USHORT                        usSvchError;  /**< CoSeMa SVC error of failed request */
+  ULONG                         ulAttribute;  /**< Attribute of parameter, set by read requests */
+  USHORT                        usStep;       /**< Internal: Step of command execution */
+  struct SIII_SVC_REQUEST_STR*  prNext;       /**< Internal: Next request of the slave */
+} SIII_SVC_REQUEST_STRUCT;
+
+/**
+ * \union SIII_SVC_CMD_DATA_UNION
+ *
+ * \brief   Attribute and command status read for SVC command requests
+ */
+typedef union
+{
+  ULONG                     ulAttribute;      /**< Parameter attribute */
+  USHORT                    ausData[4];       /**< Data buffer for CoSeMa, element 0
+                                                   holds the command status */
+} SIII_SVC_CMD_DATA_UNION;
+
+/**
+ * \struct SIII_SVC_SLAVE_STRUCT
+ *
+ * \brief   SVC requests of a slave. Slaves are served in parallel, the
+ *          requests of a slave one after another.
+ */
+typedef struct
+{
+  CSMD_SVCH_MACRO_STRUCT    rSvcMacro;        /**< CoSeMa SVC macro of active request */
+  SIII_SVC_REQUEST_STRUCT*  prActive;         /**< Request in process or NULL */
+  SIII_SVC_REQUEST_STRUCT*  prHead;           /**< First queued request or NULL */
+  SIII_SVC_REQUEST_STRUCT*  prTail;           /**< Last queued request */
+  SIII_SVC_CMD_DATA_UNION   uCmdData;         /**< Attribute and command status read
+                                                   for command requests */
+} SIII_SVC_SLAVE_STRUCT;
+
 /**
  * \enum SIII_PHASE
  *
@@ -492,12 +562,13 @@ typedef struct
                                                [SIII_MAX_CONN_PER_SLAVE];   /**< Info Struct for AT connections (offset + length) */
 
   // SVC handling
-  CSMD_SVCH_MACRO_STRUCT          rMySvcMacro;                        /**< SVC macro struct for user access */
-  SIII_SVC_ACCESS_MODE            rMySVCAccessMode;                   /**< SVC access mode (see SIII_SVC_ACCESS_MODE) */
+  SIII_SVC_SLAVE_STRUCT           arSvcSlave[SIII_MAX_SLAVES];        /**< SVC requests per slave */
+  USHORT                          usSvcActive;                        /**< Slaves with SVC requests, 0 if SIII_SVCSchedule() is idle */
+  USHORT                          usSvcNextSlave;                     /**< Slave served first by next SIII_SVCSchedule() */
+  volatile ULONG                  ulSvcSubmitCnt;                     /**< Number of submitted SVC requests */
+  ULONG                           ulSvcSeenCnt;                       /**< ulSvcSubmitCnt at last SIII_SVCSchedule() */
   SIII_SVC_RESULT_STRUCT          rMySVCResult;                       /**< SVC result struct for user access */
-  RTOS_SEMAPHORE                  semSVCBlock;                        /**< Semaphore that is used to block SVC access when transfer already running */
-  RTOS_SEMAPHORE                  semSVCStart;                        /**< Semaphore that starts SVC transfer when posted */
-  RTOS_THREAD                     rSVCThread;                         /**< SVC handler thread */
+  RTOS_SEMAPHORE                  semSVCBlock;                        /**< Semaphore that protects the SVC request queues */
 
   // Pointers to application-specific functions for Sercos slaves
   FP_APP_CONN_CONFIG              afpAppConnConfig[SIII_MAX_SLAVES];  /**< Device connection configuration function*/
@@ -849,6 +920,35 @@ SOURCE SIII_FUNC_RET SIII_SVCClearErrors
       USHORT  usDevIdx
     );
 
+SOURCE VOID SIII_SVCInitRequest
+    (
+      SIII_SVC_REQUEST_STRUCT *prRequest,
+      SIII_SVC_ACCESS_MODE eAccessMode,
+      USHORT  usDevIdx,
+      BOOL    boIsStdPar,
+      USHORT  usIdn,
+      USHORT  usSI,
+      USHORT  usSE,
+      USHORT  usElem,
+      USHORT* pusData,
+      USHORT  usLen,
+      FP_SVC_DONE fpDone,
+      VOID*   pvUser
+    );
+
+SOURCE SIII_FUNC_RET SIII_SVCSubmit
+    (
+      SIII_INSTANCE_STRUCT *prS3Instance,
+      SIII_SVC_REQUEST_STRUCT *prRequest
+    );
+
+SOURCE SIII_FUNC_RET SIII_SVCTransferBatch
+    (
+      SIII_INSTANCE_STRUCT *prS3Instance,
+      SIII_SVC_REQUEST_STRUCT *parRequest,
+      USHORT usNumRequests
+    );
+
 // SIII_UCC.c
 
 SOURCE SIII_FUNC_RET SIII_UccHandling
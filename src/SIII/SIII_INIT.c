@@ -208,7 +208,7 @@ SIII_FUNC_RET SIII_Init
     SIII_VERBOSE(1, "  Done.\n");
   }
 
-  // Create SVC semaphores
+  // Create SVC semaphore
   SIII_VERBOSE(1, "Creating SVC block semaphore ... \n");
   if ((RTOS_CreateSemaphore(&prS3Instance->semSVCBlock, "S.SVCBlock")) != RTOS_RET_OK)
   {
@@ -220,37 +220,6 @@ SIII_FUNC_RET SIII_Init
     SIII_VERBOSE(1, "  Done.\n");
   }
 
-  SIII_VERBOSE(1, "Creating SVC start semaphore ... \n");
-  if ((RTOS_CreateSemaphore(&prS3Instance->semSVCStart, "S.SVCStart")) != RTOS_RET_OK)
-  {
-    SIII_VERBOSE(0, "  Error: SVC start semaphore could not be created !");
-    return(SIII_SEMAPHORE_ERROR);
-  }
-  else
-  {
-    SIII_VERBOSE(1, "  Done.\n");
-  }
-
-  // Create SVC thread
-  SIII_VERBOSE(1, "Creating SVC thread ... \n");
-  iRet = RTOS_CreateThread
-      (
-        (VOID*) SIII_SVCThread,      // Thread function
-        &prS3Instance->rSVCThread,   // Thread data structure
-        "T.SVC",                     // Thread name string
-        (VOID*) prS3Instance         // Function argument
-      );
-
-  if (iRet != RTOS_RET_OK)
-  {
-    SIII_VERBOSE(0, "  Error: SVC thread could not be created!");
-    return(SIII_SYSTEM_ERROR);
-  }
-  else
-  {
-    SIII_VERBOSE(1, "  Done.\n");
-  }
-
   (VOID)RTOS_PostSemaphore(&prS3Instance->semSVCBlock);
 
   // Initialize data structure for controlling cyclic Sercos communication
@@ -263,6 +232,8 @@ SIII_FUNC_RET SIII_Init
   prCyclicCommCtrl->boCyclicDataError     = FALSE;
   prCyclicCommCtrl->eCyclicCsmdError      = CSMD_NO_ERROR;
 
+  SIII_UpdateCyclicSlaveList(prS3Instance);
+
   eS3FuncRet = SIII_ClearCyclicDataValid(prS3Instance);
   if (eS3FuncRet != SIII_NO_ERROR)
   {
@@ -347,13 +318,6 @@ SIII_FUNC_RET SIII_Close
     return(SIII_PARAMETER_ERROR);
   }
 
-  // Close SVC thread and destroy thread data structure
-  if (RTOS_CloseThreadRemote(&prS3Instance->rSVCThread) != RTOS_RET_OK)
-  {
-    SIII_VERBOSE(0, "Error closing SVC thread.\n");
-  }
-  RTOS_DestroyThreadData(&prS3Instance->rSVCThread);
-
   // Close SICE instance
   eSiceFuncRet = SICE_Close(&prS3Instance->rSiceInstance);
 
@@ -303,10 +303,10 @@ SIII_FUNC_RET SIII_PhaseHandler
 
           {
             CSMD_INIT_POINTER *prSercosInitPtr = &prS3Instance->rCosemaSercosInitPtr;
-            prSercosInitPtr->pvSERCOS_RX_Ram = (VOID*) (prSiceInstance->rMemory.aucRxRAM);
-            prSercosInitPtr->pvSERCOS_TX_Ram = (VOID*) (prSiceInstance->rMemory.aucTxRAM);
-            prSercosInitPtr->pvSERCOS_SVC_Ram = (VOID*) (prSiceInstance->rMemory.aucSvc);
-            prSercosInitPtr->pvSERCOS_Register = (VOID*) (prSiceInstance->rMemory.aucRegister);
+            prSercosInitPtr->pvSERCOS_RX_Ram = (VOID*) (prSiceInstance->prArena->rMemory.aucRxRAM);
+            prSercosInitPtr->pvSERCOS_TX_Ram = (VOID*) (prSiceInstance->prArena->rMemory.aucTxRAM);
+            prSercosInitPtr->pvSERCOS_SVC_Ram = (VOID*) (prSiceInstance->prArena->rMemory.aucSvc);
+            prSercosInitPtr->pvSERCOS_Register = (VOID*) (prSiceInstance->prArena->rMemory.aucRegister);
 
             eCosemaFuncRet = CSMD_Initialize
               (
@@ -345,8 +345,9 @@ SIII_FUNC_RET SIII_PhaseHandler
         case SIII_CSMD_STATE_SET_COMM_PARAM:
 
           prCosemaHWInitStruct->usSVC_BusyTimeout = prS3Instance->rS3Pars.usSVCBusyTimeout;
-          prCosemaHWInitStruct->usRxBufferMode = (USHORT) CSMD_RX_SINGLE_BUFFER;
-          prCosemaHWInitStruct->usTxBufferMode = (USHORT) CSMD_TX_SINGLE_BUFFER;
+          // Largest buffer system configured in CSMD_USER.h
+          prCosemaHWInitStruct->usRxBufferMode = (USHORT) (CSMD_MAX_RX_BUFFER - 1);
+          prCosemaHWInitStruct->usTxBufferMode = (USHORT) (CSMD_MAX_TX_BUFFER - 1);
           prCosemaHWInitStruct->usSVC_Valid_TOut_CP1 = (USHORT) SIII_TIMEOUT_SVC_VALID_CP1;
 
           prCosemaHWInitStruct->ulCycleTime_CP0 = prS3Instance->rS3Pars.ulCycleTimeCP0CP2;
@@ -1509,6 +1510,8 @@ SIII_FUNC_RET SIII_PhaseHandler
               prPhaseStateStruct->ulCsmdSleepCnt = (ULONG) 0;
               if (eCosemaFuncRet != CSMD_FUNCTION_IN_PROCESS)
               {
+                prS3Instance->rCyclicCommCtrl.boCycSlaveListDirty = TRUE;
+
                 SIII_VERBOSE
                     (
                       0,
@@ -93,6 +93,10 @@
  */
 #define SIII_C_CON_PROD_RDY             (0x0001)
 
+#if (defined SIII_CYCLIC_DIRECT) && (CSMD_MAX_TX_BUFFER != 1)
+#error SIII_CYCLIC_DIRECT requires single buffering of Tx ram (CSMD_MAX_TX_BUFFER)!
+#endif
+
 //---- type definitions -------------------------------------------------------
 
 //---- variable declarations --------------------------------------------------
@@ -117,7 +121,7 @@ SOURCE SIII_FUNC_RET SIII_BuildConnInfoList
 );
 
 // SIII_SVC.c
-SOURCE VOID SIII_SVCThread
+SOURCE VOID SIII_SVCSchedule
     (
       SIII_INSTANCE_STRUCT *prS3Instance
     );
@@ -145,6 +149,11 @@ SOURCE SIII_FUNC_RET SIII_CyclicHotplugFunc
       SIII_INSTANCE_STRUCT *prS3Instance
     );
 
+SOURCE VOID SIII_UpdateCyclicSlaveList
+    (
+      SIII_INSTANCE_STRUCT *prS3Instance
+    );
+
 #ifdef __cplusplus
 }
 #endif
@@ -121,802 +121,1137 @@
  */
 #define SIII_GET_SI(_idn)               ((ULONG)((_idn & 0xFF000000) >> 24))
 
+// Steps of SVC command requests
+
+#define SIII_SVC_STEP_ATTR              (0)   /**< Read attribute of parameter */
+#define SIII_SVC_STEP_SET_CMD           (1)   /**< Set command */
+#define SIII_SVC_STEP_CMD_STATUS        (2)   /**< Read command status */
+#define SIII_SVC_STEP_CLEAR_CMD         (3)   /**< Clear command */
+
 //---- type definitions -------------------------------------------------------
 
-//---- variable declarations --------------------------------------------------
+//---- variable declarations --------------------------------------------------
+
+//---- function declarations --------------------------------------------------
+
+//---- function implementations -----------------------------------------------
+
+/**
+ * \fn static VOID SIII_SVCPrintData(
+ *              ULONG ulAttribute,
+ *              USHORT *pusData
+ *          )
+ *
+ * \private
+ *
+ * \brief   Prints data read via the service channel, depending on the data
+ *          type given in the attribute of the parameter.
+ *
+ * \param[in]   ulAttribute     Attribute of parameter
+ * \param[in]   pusData         Data read
+ *
+ * \return  None
+ *
+ * \ingroup SIII
+ */
+static VOID SIII_SVCPrintData
+    (
+      ULONG ulAttribute,
+      USHORT *pusData
+    )
+{
+  INT iCnt = 0;
+
+  // Type cast of retrieved data, depending on data type of parameter
+  // \todo: OK for big endian?
+  /*lint -save -e740 cast! */
+  switch(ulAttribute & (ULONG) CSMD_SERC_LEN)
+  {
+    case CSMD_SERC_WORD_LEN:
+      SIII_VERBOSE(0, "- Data type: 16 bit value\n");
+      SIII_VERBOSE
+          (
+            0,
+            "- Retrieved data: %hu, 0x%04hX\n",
+            *pusData,
+            *pusData
+          );
+      break;
+    case CSMD_SERC_LONG_LEN:
+      SIII_VERBOSE(0, "- Data type: 32 bit value\n");
+      SIII_VERBOSE
+          (
+            0,
+            "- Retrieved data: %u, 0x%08X\n",
+            *((ULONG*)pusData),
+            *((ULONG*)pusData)
+          );
+      break;
+    case CSMD_SERC_DOUBLE_LEN:
+      SIII_VERBOSE(0, "- Data type: 64 bit value\n");
+      SIII_VERBOSE
+          (
+            0,
+            "- Retrieved data: %llu, 0x%016llX\n",
+            *((ULONGLONG*)pusData),
+            *((ULONGLONG*)pusData)
+          );
+      break;
+    case CSMD_SERC_VAR_BYTE_LEN:
+      SIII_VERBOSE
+          (
+            0,
+            "- Data type: 8 bit value list / string with %hu elements\n",
+            pusData[0]
+          );
+      SIII_VERBOSE(0, "- Retrieved data:\n");
+      for (iCnt = 0; iCnt < pusData[0]; iCnt++)
+      {
+        SIII_VERBOSE(0, "%c", ((CHAR*)(((UCHAR*)pusData)+4))[iCnt]);
+      }
+      SIII_VERBOSE(0, "\n");
+      for (iCnt = 0; iCnt < pusData[0]; iCnt++)
+      {
+        SIII_VERBOSE(0, "0x%02hhX ", ((CHAR*)(((UCHAR*)pusData)+4))[iCnt]);
+      }
+      SIII_VERBOSE(0, "\n");
+      break;
+    case CSMD_SERC_VAR_WORD_LEN:
+      SIII_VERBOSE
+          (
+            0,
+            "- Data type: 16 bit value list with %hu elements\n",
+            pusData[0] / 2
+          );
+      SIII_VERBOSE(0, "- Retrieved data:\n");
+      for (iCnt = 0; iCnt < (pusData[0] / 2); iCnt++)
+      {
+        SIII_VERBOSE(0, "0x%04hX ", ((USHORT*)(((UCHAR*)pusData)+4))[iCnt]);
+      }
+      SIII_VERBOSE(0, "\n");
+      break;
+    case CSMD_SERC_VAR_LONG_LEN:
+      SIII_VERBOSE
+          (
+            0,
+            "- Data type: 32 bit value list with %hu elements\n",
+            pusData[0] / 4
+          );
+      SIII_VERBOSE(0, "- Retrieved data:\n");
+      for (iCnt = 0; iCnt < (pusData[0] / 4); iCnt++)
+      {
+        SIII_VERBOSE(0, "0x%08X ", ((ULONG*)(((UCHAR*)pusData)+4))[iCnt]);
+        if (((iCnt+1) % 4)  == 0)
+        {
+          SIII_VERBOSE(0, "\n");
+        }
+      }
+      SIII_VERBOSE(0, "\n");
+      break;
+    case CSMD_SERC_VAR_DOUBLE_LEN:
+      SIII_VERBOSE
+          (
+            0,
+            "- Data type: 64 bit value list with %hu elements\n",
+            pusData[0] / 8
+          );
+      SIII_VERBOSE(0, "- Retrieved data:\n");
+      for (iCnt = 0; iCnt < (pusData[0] / 8); iCnt++)
+      {
+        SIII_VERBOSE(0, "0x%16llx ", ((ULONGLONG*)(((UCHAR*)pusData)+4))[iCnt]);
+      }
+      SIII_VERBOSE(0, "\n");
+      break;
+    default:
+      SIII_VERBOSE(0, "- Unknown data format, unable to display data.\n");
+      break;
+  }
+  /*lint -restore cast! */
+}
+
+/**
+ * \fn static const CHAR* SIII_SVCModeName(
+ *              SIII_SVC_ACCESS_MODE eAccessMode
+ *          )
+ *
+ * \private
+ *
+ * \brief   Returns the name of an SVC access mode for verbose output.
+ *
+ * \param[in]   eAccessMode     SVC access mode
+ *
+ * \return  Name of access mode
+ *
+ * \ingroup SIII
+ */
+static const CHAR* SIII_SVCModeName
+    (
+      SIII_SVC_ACCESS_MODE eAccessMode
+    )
+{
+  switch (eAccessMode)
+  {
+    case SIII_SVC_READ:
+      return("read");
+    case SIII_SVC_WRITE:
+      return("write");
+    default:
+      return("command");
+  }
+}
+
+/**
+ * \fn static VOID SIII_SVCStartRequest(
+ *              SIII_SVC_SLAVE_STRUCT *prSvcSlave
+ *          )
+ *
+ * \private
+ *
+ * \brief   Initializes the CoSeMa SVC macro of a slave for its active
+ *          request.
+ *
+ * \param[in,out]   prSvcSlave  Pointer to SVC structure of slave
+ *
+ * \return  None
+ *
+ * \ingroup SIII
+ */
+static VOID SIII_SVCStartRequest
+    (
+      SIII_SVC_SLAVE_STRUCT *prSvcSlave
+    )
+{
+  SIII_SVC_REQUEST_STRUCT*  prRequest = prSvcSlave->prActive;
+  CSMD_SVCH_MACRO_STRUCT*   prMacro   = &prSvcSlave->rSvcMacro;
+
+  prMacro->usSlaveIdx             = prRequest->usDevIdx;
+  prMacro->ulIdent_Nbr            = prRequest->ulIdent_Nbr;
+  prMacro->usElem                 = prRequest->usElem;
+  prMacro->pusAct_Data            = prRequest->pusData;
+  prMacro->usIsList               = (USHORT)  0;  // auto-detected
+  prMacro->usLength               = (USHORT)  0;  // auto-detected
+  prMacro->ulAttribute            = (ULONG)   0;
+  prMacro->usCancelActTrans       = (USHORT)  0;
+  prMacro->usPriority             = (USHORT)  0;
+  prMacro->usOtherRequestCanceled = (USHORT)  0;
+  prMacro->usSvchError            = (USHORT)  0;
+  prMacro->usInternalReq          = (USHORT)  0;
+  prMacro->usState                = (USHORT)  CSMD_START_REQUEST;
+
+  switch (prRequest->eAccessMode)
+  {
+    case SIII_SVC_READ:
+      // Automatic detection if list or single parameter
+      prMacro->usIsList = (USHORT) CSMD_ELEMENT_UNKNOWN_LENGTH;
+      break;
+
+    case SIII_SVC_WRITE:
+      break;
+
+    case SIII_SVC_CMD:
+    default:
+      SIII_VERBOSE
+          (
+            1,
+            "- Read parameter attribute to check whether it"
+            "really is a command.\n"
+          );
+
+      prMacro->pusAct_Data  = prSvcSlave->uCmdData.ausData;
+      prMacro->usElem       = (USHORT) 3;   // Element 3: Attribute
+      prRequest->usStep     = (USHORT) SIII_SVC_STEP_ATTR;
+      break;
+  }
+}
+
+/**
+ * \fn static BOOL SIII_SVCStepRequest(
+ *              SIII_INSTANCE_STRUCT *prS3Instance,
+ *              SIII_SVC_SLAVE_STRUCT *prSvcSlave
+ *          )
+ *
+ * \private
+ *
+ * \brief   Advances the active SVC request of a slave without blocking.
+ *
+ * \param[in,out]   prS3Instance    Pointer to SIII instance structure
+ * \param[in,out]   prSvcSlave      Pointer to SVC structure of slave
+ *
+ * \return  TRUE when the request is completed, its result is set in
+ *          eFuncRet of the request
+ *
+ * \details The CoSeMa SVC function of the current step is only called while
+ *          MBUSY is set in the service container of the slave. Otherwise, the
+ *          slave has not answered yet and the function returns at once.
+ *          Commands are performed in steps: Read attribute, set command,
+ *          read command status until the command is finished, and clear the
+ *          command.
+ *
+ * \ingroup SIII
+ */
+static BOOL SIII_SVCStepRequest
+    (
+      SIII_INSTANCE_STRUCT *prS3Instance,
+      SIII_SVC_SLAVE_STRUCT *prSvcSlave
+    )
+{
+  SIII_SVC_REQUEST_STRUCT*  prRequest = prSvcSlave->prActive;
+  CSMD_SVCH_MACRO_STRUCT*   prMacro   = &prSvcSlave->rSvcMacro;
+  CSMD_FUNC_RET             eMyFuncRet;
+  INT                       iCall;
+
+  for (iCall = 0; iCall < SIII_SVC_MAX_CALLS; iCall++)
+  {
+    // Check if MBUSY is set, if it is not set do nothing
+    if (
+        (
+          prS3Instance->rCosemaInstance.rPriv.prSVContainer[prMacro->usSlaveIdx]->rCONTROL.usWord[0] &
+          CSMD_SVC_CTRL_M_BUSY
+        ) == 0
+      )
+    {
+      return(FALSE);
+    }
+
+    if (prRequest->eAccessMode == SIII_SVC_READ)
+    {
+      eMyFuncRet = CSMD_ReadSVCH
+          (
+            &prS3Instance->rCosemaInstance, // CoSeMa instance
+            prMacro,                        // SVC macro structure
+            NULL                            // No callback
+          );
+
+      SIII_VERBOSE
+          (
+            1,
+            "- CSMD_ReadSVCH - state = %i, return value = 0x%X\n",
+            prMacro->usState,
+            eMyFuncRet
+          );
+
+      if (prMacro->usState == (USHORT) CSMD_DATA_VALID)
+      {
+        prRequest->ulAttribute = prMacro->ulAttribute;
+        prRequest->eFuncRet = SIII_NO_ERROR;
+        return(TRUE);
+      }
+      else if (prMacro->usState == (USHORT) CSMD_REQUEST_ERROR)
+      {
+        SIII_VERBOSE
+            (
+              1,
+              "- Error: SVC read not successful. Error: 0x%hX\n",
+              prMacro->usSvchError
+            );
+        prRequest->eFuncRet = SIII_SVC_ERROR;
+        return(TRUE);
+      }
+    }
+    else if (prRequest->eAccessMode == SIII_SVC_WRITE)
+    {
+      eMyFuncRet = CSMD_WriteSVCH
+          (
+            &prS3Instance->rCosemaInstance, // CoSeMa instance
+            prMacro,                        // SVC macro structure
+            NULL                            // No callback
+          );
+
+      SIII_VERBOSE
+          (
+            1,
+            "- CSMD_WriteSVCH - state = %i, return value = 0x%X\n",
+            prMacro->usState,
+            eMyFuncRet
+          );
+
+      if (prMacro->usState == (USHORT) CSMD_DATA_VALID)
+      {
+        prRequest->eFuncRet = SIII_NO_ERROR;
+        return(TRUE);
+      }
+      else if (prMacro->usState == (USHORT) CSMD_REQUEST_ERROR)
+      {
+        SIII_VERBOSE
+            (
+              1,
+              "- Error: SVC write not successful. Error: 0x%hX\n",
+              prMacro->usSvchError
+            );
+        prRequest->eFuncRet = SIII_SVC_ERROR;
+        return(TRUE);
+      }
+    }
+    else if (prRequest->eAccessMode == SIII_SVC_CMD)
+    {
+      switch (prRequest->usStep)
+      {
+        case SIII_SVC_STEP_ATTR:
+          eMyFuncRet = CSMD_ReadSVCH
+              (
+                &prS3Instance->rCosemaInstance, // CoSeMa instance
+                prMacro,                        // SVC macro structure
+                NULL                            // No callback
+              );
+
+          SIII_VERBOSE
+              (
+                1,
+                "- CSMD_ReadSVCH - state = %i, return value = 0x%X\n",
+                prMacro->usState,
+                eMyFuncRet
+              );
+
+          if (prMacro->usState == (USHORT) CSMD_REQUEST_ERROR)
+          {
+            SIII_VERBOSE(1, "- Error reading parameter attribute.\n");
+            prRequest->eFuncRet = SIII_SVC_ERROR;
+            return(TRUE);
+          }
+          else if (prMacro->usState == (USHORT) CSMD_DATA_VALID)
+          {
+            if ((prSvcSlave->uCmdData.ulAttribute & CSMD_SERC_PROC_CMD) == 0)
+            {
+              SIII_VERBOSE(1, "- Error: Parameter is not a command.\n");
+              prRequest->eFuncRet = SIII_SVC_NO_CMD_PAR_ERROR;
+              return(TRUE);
+            }
+
+            prMacro->usState    = (USHORT) CSMD_START_REQUEST;
+            prMacro->usElem     = (USHORT) 7;   // Element 7: Operation data
+            prRequest->usStep   = (USHORT) SIII_SVC_STEP_SET_CMD;
+          }
+          break;
+
+        case SIII_SVC_STEP_SET_CMD:
+          eMyFuncRet = CSMD_SetCommand
+              (
+                &prS3Instance->rCosemaInstance, // CoSeMa instance
+                prMacro,                        // SVC macro structure
+                NULL                            // No callback
+              );
+
+          SIII_VERBOSE
+              (
+                1,
+                "- CSMD_SetCommand - state = %i, return value = 0x%X\n",
+                prMacro->usState,
+                eMyFuncRet
+              );
+
+          if (prMacro->usState == (USHORT) CSMD_REQUEST_ERROR)
+          {
+            SIII_VERBOSE(1, "- Error: SVC set command not successful.\n");
+            prRequest->eFuncRet = SIII_SVC_ERROR;
+            return(TRUE);
+          }
+          else if (prMacro->usState == (USHORT) CSMD_CMD_ACTIVE)
+          {
+            SIII_VERBOSE(1, "- SVC command active...\n");
+
+            prMacro->usState    = (USHORT) CSMD_START_REQUEST;
+            prMacro->usLength   = (USHORT) 4;   // 4 Byte value
+            prMacro->usElem     = (USHORT) 1;   // Element 1: IDN
+            prRequest->usStep   = (USHORT) SIII_SVC_STEP_CMD_STATUS;
+          }
+          break;
+
+        case SIII_SVC_STEP_CMD_STATUS:
+          eMyFuncRet = CSMD_ReadCmdStatus
+              (
+                &prS3Instance->rCosemaInstance, // CoSeMa instance
+                prMacro,                        // SVC macro structure
+                NULL                            // No callback
+              );
+
+          SIII_VERBOSE
+              (
+                1,
+                "- CSMD_ReadCmdStatus - state = %i, return value = 0x%X\n",
+                prMacro->usState,
+                eMyFuncRet
+              );
+
+          if (prMacro->usState == (USHORT) CSMD_CMD_STATUS_VALID)
+          {
+            if (
+                (prSvcSlave->uCmdData.ausData[0] != CSMD_CMD_FINISHED)  &&
+                (prSvcSlave->uCmdData.ausData[0] != CSMD_CMD_STOPPED)   &&
+                (prSvcSlave->uCmdData.ausData[0] != CSMD_CMD_ERROR)
+              )
+            {
+              // Command not done yet, read status again
+              prMacro->usState  = (USHORT) CSMD_START_REQUEST;
+              prMacro->usLength = (USHORT) 4;
+              prMacro->usElem   = (USHORT) 1;
+              break;
+            }
+            SIII_VERBOSE(1, "- SVC command done.\n");
+          }
+          else if (prMacro->usState == (USHORT) CSMD_REQUEST_ERROR)
+          {
+            SIII_VERBOSE(1, "- Error: SVC command not successfully completed.\n");
+          }
+          else
+          {
+            break;
+          }
+
+          // Clear command
+          prMacro->usState    = (USHORT) CSMD_START_REQUEST;
+          prMacro->usLength   = (USHORT) 0;
+          prMacro->usElem     = (USHORT) 7;     // Element 7: Operation data
+          prRequest->usStep   = (USHORT) SIII_SVC_STEP_CLEAR_CMD;
+          break;
+
+        case SIII_SVC_STEP_CLEAR_CMD:
+        default:
+          eMyFuncRet = CSMD_ClearCommand
+              (
+                &prS3Instance->rCosemaInstance,
+                prMacro,
+                NULL
+              );
+
+          SIII_VERBOSE
+              (
+                1,
+                "- CSMD_ClearCommand - state = %i, return value = 0x%X\n",
+                prMacro->usState,
+                eMyFuncRet
+              );
+
+          if (prMacro->usState == (USHORT) CSMD_CMD_CLEARED)
+          {
+            SIII_VERBOSE(1, "- SVC command cleared.\n");
+            prRequest->eFuncRet = SIII_NO_ERROR;
+            return(TRUE);
+          }
+          else if (prMacro->usState == (USHORT) CSMD_REQUEST_ERROR)
+          {
+            SIII_VERBOSE(1, "- Error: SVC clear command not successful.\n");
+            prRequest->eFuncRet = SIII_SVC_ERROR;
+            return(TRUE);
+          }
+          break;
+      }
+    }
+    else
+    {
+      SIII_VERBOSE(1, "- Error: Illegal SVC transaction\n");
+      prRequest->eFuncRet = SIII_SVC_ERROR;
+      return(TRUE);
+    }
+  }
+
+  return(FALSE);
+}
+
+/**
+ * \fn VOID SIII_SVCSchedule(
+ *              SIII_INSTANCE_STRUCT *prS3Instance
+ *          )
+ *
+ * \private
+ *
+ * \brief   Advances the SVC requests of all slaves. Called by
+ *          SIII_Cycle_Start() after CSMD_TxRxSoftCont().
+ *
+ * \param[in,out]   prS3Instance    Pointer to SIII instance structure
+ *
+ * \return  None
+ *
+ * \details Each slave has one request in process at a time, so the requests
+ *          of different slaves are transferred in parallel, at most one SVC
+ *          handshake step per slave and Sercos cycle. Queued requests are
+ *          started in the same cycle the previous request of the slave is
+ *          completed. The completion function of a request is called after
+ *          its result has been set. If the Sercos phase drops below CP2,
+ *          all requests are completed with SIII_SVC_PHASE_ERROR.
+ *
+ *          The slaves are served round-robin. When SIII_SVC_CYCLE_BUDGET is
+ *          used up, the remaining slaves are served in the next cycle. The
+ *          requests are only accessed while semSVCBlock is held. If it is
+ *          held by SIII_SVCSubmit() or SIII_SVCTransferBatch(), the requests
+ *          are served in the next cycle, so the cycle never waits for a
+ *          non-real-time thread.
+ *
+ * \ingroup SIII
+ */
+VOID SIII_SVCSchedule
+    (
+      SIII_INSTANCE_STRUCT *prS3Instance
+    )
+{
+  SIII_SVC_SLAVE_STRUCT*    prSvcSlave;
+  SIII_SVC_REQUEST_STRUCT*  prRequest;
+  RTOS_TIMESPEC             rTimeStart;
+  RTOS_TIMESPEC             rTimeNow;
+  RTOS_TIMESPEC             rTimeDiff;
+  BOOL                      boPhaseOk;
+  BOOL                      boPending   = FALSE;
+  BOOL                      boDone;
+  USHORT                    usActive    = 0;
+  USHORT                    usSlave;
+  INT                       iCnt;
+
+  // Requests submitted from now on are handled in the next cycle
+  prS3Instance->ulSvcSeenCnt = prS3Instance->ulSvcSubmitCnt;
+
+  if (RTOS_TrySemaphore(&prS3Instance->semSVCBlock) != RTOS_RET_OK)
+  {
+    // Requests are changed by a non-real-time thread, retry in next cycle
+    if (prS3Instance->usSvcActive == 0)
+    {
+      prS3Instance->usSvcActive = 1;
+    }
+    return;
+  }
+
+  boPhaseOk = (SIII_GetSercosPhase(prS3Instance) >= SIII_PHASE_CP2);
+  usSlave   = prS3Instance->usSvcNextSlave;
+
+  RTOS_GetSystemTime(&rTimeStart);
+
+  for (iCnt = 0; iCnt < SIII_MAX_SLAVES; iCnt++)
+  {
+    prSvcSlave = &prS3Instance->arSvcSlave[usSlave];
+
+    if (++usSlave >= SIII_MAX_SLAVES)
+    {
+      usSlave = 0;
+    }
+
+    if (
+        (prSvcSlave->prActive == NULL)  &&
+        (prSvcSlave->prHead   == NULL)
+      )
+    {
+      continue;
+    }
+
+    do
+    {
+      boDone = FALSE;
+
+      if (prSvcSlave->prActive == NULL)
+      {
+        if (prSvcSlave->prHead == NULL)
+        {
+          break;
+        }
+
+        // Take next request of slave from queue
+        prSvcSlave->prActive  = prSvcSlave->prHead;
+        prSvcSlave->prHead    = prSvcSlave->prHead->prNext;
+
+        prSvcSlave->prActive->prNext = NULL;
+
+        if (boPhaseOk)
+        {
+          SIII_SVCStartRequest(prSvcSlave);
+        }
+      }
+
+      if (
+          !boPhaseOk                                        ||
+          SIII_SVCStepRequest(prS3Instance, prSvcSlave)
+        )
+      {
+        prRequest             = prSvcSlave->prActive;
+        prSvcSlave->prActive  = NULL;
+        boDone                = TRUE;
+
+        if (boPhaseOk)
+        {
+          prRequest->usSvchError = prSvcSlave->rSvcMacro.usSvchError;
+        }
+        else
+        {
+          prRequest->eFuncRet = SIII_SVC_PHASE_ERROR;
+        }
+
+        if (prRequest->fpDone != NULL)
+        {
+          prRequest->fpDone((VOID*) prS3Instance, prRequest);
+        }
+      }
+    }
+    // Start next request of slave at once, so queued requests do not lose
+    // a Sercos cycle each
+    while (boDone);
+
+    if (
+        (prSvcSlave->prActive != NULL)  ||
+        (prSvcSlave->prHead   != NULL)
+      )
+    {
+      usActive++;
+    }
+
+    // Check time budget
+    RTOS_GetSystemTime(&rTimeNow);
+    RTOS_GetTimeDifference(&rTimeNow, &rTimeStart, &rTimeDiff);
+
+    if (
+        (RTOS_GetTimeS(&rTimeDiff) != 0)                        ||
+        (RTOS_GetTimeNs(&rTimeDiff) >= SIII_SVC_CYCLE_BUDGET)
+      )
+    {
+      // Continue with next slave in next cycle
+      boPending = TRUE;
+      break;
+    }
+  }
+
+  prS3Instance->usSvcNextSlave  = usSlave;
+  prS3Instance->usSvcActive     = (boPending && (usActive == 0)) ? 1 : usActive;
+
+  (VOID)RTOS_PostSemaphore(&prS3Instance->semSVCBlock);
+}
+
+/**
+ * \fn VOID SIII_SVCInitRequest(
+ *              SIII_SVC_REQUEST_STRUCT *prRequest,
+ *              SIII_SVC_ACCESS_MODE eAccessMode,
+ *              USHORT  usDevIdx,
+ *              BOOL    boIsStdPar,
+ *              USHORT  usIdn,
+ *              USHORT  usSI,
+ *              USHORT  usSE,
+ *              USHORT  usElem,
+ *              USHORT* pusData,
+ *              USHORT  usLen,
+ *              FP_SVC_DONE fpDone,
+ *              VOID*   pvUser
+ *          )
+ *
+ * \public
+ *
+ * \brief   This function initializes an SVC request for SIII_SVCSubmit().
+ *
+ * \param[out]      prRequest       Pointer to SVC request
+ * \param[in]       eAccessMode     Read, write or command
+ * \param[in]       usDevIdx        Slave device index
+ * \param[in]       boIsStdPar      Indicates whether a standard (S) parameter
+ *                                  - TRUE for standard (S) parameter
+ *                                  - FALSE for device-specific (P) parameter
+ * \param[in]       usIdn           IDN of parameter
+ * \param[in]       usSI            Structural instance of parameter
+ * \param[in]       usSE            Structural element of parameter
+ * \param[in]       usElem          Element of parameter, ignored for commands
+ * \param[in,out]   pusData         Pointer to data buffer, NULL for commands
+ * \param[in]       usLen           Length of buffer pusData in bytes
+ * \param[in]       fpDone          Function called on completion or NULL
+ * \param[in]       pvUser          User data for fpDone
+ *
+ * \return  None
+ *
+ * \ingroup SIII
+ */
+VOID SIII_SVCInitRequest
+    (
+      SIII_SVC_REQUEST_STRUCT *prRequest,
+      SIII_SVC_ACCESS_MODE eAccessMode,
+      USHORT  usDevIdx,
+      BOOL    boIsStdPar,
+      USHORT  usIdn,
+      USHORT  usSI,
+      USHORT  usSE,
+      USHORT  usElem,
+      USHORT* pusData,
+      USHORT  usLen,
+      FP_SVC_DONE fpDone,
+      VOID*   pvUser
+    )
+{
+  prRequest->eAccessMode  = eAccessMode;
+  prRequest->usDevIdx     = usDevIdx;
+  prRequest->ulIdent_Nbr  =
+      CSMD_EIDN
+          (
+            usIdn,
+            usSI,
+            usSE
+          );
+
+  if (!boIsStdPar)
+  {
+    // Device-specific IDN (P parameter)
+    prRequest->ulIdent_Nbr |= ((ULONG) 1) << ((ULONG) 15);
+  }
+
+  prRequest->usElem       = (eAccessMode == SIII_SVC_CMD) ? (USHORT) 7 : usElem;
+                              // Element 7: Operation data
+  prRequest->pusData      = pusData;
+  prRequest->usLen        = usLen;
+  prRequest->fpDone       = fpDone;
+  prRequest->pvUser       = pvUser;
+  prRequest->eFuncRet     = SIII_NO_ERROR;
+  prRequest->usSvchError  = (USHORT) 0;
+  prRequest->ulAttribute  = (ULONG) 0;
+  prRequest->usStep       = (USHORT) 0;
+  prRequest->prNext       = NULL;
+}
+
+/**
+ * \fn SIII_FUNC_RET SIII_SVCSubmit(
+ *              SIII_INSTANCE_STRUCT *prS3Instance,
+ *              SIII_SVC_REQUEST_STRUCT *prRequest
+ *          )
+ *
+ * \public
+ *
+ * \brief   This function queues an SVC request without waiting for its
+ *          completion.
+ *
+ * \note    The Sercos phase needs to be CP2 or higher. The request has to be
+ *          initialized by SIII_SVCInitRequest() and must not be changed or
+ *          released until it is completed. The requests of a slave are
+ *          performed in the order they are submitted, the requests of
+ *          different slaves in parallel.
+ *
+ * \param[in,out]   prS3Instance    Pointer to SIII instance structure
+ * \param[in,out]   prRequest       Pointer to SVC request
+ *
+ * \return  See definition of SIII_FUNC_RET
+ *          - SIII_NO_ERROR         when the request is queued
+ *          - SIII_PARAMETER_ERROR  for function parameter error
+ *          - SIII_SVC_PHASE_ERROR  when phase is not CP2 or higher
+ *          - SIII_DEVICE_IDX_ERROR for illegal device index
+ *
+ * \details eFuncRet of the request is SIII_FUNCTION_IN_PROCESS until the
+ *          request is completed. Then, it contains the result and fpDone of
+ *          the request is called from SIII_Cycle_Start() in the context of
+ *          the real-time cycle. fpDone must not block and shall return
+ *          quickly, e.g. by only posting a semaphore the requester waits
+ *          for.
+ *
+ * \ingroup SIII
+ */
+SIII_FUNC_RET SIII_SVCSubmit
+    (
+      SIII_INSTANCE_STRUCT *prS3Instance,
+      SIII_SVC_REQUEST_STRUCT *prRequest
+    )
+{
+  SIII_SVC_SLAVE_STRUCT*  prSvcSlave;
+
+  SIII_VERBOSE(3, "SIII_SVCSubmit()\n");
+
+  if (
+      (prS3Instance == NULL)  ||
+      (prRequest    == NULL)
+    )
+  {
+    return(SIII_PARAMETER_ERROR);
+  }
+  else if (SIII_GetSercosPhase(prS3Instance) < SIII_PHASE_CP2)
+  {
+    return(SIII_SVC_PHASE_ERROR);
+  }
+  else if (prRequest->usDevIdx >= prS3Instance->rCosemaInstance.rSlaveList.usNumProjSlaves)
+  {
+    return(SIII_DEVICE_IDX_ERROR);
+  }
+
+  prRequest->eFuncRet = SIII_FUNCTION_IN_PROCESS;
+  prRequest->prNext   = NULL;
+  prSvcSlave          = &prS3Instance->arSvcSlave[prRequest->usDevIdx];
+
+  // Append to queue of slave
+  /*lint -save -e722 */
+  while(RTOS_WaitForSemaphore(&prS3Instance->semSVCBlock) != RTOS_RET_OK);
+  /*lint -restore */
+
+  if (prSvcSlave->prHead == NULL)
+  {
+    prSvcSlave->prHead = prRequest;
+  }
+  else
+  {
+    prSvcSlave->prTail->prNext = prRequest;
+  }
+  prSvcSlave->prTail = prRequest;
+
+  // Notify SIII_Cycle_Start()
+  prS3Instance->ulSvcSubmitCnt++;
+
+  (VOID)RTOS_PostSemaphore(&prS3Instance->semSVCBlock);
+
+  return(SIII_NO_ERROR);
+}
+
+/**
+ * \fn static VOID SIII_SVCPostDone(
+ *              VOID *pvS3Instance,
+ *              SIII_SVC_REQUEST_STRUCT *prRequest
+ *          )
+ *
+ * \private
+ *
+ * \brief   Completion function of the blocking SVC functions. Posts the
+ *          semaphore given as user data of the request.
+ *
+ * \param[in]   pvS3Instance    Pointer to SIII instance structure
+ * \param[in]   prRequest       Completed SVC request
+ *
+ * \return  None
+ *
+ * \ingroup SIII
+ */
+/*lint -save -e715 -e818 */
+static VOID SIII_SVCPostDone
+    (
+      VOID *pvS3Instance,
+      SIII_SVC_REQUEST_STRUCT *prRequest
+    )
+{
+  (VOID)RTOS_PostSemaphore((RTOS_SEMAPHORE*) prRequest->pvUser);
+}
+/*lint -restore */
+
+/**
+ * \fn static VOID SIII_SVCCancelRequest(
+ *              SIII_INSTANCE_STRUCT *prS3Instance,
+ *              SIII_SVC_REQUEST_STRUCT *prRequest
+ *          )
+ *
+ * \private
+ *
+ * \brief   Removes a request that is not completed yet from the queue of its
+ *          slave and completes it with SIII_TIMEOUT_ERROR without calling
+ *          fpDone.
+ *
+ * \note    semSVCBlock needs to be held by the caller.
+ *
+ * \param[in,out]   prS3Instance    Pointer to SIII instance structure
+ * \param[in,out]   prRequest       Pointer to SVC request
+ *
+ * \return  None
+ *
+ * \ingroup SIII
+ */
+static VOID SIII_SVCCancelRequest
+    (
+      SIII_INSTANCE_STRUCT *prS3Instance,
+      SIII_SVC_REQUEST_STRUCT *prRequest
+    )
+{
+  SIII_SVC_SLAVE_STRUCT*    prSvcSlave  = &prS3Instance->arSvcSlave[prRequest->usDevIdx];
+  SIII_SVC_REQUEST_STRUCT*  prPrev      = NULL;
+  SIII_SVC_REQUEST_STRUCT*  prCur       = prSvcSlave->prHead;
+
+  if (prSvcSlave->prActive == prRequest)
+  {
+    // Abandon the SVC transfer, the next request restarts the SVC macro
+    prSvcSlave->prActive = NULL;
+  }
+  else
+  {
+    while ((prCur != NULL) && (prCur != prRequest))
+    {
+      prPrev = prCur;
+      prCur  = prCur->prNext;
+    }
+
+    if (prCur == NULL)
+    {
+      return;
+    }
 
-//---- function declarations --------------------------------------------------
+    if (prPrev == NULL)
+    {
+      prSvcSlave->prHead = prRequest->prNext;
+    }
+    else
+    {
+      prPrev->prNext = prRequest->prNext;
+    }
 
-//---- function implementations -----------------------------------------------
+    if (prSvcSlave->prTail == prRequest)
+    {
+      prSvcSlave->prTail = prPrev;
+    }
+  }
+
+  prRequest->prNext   = NULL;
+  prRequest->eFuncRet = SIII_TIMEOUT_ERROR;
+}
 
 /**
- * \fn VOID SIII_SVCThread(
- *              SIII_INSTANCE_STRUCT *prS3Instance
+ * \fn SIII_FUNC_RET SIII_SVCTransferBatch(
+ *              SIII_INSTANCE_STRUCT *prS3Instance,
+ *              SIII_SVC_REQUEST_STRUCT *parRequest,
+ *              USHORT usNumRequests
  *          )
  *
- * \private
- *
- * \brief   Service channel thread.
+ * \public
  *
- * \param[in,out] prS3Instance Pointer to SIII instance structure
+ * \brief   This function performs a number of SVC requests on any slaves
+ *          and waits for their completion. The function is blocking.
  *
- * \details This function is activated when the semaphore
- *          prS3Instance->semSVCStart is posted. The thread handles the calling
- *          of the CoSeMa soft service channel interface. The thread must not
- *          be activated before Sercos phase CP2.
+ * \note    The Sercos phase needs to be CP2 or higher. The requests have to
+ *          be initialized by SIII_SVCInitRequest(), fpDone and pvUser are
+ *          overwritten.
  *
- *          Input to the function are the data structures
- *          prS3Instance->rMySvcMacro and prS3Instance->rMySVCAccess that have
- *          to be initialized accordingly before, as well as the CoSeMa instance
- *          prS3Instance->rCosemaInstance.
+ * \param[in,out]   prS3Instance    Pointer to SIII instance structure
+ * \param[in,out]   parRequest      Array of SVC requests
+ * \param[in]       usNumRequests   Number of requests
  *
- *          The output data is returned in the data structure
- *          prS3Instance->rMySVCResult.
- *          Possible values of the return value
- *          prS3Instance->rMySVCResult.eFuncRet are as follows:
- *          - SIII_NO_ERROR             for success
- *          - SIII_SVC_ERROR            for a generic service channel error
- *          - SIII_SVC_NO_CMD_PAR_ERROR when it is tried to perform a command
- *                                      on a non-command parameter
+ * \return  See definition of SIII_FUNC_RET
+ *          - SIII_NO_ERROR         for success of all requests
+ *          - SIII_SEMAPHORE_ERROR  when the semaphore could not be created
+ *          - Error of the first failed request otherwise
  *
- * \note    This function is private. It shall not be called directly by an
- *          application.
+ * \details All requests are submitted at once. The requests of different
+ *          slaves are performed in parallel, the requests of a slave one
+ *          after another without an idle cycle in between. The result of
+ *          each request is stored in its eFuncRet and usSvchError, also for
+ *          requests that could not be submitted. If no request is
+ *          completed within SIII_SVC_BATCH_TIMEOUT, e.g. because the Sercos
+ *          cycle has stopped, the remaining requests are cancelled with
+ *          SIII_TIMEOUT_ERROR.
  *
  * \ingroup SIII
- *
- * \author GMy
- *
- * \date 18.01.2013
- *
- * \version 2013-02-19 (GMy): Performance optimization: SVC thread now
- *                            continuously runs and does not need to be started
- *                            again for every SVC transfer. Support for list data
- *                            types.
- * \version 2013-06-12 (GMy): Bugfix / optimization: Corrected error reaction
- *                            when command error occurs.
- * \version 2016-08-22 WK:    Support parameter set of the IDN.
- * \version 2016-09-20 WK:    Check MBusy as a substitute for a sleeptime for the 
- +                            execution of the next SVC step.
  */
-VOID SIII_SVCThread
+SIII_FUNC_RET SIII_SVCTransferBatch
     (
-      SIII_INSTANCE_STRUCT *prS3Instance
+      SIII_INSTANCE_STRUCT *prS3Instance,
+      SIII_SVC_REQUEST_STRUCT *parRequest,
+      USHORT usNumRequests
     )
 {
-#undef SIII_SVC_RUNTIME_MEASUREMENT  // For debug purposes only!
-
-  CSMD_FUNC_RET eMyFuncRet      = CSMD_NO_ERROR;
-  ULONG         ulSvcDataFormat = 0;
-  INT           iCnt            = 0;
-#ifdef SIII_SVC_RUNTIME_MEASUREMENT
-  RTOS_TIMESPEC   timeStart;
-  RTOS_TIMESPEC   timeEnd;
-  RTOS_TIMESPEC   timeDiff;
-  LONG            lSIII_SVC_WorkingTimeS;
-  LONG            lSIII_SVC_WorkingTimeNs;
-  DOUBLE          dSIII_SVC_WorkingTime;
-#endif
-
-  SIII_VERBOSE(3, "SIII_SVCThread()\n");
-
-  // Set own thread priority
-  if (RTOS_SetThreadPriority(RTOS_THREAD_PRIORITY_SVC) != RTOS_RET_OK)
+  RTOS_SEMAPHORE  semDone;
+  SIII_FUNC_RET   eS3FuncRet  = SIII_NO_ERROR;
+  USHORT          usSubmitted = 0;
+  USHORT          usCnt;
+  INT             iLevel      = (usNumRequests == 1) ? 0 : 1;
+                                // Single transfers are reported as before
+  SIII_VERBOSE(3, "SIII_SVCTransferBatch()\n");
+
+  if (parRequest == NULL)
   {
-    SIII_VERBOSE(0, "Error: Failed to set priority of SVC thread.\n");
-    exit(-1);
+    return(SIII_PARAMETER_ERROR);
   }
 
-  RTOS_AllowRemoteClose();
-
-  /*lint -save -e716 */
-  while (TRUE)
-  /*lint -restore */
+  if (RTOS_CreateSemaphore(&semDone, "S.SVCDone") != RTOS_RET_OK)
   {
-    // Wait for started SVC request
-    /*lint -save -e722 */
-    while(RTOS_WaitForSemaphore(&prS3Instance->semSVCStart) != RTOS_RET_OK);
-    /*lint -restore */
-
-    prS3Instance->rMySvcMacro.usState = (USHORT) CSMD_START_REQUEST;
-
-    switch(prS3Instance->rMySVCAccessMode) {
-
-      case SIII_SVC_READ:
-
-        SIII_VERBOSE
-            (
-              0,
-              "- Starting SVC read (%c-%1u-%04lu.%lu.%lu) on device #%d...\n",
-              SIII_GET_S_P(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              SIII_GET_IDNSET(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              SIII_GET_IDN(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              SIII_GET_SI(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              SIII_GET_SE(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              prS3Instance->rMySvcMacro.usSlaveIdx
-            );
-
-#ifdef SIII_SVC_RUNTIME_MEASUREMENT
-        // Get start time for calculation of runtime of cyclic functions
-        RTOS_GetSystemTime( &timeStart );
-#endif
-        do {
-          // Check if MBUSY is set, if it is not set do nothing
-          if ( prS3Instance->rCosemaInstance.rPriv.prSVContainer[prS3Instance->rMySvcMacro.usSlaveIdx]->rCONTROL.usWord[0] & CSMD_SVC_CTRL_M_BUSY )
-          {
-            eMyFuncRet = CSMD_ReadSVCH
-                (
-                  &prS3Instance->rCosemaInstance, // CoSeMa instance
-                  &prS3Instance->rMySvcMacro,     // SVC macro structure
-                  NULL                            // No callback
-                );
-
-            SIII_VERBOSE
-                (
-                  1,
-                  "- CSMD_ReadSVCH - state = %i, return value = 0x%X\n",
-                  prS3Instance->rMySvcMacro.usState,
-                  eMyFuncRet
-                );
-          }
-
-        } while (
-              (prS3Instance->rMySvcMacro.usState != (USHORT) CSMD_DATA_VALID)     &&
-              (prS3Instance->rMySvcMacro.usState != (USHORT) CSMD_REQUEST_ERROR)
-            );
-#ifdef SIII_SVC_RUNTIME_MEASUREMENT
-        // Get start time for calculation of runtime of cyclic functions
-        RTOS_GetSystemTime( &timeEnd );
-
-        RTOS_GetTimeDifference
-        (
-          &timeEnd,       // End time of measurement interval
-          &timeStart,     // Start time of measurement interval
-          &timeDiff       // Time difference (= working time)
-        );
-
-        lSIII_SVC_WorkingTimeNs = RTOS_GetTimeNs(&timeDiff);
-        lSIII_SVC_WorkingTimeS  = RTOS_GetTimeS(&timeDiff);
-        dSIII_SVC_WorkingTime =  (DOUBLE)(lSIII_SVC_WorkingTimeS * 1000) + (DOUBLE)(lSIII_SVC_WorkingTimeNs) / (DOUBLE)(1000*1000);
-
-        SIII_VERBOSE
-        (
-          0,
-          "- Time required for the SVC transmission: %.2f ms\n",
-          dSIII_SVC_WorkingTime
-        );
-#endif
-
-        if (prS3Instance->rMySvcMacro.usState == (USHORT) CSMD_DATA_VALID)
-        {
-          SIII_VERBOSE(0, "- SVC read successful.\n");
-
-          ulSvcDataFormat = prS3Instance->rMySvcMacro.ulAttribute &
-                    (ULONG) CSMD_SERC_LEN;
-
-          // Type cast of retrieved data, depending on data type of parameter
-          // \todo: OK for big endian?
-          switch(ulSvcDataFormat)
-          {
-            case CSMD_SERC_WORD_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 16 bit value\n"
-                  );
-              /*lint -save -e740 cast! */
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Retrieved data: %hu, 0x%04hX\n",
-                    *((USHORT*)prS3Instance->rMySVCResult.ausSVCData),
-                    *((USHORT*)prS3Instance->rMySVCResult.ausSVCData)
-                  );
-              /*lint -restore cast! */
-              break;
-            case CSMD_SERC_LONG_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 32 bit value\n"
-                  );
-              /*lint -save -e740 cast! */
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Retrieved data: %lu, 0x%08lX\n",
-                    *((ULONG*)prS3Instance->rMySVCResult.ausSVCData),
-                    *((ULONG*)prS3Instance->rMySVCResult.ausSVCData)
-                  );
-              /*lint -restore cast! */
-              break;
-            case CSMD_SERC_DOUBLE_LEN:
-              SIII_VERBOSE(   0,
-                      "- Data type: 64 bit value\n");
-              /*lint -save -e740 cast! */
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Retrieved data: %llu, 0x%016llX\n",
-                    *((ULONGLONG*)prS3Instance->rMySVCResult.ausSVCData),
-                    *((ULONGLONG*)prS3Instance->rMySVCResult.ausSVCData)
-                  );
-              /*lint -restore cast! */
-              break;
-            case CSMD_SERC_VAR_BYTE_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 8 bit value list / string with %hu elements\n",
-                    prS3Instance->rMySVCResult.ausSVCData[0]
-                  );
-              SIII_VERBOSE(0, "- Retrieved data:\n");
-              /*lint -save -e740 cast! */
-              for (   
-                  iCnt = 0;
-                  iCnt < prS3Instance->rMySVCResult.ausSVCData[0];
-                  iCnt++
-                )
-              {
-                SIII_VERBOSE
-                    (
-                      0,
-                      "%c",
-                      (((CHAR*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                    );
-              }
-              SIII_VERBOSE(0, "\n");
-              for (   
-                  iCnt = 0;
-                  iCnt < prS3Instance->rMySVCResult.ausSVCData[0];
-                  iCnt++
-                )
-              {
-                SIII_VERBOSE
-                    (
-                      0,
-                      "0x%02hhX ",
-                      (((CHAR*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                    );
-              }
-              /*lint -restore cast! */
-              SIII_VERBOSE(0, "\n");
-              break;
-            case CSMD_SERC_VAR_WORD_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 16 bit value list with %hu elements\n",
-                    prS3Instance->rMySVCResult.ausSVCData[0] / 2
-                  );
-              SIII_VERBOSE(0, "- Retrieved data:\n");
-              for (   
-                  iCnt = 0;
-                  iCnt < (prS3Instance->rMySVCResult.ausSVCData[0] / 2);
-                  iCnt++
-                )
-              {
-                /*lint -save -e740 cast! */
-                SIII_VERBOSE
-                  (
-                    0,
-                    "0x%04hX ",
-                    (((USHORT*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                  );
-                /*lint -restore cast! */
-              }
-              SIII_VERBOSE(0, "\n");
-              break;
-            case CSMD_SERC_VAR_LONG_LEN:
-              SIII_VERBOSE
-                  (   0,
-                    "- Data type: 32 bit value list with %hu elements\n",
-                    prS3Instance->rMySVCResult.ausSVCData[0] / 4
-                  );
-              SIII_VERBOSE(0, "- Retrieved data:\n");
-              for (   iCnt = 0;
-                  iCnt < (prS3Instance->rMySVCResult.ausSVCData[0] / 4);
-                  iCnt++)
-              {
-                /*lint -save -e740 cast! */
-                SIII_VERBOSE
-                    (
-                      0,
-                      "0x%08lX ",
-                      (((ULONG*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                    );
-                /*lint -restore cast! */
-                if (((iCnt+1) % 4)  == 0)
-                {
-                  SIII_VERBOSE( 0, "\n");
-                }
-              }
-              SIII_VERBOSE(0, "\n");
-              break;
-            case CSMD_SERC_VAR_DOUBLE_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 64 bit value list with %hu elements\n",
-                    prS3Instance->rMySVCResult.ausSVCData[0] / 8
-                  );
-              SIII_VERBOSE(0, "- Retrieved data:\n");
-              for (   iCnt = 0;
-                  iCnt < (prS3Instance->rMySVCResult.ausSVCData[0] / 8);
-                  iCnt++)
-              {
-                /*lint -save -e740 cast! */
-                SIII_VERBOSE
-                    (
-                      0,
-                      "0x%16llx ",
-                      (((ULONGLONG*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                    );
-                /*lint -restore cast! */
-              }
-              SIII_VERBOSE(0, "\n");
-              break;
-            default:
-              SIII_VERBOSE(0, "- Unknown data format, unable to display data.\n");
-              break;
-          }
-          prS3Instance->rMySVCResult.eFuncRet = SIII_NO_ERROR;
-        }
-        else
-        {
-          SIII_VERBOSE
-              (
-                0,
-                "- Error: SVC read not successful. Error: 0x%hX\n",
-                prS3Instance->rMySvcMacro.usSvchError
-              );
-          prS3Instance->rMySVCResult.eFuncRet = SIII_SVC_ERROR;
-        }
-
-        break;
-
-      case SIII_SVC_WRITE:
-        SIII_VERBOSE
-            (
-              0,
-              "- Starting SVC write (%c-%1u-%04lu.%lu.%lu) on device #%d...\n",
-              SIII_GET_S_P(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              SIII_GET_IDNSET(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              SIII_GET_IDN(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              SIII_GET_SI(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              SIII_GET_SE(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-              prS3Instance->rMySvcMacro.usSlaveIdx
-            );
-
-        do {
-          // Check if MBUSY is set, if it is not set do nothing
-          if ( prS3Instance->rCosemaInstance.rPriv.prSVContainer[prS3Instance->rMySvcMacro.usSlaveIdx]->rCONTROL.usWord[0] & CSMD_SVC_CTRL_M_BUSY )
-          {
-            eMyFuncRet = CSMD_WriteSVCH
-                (
-                  &prS3Instance->rCosemaInstance, // CoSeMa instance
-                  &prS3Instance->rMySvcMacro,     // SVC macro structure
-                  NULL                            // No callback
-                );
-
-            SIII_VERBOSE
-                (
-                  1,
-                  "- CSMD_WriteSVCH - state = %i, return value = 0x%X\n",
-                  prS3Instance->rMySvcMacro.usState,
-                  eMyFuncRet
-                );
-          }
-
-        } while (
-              (prS3Instance->rMySvcMacro.usState != CSMD_DATA_VALID)    &&
-              (prS3Instance->rMySvcMacro.usState != CSMD_REQUEST_ERROR)
-            );
-
-        if (prS3Instance->rMySvcMacro.usState == CSMD_DATA_VALID)
-        {
-          SIII_VERBOSE(0, "- SVC write successful.\n");
+    return(SIII_SEMAPHORE_ERROR);
+  }
 
-/*          // Display written data
-          ulSvcDataFormat = prS3Instance->rMySvcMacro.ulAttribute &
-                              (ULONG) CSMD_SERC_LEN;
+  for (usCnt = 0; usCnt < usNumRequests; usCnt++)
+  {
+    parRequest[usCnt].fpDone = SIII_SVCPostDone;
+    parRequest[usCnt].pvUser = &semDone;
 
-          // Type cast of retrieved data, depending on data type of parameter
-          // \todo: OK for big endian?
-          switch(ulSvcDataFormat)
-          {
-            case CSMD_SERC_WORD_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 16 bit value\n"
-                  );
-              //lint -save -e740 cast!
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Wrote data: %hu, 0x%04hX\n",
-                    *((USHORT*)prS3Instance->rMySVCResult.ausSVCData),
-                    *((USHORT*)prS3Instance->rMySVCResult.ausSVCData)
-                  );
-              //lint -restore cast!
-              break;
-            case CSMD_SERC_LONG_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 32 bit value\n"
-                  );
-              //lint -save -e740 cast!
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Wrote data: %lu, 0x%08lX\n",
-                    *((ULONG*)prS3Instance->rMySVCResult.ausSVCData),
-                    *((ULONG*)prS3Instance->rMySVCResult.ausSVCData)
-                  );
-              //lint -restore cast!
-              break;
-            case CSMD_SERC_DOUBLE_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 64 bit value\n"
-                  );
-              //lint -save -e740 cast!
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Wrote data: %llu, 0x%016llX\n",
-                    *((ULONGLONG*)prS3Instance->rMySVCResult.ausSVCData),
-                    *((ULONGLONG*)prS3Instance->rMySVCResult.ausSVCData)
-                  );
-              //lint -restore cast!
-              break;
-            case CSMD_SERC_VAR_BYTE_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 8 bit value list / string with %hu elements\n",
-                    prS3Instance->rMySVCResult.ausSVCData[0]
-                  );
-              SIII_VERBOSE(0, "- Retrieved data:\n");
-              //lint -save -e740 cast!
-              for ( 
-                  iCnt = 0;
-                  iCnt < prS3Instance->rMySVCResult.ausSVCData[0];
-                  iCnt++
-                )
-              {
-                SIII_VERBOSE
-                    (
-                      0,
-                      "%c",
-                      (((CHAR*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                    );
-              }
-              SIII_VERBOSE(0, "\n");
-              for (   
-                  iCnt = 0;
-                  iCnt < prS3Instance->rMySVCResult.ausSVCData[0];
-                  iCnt++
-                )
-              {
-                SIII_VERBOSE
-                    (
-                      0,
-                      "0x%02hhX ",
-                      (((CHAR*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                    );
-              }
-              //lint -restore cast!
-              SIII_VERBOSE(0, "\n");
-              break;
-            case CSMD_SERC_VAR_WORD_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 16 bit value list with %hu elements\n",
-                    prS3Instance->rMySVCResult.ausSVCData[0] / 2
-                  );
-              SIII_VERBOSE(0, "- Wrote data:\n");
-              for (   
-                  iCnt = 0;
-                  iCnt < (prS3Instance->rMySVCResult.ausSVCData[0] / 2);
-                  iCnt++
-                )
-              {
-                //lint -save -e740 cast!
-                SIII_VERBOSE
-                    (
-                      0,
-                      "0x%04hX ",
-                      (((USHORT*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                    );
-                //lint -restore cast!
-              }
-              SIII_VERBOSE(0, "\n");
-              break;
-            case CSMD_SERC_VAR_LONG_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 32 bit value list with %hu elements\n",
-                    prS3Instance->rMySVCResult.ausSVCData[0] / 4
-                  );
-              SIII_VERBOSE(0, "- Wrote data:\n");
-              for (   
-                  iCnt = 0;
-                  iCnt < (prS3Instance->rMySVCResult.ausSVCData[0] / 4);
-                  iCnt++
-                )
-              {
-                //lint -save -e740 cast!
-                SIII_VERBOSE
-                    (
-                      0,
-                      "0x%08lX ",
-                      (((ULONG*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                    );
-                //lint -restore cast!
-                if (((iCnt+1) % 4)  == 0)
-                {
-                  SIII_VERBOSE( 0, "\n");
-                }
-              }
-              SIII_VERBOSE(0, "\n");
-              break;
-            case CSMD_SERC_VAR_DOUBLE_LEN:
-              SIII_VERBOSE
-                  (
-                    0,
-                    "- Data type: 64 bit value list with %hu elements\n",
-                    prS3Instance->rMySVCResult.ausSVCData[0] / 8
-                  );
-              SIII_VERBOSE(0, "- Wrote data:\n");
-              for (   
-                  iCnt = 0;
-                  iCnt < (prS3Instance->rMySVCResult.ausSVCData[0] / 8);
-                  iCnt++
-                )
-              {
-                //lint -save -e740 cast!
-                SIII_VERBOSE
-                    (
-                      0,
-                      "0x%16llx ",
-                      (((ULONGLONG*)(((UCHAR*)prS3Instance->rMySVCResult.ausSVCData)+4)))[iCnt]
-                    );
-                //lint -restore cast!
-              }
-              SIII_VERBOSE(0, "\n");
-              break;
-            default:
-              SIII_VERBOSE(0, "- Unknown data format, unable to display data.\n");
-              break;
-          }*/
-          prS3Instance->rMySVCResult.eFuncRet = SIII_NO_ERROR;
-        }
-        else
-        {
-          SIII_VERBOSE
-              (
-                0,
-                "- Error: SVC write not successful. Error: 0x%hX\n",
-                prS3Instance->rMySvcMacro.usSvchError
-              );
-          prS3Instance->rMySVCResult.eFuncRet = SIII_SVC_ERROR;
-        }
+    eS3FuncRet = SIII_SVCSubmit(prS3Instance, &parRequest[usCnt]);
 
-        break;
+    if (eS3FuncRet != SIII_NO_ERROR)
+    {
+      parRequest[usCnt].eFuncRet = eS3FuncRet;
+    }
+    else
+    {
+      usSubmitted++;
 
-      case SIII_SVC_CMD:
+      SIII_VERBOSE
+          (
+            iLevel,
+            "- Starting SVC %s (%c-%1u-%04u.%u.%u) on device #%d...\n",
+            SIII_SVCModeName(parRequest[usCnt].eAccessMode),
+            SIII_GET_S_P(parRequest[usCnt].ulIdent_Nbr),
+            SIII_GET_IDNSET(parRequest[usCnt].ulIdent_Nbr),
+            SIII_GET_IDN(parRequest[usCnt].ulIdent_Nbr),
+            SIII_GET_SI(parRequest[usCnt].ulIdent_Nbr),
+            SIII_GET_SE(parRequest[usCnt].ulIdent_Nbr),
+            parRequest[usCnt].usDevIdx
+          );
+    }
+  }
 
-        SIII_VERBOSE
+  // Wait until all submitted transfers are done
+  for (usCnt = 0; usCnt < usSubmitted; usCnt++)
+  {
+    if (
+        RTOS_WaitForSemaphoreTimeout
             (
-              1,
-              "- Read parameter attribute to check whether it"
-              "really is a command.\n"
-            );
-
-        prS3Instance->rMySvcMacro.usState   = (USHORT) CSMD_START_REQUEST;
-        prS3Instance->rMySvcMacro.usElem  = (USHORT) 3;
-                                  // Element 3: Attribute
-        do {
-          // Check if MBUSY is set, if it is not set do nothing
-          if ( prS3Instance->rCosemaInstance.rPriv.prSVContainer[prS3Instance->rMySvcMacro.usSlaveIdx]->rCONTROL.usWord[0] & CSMD_SVC_CTRL_M_BUSY )
-          {
-            eMyFuncRet = CSMD_ReadSVCH
-              (
-                &prS3Instance->rCosemaInstance,   // CoSeMa instance
-                &prS3Instance->rMySvcMacro,       // SVC macro structure
-                NULL                              // No callback
-              );
+              &semDone,
+              SIII_SVC_BATCH_TIMEOUT
+            ) != RTOS_RET_OK
+      )
+    {
+      SIII_VERBOSE(0, "Error: Timeout of SVC transfer, cycle not running?\n");
 
-            SIII_VERBOSE
-              (
-                1,
-                "- CSMD_ReadSVCH - state = %i, return value = 0x%X\n",
-                prS3Instance->rMySvcMacro.usState,
-                eMyFuncRet
-              );
-          }
-        } while (
-              (prS3Instance->rMySvcMacro.usState != (USHORT) CSMD_DATA_VALID)     &&
-              (prS3Instance->rMySvcMacro.usState != (USHORT) CSMD_REQUEST_ERROR)
-            );
+      // Cancel the requests not completed yet. Completed requests have
+      // posted semDone already, it is not accessed after this.
+      /*lint -save -e722 */
+      while(RTOS_WaitForSemaphore(&prS3Instance->semSVCBlock) != RTOS_RET_OK);
+      /*lint -restore */
 
-        if (prS3Instance->rMySvcMacro.usState != (USHORT) CSMD_DATA_VALID)
-        {
-          SIII_VERBOSE(0, "- Error reading parameter attribute.\n");
-          prS3Instance->rMySVCResult.eFuncRet = SIII_SVC_ERROR;
-        }
-        else if (
-              (
-                (*((ULONG*)prS3Instance->rMySvcMacro.pusAct_Data)) &
-                    CSMD_SERC_PROC_CMD
-              ) == 0
-            )
+      for (usCnt = 0; usCnt < usNumRequests; usCnt++)
+      {
+        if (parRequest[usCnt].eFuncRet == SIII_FUNCTION_IN_PROCESS)
         {
-          SIII_VERBOSE(0, "- Error: Parameter is not a command.\n");
-          prS3Instance->rMySVCResult.eFuncRet = SIII_SVC_NO_CMD_PAR_ERROR;
+          SIII_SVCCancelRequest(prS3Instance, &parRequest[usCnt]);
         }
-        else
-        {
-          SIII_VERBOSE
-              (
-                0,
-                "- Starting SVC command (%c-%1u-%04lu.%lu.%lu) on device #%d...\n",
-                SIII_GET_S_P(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-                SIII_GET_IDNSET(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-                SIII_GET_IDN(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-                SIII_GET_SI(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-                SIII_GET_SE(prS3Instance->rMySvcMacro.ulIdent_Nbr),
-                prS3Instance->rMySvcMacro.usSlaveIdx
-              );
-
-          prS3Instance->rMySvcMacro.usState = (USHORT) CSMD_START_REQUEST;
-          prS3Instance->rMySvcMacro.usElem  = (USHORT) 7;
-                                    // Element 7: Operation data
+      }
 
-          // Set command
-          do {
-            // Check if MBUSY is set, if it is not set do nothing
-            if ( prS3Instance->rCosemaInstance.rPriv.prSVContainer[prS3Instance->rMySvcMacro.usSlaveIdx]->rCONTROL.usWord[0] & CSMD_SVC_CTRL_M_BUSY )
-            {
-              eMyFuncRet = CSMD_SetCommand
-                (
-                  &prS3Instance->rCosemaInstance, // CoSeMa instance
-                  &prS3Instance->rMySvcMacro,     // SVC macro structure
-                  NULL                            // No callback
-                );
-
-              SIII_VERBOSE
-                (
-                  1,
-                  "- CSMD_SetCommand - state = %i, return value = 0x%X\n",
-                  prS3Instance->rMySvcMacro.usState,
-                  eMyFuncRet
-                );
-            }
-          } while (
-                (prS3Instance->rMySvcMacro.usState  !=  CSMD_CMD_ACTIVE)  &&
-                (prS3Instance->rMySvcMacro.usState  !=  CSMD_REQUEST_ERROR)
-              );
+      (VOID)RTOS_PostSemaphore(&prS3Instance->semSVCBlock);
+      break;
+    }
+  }
 
-          if (prS3Instance->rMySvcMacro.usState == CSMD_REQUEST_ERROR)
-          {
-            SIII_VERBOSE(0, "- Error: SVC set command not successful.\n");
-            prS3Instance->rMySVCResult.eFuncRet = SIII_SVC_ERROR;
-          }
-          else
-          {
-            SIII_VERBOSE(0, "- SVC command active...\n");
-
-            // Wait for command completion, quick-and-dirty
-            //RTOS_SimpleMicroWait(SIII_SVC_CMD_WAIT_TIME);
-
-            // Wait for command completion, 'clean' version
-
-            do {
-              prS3Instance->rMySvcMacro.usState   = (USHORT) CSMD_START_REQUEST;
-              prS3Instance->rMySvcMacro.usLength  = (USHORT) 4;     // 4 Byte value
-              prS3Instance->rMySvcMacro.usElem    = (USHORT) 1;
-                                          // Element 1: IDN
-              do {
-                // Check if MBUSY is set, if it is not set do nothing
-                if ( prS3Instance->rCosemaInstance.rPriv.prSVContainer[prS3Instance->rMySvcMacro.usSlaveIdx]->rCONTROL.usWord[0] & CSMD_SVC_CTRL_M_BUSY )
-                {
-                  eMyFuncRet = CSMD_ReadCmdStatus
-                    (
-                      &prS3Instance->rCosemaInstance, // CoSeMa instance
-                      &prS3Instance->rMySvcMacro,     // SVC macro structure
-                      NULL                            // No callback
-                    );
-
-                  SIII_VERBOSE
-                    (
-                      1,
-                      "- CSMD_ReadCmdStatus - state = %i, return value = 0x%X\n",
-                      prS3Instance->rMySvcMacro.usState,
-                      eMyFuncRet
-                    );
-                }
-              } while (
-                    (prS3Instance->rMySvcMacro.usState != CSMD_CMD_STATUS_VALID) &&
-                    (prS3Instance->rMySvcMacro.usState != CSMD_REQUEST_ERROR)
-                  );              // while CSMD_ReadCmdStatus() is in process
-
-            } while (
-                  (prS3Instance->rMySVCResult.ausSVCData[0] != CSMD_CMD_FINISHED)   &&
-                  (prS3Instance->rMySVCResult.ausSVCData[0] != CSMD_CMD_STOPPED)    &&
-                  (prS3Instance->rMySVCResult.ausSVCData[0] != CSMD_CMD_ERROR)      &&
-                  (prS3Instance->rMySvcMacro.usState        != CSMD_REQUEST_ERROR)
-                );                // while CSMD_ReadCmdStatus() is not done or error
-
-            if (prS3Instance->rMySvcMacro.usState   != CSMD_REQUEST_ERROR)
-            {
-              SIII_VERBOSE(0, "- SVC command done.\n");
-            }
-            else
-            {
-              SIII_VERBOSE(0, "- Error: SVC command not successfully completed.\n");
-            }
+  (VOID)RTOS_DestroySemaphore(&semDone);
 
-            // Clear command
-            prS3Instance->rMySvcMacro.usState  = (USHORT) CSMD_START_REQUEST;
-            prS3Instance->rMySvcMacro.usLength = (USHORT) 0;
-            prS3Instance->rMySvcMacro.usElem   = (USHORT) 7;
-                                // Element 7: Operation data
-
-            do {
-              // Check if MBUSY is set, if it is not set do nothing
-              if ( prS3Instance->rCosemaInstance.rPriv.prSVContainer[prS3Instance->rMySvcMacro.usSlaveIdx]->rCONTROL.usWord[0] & CSMD_SVC_CTRL_M_BUSY )
-              {
-                eMyFuncRet = CSMD_ClearCommand
-                  (
-                    &prS3Instance->rCosemaInstance,
-                    &prS3Instance->rMySvcMacro,
-                    NULL
-                  );
-
-                SIII_VERBOSE
-                  (
-                    1,
-                    "- CSMD_ClearCommand - state = %i, return value = 0x%X\n",
-                    prS3Instance->rMySvcMacro.usState,
-                    eMyFuncRet
-                  );
-              }
-            } while (
-                  (prS3Instance->rMySvcMacro.usState != CSMD_CMD_CLEARED) &&
-                  (prS3Instance->rMySvcMacro.usState != CSMD_REQUEST_ERROR)
-                );
-
-            if (prS3Instance->rMySvcMacro.usState == CSMD_CMD_CLEARED)
-            {
-              SIII_VERBOSE(0, "- SVC command cleared.\n");
-              prS3Instance->rMySVCResult.eFuncRet = SIII_NO_ERROR;
-            }
-            else
-            {
-              SIII_VERBOSE(0, "- Error: SVC clear command not successful.\n");
-              prS3Instance->rMySVCResult.eFuncRet = SIII_SVC_ERROR;
-            }
-          }   // if command activation successful
-        }   // if parameter is a command
-        break;
+  eS3FuncRet = SIII_NO_ERROR;
 
-      default:
-        SIII_VERBOSE(0, "- Error: Illegal SVC transaction\n");
-        prS3Instance->rMySVCResult.eFuncRet = SIII_SVC_ERROR;
-        break;
+  for (usCnt = 0; usCnt < usNumRequests; usCnt++)
+  {
+    if (parRequest[usCnt].eFuncRet == SIII_NO_ERROR)
+    {
+      SIII_VERBOSE
+          (
+            iLevel,
+            "- SVC %s on device #%d successful.\n",
+            SIII_SVCModeName(parRequest[usCnt].eAccessMode),
+            parRequest[usCnt].usDevIdx
+          );
 
-    }   // switch(rMySVCAccessMode)
+      if (
+          (iLevel                         <= SIII_VERBOSE_LEVEL)  &&
+          (parRequest[usCnt].eAccessMode  == SIII_SVC_READ)
+        )
+      {
+        SIII_SVCPrintData(parRequest[usCnt].ulAttribute, parRequest[usCnt].pusData);
+      }
+    }
+    else
+    {
+      SIII_VERBOSE
+          (
+            0,
+            "- Error: SVC %s (%c-%1u-%04u.%u.%u) on device #%d not successful. "
+            "Error: 0x%X / 0x%hX\n",
+            SIII_SVCModeName(parRequest[usCnt].eAccessMode),
+            SIII_GET_S_P(parRequest[usCnt].ulIdent_Nbr),
+            SIII_GET_IDNSET(parRequest[usCnt].ulIdent_Nbr),
+            SIII_GET_IDN(parRequest[usCnt].ulIdent_Nbr),
+            SIII_GET_SI(parRequest[usCnt].ulIdent_Nbr),
+            SIII_GET_SE(parRequest[usCnt].ulIdent_Nbr),
+            parRequest[usCnt].usDevIdx,
+            (INT) parRequest[usCnt].eFuncRet,
+            parRequest[usCnt].usSvchError
+          );
 
-    // Remove blocking of SVC
-    (VOID) RTOS_PostSemaphore(&prS3Instance->semSVCBlock);
+      if (eS3FuncRet == SIII_NO_ERROR)
+      {
+        eS3FuncRet = parRequest[usCnt].eFuncRet;
+      }
+    }
+  }
 
-  }   // while(TRUE)
+  return(eS3FuncRet);
 }
 
 /**
@@ -982,70 +1317,36 @@ SIII_FUNC_RET SIII_SVCWrite
       USHORT  usLen
     )
 {
+  SIII_SVC_REQUEST_STRUCT rRequest;
+  SIII_FUNC_RET           eS3FuncRet;
+
   SIII_VERBOSE(3, "SIII_SVCWrite()\n");
 
-  if (SIII_GetSercosPhase(prS3Instance) < SIII_PHASE_CP2)
-  {
-    return(SIII_SVC_PHASE_ERROR);
-  }
-  else if (
-        (prS3Instance == NULL)            ||
-         usDevIdx >= prS3Instance->rCosemaInstance.rSlaveList.usNumProjSlaves
-      )
+  if (prS3Instance == NULL)
   {
     return(SIII_DEVICE_IDX_ERROR);
   }
-  else
-  {
-    // Wait for SVC semaphore
-    /*lint -save -e722 */
-    while(RTOS_WaitForSemaphore(&prS3Instance->semSVCBlock) != RTOS_RET_OK);
-    /*lint -restore */
-
-    prS3Instance->rMySVCResult.eFuncRet   = SIII_FUNCTION_IN_PROCESS;
-
-    // Set SVC access data structures
-    prS3Instance->rMySVCAccessMode        = SIII_SVC_WRITE;
-    prS3Instance->rMySvcMacro.pusAct_Data = pusValue;
-    prS3Instance->rMySvcMacro.usSlaveIdx  = usDevIdx;
-    prS3Instance->rMySvcMacro.usElem      = usElem;
-    prS3Instance->rMySvcMacro.ulIdent_Nbr = 
-        CSMD_EIDN
-            (
-              usIdn,
-              usSI,
-              usSE
-            );
 
-    if (!boIsStdPar)
-    {
-      // Device-specific IDN (P parameter)
-      prS3Instance->rMySvcMacro.ulIdent_Nbr |= ((ULONG) 1) << ((ULONG) 15);
-    }
-
-    prS3Instance->rMySvcMacro.usIsList               = (USHORT)  0;  // auto-detected
-    prS3Instance->rMySvcMacro.usLength               = (USHORT)  0;  // auto-detected
-    prS3Instance->rMySvcMacro.ulAttribute            = (ULONG)   0;
-    prS3Instance->rMySvcMacro.usCancelActTrans       = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usPriority             = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usOtherRequestCanceled = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usSvchError            = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usInternalReq          = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usState                = (USHORT)  CSMD_START_REQUEST;
-
-    // Start SVC transfer
-    (VOID)RTOS_PostSemaphore(&prS3Instance->semSVCStart);
-
-    // Wait until transfer done.
-    do
-    {
-      // TODO: Check whether the value can be reduced or replaced by another mechanism
-      RTOS_SimpleMicroWait(SIII_SVC_CMD_WAIT_TIME);
-    }
-    while (prS3Instance->rMySVCResult.eFuncRet == SIII_FUNCTION_IN_PROCESS);
-
-    return(prS3Instance->rMySVCResult.eFuncRet);
-  }
+  SIII_SVCInitRequest
+      (
+        &rRequest,
+        SIII_SVC_WRITE,
+        usDevIdx,
+        boIsStdPar,
+        usIdn,
+        usSI,
+        usSE,
+        usElem,
+        pusValue,
+        usLen,
+        NULL,
+        NULL
+      );
+
+  eS3FuncRet = SIII_SVCTransferBatch(prS3Instance, &rRequest, 1);
+  prS3Instance->rMySVCResult.eFuncRet = eS3FuncRet;
+
+  return(eS3FuncRet);
 }
 
 /**
@@ -1110,71 +1411,36 @@ SIII_FUNC_RET SIII_SVCRead
       USHORT  usLen
     )
 {
+  SIII_SVC_REQUEST_STRUCT rRequest;
+  SIII_FUNC_RET           eS3FuncRet;
+
   SIII_VERBOSE(3, "SIII_SVCRead()\n");
 
-  if (SIII_GetSercosPhase(prS3Instance) < SIII_PHASE_CP2)
-  {
-    return(SIII_SVC_PHASE_ERROR);
-  }
-  else if (
-        (prS3Instance == NULL)             ||
-         usDevIdx >= prS3Instance->rCosemaInstance.rSlaveList.usNumProjSlaves
-      )
+  if (prS3Instance == NULL)
   {
     return(SIII_DEVICE_IDX_ERROR);
   }
-  else
-  {
-    // Wait for SVC semaphore
-    /*lint -save -e722 */
-    while(RTOS_WaitForSemaphore(&prS3Instance->semSVCBlock) != RTOS_RET_OK);
-    /*lint -restore */
-
-    prS3Instance->rMySVCResult.eFuncRet   = SIII_FUNCTION_IN_PROCESS;
-
-    // Set SVC access data structures
-    prS3Instance->rMySVCAccessMode        = SIII_SVC_READ;
-    prS3Instance->rMySvcMacro.pusAct_Data = pusValue;
-    prS3Instance->rMySvcMacro.usSlaveIdx  = usDevIdx;
-    prS3Instance->rMySvcMacro.usElem      = usElem;
-    prS3Instance->rMySvcMacro.ulIdent_Nbr = 
-        CSMD_EIDN
-            (
-              usIdn,
-              usSI,
-              usSE
-            );
-
-    if (!boIsStdPar)
-    {
-      // Device-specific IDN (P parameter)
-      prS3Instance->rMySvcMacro.ulIdent_Nbr |= ((ULONG) 1) << ((ULONG) 15);
-    }
-
-    prS3Instance->rMySvcMacro.usIsList               = (USHORT) 3;
-                                            // Automatic detection if list or single parameter
-    prS3Instance->rMySvcMacro.usLength               = (USHORT)  0;
-    prS3Instance->rMySvcMacro.ulAttribute            = (ULONG)   0;
-    prS3Instance->rMySvcMacro.usCancelActTrans       = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usPriority             = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usOtherRequestCanceled = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usSvchError            = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usInternalReq          = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usState                = (USHORT)  CSMD_START_REQUEST;
-
-    // Start SVC transfer
-    (VOID)RTOS_PostSemaphore(&prS3Instance->semSVCStart);
-
-    // Wait until transfer done.
-    do
-    {
-      // TODO: Check whether the value can be reduced or replaced by another mechanism
-      RTOS_SimpleMicroWait(SIII_SVC_CMD_WAIT_TIME);
-    }
-    while (prS3Instance->rMySVCResult.eFuncRet == SIII_FUNCTION_IN_PROCESS);
 
-    return(prS3Instance->rMySVCResult.eFuncRet);
-  }
+  SIII_SVCInitRequest
+      (
+        &rRequest,
+        SIII_SVC_READ,
+        usDevIdx,
+        boIsStdPar,
+        usIdn,
+        usSI,
+        usSE,
+        usElem,
+        pusValue,
+        usLen,
+        NULL,
+        NULL
+      );
+
+  eS3FuncRet = SIII_SVCTransferBatch(prS3Instance, &rRequest, 1);
+  prS3Instance->rMySVCResult.eFuncRet = eS3FuncRet;
+
+  return(eS3FuncRet);
 }
 
 /**
@@ -1227,71 +1493,36 @@ SIII_FUNC_RET SIII_SVCCmd
       USHORT  usSE
     )
 {
+  SIII_SVC_REQUEST_STRUCT rRequest;
+  SIII_FUNC_RET           eS3FuncRet;
+
   SIII_VERBOSE(3, "SIII_SVCCmd()\n");
 
-  if (SIII_GetSercosPhase(prS3Instance) < SIII_PHASE_CP2)
-  {
-    return(SIII_SVC_PHASE_ERROR);
-  }
-  else if (
-        (prS3Instance == NULL)             ||
-         usDevIdx >= prS3Instance->rCosemaInstance.rSlaveList.usNumProjSlaves
-      )
+  if (prS3Instance == NULL)
   {
     return(SIII_DEVICE_IDX_ERROR);
   }
-  else
-  {
-    // Wait for SVC semaphore
-    /*lint -save -e722 */
-    while(RTOS_WaitForSemaphore(&prS3Instance->semSVCBlock)!= RTOS_RET_OK);
-    /*lint -restore */
-
-    prS3Instance->rMySVCResult.eFuncRet   = SIII_FUNCTION_IN_PROCESS;
-
-    // Set SVC access data structures
-    prS3Instance->rMySVCAccessMode        = SIII_SVC_CMD;
-    prS3Instance->rMySvcMacro.pusAct_Data = prS3Instance->rMySVCResult.ausSVCData;
-    prS3Instance->rMySvcMacro.usSlaveIdx  = usDevIdx;
-    prS3Instance->rMySvcMacro.usElem      = (USHORT) 7;
-                              // Element 7: Operation data
-    prS3Instance->rMySvcMacro.ulIdent_Nbr =
-        CSMD_EIDN
-          (
-            usIdn,
-            usSI,
-            usSE
-          );
-
-    if (!boIsStdPar)
-    {
-      // Device-specific IDN (P parameter)
-      prS3Instance->rMySvcMacro.ulIdent_Nbr |= ((ULONG) 1) << ((ULONG) 15);
-    }
-
-    prS3Instance->rMySvcMacro.usIsList               = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usLength               = (USHORT)  0;
-    prS3Instance->rMySvcMacro.ulAttribute            = (ULONG)   0;
-    prS3Instance->rMySvcMacro.usCancelActTrans       = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usPriority             = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usOtherRequestCanceled = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usSvchError            = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usInternalReq          = (USHORT)  0;
-    prS3Instance->rMySvcMacro.usState                = (USHORT)  CSMD_START_REQUEST;
-
-    // Start SVC transfer
-    (VOID)RTOS_PostSemaphore(&prS3Instance->semSVCStart);
-
-    // Wait until transfer done.
-    do
-    {
-      // TODO: Check whether the value can be reduced or replaced by another mechanism
-      RTOS_SimpleMicroWait(SIII_SVC_CMD_WAIT_TIME);
-    }
-    while (prS3Instance->rMySVCResult.eFuncRet == SIII_FUNCTION_IN_PROCESS);
 
-    return(prS3Instance->rMySVCResult.eFuncRet);
-  }
+  SIII_SVCInitRequest
+      (
+        &rRequest,
+        SIII_SVC_CMD,
+        usDevIdx,
+        boIsStdPar,
+        usIdn,
+        usSI,
+        usSE,
+        (USHORT) 7,
+        NULL,
+        (USHORT) 0,
+        NULL,
+        NULL
+      );
+
+  eS3FuncRet = SIII_SVCTransferBatch(prS3Instance, &rRequest, 1);
+  prS3Instance->rMySVCResult.eFuncRet = eS3FuncRet;
+
+  return(eS3FuncRet);
 }
 
 /**
@@ -1309,7 +1540,8 @@ SIII_FUNC_RET SIII_SVCCmd
  * \param[in]       usDevIdx        Slave device index or 'SIII_ALL_DEVICES'.
  *
  * \note    The 'SIII_ALL_DEVICES' option does not work properly when hotplug
- *          slaves are configured but not (yet) present.
+ *          slaves are configured but not (yet) present. With this option,
+ *          the command is performed on all slaves in parallel.
  *
  * \return  See definition of SIII_FUNC_RET
  *          - SIII_NO_ERROR         for success
@@ -1330,8 +1562,9 @@ SIII_FUNC_RET SIII_SVCClearErrors
       USHORT  usDevIdx
     )
 {
-  INT           iCnt       = 0;
-  SIII_FUNC_RET eS3FuncRet = SIII_NO_ERROR;
+  INT                     iCnt       = 0;
+  SIII_FUNC_RET           eS3FuncRet = SIII_NO_ERROR;
+  SIII_SVC_REQUEST_STRUCT arRequest[SIII_MAX_SLAVES];
 
   SIII_VERBOSE(3, "SIII_SVCClearErrors()\n");
 
@@ -1356,26 +1589,40 @@ SIII_FUNC_RET SIII_SVCClearErrors
     {
       if (usDevIdx == (USHORT) SIII_ALL_DEVICES)
       {
+        // Clear errors of all slaves in parallel
         for (
             iCnt = 0;
             iCnt < SIII_GetNoOfSlaves(prS3Instance);
             iCnt++
           )
         {
-          eS3FuncRet = SIII_SVCCmd
+          SIII_SVCInitRequest
               (
-                prS3Instance, // SIII instance
-                iCnt,         // Device number
-                TRUE,         // S-Parameter
-                99,           // S-0-99: Clear errors command
-                0,            // SI = 0
-                0             // SE = 0
+                &arRequest[iCnt],
+                SIII_SVC_CMD,
+                (USHORT) iCnt,  // Device number
+                TRUE,           // S-Parameter
+                99,             // S-0-99: Clear errors command
+                0,              // SI = 0
+                0,              // SE = 0
+                7,              // Element 7: Operation data
+                NULL,
+                0,
+                NULL,
+                NULL
               );
+        }
 
-          if (eS3FuncRet != SIII_NO_ERROR)
-          {
-            return(eS3FuncRet);
-          }
+        eS3FuncRet = SIII_SVCTransferBatch
+            (
+              prS3Instance,
+              arRequest,
+              (USHORT) iCnt
+            );
+
+        if (eS3FuncRet != SIII_NO_ERROR)
+        {
+          return(eS3FuncRet);
         }
       }
       else
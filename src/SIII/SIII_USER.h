@@ -61,6 +61,21 @@
  */
 #undef SIII_INC_PRIO_SETPHASE3
 
+/**
+ * \def     SIII_CYCLIC_DIRECT
+ *
+ * \brief   If defined, SIII_GetDeviceCyclicDataPtr() returns pointers directly
+ *          into the CoSeMa Tx and Rx ram in CP4 instead of pointers into the
+ *          SIII cyclic data buffers, so the copies with
+ *          CSMD_SetConnectionData() and CSMD_GetConnectionData() are omitted.
+ *          The pointers are only valid in the current Sercos cycle and have
+ *          to be fetched again in each cycle. The C-CON in Tx ram is written
+ *          in place by SIII after the cyclic callbacks. Requires single
+ *          buffering of Tx ram (CSMD_MAX_TX_BUFFER), so data written once is
+ *          kept for the following cycles.
+ */
+#undef SIII_CYCLIC_DIRECT
+
 /**
  * \def     SIII_MAX_HP_DEV
  *
@@ -121,12 +136,31 @@
 #define SIII_SVC_WAIT_TIME              (100*1000)
 
 /**
- * \def     SIII_SVC_CMD_WAIT_TIME
+ * \def     SIII_SVC_MAX_CALLS
+ *
+ * \brief   Maximum number of CoSeMa SVC function calls per slave and Sercos
+ *          cycle.
+ */
+#define SIII_SVC_MAX_CALLS              (8)
+
+/**
+ * \def     SIII_SVC_CYCLE_BUDGET
+ *
+ * \brief   Time in ns that SIII_Cycle_Start() may spend on service channel
+ *          handling per Sercos cycle. Slaves not served within this time are
+ *          served first in the next cycle.
+ */
+#define SIII_SVC_CYCLE_BUDGET           (20*1000)
+
+/**
+ * \def     SIII_SVC_BATCH_TIMEOUT
  *
- * \brief   Time in us that is waited before checking for SVC command
- *          completion.
+ * \brief   Time in ms SIII_SVCTransferBatch() waits for the next of its
+ *          requests to be completed. If none is completed within this time,
+ *          e.g. because the Sercos cycle has stopped, the remaining requests
+ *          are cancelled with SIII_TIMEOUT_ERROR.
  */
-#define SIII_SVC_CMD_WAIT_TIME          (100*1000)
+#define SIII_SVC_BATCH_TIMEOUT          (10*1000)
 
 //---- type definitions -------------------------------------------------------
 
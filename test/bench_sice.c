@@ -0,0 +1,613 @@
+/**
+ * \file      bench_sice.c
+ *
+ * \brief     Benchmark of the cyclic telegram processing of the Sercos IP core
+ *            emulation (SICE).
+ *
+ * \details   The TX and RX RAM of an instance are set up as by CoSeMa in CP4
+ *            for a given number of slaves: 4 MDTs with a hot-plug field and
+ *            the service channel and real-time data of the slaves, and 4 ATs
+ *            with a hot-plug field, from which the service channel and
+ *            real-time data of the slaves are received. The slaves are
+ *            distributed evenly over the telegrams.
+ *
+ *            SICE_PrepareTelegrams() is timed as implemented, which only
+ *            zero-fills the parts of the frames not covered by descriptors,
+ *            and with the former zero-filling of each complete frame buffer
+ *            before.
+ *
+ *            SICE_ReceiveTelegrams() is timed by replaying frames through
+ *            RTLX_RxPacket(), each call receiving one cycle. Without a
+ *            capture, the cycle consists of the prepared telegrams of all
+ *            ports, as returned by a double line. A capture is read as
+ *            classic pcap file and split into cycles before a telegram
+ *            already contained in the current cycle; only Sercos frames are
+ *            replayed, S channel frames on port S with redundancy.
+ *
+ *            Build with BENCH_REDUNDANCY for an instance with redundancy
+ *            (SICE_REDUNDANCY).
+ *
+ *            Usage: bench_sice [iterations [capture.pcap]]
+ */
+
+//---- includes ---------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/SICE/SICE_USER.h"
+
+#ifdef BENCH_REDUNDANCY
+#define SICE_REDUNDANCY
+#endif
+
+#include "../src/SICE/SICE_TX.c"
+#include "../src/SICE/SICE_RX.c"
+#include "../src/SICE/SICE_UTIL.c"
+#include "../src/SICE/SICE_SIII.c"
+
+//---- defines ----------------------------------------------------------------
+
+#define BENCH_ITER_DEFAULT      (100000)    /* Default number of iterations */
+
+// TX RAM layout
+#define BENCH_TX_RT_BUF         (0x0000)    /* Real-time data, buffer system A */
+#define BENCH_TX_SVC_BUF        (0x0400)    /* Service channel */
+#define BENCH_TX_PORT1_BUF      (0x0600)    /* Port-specific data of port 1 */
+#define BENCH_TX_PORT2_BUF      (0x0680)    /* Port-specific data of port 2 */
+#define BENCH_TX_DESC           (0x0800)    /* Descriptor lists */
+#define BENCH_TX_IDX_TABLE      (0x1F00)    /* Descriptor index table */
+
+// RX RAM layout
+#define BENCH_RX_RT_BUF         (0x0000)    /* Real-time data, buffer system A of port 1 */
+#define BENCH_RX_SVC_BUF        (0x0400)    /* Service channel of port 1 */
+#define BENCH_RX_RT_BUF_P2      (0x0800)    /* Real-time data, buffer system A of port 2 */
+#define BENCH_RX_SVC_BUF_P2     (0x0C00)    /* Service channel of port 2 */
+#define BENCH_RX_DESC           (0x1000)    /* Descriptor lists */
+#define BENCH_RX_IDX_TABLE      (0x3F00)    /* Descriptor index table */
+
+#define BENCH_HP_LEN            (4)         /* Hot-plug field */
+#define BENCH_SVC_LEN           (6)         /* Service channel field per slave */
+#define BENCH_RT_LEN            (16)        /* Real-time data per slave */
+#define BENCH_MIN_TEL_LEN       (40)        /* Minimum length of telegram data */
+
+// Descriptor types of the IP core
+#define BENCH_DESC_SVC          (0x0)
+#define BENCH_DESC_RT           (0x2)
+#define BENCH_DESC_END          (0x4)
+#define BENCH_DESC_PORT         (0x8)
+
+#define BENCH_REPLAY_MAX        (4096)      /* Maximum number of replayed frames */
+#define BENCH_SLAVE_DATA        (0x5A)      /* Data written by the slaves into ATs */
+
+// Classic pcap file format
+#define BENCH_PCAP_MAGIC        (0xA1B2C3D4)
+#define BENCH_PCAP_MAGIC_NS     (0xA1B23C4D)
+#define BENCH_PCAP_LINK_ETH     (1)
+
+//---- type definitions -------------------------------------------------------
+
+typedef struct
+{
+  USHORT  usLen;                                /* Length of frame */
+  INT     iPort;                                /* Receive port */
+  ULONG   aulData[SICE_ETH_FRAMEBUF_LEN / sizeof(ULONG)];
+} BENCH_REPLAY_FRAME;
+
+typedef struct
+{
+  BENCH_REPLAY_FRAME  arFrame[BENCH_REPLAY_MAX];
+  INT                 iNumFrames;
+  INT                 aiCycleStart[BENCH_REPLAY_MAX + 1];
+  INT                 iNumCycles;
+  ULONG               ulSeen;                   /* Telegrams of the last cycle,
+                                                   by SICE_RX_CLASS_IDX() */
+  INT                 iCycle;                   /* Cycle being received */
+  INT                 aiPos[SICE_REDUNDANCY_VAL];
+                                                /* Next frame per port */
+} BENCH_REPLAY_STRUCT;
+
+//---- variable declarations --------------------------------------------------
+
+static SICE_INSTANCE_STRUCT rBenchInst;
+static SICE_ARENA_STRUCT    rBenchArena;
+static BENCH_REPLAY_STRUCT  rBenchReplay;
+
+//---- function implementations -----------------------------------------------
+
+// Transmission is not part of the benchmark
+INT RTLX_TxPacket(INT iInstanceNo, INT iPort, UCHAR* pucFrame, USHORT usLen, USHORT usIFG)
+{
+  return((INT)usLen);
+}
+
+// Next frame of the current replay cycle for the port, 0 at its end
+INT RTLX_RxPacket(INT iInstanceNo, INT iPort, UCHAR* pucFrame, UCHAR** ppucFrame)
+{
+  BENCH_REPLAY_FRAME* prFrame;
+  INT                 iEnd = rBenchReplay.aiCycleStart[rBenchReplay.iCycle + 1];
+  INT                 iPos;
+
+  for (iPos = rBenchReplay.aiPos[iPort]; iPos < iEnd; iPos++)
+  {
+    prFrame = &rBenchReplay.arFrame[iPos];
+    if (prFrame->iPort == iPort)
+    {
+      rBenchReplay.aiPos[iPort] = iPos + 1;
+      *ppucFrame = (UCHAR*) prFrame->aulData;
+      return((INT) prFrame->usLen);
+    }
+  }
+  rBenchReplay.aiPos[iPort] = iEnd;
+  return(0);
+}
+
+static double BenchNow(VOID)
+{
+  struct timespec rTime;
+
+  (VOID)clock_gettime(CLOCK_MONOTONIC, &rTime);
+  return((double)rTime.tv_sec * 1e9 + (double)rTime.tv_nsec);
+}
+
+static ULONG* BenchAddSeg
+    (
+      ULONG* pulDesc,
+      UCHAR ucType,
+      USHORT usFrameOffset,
+      USHORT usLen,
+      USHORT usBufOffset
+    )
+{
+  // Start and end descriptor of the segment, buffer system A selected
+  *pulDesc++ =
+      (((ULONG) ucType) << CSMD_HAL_DES_SHIFT_TYPE) |
+      (((ULONG) usFrameOffset) << CSMD_HAL_DES_SHIFT_TEL_OFFS) |
+      (ULONG) usBufOffset;
+  *pulDesc++ =
+      (((ULONG) ucType + 1) << CSMD_HAL_DES_SHIFT_TYPE) |
+      (((ULONG) usFrameOffset + usLen - 2) << CSMD_HAL_DES_SHIFT_TEL_OFFS);
+
+  return(pulDesc);
+}
+
+// Service channel and real-time data of the slaves of a telegram
+static ULONG* BenchAddSlaveSegs
+    (
+      ULONG* pulDesc,
+      INT iTelNo,
+      INT iNumSlaves
+    )
+{
+  INT     iSlavesPerTel = (iNumSlaves + CSMD_MAX_TEL - 1) / CSMD_MAX_TEL;
+  INT     iFirst        = iTelNo * iSlavesPerTel;
+  INT     iLast         = iFirst + iSlavesPerTel;
+  USHORT  usFrameOffset = BENCH_HP_LEN;
+  INT     iSlave;
+
+  if (iLast > iNumSlaves)
+  {
+    iLast = iNumSlaves;
+  }
+  for (iSlave = iFirst; iSlave < iLast; iSlave++)
+  {
+    pulDesc = BenchAddSeg(pulDesc, BENCH_DESC_SVC, usFrameOffset, BENCH_SVC_LEN, (USHORT) (iSlave * BENCH_SVC_LEN));
+    usFrameOffset += BENCH_SVC_LEN;
+  }
+  for (iSlave = iFirst; iSlave < iLast; iSlave++)
+  {
+    pulDesc = BenchAddSeg(pulDesc, BENCH_DESC_RT, usFrameOffset, BENCH_RT_LEN, (USHORT) (iSlave * BENCH_RT_LEN));
+    usFrameOffset += BENCH_RT_LEN;
+  }
+
+  return(pulDesc);
+}
+
+static ULONG* BenchAddEnd(ULONG* pulDesc, USHORT usLen)
+{
+  *pulDesc++ =
+      (((ULONG) BENCH_DESC_END) << CSMD_HAL_DES_SHIFT_TYPE) |
+      (((ULONG) usLen) << CSMD_HAL_DES_SHIFT_TEL_OFFS);
+
+  return(pulDesc);
+}
+
+static VOID BenchSetup(INT iNumSlaves)
+{
+  UCHAR*  pucTxRam;
+  UCHAR*  pucRxRam;
+  ULONG*  pulDesc;
+  USHORT  usTxDescOffset  = BENCH_TX_DESC;
+  USHORT  usRxDescOffset  = BENCH_RX_DESC;
+  USHORT  usSlavesPerTel;
+  USHORT  usLen;
+  INT     iPacket;
+  INT     i;
+
+  (VOID)memset(&rBenchInst, 0, sizeof(rBenchInst));
+  (VOID)memset(&rBenchArena, 0, sizeof(rBenchArena));
+
+  // As set up by SICE_Init() and SICE_SoftReset()
+  rBenchInst.prArena = &rBenchArena;
+  for (i = 0; i < 2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL; i++)
+  {
+    rBenchInst.aprSendFrame[i] = &rBenchArena.arSendFrame[i].rFrame;
+  }
+  rBenchInst.prReg    = (CSMD_HAL_SERCFPGA_REGISTER*) rBenchArena.rMemory.aucRegister;
+  rBenchInst.prTX_Ram = (CSMD_HAL_TX_RAM*) rBenchArena.rMemory.aucTxRAM;
+  rBenchInst.prRX_Ram = (CSMD_HAL_RX_RAM*) rBenchArena.rMemory.aucRxRAM;
+
+  rBenchInst.prReg->ulPHASECR = ((ULONG) CSMD_SERC_PHASE_4) << CSMD_HAL_PHASECR_PHASE_SHIFT;
+  rBenchInst.prReg->rDECR.rDesIdx.usOffsetTxRam = BENCH_TX_IDX_TABLE;
+  rBenchInst.prReg->rDECR.rDesIdx.usOffsetRxRam = BENCH_RX_IDX_TABLE;
+  rBenchInst.prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_0_SYS_A] = BENCH_TX_RT_BUF;
+  rBenchInst.prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_SVC]     = BENCH_TX_SVC_BUF;
+  rBenchInst.prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_1]  = BENCH_TX_PORT1_BUF;
+  rBenchInst.prReg->aulTxBufBasePtr[CSMD_HAL_IDX_TX_BUFF_PORT_2]  = BENCH_TX_PORT2_BUF;
+  rBenchInst.prReg->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_0_SYS_A] = BENCH_RX_RT_BUF;
+  rBenchInst.prReg->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P1_BUFF_SVC]     = BENCH_RX_SVC_BUF;
+  rBenchInst.prReg->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P2_BUFF_0_SYS_A] = BENCH_RX_RT_BUF_P2;
+  rBenchInst.prReg->aulRxBufBasePtr[CSMD_HAL_IDX_RX_P2_BUFF_SVC]     = BENCH_RX_SVC_BUF_P2;
+
+  pucTxRam = (UCHAR*) rBenchInst.prTX_Ram;
+  pucRxRam = (UCHAR*) rBenchInst.prRX_Ram;
+  for (i = 0; i < BENCH_TX_DESC; i++)
+  {
+    pucTxRam[i] = (UCHAR) i;
+  }
+
+  usSlavesPerTel = (USHORT) ((iNumSlaves + CSMD_MAX_TEL - 1) / CSMD_MAX_TEL);
+  usLen = (USHORT) (BENCH_HP_LEN + usSlavesPerTel * (BENCH_SVC_LEN + BENCH_RT_LEN));
+  if (usLen < BENCH_MIN_TEL_LEN)
+  {
+    usLen = BENCH_MIN_TEL_LEN;
+  }
+
+  for (iPacket = 0; iPacket < 2*CSMD_MAX_TEL; iPacket++)
+  {
+    *(ULONG*) (pucTxRam + BENCH_TX_IDX_TABLE + iPacket * sizeof(ULONG)) =
+        (ULONG) usTxDescOffset | SICE_TEL_DESC_ENABLE_MASK;
+    rBenchInst.prReg->ulSFCR |= ((ULONG) 1) << ((iPacket < CSMD_MAX_TEL) ?
+        (CSMD_HAL_SFCR_ENABLE_MDT0 + iPacket) :
+        (CSMD_HAL_SFCR_ENABLE_AT0 + iPacket - CSMD_MAX_TEL));
+
+    pulDesc = (ULONG*) (pucTxRam + usTxDescOffset);
+    pulDesc = BenchAddSeg(pulDesc, BENCH_DESC_PORT, 0, BENCH_HP_LEN, (USHORT) (iPacket * BENCH_HP_LEN));
+    if (iPacket < CSMD_MAX_TEL)
+    {
+      pulDesc = BenchAddSlaveSegs(pulDesc, iPacket, iNumSlaves);
+    }
+    pulDesc = BenchAddEnd(pulDesc, usLen);
+    usTxDescOffset = (USHORT) ((UCHAR*) pulDesc - pucTxRam);
+
+    // The data of the slaves is received from the ATs
+    if (iPacket >= CSMD_MAX_TEL)
+    {
+      *(ULONG*) (pucRxRam + BENCH_RX_IDX_TABLE + iPacket * sizeof(ULONG)) =
+          (ULONG) usRxDescOffset | SICE_TEL_DESC_ENABLE_MASK;
+
+      pulDesc = (ULONG*) (pucRxRam + usRxDescOffset);
+      pulDesc = BenchAddSlaveSegs(pulDesc, iPacket - CSMD_MAX_TEL, iNumSlaves);
+      pulDesc = BenchAddEnd(pulDesc, usLen);
+      usRxDescOffset = (USHORT) ((UCHAR*) pulDesc - pucRxRam);
+    }
+  }
+}
+
+// Zero-filling of the frame buffers before SICE_PrepareTelegrams() used it
+static VOID BenchFormerClear(VOID)
+{
+  INT iPacket;
+
+  for (iPacket = 0; iPacket < 2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL; iPacket++)
+  {
+    (VOID)memset
+        (
+          ((SICE_SIII_FRAME*) rBenchInst.aprSendFrame[iPacket]->aucData)->rTel.aucData,
+          0,
+          SICE_ETH_FRAMEBUF_LEN - SICE_SERC3_TEL_HEADER
+        );
+  }
+}
+
+static double BenchPrepare(INT iIter, BOOL boFormerClear)
+{
+  double dStart;
+  INT    i;
+
+  dStart = BenchNow();
+  for (i = 0; i < iIter; i++)
+  {
+    if (boFormerClear)
+    {
+      BenchFormerClear();
+    }
+    if (SICE_PrepareTelegrams(&rBenchInst) != SICE_NO_ERROR)
+    {
+      printf("SICE_PrepareTelegrams() failed\n");
+      exit(1);
+    }
+  }
+  return((BenchNow() - dStart) / (double) iIter);
+}
+
+// Appends a frame to the replay, a repeated telegram starts the next cycle
+static SICE_SIII_FRAME* BenchReplayAdd(const UCHAR* pucData, USHORT usLen)
+{
+  BENCH_REPLAY_FRAME* prFrame;
+  SICE_SIII_FRAME*    puSercosFrame;
+  ULONG               ulClass;
+
+  if (  (rBenchReplay.iNumFrames >= BENCH_REPLAY_MAX)                   ||
+        (usLen <= SICE_TEL_LENGTH_HDR_FOR_CRC + sizeof(ULONG))          ||
+        (usLen > SICE_ETH_FRAMEBUF_LEN))
+  {
+    return(NULL);
+  }
+
+  prFrame = &rBenchReplay.arFrame[rBenchReplay.iNumFrames];
+  (VOID)memcpy(prFrame->aulData, pucData, usLen);
+  prFrame->usLen = usLen;
+
+  puSercosFrame = (SICE_SIII_FRAME*) prFrame->aulData;
+  prFrame->iPort =
+      (SICE_REDUNDANCY_BOOL &&
+      ((puSercosFrame->rTel.ucSercosType & SICE_TEL_CHANNEL_MASK) == SICE_TEL_S_CHANNEL)) ?
+          SICE_ETH_PORT_S : SICE_ETH_PORT_P;
+
+  ulClass = ((ULONG) 1) << SICE_RX_CLASS_IDX(puSercosFrame->rTel.ucSercosType);
+  if ((rBenchReplay.iNumCycles == 0) || (rBenchReplay.ulSeen & ulClass))
+  {
+    rBenchReplay.aiCycleStart[rBenchReplay.iNumCycles++] = rBenchReplay.iNumFrames;
+    rBenchReplay.ulSeen = 0;
+  }
+  rBenchReplay.ulSeen |= ulClass;
+  rBenchReplay.aiCycleStart[rBenchReplay.iNumCycles] = ++rBenchReplay.iNumFrames;
+
+  return(puSercosFrame);
+}
+
+// One cycle of the prepared telegrams, the ATs filled in by the slaves
+static VOID BenchReplayFromTx(VOID)
+{
+  SICE_SIII_PACKET_BUF* prBuf;
+  SICE_SIII_FRAME*      puSercosFrame;
+  INT                   iPacket;
+  INT                   iDataLen;
+
+  (VOID)memset(&rBenchReplay, 0, sizeof(rBenchReplay));
+
+  for (iPacket = 0; iPacket < 2*CSMD_MAX_TEL*SICE_REDUNDANCY_VAL; iPacket++)
+  {
+    prBuf = rBenchInst.aprSendFrame[iPacket];
+    if (!prBuf->boEnable)
+    {
+      continue;
+    }
+
+    puSercosFrame = BenchReplayAdd(prBuf->aucData, prBuf->usLen);
+    if (puSercosFrame == NULL)
+    {
+      continue;
+    }
+
+    puSercosFrame->rTel.usPortID = (USHORT) htons((USHORT) SICE_SIII_ETHER_TYPE);
+
+    iDataLen = (INT) prBuf->usLen - SICE_SERC3_TEL_HEADER - BENCH_HP_LEN;
+    if (((iPacket % (2*CSMD_MAX_TEL)) >= CSMD_MAX_TEL) && (iDataLen > 0))
+    {
+      (VOID)memset(&puSercosFrame->rTel.aucData[BENCH_HP_LEN], BENCH_SLAVE_DATA, (size_t) iDataLen);
+    }
+
+    puSercosFrame->rTel.ulCRC = SICE_CRC32Calc(puSercosFrame->aucRaw, SICE_TEL_LENGTH_HDR_FOR_CRC, 0);
+  }
+}
+
+static ULONG BenchPcapLong(ULONG ulValue, BOOL boSwap)
+{
+  return(boSwap ? __builtin_bswap32(ulValue) : ulValue);
+}
+
+// Sercos frames of a classic pcap capture, FALSE if it cannot be read
+static BOOL BenchReplayFromPcap(const CHAR* pcFile)
+{
+  static UCHAR  aucData[65536];
+  ULONG         aulHeader[6];
+  ULONG         aulRecord[4];
+  ULONG         ulLen;
+  BOOL          boSwap;
+  FILE*         prFile;
+
+  (VOID)memset(&rBenchReplay, 0, sizeof(rBenchReplay));
+
+  prFile = fopen(pcFile, "rb");
+  if (prFile == NULL)
+  {
+    return(FALSE);
+  }
+
+  if (fread(aulHeader, sizeof(aulHeader), 1, prFile) != 1)
+  {
+    (VOID)fclose(prFile);
+    return(FALSE);
+  }
+
+  boSwap = (aulHeader[0] != BENCH_PCAP_MAGIC) && (aulHeader[0] != BENCH_PCAP_MAGIC_NS);
+  if (  (  (BenchPcapLong(aulHeader[0], boSwap) != BENCH_PCAP_MAGIC)                &&
+           (BenchPcapLong(aulHeader[0], boSwap) != BENCH_PCAP_MAGIC_NS))            ||
+        (BenchPcapLong(aulHeader[5], boSwap) != BENCH_PCAP_LINK_ETH))
+  {
+    (VOID)fclose(prFile);
+    return(FALSE);
+  }
+
+  while (fread(aulRecord, sizeof(aulRecord), 1, prFile) == 1)
+  {
+    ulLen = BenchPcapLong(aulRecord[2], boSwap);
+    if ((ulLen > sizeof(aucData)) || (fread(aucData, ulLen, 1, prFile) != 1))
+    {
+      break;
+    }
+
+    // Ethernet type at offset 12
+    if (  (ulLen > 14) && (ulLen <= SICE_ETH_FRAMEBUF_LEN)  &&
+          (aucData[12] == 0x88) && (aucData[13] == 0xCD))
+    {
+      (VOID)BenchReplayAdd(aucData, (USHORT) ulLen);
+    }
+  }
+
+  (VOID)fclose(prFile);
+
+  return(rBenchReplay.iNumFrames > 0);
+}
+
+// All telegrams signalled in TGSR, data of the first slave in the RX RAM
+static BOOL BenchCheckRx(VOID)
+{
+  ULONG ulExpected1 = 0;
+  ULONG ulExpected2 = 0;
+  INT   i;
+
+  for (i = 0; i < 2*CSMD_MAX_TEL; i++)
+  {
+    ulExpected1 |= arRxClass[i].ulTGSR;
+    ulExpected2 |= arRxClass[2*CSMD_MAX_TEL + i].ulTGSR;
+  }
+
+  return(
+      (rBenchInst.ulTGSR1 == ulExpected1)                                         &&
+      (!SICE_REDUNDANCY_BOOL || (rBenchInst.ulTGSR2 == ulExpected2))             &&
+      (((UCHAR*) rBenchInst.prRX_Ram)[BENCH_RX_SVC_BUF] == BENCH_SLAVE_DATA)      &&
+      (((UCHAR*) rBenchInst.prRX_Ram)[BENCH_RX_RT_BUF] == BENCH_SLAVE_DATA));
+}
+
+static double BenchReceive(INT iIter)
+{
+  double dStart;
+  INT    iPort;
+  INT    i;
+
+  dStart = BenchNow();
+  for (i = 0; i < iIter; i++)
+  {
+    rBenchReplay.iCycle = i % rBenchReplay.iNumCycles;
+    for (iPort = 0; iPort < SICE_REDUNDANCY_VAL; iPort++)
+    {
+      rBenchReplay.aiPos[iPort] = rBenchReplay.aiCycleStart[rBenchReplay.iCycle];
+    }
+    rBenchInst.ulTGSR1 = 0;
+    rBenchInst.ulTGSR2 = 0;
+
+    if (SICE_ReceiveTelegrams(&rBenchInst) != SICE_NO_ERROR)
+    {
+      printf("SICE_ReceiveTelegrams() failed\n");
+      exit(1);
+    }
+  }
+  return((BenchNow() - dStart) / (double) iIter);
+}
+
+int main(int argc, char** argv)
+{
+  static const INT aiSlaves[] = {4, 16, 64};
+  INT              iIter    = BENCH_ITER_DEFAULT;
+  const CHAR*      pcPcap   = NULL;
+  ULONG            ulCnt;
+  double           adPrepare[sizeof(aiSlaves) / sizeof(aiSlaves[0])][2];
+  double           adReceive[sizeof(aiSlaves) / sizeof(aiSlaves[0])];
+  USHORT           ausFrameLen[sizeof(aiSlaves) / sizeof(aiSlaves[0])];
+  double           dFrames;
+
+  if (argc > 1)
+  {
+    iIter = atoi(argv[1]);
+  }
+  if (argc > 2)
+  {
+    pcPcap = argv[2];
+  }
+  if ((iIter <= 0) || (argc > 3))
+  {
+    printf("Usage: %s [iterations [capture.pcap]]\n", argv[0]);
+    return(1);
+  }
+
+  (VOID)SICE_CRC32BuildTable();
+
+  if ((pcPcap != NULL) && !BenchReplayFromPcap(pcPcap))
+  {
+    printf("No Sercos frames read from %s\n", pcPcap);
+    return(1);
+  }
+
+  for (ulCnt = 0; ulCnt < sizeof(aiSlaves) / sizeof(aiSlaves[0]); ulCnt++)
+  {
+    BenchSetup(aiSlaves[ulCnt]);
+
+    // Warm up and compile the descriptor plan
+    (VOID)BenchPrepare(iIter / 10 + 1, FALSE);
+
+    adPrepare[ulCnt][0] = BenchPrepare(iIter, FALSE);
+    adPrepare[ulCnt][1] = BenchPrepare(iIter, TRUE);
+    ausFrameLen[ulCnt]  = rBenchInst.rTxPlan.arPkt[0].usFrameLen;
+
+    if (pcPcap == NULL)
+    {
+      BenchReplayFromTx();
+
+      (VOID)BenchReceive(1);
+      if (!BenchCheckRx())
+      {
+        printf("SICE_ReceiveTelegrams() did not receive the replayed cycle\n");
+        return(1);
+      }
+    }
+
+    (VOID)BenchReceive(iIter / 10 + 1);
+    adReceive[ulCnt] = BenchReceive(iIter);
+  }
+
+  printf
+      (
+        "SICE_PrepareTelegrams(), 4 MDT + 4 AT%s, ns per cycle\n",
+        SICE_REDUNDANCY_BOOL ? " per port" : ""
+      );
+  printf("%6s %9s %8s %14s\n", "slaves", "frame len", "gaps", "full clearing");
+
+  for (ulCnt = 0; ulCnt < sizeof(aiSlaves) / sizeof(aiSlaves[0]); ulCnt++)
+  {
+    printf
+        (
+          "%6d %9hu %8.1f %14.1f\n",
+          aiSlaves[ulCnt],
+          ausFrameLen[ulCnt],
+          adPrepare[ulCnt][0],
+          adPrepare[ulCnt][1]
+        );
+  }
+
+  dFrames = (double) rBenchReplay.iNumFrames / (double) rBenchReplay.iNumCycles;
+
+  printf
+      (
+        "SICE_ReceiveTelegrams(), replay of %s, %.1f frames per cycle, ns\n",
+        (pcPcap != NULL) ? pcPcap : "the prepared telegrams",
+        dFrames
+      );
+  printf("%6s %10s %10s\n", "slaves", "per cycle", "per frame");
+
+  for (ulCnt = 0; ulCnt < sizeof(aiSlaves) / sizeof(aiSlaves[0]); ulCnt++)
+  {
+    printf
+        (
+          "%6d %10.1f %10.1f\n",
+          aiSlaves[ulCnt],
+          adReceive[ulCnt],
+          adReceive[ulCnt] / dFrames
+        );
+  }
+
+  return(0);
+}
@@ -0,0 +1,373 @@
+/**
+ * \file      bench_siii.c
+ *
+ * \brief     Benchmark of the per-cycle cost of the SIII cyclic path against
+ *            the number of slaves.
+ *
+ * \details   SIII_Cycle_Prepare() and SIII_Cycle_Start() of SIII_CYCLIC.c are
+ *            timed as implemented, iterating over the list of slaves handled
+ *            in the cycle, and as formerly scanning all SIII_MAX_SLAVES
+ *            entries for the cyclic callbacks, the C-CON producer ready bits
+ *            and the data validity flags. The rebuild of the list by
+ *            SIII_UpdateCyclicSlaveList() after a topology change or hot-plug
+ *            is timed separately.
+ *
+ *            Each active slave has a cyclic callback and one MDT connection,
+ *            the callback signals valid data for every second slave. SICE and
+ *            CoSeMa are replaced by stubs and the instance is kept in CP3, so
+ *            the connection handling of CoSeMa in CP4 is not part of the
+ *            benchmark. The fastest of BENCH_REPEAT runs is reported.
+ *
+ *            Usage: bench_siii [iterations]
+ */
+
+//---- includes ---------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/SIII/SIII_CYCLIC.c"
+
+//---- defines ----------------------------------------------------------------
+
+#define BENCH_ITER_DEFAULT      (50000)     /* Default number of iterations */
+#define BENCH_CONN_LEN          (16)        /* Length of an MDT connection */
+#define BENCH_REPEAT            (5)         /* Runs, the fastest is reported */
+
+//---- variable declarations --------------------------------------------------
+
+static SIII_INSTANCE_STRUCT rBenchInst;
+
+//---- function implementations -----------------------------------------------
+
+// SICE and CoSeMa are not part of the benchmark
+SICE_FUNC_RET SICE_Cycle_Prepare(SICE_INSTANCE_STRUCT *prSiceInstance)
+{
+  return(SICE_NO_ERROR);
+}
+
+SICE_FUNC_RET SICE_Cycle_Start(SICE_INSTANCE_STRUCT *prSiceInstance, ULONG *pulSICECycleTime)
+{
+  return(SICE_NO_ERROR);
+}
+
+CSMD_FUNC_RET CSMD_CyclicHandling(CSMD_INSTANCE *prCSMD_Instance)
+{
+  return(CSMD_NO_ERROR);
+}
+
+CSMD_FUNC_RET CSMD_TxRxSoftCont(CSMD_INSTANCE *prCSMD_Instance)
+{
+  return(CSMD_NO_ERROR);
+}
+
+CSMD_FUNC_RET CSMD_HotPlug(CSMD_INSTANCE *prCSMD_Instance, CSMD_FUNC_STATE *prFuncState, CSMD_USHORT *pusHPDevAddList, CSMD_BOOL boCancel)
+{
+  return(CSMD_NO_ERROR);
+}
+
+CSMD_FUNC_RET CSMD_ClearConnectionError(CSMD_INSTANCE *prCSMD_Instance, CSMD_USHORT usConnIdx)
+{
+  return(CSMD_NO_ERROR);
+}
+
+CSMD_FUNC_RET CSMD_GetConnectionData(CSMD_INSTANCE *prCSMD_Instance, CSMD_USHORT usConnIdx, CSMD_USHORT *pusDestination)
+{
+  return(CSMD_NO_ERROR);
+}
+
+CSMD_FUNC_RET CSMD_GetConnectionState(CSMD_INSTANCE *prCSMD_Instance, CSMD_USHORT usConnIdx, CSMD_USHORT *pusState)
+{
+  return(CSMD_NO_ERROR);
+}
+
+CSMD_FUNC_RET CSMD_SetConnectionData(CSMD_INSTANCE *prCSMD_Instance, CSMD_USHORT usConnIdx, CSMD_USHORT *pusConnData, CSMD_USHORT usRTBits)
+{
+  return(CSMD_NO_ERROR);
+}
+
+CSMD_FUNC_RET CSMD_SetConnectionState(CSMD_INSTANCE *prCSMD_Instance, CSMD_USHORT usConnIdx, CSMD_PROD_STATE eComState)
+{
+  return(CSMD_NO_ERROR);
+}
+
+SIII_FUNC_RET SIII_GetControlIdx(SIII_INSTANCE_STRUCT *prS3Instance, USHORT usDevIdx, USHORT* pusConnIdx)
+{
+  return(SIII_NO_ERROR);
+}
+
+SIII_PHASE SIII_GetSercosPhase(SIII_INSTANCE_STRUCT *prS3Instance)
+{
+  return(SIII_PHASE_CP3);
+}
+
+SIII_FUNC_RET SIII_UpdateTopology(SIII_INSTANCE_STRUCT *prS3Instance)
+{
+  return(SIII_NO_ERROR);
+}
+
+VOID SIII_SVCSchedule(SIII_INSTANCE_STRUCT *prS3Instance)
+{
+}
+
+static double BenchNow(VOID)
+{
+  struct timespec rTime;
+
+  (VOID)clock_gettime(CLOCK_MONOTONIC, &rTime);
+  return((double)rTime.tv_sec * 1e9 + (double)rTime.tv_nsec);
+}
+
+// Cyclic function of the application, data of every second slave valid
+static VOID BenchAppCyclic(VOID* pvS3Instance, USHORT usDevIdx)
+{
+  if ((usDevIdx & 1) == 0)
+  {
+    (VOID)SIII_SetCyclicDataValid((SIII_INSTANCE_STRUCT*) pvS3Instance, usDevIdx);
+  }
+}
+
+static VOID BenchSetup(INT iNumSlaves)
+{
+  INT iSlave;
+
+  (VOID)memset(&rBenchInst, 0, sizeof(rBenchInst));
+
+  rBenchInst.rCyclicCommCtrl.boAppDataValid       = TRUE;
+  rBenchInst.rCyclicCommCtrl.boCycSlaveListDirty  = TRUE;
+
+  for (iSlave = 0; iSlave < iNumSlaves; iSlave++)
+  {
+    rBenchInst.rCosemaInstance.rSlaveList.aeSlaveActive[iSlave] = CSMD_SLAVE_ACTIVE;
+    rBenchInst.rCosemaInstance.rConfiguration.parSlaveConfig[iSlave].usNbrOfConnections = 1;
+    rBenchInst.arConnInfoMDT[iSlave][0].usConnIdx = (USHORT) iSlave;
+    rBenchInst.arConnInfoMDT[iSlave][0].usOffset  = (USHORT) (iSlave * BENCH_CONN_LEN);
+    rBenchInst.afpAppCyclic[iSlave] = BenchAppCyclic;
+  }
+}
+
+/*
+ * Former SIII_Cycle_Prepare() and SIII_Cycle_Start(), scanning all slaves,
+ * with the same stubs and phase
+ */
+static VOID BenchFormerCycle(VOID)
+{
+  SIII_INSTANCE_STRUCT* prS3Instance = &rBenchInst;
+  ULONG                 ulCycleTime;
+  USHORT*               pusC_Con;
+  USHORT                usI;
+  INT                   iCnt;
+  CSMD_FUNC_RET         eCsmdFuncRet;
+
+  // SIII_Cycle_Prepare()
+  (VOID)SICE_Cycle_Prepare(&prS3Instance->rSiceInstance);
+
+  for (iCnt = 0; iCnt < SIII_MAX_SLAVES; iCnt++)
+  {
+    prS3Instance->rCyclicCommCtrl.aboCycDataValid[iCnt] = FALSE;
+  }
+
+  // SIII_Cycle_Start()
+  (VOID)SICE_Cycle_Start(&prS3Instance->rSiceInstance, &ulCycleTime);
+
+  eCsmdFuncRet = CSMD_CyclicHandling(&prS3Instance->rCosemaInstance);
+  if (eCsmdFuncRet == CSMD_TOPOLOGY_CHANGE)
+  {
+    (VOID)SIII_UpdateTopology(prS3Instance);
+  }
+  else if (eCsmdFuncRet == CSMD_NO_ERROR)
+  {
+    prS3Instance->rCyclicCommCtrl.boCyclicDataError = FALSE;
+  }
+
+  if (
+       (prS3Instance->rCyclicCommCtrl.boAppDataValid)        &&
+       (SIII_GetSercosPhase(prS3Instance) == SIII_PHASE_CP4)
+     )
+  {
+    (VOID)SIII_GetConnections(prS3Instance);
+  }
+
+  if (prS3Instance->rCyclicCommCtrl.boAppDataValid)
+  {
+    if (prS3Instance->fpAppCyclicGlob != NULL)
+    {
+      prS3Instance->fpAppCyclicGlob(prS3Instance);
+    }
+
+    for (iCnt = 0; iCnt < SIII_MAX_SLAVES; iCnt++)
+    {
+      if (prS3Instance->afpAppCyclic[iCnt] != NULL)
+      {
+        prS3Instance->afpAppCyclic[iCnt](prS3Instance, (USHORT)iCnt);
+      }
+    }
+
+    for (iCnt = 0; iCnt < SIII_MAX_SLAVES; iCnt++)
+    {
+      if (prS3Instance->rCosemaInstance.rSlaveList.aeSlaveActive[iCnt] ==
+          CSMD_SLAVE_ACTIVE)
+      {
+        if (prS3Instance->rCyclicCommCtrl.aboCycDataValid[iCnt])
+        {
+          for (usI = 0; usI < prS3Instance->rCosemaInstance.rConfiguration.parSlaveConfig[iCnt].usNbrOfConnections; usI++)
+          {
+            if (prS3Instance->arConnInfoMDT[iCnt][usI].usConnIdx != 0xFFFF)
+            {
+              pusC_Con = (USHORT*)&prS3Instance->aucCyclicMDTBuffer[prS3Instance->arConnInfoMDT[iCnt][usI].usOffset];
+              *pusC_Con |= (USHORT) SIII_C_CON_PROD_RDY;
+
+              SIII_VERBOSE(2, "Slave active: %i \n", iCnt);
+            }
+          }
+        }
+        else
+        {
+          for (usI = 0; usI < prS3Instance->rCosemaInstance.rConfiguration.parSlaveConfig[iCnt].usNbrOfConnections; usI++)
+          {
+            if (prS3Instance->arConnInfoMDT[iCnt][usI].usConnIdx != 0xFFFF)
+            {
+              pusC_Con = (USHORT*)&prS3Instance->aucCyclicMDTBuffer[prS3Instance->arConnInfoMDT[iCnt][usI].usOffset];
+              *pusC_Con &= (USHORT) ~SIII_C_CON_PROD_RDY;
+
+              SIII_VERBOSE(2, "Slave active: %i \n", iCnt);
+            }
+          }
+        }
+      }
+    }
+
+    if (SIII_GetSercosPhase(prS3Instance) == SIII_PHASE_CP4)
+    {
+      (VOID)SIII_SetConnections(prS3Instance);
+    }
+  }
+
+#ifdef CSMD_HOTPLUG
+  (VOID)SIII_CyclicHotplugFunc(prS3Instance);
+#endif
+
+  if (prS3Instance->rCyclicCommCtrl.boCallTxRxSoftCont)
+  {
+    (VOID)CSMD_TxRxSoftCont(&prS3Instance->rCosemaInstance);
+  }
+
+  if (
+      (prS3Instance->usSvcActive    != 0)                           ||
+      (prS3Instance->ulSvcSubmitCnt != prS3Instance->ulSvcSeenCnt)
+    )
+  {
+    SIII_SVCSchedule(prS3Instance);
+  }
+}
+
+static VOID BenchCycle(VOID)
+{
+  ULONG ulCycleTime;
+
+  (VOID)SIII_Cycle_Prepare(&rBenchInst);
+  (VOID)SIII_Cycle_Start(&rBenchInst, &ulCycleTime);
+}
+
+static double BenchTime(VOID (*pfCycle)(VOID), INT iIter)
+{
+  double dStart;
+  double dTime;
+  double dBest = 0.0;
+  INT    iRun;
+  INT    i;
+
+  for (iRun = 0; iRun < BENCH_REPEAT; iRun++)
+  {
+    dStart = BenchNow();
+    for (i = 0; i < iIter; i++)
+    {
+      pfCycle();
+    }
+    dTime = (BenchNow() - dStart) / (double) iIter;
+
+    if ((iRun == 0) || (dTime < dBest))
+    {
+      dBest = dTime;
+    }
+  }
+  return(dBest);
+}
+
+static VOID BenchRebuild(VOID)
+{
+  SIII_UpdateCyclicSlaveList(&rBenchInst);
+}
+
+// C-CON producer ready bit of each active slave as signalled in the cycle
+static BOOL BenchCheck(INT iNumSlaves)
+{
+  USHORT  usC_Con;
+  INT     iSlave;
+
+  for (iSlave = 0; iSlave < iNumSlaves; iSlave++)
+  {
+    usC_Con = *(USHORT*) &rBenchInst.aucCyclicMDTBuffer[iSlave * BENCH_CONN_LEN];
+    if (((usC_Con & SIII_C_CON_PROD_RDY) != 0) != ((iSlave & 1) == 0))
+    {
+      return(FALSE);
+    }
+  }
+  return(TRUE);
+}
+
+int main(int argc, char** argv)
+{
+  static const INT aiSlaves[] = {1, 3, 8, 32, 128, SIII_MAX_SLAVES};
+  INT              iIter = BENCH_ITER_DEFAULT;
+  ULONG            ulCnt;
+  double           dFormer;
+  double           dList;
+  double           dRebuild;
+
+  if (argc > 1)
+  {
+    iIter = atoi(argv[1]);
+  }
+  if (iIter <= 0)
+  {
+    printf("Usage: %s [iterations]\n", argv[0]);
+    return(1);
+  }
+
+  printf("SIII_Cycle_Prepare() + SIII_Cycle_Start(), SICE and CoSeMa stubbed, ns per cycle\n");
+  printf("%6s %8s %8s %8s\n", "slaves", "scan", "list", "rebuild");
+
+  for (ulCnt = 0; ulCnt < sizeof(aiSlaves) / sizeof(aiSlaves[0]); ulCnt++)
+  {
+    BenchSetup(aiSlaves[ulCnt]);
+
+    BenchFormerCycle();
+    if (!BenchCheck(aiSlaves[ulCnt]))
+    {
+      printf("Former cycle did not set the C-CON producer ready bits\n");
+      return(1);
+    }
+
+    BenchSetup(aiSlaves[ulCnt]);
+
+    BenchCycle();
+    if (  (rBenchInst.rCyclicCommCtrl.usNumCycSlaves != (USHORT) aiSlaves[ulCnt]) ||
+          !BenchCheck(aiSlaves[ulCnt]))
+    {
+      printf("SIII_Cycle_Start() did not set the C-CON producer ready bits\n");
+      return(1);
+    }
+
+    (VOID)BenchTime(BenchFormerCycle, iIter / 10 + 1);
+    dFormer  = BenchTime(BenchFormerCycle, iIter);
+    (VOID)BenchTime(BenchCycle, iIter / 10 + 1);
+    dList    = BenchTime(BenchCycle, iIter);
+    dRebuild = BenchTime(BenchRebuild, iIter);
+
+    printf("%6d %8.1f %8.1f %8.1f\n", aiSlaves[ulCnt], dFormer, dList, dRebuild);
+  }
+
+  return(0);
+}
@@ -0,0 +1,464 @@
+/**
+ * \file      bench_sock.c
+ *
+ * \brief     Benchmark of the packet transmission and reception paths of
+ *            RTLX_SOCK.c and RTLX_XDP.c on a veth pair.
+ *
+ * \details   One instance with redundancy is opened on both ends of the pair,
+ *            so that port P transmits and port S receives the telegrams. Per
+ *            cycle, 4 MDT and 4 AT telegrams are transmitted on port P, either
+ *            one by one with RTLX_TxPacket() or as one batch with
+ *            RTLX_TxPacketBatch(). Then port S is polled until all telegrams
+ *            of the cycle have arrived, and the copies of the outgoing
+ *            telegrams are drained from port P, as SICE_ReceiveTelegrams()
+ *            does.
+ *
+ *            Each path is measured with recvfrom() and with the receive ring
+ *            (RTOS_RX_RING), and with AF_XDP in generic mode (RTOS_XDP). If
+ *            built with BENCH_TX_RING, the transmit ring (RTOS_TX_RING) is
+ *            used for transmission.
+ *
+ *            Reported per path: system calls per cycle for transmission and
+ *            reception, time of the transmission calls, i.e. the spread
+ *            between the first MDT and the last AT handed over, and
+ *            percentiles of the cycle latency from the first transmission
+ *            until the last telegram has been received. While waiting, each
+ *            empty poll of recvfrom() is a system call of its own, the rings
+ *            are polled in memory.
+ *
+ *            Usage: bench_sock [adapter P,adapter S] [cycles] [cycle time in us]
+ *
+ *            The default adapters vbt0,vbt1 are created with "./veth.sh up",
+ *            the benchmark needs to run as root.
+ */
+
+//---- includes ---------------------------------------------------------------
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+
+#include "../src/GLOB/GLOB_TYPE.h"
+#include "../src/RTLX/RTLX_S3SM_USER.h"
+
+// Build switches of the paths under test, independent of RTLX_S3SM_USER.h
+#define RTOS_RX_RING
+#define RTOS_XDP
+#ifdef BENCH_TX_RING
+#define RTOS_TX_RING
+#endif
+
+// Count the system calls of the paths under test
+static ULONG ulBenchTxCalls = 0;
+static ULONG ulBenchRxCalls = 0;
+
+static ssize_t BenchSendto(int s, const void* b, size_t l, int f, const struct sockaddr* a, socklen_t al)
+{
+  ulBenchTxCalls++;
+  return(sendto(s, b, l, f, a, al));
+}
+
+static int BenchSendmmsg(int s, struct mmsghdr* m, unsigned int n, int f)
+{
+  ulBenchTxCalls++;
+  return(sendmmsg(s, m, n, f));
+}
+
+static ssize_t BenchRecvfrom(int s, void* b, size_t l, int f, struct sockaddr* a, socklen_t* al)
+{
+  ulBenchRxCalls++;
+  return(recvfrom(s, b, l, f, a, al));
+}
+
+#define sendto      BenchSendto
+#define sendmmsg    BenchSendmmsg
+#define recvfrom    BenchRecvfrom
+
+#include "../src/RTLX/RTLX_SOCK.c"
+#include "../src/RTLX/RTLX_XDP.c"
+
+#undef sendto
+#undef sendmmsg
+#undef recvfrom
+
+//---- defines ----------------------------------------------------------------
+
+#define BENCH_NUM_MDT           (4)         /* MDTs per cycle */
+#define BENCH_NUM_AT            (4)         /* ATs per cycle */
+#define BENCH_NUM_TEL           (BENCH_NUM_MDT + BENCH_NUM_AT)
+#define BENCH_TEL_LEN           (400)       /* Length of a telegram in bytes */
+#define BENCH_CYCLES_DEFAULT    (5000)      /* Default number of cycles per path */
+#define BENCH_CYCLE_US_DEFAULT  (500)       /* Default cycle time in us */
+#define BENCH_TIMEOUT_NS        (10000000)  /* Time to wait for the telegrams of a cycle */
+
+//---- type definitions -------------------------------------------------------
+
+typedef struct
+{
+  const CHAR* pcName;
+  BOOL        boXdp;                        /* AF_XDP instead of raw sockets */
+  BOOL        boRxRing;                     /* Receive ring instead of recvfrom() */
+  BOOL        boBatch;                      /* RTLX_TxPacketBatch() */
+} BENCH_PATH_STRUCT;
+
+//---- variable declarations --------------------------------------------------
+
+static const BENCH_PATH_STRUCT arBenchPath[] =
+{
+#ifdef BENCH_TX_RING
+  {"tx ring, recvfrom, single",   FALSE, FALSE, FALSE},
+  {"tx ring, recvfrom, batch",    FALSE, FALSE, TRUE },
+  {"tx ring, rx ring, single",    FALSE, TRUE,  FALSE},
+  {"tx ring, rx ring, batch",     FALSE, TRUE,  TRUE },
+#else
+  {"recvfrom, single",            FALSE, FALSE, FALSE},
+  {"recvfrom, batch",             FALSE, FALSE, TRUE },
+  {"rx ring, single",             FALSE, TRUE,  FALSE},
+  {"rx ring, batch",              FALSE, TRUE,  TRUE },
+  {"xdp generic, single",         TRUE,  FALSE, FALSE},
+  {"xdp generic, batch",          TRUE,  FALSE, TRUE },
+#endif
+};
+
+static UCHAR aaucBenchFrame[BENCH_NUM_TEL][SICE_ETH_FRAMEBUF_LEN];
+static UCHAR aucBenchRxBuf[SICE_ETH_FRAMEBUF_LEN];
+
+//---- function implementations -----------------------------------------------
+
+static LONGLONG BenchNow(VOID)
+{
+  struct timespec rTime;
+
+  (VOID)clock_gettime(CLOCK_MONOTONIC, &rTime);
+  return((LONGLONG)rTime.tv_sec * 1000000000LL + rTime.tv_nsec);
+}
+
+static int BenchCompare(const void* pvA, const void* pvB)
+{
+  LONGLONG llA = *(const LONGLONG*)pvA;
+  LONGLONG llB = *(const LONGLONG*)pvB;
+
+  return((llA > llB) - (llA < llB));
+}
+
+static double BenchPercentile(LONGLONG* pllSorted, INT iNum, double dPercent)
+{
+  INT iIdx = (INT)((double)(iNum - 1) * dPercent / 100.0 + 0.5);
+
+  return((double)pllSorted[iIdx] / 1000.0);
+}
+
+static INT BenchOpen(const BENCH_PATH_STRUCT* prPath, UCHAR* pucMAC)
+{
+  if (prPath->boXdp)
+  {
+    if (RTLX_XdpOpenTxSocket(0, TRUE, pucMAC) != RTOS_RET_OK)
+    {
+      return(RTOS_RET_ERROR);
+    }
+    if (RTLX_XdpOpenRxSocket(0, TRUE) != RTOS_RET_OK)
+    {
+      RTLX_XdpCloseTxSocket(0, TRUE);
+      return(RTOS_RET_ERROR);
+    }
+    return(RTOS_RET_OK);
+  }
+
+  (VOID)RTLX_SetRxRing(0, prPath->boRxRing);
+
+  if (RTLX_OpenTxSocket(0, TRUE, pucMAC) != RTOS_RET_OK)
+  {
+    return(RTOS_RET_ERROR);
+  }
+  if (RTLX_OpenRxSocket(0, TRUE) != RTOS_RET_OK)
+  {
+    RTLX_CloseTxSocket(0, TRUE);
+    return(RTOS_RET_ERROR);
+  }
+  return(RTOS_RET_OK);
+}
+
+static VOID BenchClose(const BENCH_PATH_STRUCT* prPath)
+{
+  if (prPath->boXdp)
+  {
+    RTLX_XdpCloseRxSocket(0, TRUE);
+    RTLX_XdpCloseTxSocket(0, TRUE);
+
+    // The kernel releases the queues of the adapters deferred
+    (VOID)usleep(500000);
+  }
+  else
+  {
+    RTLX_CloseRxSocket(0, TRUE);
+    RTLX_CloseTxSocket(0, TRUE);
+  }
+}
+
+static INT BenchRx(const BENCH_PATH_STRUCT* prPath, INT iPort, UCHAR** ppucFrame)
+{
+  if (prPath->boXdp)
+  {
+    return(RTLX_XdpRxPacket(0, iPort, aucBenchRxBuf, ppucFrame));
+  }
+  return(RTLX_RxPacket(0, iPort, aucBenchRxBuf, ppucFrame));
+}
+
+static INT BenchTx(const BENCH_PATH_STRUCT* prPath)
+{
+  static UCHAR* apucFrame[BENCH_NUM_TEL];
+  static USHORT ausLen[BENCH_NUM_TEL];
+  static UCHAR  aucPort[BENCH_NUM_TEL];
+  INT           iCnt;
+
+  if (prPath->boBatch)
+  {
+    for (iCnt = 0; iCnt < BENCH_NUM_TEL; iCnt++)
+    {
+      apucFrame[iCnt] = aaucBenchFrame[iCnt];
+      ausLen[iCnt]    = BENCH_TEL_LEN;
+      aucPort[iCnt]   = 0;
+    }
+    return(
+        (prPath->boXdp ?
+            RTLX_XdpTxPacketBatch(0, apucFrame, ausLen, NULL, NULL, aucPort, BENCH_NUM_TEL, 0) :
+            RTLX_TxPacketBatch(0, apucFrame, ausLen, NULL, NULL, aucPort, BENCH_NUM_TEL, 0))
+        == BENCH_NUM_TEL ? RTOS_RET_OK : RTOS_RET_ERROR);
+  }
+
+  for (iCnt = 0; iCnt < BENCH_NUM_TEL; iCnt++)
+  {
+    if (
+        (prPath->boXdp ?
+            RTLX_XdpTxPacket(0, 0, aaucBenchFrame[iCnt], BENCH_TEL_LEN, 0) :
+            RTLX_TxPacket(0, 0, aaucBenchFrame[iCnt], BENCH_TEL_LEN, 0))
+        < 0
+      )
+    {
+      return(RTOS_RET_ERROR);
+    }
+  }
+  return(RTOS_RET_OK);
+}
+
+static VOID BenchRun(const BENCH_PATH_STRUCT* prPath, INT iCycles, INT iCycleUs)
+{
+  struct timespec rWake;
+  LONGLONG* pllTx;
+  LONGLONG* pllLat;
+  LONGLONG  llStart;
+  LONGLONG  llTxEnd;
+  LONGLONG  llNow;
+  UCHAR     aucMAC[6];
+  UCHAR*    pucFrame;
+  ULONG     ulTxCalls = 0;
+  ULONG     ulRxCalls = 0;
+  ULONG     ulCycleNo;
+  INT       iDone     = 0;
+  INT       iLost     = 0;
+  INT       iCyc;
+  INT       iRecv;
+  INT       iLen;
+  INT       iCnt;
+
+  if (BenchOpen(prPath, aucMAC) != RTOS_RET_OK)
+  {
+    printf("%-26s skipped, adapters can not be opened\n", prPath->pcName);
+    return;
+  }
+
+  pllTx  = malloc(iCycles * sizeof(LONGLONG));
+  pllLat = malloc(iCycles * sizeof(LONGLONG));
+  if ((pllTx == NULL) || (pllLat == NULL))
+  {
+    free(pllTx);
+    free(pllLat);
+    BenchClose(prPath);
+    return;
+  }
+
+  // Sercos telegrams: broadcast, ethertype, type of MDT0..3 and AT0..3
+  for (iCnt = 0; iCnt < BENCH_NUM_TEL; iCnt++)
+  {
+    (VOID)memset(aaucBenchFrame[iCnt], 0, BENCH_TEL_LEN);
+    (VOID)memset(aaucBenchFrame[iCnt], 0xFF, 6);
+    (VOID)memcpy(&aaucBenchFrame[iCnt][6], aucMAC, 6);
+    aaucBenchFrame[iCnt][12] = (UCHAR)(SICE_SIII_ETHER_TYPE >> 8);
+    aaucBenchFrame[iCnt][13] = (UCHAR)(SICE_SIII_ETHER_TYPE & 0xFF);
+    aaucBenchFrame[iCnt][14] = (UCHAR)((iCnt < BENCH_NUM_MDT) ?
+        iCnt : (0x80 | (iCnt - BENCH_NUM_MDT)));
+  }
+
+  (VOID)clock_gettime(CLOCK_MONOTONIC, &rWake);
+
+  for (iCyc = 0; iCyc < iCycles; iCyc++)
+  {
+    rWake.tv_nsec += iCycleUs * 1000;
+    while (rWake.tv_nsec >= 1000000000)
+    {
+      rWake.tv_nsec -= 1000000000;
+      rWake.tv_sec++;
+    }
+    (VOID)clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &rWake, NULL);
+
+    ulCycleNo = (ULONG)iCyc;
+    for (iCnt = 0; iCnt < BENCH_NUM_TEL; iCnt++)
+    {
+      (VOID)memcpy(&aaucBenchFrame[iCnt][16], &ulCycleNo, sizeof(ulCycleNo));
+    }
+
+    ulBenchTxCalls = 0;
+    ulBenchRxCalls = 0;
+
+    llStart = BenchNow();
+    if (BenchTx(prPath) != RTOS_RET_OK)
+    {
+      iLost++;
+      continue;
+    }
+    llTxEnd = BenchNow();
+
+    // Telegrams of this cycle on port S
+    iRecv = 0;
+    do
+    {
+      iLen = BenchRx(prPath, 1, &pucFrame);
+      if (iLen > 0)
+      {
+        if (pucFrame == NULL)
+        {
+          pucFrame = aucBenchRxBuf;
+        }
+        if (
+            (pucFrame[12] == (UCHAR)(SICE_SIII_ETHER_TYPE >> 8)) &&
+            (memcmp(&pucFrame[16], &ulCycleNo, sizeof(ulCycleNo)) == 0)
+          )
+        {
+          iRecv++;
+        }
+      }
+      llNow = BenchNow();
+    } while ((iRecv < BENCH_NUM_TEL) && (iLen >= 0) && (llNow - llStart < BENCH_TIMEOUT_NS));
+
+    // Own telegrams seen on port P, and leftovers on port S
+    for (iCnt = 0; iCnt < 2; iCnt++)
+    {
+      while (BenchRx(prPath, iCnt, &pucFrame) > 0)
+      {
+      }
+    }
+
+    ulTxCalls += ulBenchTxCalls;
+    ulRxCalls += ulBenchRxCalls;
+
+    if (iRecv < BENCH_NUM_TEL)
+    {
+      iLost++;
+      continue;
+    }
+
+    pllTx[iDone]  = llTxEnd - llStart;
+    pllLat[iDone] = llNow - llStart;
+    iDone++;
+  }
+
+  BenchClose(prPath);
+
+  if (iDone == 0)
+  {
+    printf("%-26s no complete cycle, %d cycles lost\n", prPath->pcName, iLost);
+  }
+  else
+  {
+    qsort(pllTx, iDone, sizeof(LONGLONG), BenchCompare);
+    qsort(pllLat, iDone, sizeof(LONGLONG), BenchCompare);
+
+    printf
+        (
+          "%-26s %5.1f %7.1f %7.1f %7.1f | %7.1f %7.1f %7.1f %7.1f %5d\n",
+          prPath->pcName,
+          (double)ulTxCalls / (double)iCycles,
+          (double)ulRxCalls / (double)iCycles,
+          BenchPercentile(pllTx, iDone, 50.0),
+          BenchPercentile(pllTx, iDone, 99.0),
+          BenchPercentile(pllLat, iDone, 50.0),
+          BenchPercentile(pllLat, iDone, 99.0),
+          BenchPercentile(pllLat, iDone, 99.9),
+          (double)pllLat[iDone - 1] / 1000.0,
+          iLost
+        );
+  }
+
+  free(pllTx);
+  free(pllLat);
+}
+
+int main(int argc, char** argv)
+{
+  struct sched_param rParam;
+  CHAR* pcNicNames = "vbt0,vbt1";
+  INT   iCycles    = BENCH_CYCLES_DEFAULT;
+  INT   iCycleUs   = BENCH_CYCLE_US_DEFAULT;
+  ULONG uiCyc;
+
+  if (argc > 1)
+  {
+    pcNicNames = argv[1];
+  }
+  if (argc > 2)
+  {
+    iCycles = atoi(argv[2]);
+  }
+  if (argc > 3)
+  {
+    iCycleUs = atoi(argv[3]);
+  }
+  if ((iCycles <= 0) || (iCycleUs <= 0))
+  {
+    printf("Usage: %s [adapter P,adapter S] [cycles] [cycle time in us]\n", argv[0]);
+    return(1);
+  }
+
+  if (
+      (RTLX_SetNicName(0, pcNicNames) != RTOS_RET_OK) ||
+      (if_nametoindex(RTLX_GetNicName(0, 0)) == 0) ||
+      (if_nametoindex(RTLX_GetNicName(0, 1)) == 0)
+    )
+  {
+    printf("Adapters %s not found, skipped (create them with ./veth.sh up)\n", pcNicNames);
+    return(0);
+  }
+
+  // Best effort, results are less stable without
+  (VOID)mlockall(MCL_CURRENT | MCL_FUTURE);
+  rParam.sched_priority = 80;
+  (VOID)sched_setscheduler(0, SCHED_FIFO, &rParam);
+
+  printf
+      (
+        "%d cycles of %d us, %d telegrams of %d bytes per cycle, times in us\n",
+        iCycles,
+        iCycleUs,
+        BENCH_NUM_TEL,
+        BENCH_TEL_LEN
+      );
+  printf
+      (
+        "%-26s %5s %7s %7s %7s | %7s %7s %7s %7s %5s\n",
+        "path", "tx/c", "rx/c", "tx p50", "tx p99",
+        "lat p50", "p99", "p99.9", "max", "lost"
+      );
+
+  for (uiCyc = 0; uiCyc < sizeof(arBenchPath) / sizeof(arBenchPath[0]); uiCyc++)
+  {
+    BenchRun(&arBenchPath[uiCyc], iCycles, iCycleUs);
+  }
+
+  return(0);
+}
@@ -0,0 +1,283 @@
+/**
+ * \file      test_crc32.c
+ *
+ * \brief     Cross-check and micro-benchmark of the CRC32 engines of
+ *            SICE_SIII.c against the former byte-wise implementation.
+ *
+ * \details   SICE_SIII.c is included directly, so the static engines can be
+ *            called one by one. Each engine available on the host (slice-by-8
+ *            always, PCLMULQDQ on x86-64, CRC32 instructions on ARMv8) is
+ *            compared with the reference over random Sercos headers and
+ *            buffers of random length and alignment, with and without a seed
+ *            continuing a preceding buffer. Then the time per header and per
+ *            full Ethernet frame is measured.
+ *
+ *            Usage: test_crc32 [number of random buffers]
+ *
+ * \return    0 if all engines match the reference, 1 otherwise
+ */
+
+//---- includes ---------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/SICE/SICE_SIII.c"
+
+//---- defines ----------------------------------------------------------------
+
+#define TEST_CRC_MAX_LEN        (1536)      /* Maximum length of random buffers */
+#define TEST_CRC_NUM_DEFAULT    (300000)    /* Default number of random buffers */
+
+//---- type definitions -------------------------------------------------------
+
+typedef struct
+{
+  const CHAR*       pcName;
+  SICE_CRC32_ENGINE pfEngine;
+} TEST_CRC_ENGINE_STRUCT;
+
+//---- variable declarations --------------------------------------------------
+
+/** Table of the former byte-wise implementation */
+static ULONG aulRefTable[SICE_CRC_TABLE_SIZE];
+
+static ULONG ulSeed = 1;
+
+//---- function implementations -----------------------------------------------
+
+static ULONG TestRandom(VOID)
+{
+  ulSeed = ulSeed * 1103515245u + 12345u;
+  return(ulSeed >> 8);
+}
+
+static double TestNow(VOID)
+{
+  struct timespec rTime;
+
+  (VOID)clock_gettime(CLOCK_MONOTONIC, &rTime);
+  return((double)rTime.tv_sec * 1e9 + (double)rTime.tv_nsec);
+}
+
+/* Former SICE_CRC32BuildTable() */
+static VOID TestRefBuildTable(VOID)
+{
+  ULONG ulCRC;
+  INT   i, j;
+
+  for (i = 0; i < SICE_CRC_TABLE_SIZE; i++)
+  {
+    ulCRC = (ULONG) i;
+    for (j = 8; j >= 1; j--)
+    {
+      ulCRC = (ulCRC & 1) ? ((ulCRC / 2) ^ (ULONG) SICE_CRC_POLY) : (ulCRC / 2);
+    }
+    aulRefTable[i] = ulCRC;
+  }
+}
+
+/* Former SICE_CRC32Calc() */
+static ULONG TestRefCRC32
+    (
+      UCHAR* pucBuffer,
+      INT iSize,
+      ULONG ulStartCRC
+    )
+{
+  ULONG ulCRC = ulStartCRC ^ (ULONG) 0xFFFFFFFF;
+
+  while (iSize-- > 0)
+  {
+    ulCRC = ((ulCRC / 256) & (ULONG) 0xFFFFFF) ^
+        aulRefTable[(ulCRC ^ *pucBuffer++) & (ULONG) 0xFF];
+  }
+  return(ulCRC ^ (ULONG) 0xFFFFFFFF);
+}
+
+/* CRC of an engine with the seed semantics of SICE_CRC32Calc() */
+static ULONG TestEngineCRC32
+    (
+      SICE_CRC32_ENGINE pfEngine,
+      UCHAR* pucBuffer,
+      INT iSize,
+      ULONG ulStartCRC
+    )
+{
+  return(pfEngine(pucBuffer, iSize, ulStartCRC ^ (ULONG) 0xFFFFFFFF) ^ (ULONG) 0xFFFFFFFF);
+}
+
+static INT TestCheck
+    (
+      const TEST_CRC_ENGINE_STRUCT* prEngine,
+      INT iNumBuffers
+    )
+{
+  static UCHAR aucBuf[TEST_CRC_MAX_LEN + 16];
+  ULONG ulStart;
+  ULONG ulRef;
+  INT   iErrors = 0;
+  INT   iLen;
+  INT   iOffs;
+  INT   iSplit;
+  INT   iCnt;
+  INT   i;
+
+  ulSeed = 1;
+
+  for (iCnt = 0; iCnt < iNumBuffers; iCnt++)
+  {
+    // Mostly Sercos headers, some longer buffers
+    iLen  = ((iCnt % 4) != 0) ?
+        SICE_TEL_LENGTH_HDR_FOR_CRC : (INT)(TestRandom() % TEST_CRC_MAX_LEN);
+    iOffs = (INT)(TestRandom() % 16);
+
+    for (i = 0; i < iLen + iOffs; i++)
+    {
+      aucBuf[i] = (UCHAR) TestRandom();
+    }
+
+    ulStart = ((iCnt % 3) == 0) ? (ULONG) 0 : TestRandom() * 2654435761u;
+    ulRef   = TestRefCRC32(&aucBuf[iOffs], iLen, ulStart);
+
+    if (TestEngineCRC32(prEngine->pfEngine, &aucBuf[iOffs], iLen, ulStart) != ulRef)
+    {
+      iErrors++;
+    }
+
+    // Continuation, e.g. header of port S after header of port P
+    iSplit = (iLen != 0) ? (INT)(TestRandom() % (ULONG) iLen) : 0;
+    if (
+        TestEngineCRC32
+            (
+              prEngine->pfEngine,
+              &aucBuf[iOffs + iSplit],
+              iLen - iSplit,
+              TestEngineCRC32(prEngine->pfEngine, &aucBuf[iOffs], iSplit, ulStart)
+            ) != ulRef
+      )
+    {
+      iErrors++;
+    }
+  }
+
+  printf
+      (
+        "check %-9s %d buffers: %s (%d mismatches)\n",
+        prEngine->pcName,
+        iNumBuffers,
+        (iErrors == 0) ? "OK" : "FAILED",
+        iErrors
+      );
+
+  return(iErrors);
+}
+
+static VOID TestBench
+    (
+      const TEST_CRC_ENGINE_STRUCT* prEngine
+    )
+{
+  static const INT aiLen[] = {SICE_TEL_LENGTH_HDR_FOR_CRC, 64, 1500};
+  static UCHAR aucBuf[TEST_CRC_MAX_LEN];
+  volatile ULONG ulSink = 0;
+  double dStart;
+  LONG   lRepeat;
+  LONG   lCnt;
+  ULONG  ulIdx;
+
+  for (ulIdx = 0; ulIdx < sizeof(aucBuf); ulIdx++)
+  {
+    aucBuf[ulIdx] = (UCHAR) ulIdx;
+  }
+
+  printf("bench %-9s", prEngine->pcName);
+
+  for (ulIdx = 0; ulIdx < sizeof(aiLen) / sizeof(aiLen[0]); ulIdx++)
+  {
+    lRepeat = 20000000L / (aiLen[ulIdx] + 16);
+    dStart  = TestNow();
+
+    for (lCnt = 0; lCnt < lRepeat; lCnt++)
+    {
+      ulSink = (prEngine->pfEngine != NULL) ?
+          TestEngineCRC32(prEngine->pfEngine, aucBuf, aiLen[ulIdx], ulSink) :
+          TestRefCRC32(aucBuf, aiLen[ulIdx], ulSink);
+    }
+
+    printf
+        (
+          "  %4d bytes: %8.1f ns",
+          aiLen[ulIdx],
+          (TestNow() - dStart) / (double) lRepeat
+        );
+  }
+  printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+  TEST_CRC_ENGINE_STRUCT  arEngine[4];
+  TEST_CRC_ENGINE_STRUCT  rRef        = {"reference", NULL};
+  INT                     iNumEngines = 0;
+  INT                     iNumBuffers = TEST_CRC_NUM_DEFAULT;
+  INT                     iErrors     = 0;
+  INT                     iCnt;
+
+  if (argc > 1)
+  {
+    iNumBuffers = atoi(argv[1]);
+  }
+
+  TestRefBuildTable();
+  (VOID)SICE_CRC32BuildTable();
+
+  arEngine[iNumEngines].pcName   = "slice8";
+  arEngine[iNumEngines].pfEngine = SICE_CRC32Slice8;
+  iNumEngines++;
+
+#ifdef SICE_CRC32_PCLMUL
+  if (__builtin_cpu_supports("pclmul"))
+  {
+    arEngine[iNumEngines].pcName   = "pclmul";
+    arEngine[iNumEngines].pfEngine = SICE_CRC32Pclmul;
+    iNumEngines++;
+  }
+  else
+  {
+    printf("pclmul    not supported by CPU, skipped\n");
+  }
+#endif
+
+#ifdef SICE_CRC32_ARMV8
+  if (getauxval(AT_HWCAP) & HWCAP_CRC32)
+  {
+    arEngine[iNumEngines].pcName   = "armv8";
+    arEngine[iNumEngines].pfEngine = SICE_CRC32Armv8;
+    iNumEngines++;
+  }
+  else
+  {
+    printf("armv8     not supported by CPU, skipped\n");
+  }
+#endif
+
+  // Engine selected at runtime, as used by SICE_CRC32Calc()
+  arEngine[iNumEngines].pcName   = "selected";
+  arEngine[iNumEngines].pfEngine = pfCRC32Engine;
+  iNumEngines++;
+
+  for (iCnt = 0; iCnt < iNumEngines; iCnt++)
+  {
+    iErrors += TestCheck(&arEngine[iCnt], iNumBuffers);
+  }
+
+  TestBench(&rRef);
+  for (iCnt = 0; iCnt < iNumEngines; iCnt++)
+  {
+    TestBench(&arEngine[iCnt]);
+  }
+
+  return((iErrors == 0) ? 0 : 1);
+}
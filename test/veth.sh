@@ -0,0 +1,19 @@
+#!/bin/sh
+#
+# Creates or removes the veth pair vbt0/vbt1 used by the socket benchmarks.
+# Needs to run as root.
+
+case "$1" in
+  up)
+    ip link add vbt0 type veth peer name vbt1 &&
+    ip link set vbt0 up &&
+    ip link set vbt1 up
+    ;;
+  down)
+    ip link del vbt0
+    ;;
+  *)
+    echo "Usage: $0 up|down"
+    exit 1
+    ;;
+esac